@@ -0,0 +1,679 @@
+// Copyright (c) 2015-16 Tom Deakin, Simon McIntosh-Smith,
+// University of Bristol HPC
+//
+// For full license terms please see the LICENSE file distributed with this
+// source code
+
+#include <iostream>
+#include <vector>
+#include <vector>
+#include <string>
+#include <numeric>
+#include <cmath>
+#include <limits>
+#include <chrono>
+#include <algorithm>
+#include <iomanip>
+#include <cstring>
+#include <mutex>
+#include <sstream>
+
+#define VERSION_STRING "3.4"
+#include "include/rvs_util.h"
+#include "include/rvs_memworker.h"
+#include "include/Stream.h"
+#include "include/HIPStream.h"
+#include "include/rvsloglp.h"
+#include "include/rvstracer.h"
+#include "include/rvs_faultinject.h"
+
+// Default size of 2^25
+std::string csv_separator = ",";
+
+ bool event_timing = false;
+ std::string module_name{"babel"};
+
+// Total no. of babel subtests
+const int total_babel_subtests = 7;
+
+template <typename T>
+bool check_solution(const unsigned int ntimes, std::vector<T>& a, std::vector<T>& b, std::vector<T>& c, T& sum, uint64_t,
+    const subtest *test, bool start_values);
+
+template <typename T>
+bool check_solution_faults(rvs::faultinject *faults, const unsigned int ntimes, std::vector<T>& a, std::vector<T>& b,
+    std::vector<T>& c, T& sum, uint64_t ARRAY_SIZE, const subtest *test, const std::string& data_init);
+
+template <typename T>
+bool run_stress(std::pair<int, uint16_t> device, int num_times, int ARRAY_SIZE, bool output_as_csv, bool mibibytes,
+    uint16_t dwords_per_lane, uint16_t chunks_per_block, uint16_t tb_size, bool json, std::string action, subtest *test,
+    const std::string& data_init, const std::string& nontemporal, uint64_t duration, rvs::faultinject *faults);
+
+template <typename T>
+bool run_triad(std::pair<int, uint16_t> device, int num_times, int ARRAY_SIZE, bool output_as_csv, bool mibibytes,
+    uint16_t dwords_per_lane, uint16_t chunks_per_block, uint16_t tb_size, bool json, std::string action, subtest *test,
+    const std::string& data_init, const std::string& nontemporal, uint64_t duration, rvs::faultinject *faults);
+
+void parseArguments(int argc, char *argv[]);
+
+bool run_babel(std::pair<int, uint16_t> device, int num_times, int array_size, bool output_csv, bool mibibytes, int test_type,
+    uint16_t dwords_per_lane, uint16_t chunks_per_block, uint16_t tb_size, bool json, std::string action, subtest *test,
+    const std::string& data_init, const std::string& nontemporal, uint64_t duration, rvs::faultinject *faults) {
+
+  bool result = false;
+
+  switch(test_type) {
+    case FLOAT_TEST:
+      result = run_stress<float>(device, num_times, array_size, output_csv, mibibytes, dwords_per_lane, chunks_per_block, tb_size,
+          json, action, test, data_init, nontemporal, duration, faults);
+      break;
+
+    case DOUBLE_TEST:
+      result = run_stress<double>(device, num_times, array_size, output_csv, mibibytes, dwords_per_lane, chunks_per_block, tb_size,
+          json, action, test, data_init, nontemporal, duration, faults);
+      break;
+
+    case TRAID_FLOAT:
+      result = run_triad<float>(device, num_times, array_size, output_csv, mibibytes, dwords_per_lane, chunks_per_block, tb_size,
+          json, action, test, data_init, nontemporal, duration, faults);
+      break;
+
+    case TRIAD_DOUBLE:
+      result = run_triad<double>(device, num_times, array_size, output_csv, mibibytes, dwords_per_lane, chunks_per_block, tb_size,
+          json, action, test, data_init, nontemporal, duration, faults);
+      break;
+
+    default:
+      std::cout << "\n specify a valid testnumber";
+      break;
+  }
+
+  return result;
+}
+
+template <typename T>
+bool run_stress(std::pair<int, uint16_t> device, int num_times, int ARRAY_SIZE, bool output_as_csv, bool mibibytes,
+    uint16_t dwords_per_lane, uint16_t chunks_per_block, uint16_t tb_size, bool json, std::string action, subtest *test,
+    const std::string& data_init, const std::string& nontemporal, uint64_t duration, rvs::faultinject *faults)
+{
+  std::string   msg;
+  std::streamsize ss = std::cout.precision();
+  std::stringstream sstr;
+  auto desc = action_descriptor{action, module_name, device.second};
+  bool time_based = (duration > 0);
+
+  if (!output_as_csv)
+  {
+    if (time_based)
+      msg = "Running kernels for " + std::to_string(duration) + " ms, ";
+    else
+      msg = "Running kernels " + std::to_string(num_times) + " times, " ;
+
+
+    if (sizeof(T) == sizeof(float)) 
+      msg += "Precision: float";
+    else
+      msg += "Precision: double";
+
+    rvs::lp::Log(msg, rvs::logresults);
+    if (mibibytes)
+    {
+      // MiB = 2^20
+      sstr << std::setprecision(1) << std::fixed
+                << "Array size: " << ARRAY_SIZE*sizeof(T)*pow(2.0, -20.0) << " MiB"
+                << " (=" << ARRAY_SIZE*sizeof(T)*pow(2.0, -30.0) << " GiB), ";
+      sstr << "Total size: " << 3.0*ARRAY_SIZE*sizeof(T)*pow(2.0, -20.0) << " MiB"
+                << " (=" << 3.0*ARRAY_SIZE*sizeof(T)*pow(2.0, -30.0) << " GiB)" << std::endl;
+    }
+    else
+    {
+      // MB = 10^6
+      sstr << std::setprecision(1) << std::fixed
+                << "Array size: " << ARRAY_SIZE*sizeof(T)*1.0E-6 << " MB"
+                << " (=" << ARRAY_SIZE*sizeof(T)*1.0E-9 << " GB), ";
+      sstr << "Total size: " << 3.0*ARRAY_SIZE*sizeof(T)*1.0E-6 << " MB"
+                << " (=" << 3.0*ARRAY_SIZE*sizeof(T)*1.0E-9 << " GB)" << std::endl;
+    }
+    rvs::lp::Log(sstr.str(), rvs::logresults);
+    std::cout.precision(ss);
+
+  }
+
+  //json
+  if (json){
+    std::string scale = mibibytes ? "MiB" : "MB";
+    auto arr_size = mibibytes ? ARRAY_SIZE*sizeof(T)*pow(2.0, -20.0) :
+	    ARRAY_SIZE*sizeof(T)*1.0E-6;
+    auto total_size = mibibytes ? 3.0*ARRAY_SIZE*sizeof(T)*pow(2.0, -20.0) :
+	    3.0*ARRAY_SIZE*sizeof(T)*1.0E-6;
+    if (time_based)
+      log_to_json(desc, rvs::logresults,"Array size", std::to_string(arr_size),
+	        "Total size", std::to_string(total_size),
+	        "Duration(ms)", std::to_string(duration) );
+    else
+      log_to_json(desc, rvs::logresults,"Array size", std::to_string(arr_size),
+	        "Total size", std::to_string(total_size),
+	        "Iterations", std::to_string(num_times) );
+  }
+
+  // Create host vectors
+  std::vector<T> a(ARRAY_SIZE);
+  std::vector<T> b(ARRAY_SIZE);
+  std::vector<T> c(ARRAY_SIZE);
+
+  // Result of the Dot kernel
+  T sum;
+
+  // Use the HIP implementation
+  HIPStream<T> *stream;
+  {
+    RVS_TRACE_SCOPE("babel", "babel_setup");
+    stream = new HIPStream<T>(ARRAY_SIZE, event_timing, device.first, dwords_per_lane, chunks_per_block, tb_size, nontemporal);
+
+    if (data_init == "gpu_norm_dist") {
+      stream->init_arrays_normdist(static_cast<T>(0.0), static_cast<T>(1.0), true, a, b, c);
+    } else if (data_init == "cpu_norm_dist") {
+      stream->init_arrays_normdist(static_cast<T>(0.0), static_cast<T>(1.0), false, a, b, c);
+    } else if (data_init == "zero_init") {
+      stream->init_arrays(T{0}, T{0}, T{0});
+    } else {
+      stream->init_arrays(startA, startB, startC);
+    }
+  }
+
+  // List of times
+  std::vector<std::vector<double>> timings(total_babel_subtests);
+
+  // Declare timers
+  std::chrono::high_resolution_clock::time_point t1, t2;
+
+  auto loop_start = std::chrono::high_resolution_clock::now();
+  auto duration_limit = std::chrono::milliseconds(duration);
+  uint64_t actual_iterations = 0;
+
+  // Main loop - run each babel subtest if enabled
+  // When duration > 0: run until elapsed time exceeds duration
+  // When duration == 0: run for num_times iterations
+  for (uint64_t k = 0; !time_based ? (k < (uint64_t)num_times) : true; k++)
+  {
+    if (time_based) {
+      auto elapsed = std::chrono::high_resolution_clock::now() - loop_start;
+      if (elapsed >= duration_limit)
+        break;
+    }
+
+    RVS_TRACE_SCOPE("babel", "babel_kernels");
+
+    if(test->read) {
+      // Execute Read
+      t1 = std::chrono::high_resolution_clock::now();
+      stream->read();
+      t2 = std::chrono::high_resolution_clock::now();
+      timings[0].push_back(std::chrono::duration_cast<std::chrono::duration<double> >(t2 - t1).count());
+    }
+
+    if(test->write) {
+      // Execute Write
+      t1 = std::chrono::high_resolution_clock::now();
+      stream->write();
+      t2 = std::chrono::high_resolution_clock::now();
+      timings[1].push_back(std::chrono::duration_cast<std::chrono::duration<double> >(t2 - t1).count());
+    }
+
+    if(test->copy) {
+      // Execute Copy
+      t1 = std::chrono::high_resolution_clock::now();
+      stream->copy();
+      t2 = std::chrono::high_resolution_clock::now();
+      timings[2].push_back(std::chrono::duration_cast<std::chrono::duration<double> >(t2 - t1).count());
+    }
+
+    if(test->mul) {
+      // Execute Mul
+      t1 = std::chrono::high_resolution_clock::now();
+      stream->mul();
+      t2 = std::chrono::high_resolution_clock::now();
+      timings[3].push_back(std::chrono::duration_cast<std::chrono::duration<double> >(t2 - t1).count());
+    }
+
+    if(test->add) {
+      // Execute Add
+      t1 = std::chrono::high_resolution_clock::now();
+      stream->add();
+      t2 = std::chrono::high_resolution_clock::now();
+      timings[4].push_back(std::chrono::duration_cast<std::chrono::duration<double> >(t2 - t1).count());
+    }
+
+    if(test->triad) {
+      // Execute Triad
+      t1 = std::chrono::high_resolution_clock::now();
+      stream->triad();
+      t2 = std::chrono::high_resolution_clock::now();
+      timings[5].push_back(std::chrono::duration_cast<std::chrono::duration<double> >(t2 - t1).count());
+    }
+
+    if(test->dot) {
+      // Execute Dot
+      t1 = std::chrono::high_resolution_clock::now();
+      sum = stream->dot();
+      t2 = std::chrono::high_resolution_clock::now();
+      timings[6].push_back(std::chrono::duration_cast<std::chrono::duration<double> >(t2 - t1).count());
+    }
+
+    actual_iterations++;
+  }
+
+  uint64_t effective_num_times = time_based ? actual_iterations : (uint64_t)num_times;
+
+  if (time_based) {
+    auto total_elapsed = std::chrono::duration_cast<std::chrono::duration<double>>(
+        std::chrono::high_resolution_clock::now() - loop_start).count();
+    msg = "Completed " + std::to_string(actual_iterations) + " iterations in " +
+        std::to_string(total_elapsed) + " seconds";
+    rvs::lp::Log(msg, rvs::logresults);
+  }
+
+  // Check solutions
+  {
+    RVS_TRACE_SCOPE("babel", "babel_copy");
+    stream->read_arrays(a, b, c);
+  }
+  bool valid = check_solution_faults<T>(faults, effective_num_times, a, b, c, sum, ARRAY_SIZE, test, data_init);
+  sstr.str( std::string() );
+  sstr.clear();
+  if (output_as_csv)
+  {
+     sstr  << "gpu_id" << csv_separator
+      << "function" << csv_separator
+      << "num_times" << csv_separator
+      << "n_elements" << csv_separator
+      << "sizeof" << csv_separator
+      << ((mibibytes) ? "max_mibytes_per_sec" : "max_mbytes_per_sec") << csv_separator
+      << ((mibibytes) ? "mibps_at_min_t" : "mbps_at_min_t") << csv_separator
+      << ((mibibytes) ? "mibps_at_max_t" : "mbps_at_max_t") << csv_separator
+      << ((mibibytes) ? "mibps_at_avg_t" : "mbps_at_avg_t") << std::endl;
+  }
+  else
+  {
+      sstr << "\n---------------------------------------------------------------------------------" << std::endl
+      << std::left << std::setw(12) << "GPU Id"
+      << std::left << std::setw(12) << "Function"
+      << std::left << std::setw(15) << ((mibibytes) ? "MiBytes/sec" : "MBytes/sec")
+      << std::left << std::setw(15) << ((mibibytes) ? "Max MiB/s" : "Max MB/s")
+      << std::left << std::setw(15) << ((mibibytes) ? "Min MiB/s" : "Min MB/s")
+      << std::left << std::setw(15) << ((mibibytes) ? "Avg MiB/s" : "Avg MB/s")
+      << std::endl
+      << "---------------------------------------------------------------------------------" << std::endl
+      << std::fixed;
+  }
+
+  std::string labels[total_babel_subtests] = {"Read","Write","Copy", "Mul", "Add", "Triad", "Dot"};
+  size_t sizes[total_babel_subtests] = {
+    1 * sizeof(T) * ARRAY_SIZE,
+    1 * sizeof(T) * ARRAY_SIZE,
+    2 * sizeof(T) * ARRAY_SIZE,
+    2 * sizeof(T) * ARRAY_SIZE,
+    3 * sizeof(T) * ARRAY_SIZE,
+    3 * sizeof(T) * ARRAY_SIZE,
+    2 * sizeof(T) * ARRAY_SIZE
+  };
+
+  bool test_enable[total_babel_subtests] = {
+    test->read,
+    test->write,
+    test->copy,
+    test->mul,
+    test->add,
+    test->triad,
+    test->dot};
+
+  // Display babel subtest results
+  for (int i = 0; i < total_babel_subtests; i++)
+  {
+    if(test_enable[i]) {
+
+      // Get min/max; ignore the first result
+      auto minmax = std::minmax_element(timings[i].begin()+1, timings[i].end());
+
+      // Calculate average; ignore the first result
+      double average = std::accumulate(timings[i].begin()+1, timings[i].end(), 0.0) / (double)(effective_num_times - 1);
+      const double bw_scale = (mibibytes) ? pow(2.0, -20.0) : 1.0E-6;
+      // Display results
+      if (output_as_csv)
+      {
+        sstr
+          << device.second << csv_separator
+          << labels[i] << csv_separator
+          << effective_num_times << csv_separator
+          << ARRAY_SIZE << csv_separator
+          << sizeof(T) << csv_separator
+          << bw_scale * sizes[i] / (*minmax.first) << csv_separator
+          << bw_scale * sizes[i] / (*minmax.first) << csv_separator
+          << bw_scale * sizes[i] / (*minmax.second) << csv_separator
+          << bw_scale * sizes[i] / average
+          << std::endl;
+      }
+      else
+      {
+        sstr
+          << std::left << std::setw(12) << device.second
+          << std::left << std::setw(12) << labels[i]
+          << std::left << std::setw(15) << std::setprecision(3) <<
+          bw_scale * sizes[i] / (*minmax.first)
+          << std::left << std::setw(15) << std::setprecision(3) <<
+          bw_scale * sizes[i] / (*minmax.first)
+          << std::left << std::setw(15) << std::setprecision(3) <<
+          bw_scale * sizes[i] / (*minmax.second)
+          << std::left << std::setw(15) << std::setprecision(3) <<
+          bw_scale * sizes[i] / average
+          << std::endl;
+      }
+      if (json){
+        const char *key = mibibytes ? "MiBytes/sec" : "MBytes/sec";
+        const char *peak_key = mibibytes ? "Max_MiBytes/sec" : "Max_MBytes/sec";
+        const char *worst_key = mibibytes ? "Min_MiBytes/sec" : "Min_MBytes/sec";
+        const char *avg_key = mibibytes ? "Avg_MiBytes/sec" : "Avg_MBytes/sec";
+        log_to_json(desc, rvs::logresults, "Function",std::string(labels[i]),
+            key, std::to_string(bw_scale * sizes[i] / (*minmax.first)),
+            peak_key, std::to_string(bw_scale * sizes[i] / (*minmax.first)),
+            worst_key, std::to_string(bw_scale * sizes[i] / (*minmax.second)),
+            avg_key, std::to_string(bw_scale * sizes[i] / average),
+            "pass", "true");
+      }
+    }
+  }
+
+  sstr
+    << "---------------------------------------------------------------------------------" << std::endl;
+  rvs::lp::Log(sstr.str(), rvs::logresults);
+  delete stream;
+
+  return valid;
+}
+
+template <typename T>
+bool run_triad(std::pair<int, uint16_t> device, int num_times, int ARRAY_SIZE, bool output_as_csv, bool mibibytes,
+    uint16_t dwords_per_lane, uint16_t chunks_per_block, uint16_t tb_size, bool json, std::string action, subtest *test,
+    const std::string& data_init, const std::string& nontemporal, uint64_t duration, rvs::faultinject *faults)
+{
+  std::string msg;
+  auto desc = action_descriptor{action, module_name, device.second};
+  bool time_based = (duration > 0);
+  std::stringstream sstr;
+  if (!output_as_csv)
+  {
+    if (time_based)
+      msg = "Running triad for " + std::to_string(duration) + " ms,";
+    else
+      msg = "Running triad " + std::to_string (num_times) + " times,";
+    msg += "Number of elements: " + std::to_string(ARRAY_SIZE) + ", ";
+
+    if (sizeof(T) == sizeof(float))
+      msg += "Precision: float\n";
+    else
+      msg += "Precision: double\n" ;
+    
+    rvs::lp::Log(msg, rvs::loginfo);
+    std::streamsize ss = std::cout.precision();
+    if (mibibytes)
+    {
+      sstr << std::setprecision(1) << std::fixed
+        << "Array size: " << ARRAY_SIZE*sizeof(T)*pow(2.0, -10.0) << " KiB"
+        << " (=" << ARRAY_SIZE*sizeof(T)*pow(2.0, -20.0) << " MiB)" << std::endl;
+      std::cout << "Total size: " << 3.0*ARRAY_SIZE*sizeof(T)*pow(2.0, -10.0) << " KiB"
+        << " (=" << 3.0*ARRAY_SIZE*sizeof(T)*pow(2.0, -20.0) << " MiB)" << std::endl;
+    }
+    else
+    {
+      sstr << std::setprecision(1) << std::fixed
+        << "Array size: " << ARRAY_SIZE*sizeof(T)*1.0E-3 << " KB"
+        << " (=" << ARRAY_SIZE*sizeof(T)*1.0E-6 << " MB)" << std::endl;
+      std::cout << "Total size: " << 3.0*ARRAY_SIZE*sizeof(T)*1.0E-3 << " KB"
+        << " (=" << 3.0*ARRAY_SIZE*sizeof(T)*1.0E-6 << " MB)" << std::endl;
+    }
+    rvs::lp::Log(sstr.str(), rvs::logresults);
+    if (json){
+      std::string scale = mibibytes ? "MiB" : "MB";
+      auto arr_size = mibibytes ? ARRAY_SIZE*sizeof(T)*pow(2.0, -20.0) :
+	      ARRAY_SIZE*sizeof(T)*1.0E-6;
+     auto total_size = mibibytes  ? 3.0*ARRAY_SIZE*sizeof(T)*pow(2.0, -20.0) :
+	     3.0*ARRAY_SIZE*sizeof(T)*1.0E-6;
+     if (time_based)
+       log_to_json(desc, rvs::logresults,"Array size", std::to_string(arr_size),
+                "Total size", std::to_string(total_size),
+                "Duration(ms)", std::to_string(duration) );
+     else
+       log_to_json(desc, rvs::logresults,"Array size", std::to_string(arr_size),
+                "Total size", std::to_string(total_size),
+                "Iterations", std::to_string(num_times) );
+    }
+    std::cout.precision(ss);
+  }
+  sstr.str( std::string() );
+  sstr.clear();
+  // Create host vectors
+  std::vector<T> a(ARRAY_SIZE);
+  std::vector<T> b(ARRAY_SIZE);
+  std::vector<T> c(ARRAY_SIZE);
+
+  // Use the HIP implementation
+  HIPStream<T> *stream;
+  {
+    RVS_TRACE_SCOPE("babel", "babel_setup");
+    stream = new HIPStream<T>(ARRAY_SIZE, event_timing, device.first, dwords_per_lane, chunks_per_block, tb_size, nontemporal);
+
+    if (data_init == "gpu_norm_dist") {
+      stream->init_arrays_normdist(static_cast<T>(0.0), static_cast<T>(1.0), true, a, b, c);
+    } else if (data_init == "cpu_norm_dist") {
+      stream->init_arrays_normdist(static_cast<T>(0.0), static_cast<T>(1.0), false, a, b, c);
+    } else if (data_init == "zero_init") {
+      stream->init_arrays(T{0}, T{0}, T{0});
+    } else {
+      stream->init_arrays(startA, startB, startC);
+    }
+  }
+
+  // Declare timers
+  std::chrono::high_resolution_clock::time_point t1, t2;
+
+  uint64_t actual_iterations = 0;
+
+  // Run triad in loop
+  {
+    RVS_TRACE_SCOPE("babel", "babel_kernels");
+    t1 = std::chrono::high_resolution_clock::now();
+    if (time_based) {
+      auto duration_limit = std::chrono::milliseconds(duration);
+      while (true) {
+        auto elapsed = std::chrono::high_resolution_clock::now() - t1;
+        if (elapsed >= duration_limit)
+          break;
+        stream->triad();
+        actual_iterations++;
+      }
+    } else {
+      for (unsigned int k = 0; k < num_times; k++)
+      {
+        stream->triad();
+      }
+      actual_iterations = num_times;
+    }
+    t2 = std::chrono::high_resolution_clock::now();
+  }
+
+  double runtime = std::chrono::duration_cast<std::chrono::duration<double> >(t2 - t1).count();
+
+  if (time_based) {
+    msg = "Completed " + std::to_string(actual_iterations) + " triad iterations in " +
+        std::to_string(runtime) + " seconds";
+    rvs::lp::Log(msg, rvs::logresults);
+  }
+
+  // Check solutions
+  T sum = 0.0;
+  {
+    RVS_TRACE_SCOPE("babel", "babel_copy");
+    stream->read_arrays(a, b, c);
+  }
+  subtest triad_test = {false, false, false, false, false, false, true};
+  bool valid = check_solution_faults<T>(faults, actual_iterations, a, b, c, sum, ARRAY_SIZE, &triad_test, data_init);
+
+  // Display timing results
+  double total_bytes = 3 * sizeof(T) * ARRAY_SIZE * actual_iterations;
+  double bandwidth = ((mibibytes) ? pow(2.0, -30.0) : 1.0E-9) * (total_bytes / runtime);
+
+  if (output_as_csv)
+  {
+    sstr
+      << "gpu_id" << csv_separator
+      << "function" << csv_separator
+      << "num_times" << csv_separator
+      << "n_elements" << csv_separator
+      << "sizeof" << csv_separator
+      << ((mibibytes) ? "gibytes_per_sec" : "gbytes_per_sec") << csv_separator
+      << "runtime"
+      << std::endl
+      << device.second << csv_separator
+      << "Triad" << csv_separator
+      << actual_iterations << csv_separator
+      << ARRAY_SIZE << csv_separator
+      << sizeof(T) << csv_separator
+      << bandwidth << csv_separator
+      << runtime
+      << std::endl;
+  }
+  else
+  {
+    sstr
+      << "--------------------------------"
+      << std::endl << std::fixed
+      << "GPU Id: " << std::left << device.second << std::endl
+      << "Runtime (seconds): " << std::left << std::setprecision(5)
+      << runtime << std::endl
+      << "Bandwidth (" << ((mibibytes) ? "GiB/s" : "GB/s") << "):  "
+      << std::left << std::setprecision(3)
+      << bandwidth << std::endl;
+  }
+   rvs::lp::Log(sstr.str(), rvs::logresults);
+   if (json){
+     std::string bw_field{"Bandwidth ("};
+     bw_field +=(mibibytes) ? "GiB/s" : "GB/s";
+     bw_field += ")";
+     log_to_json(desc, rvs::logresults,
+		     "GPU Id", std::to_string(device.second),
+		     "Runtime (seconds)", std::to_string(runtime),
+		     bw_field, std::to_string(bandwidth),
+		     "pass", "true");
+   }
+  delete stream;
+
+  return valid;
+}
+
+template <typename T>
+bool check_solution(const unsigned int ntimes, std::vector<T>& a, std::vector<T>& b, std::vector<T>& c, T& sum, uint64_t ARRAY_SIZE,
+    const subtest *test, bool start_values)
+{
+  // Generate correct solution (arrays start at startA/B/C or zero)
+  T goldA = start_values ? T(startA) : T(0);
+  T goldB = start_values ? T(startB) : T(0);
+  T goldC = start_values ? T(startC) : T(0);
+  T goldSum = 0.0;
+  std::string  msg;
+  bool valid = true;
+
+  const T scalar = startScalar;
+
+  for (unsigned int i = 0; i < ntimes; i++)
+  {
+    // Do STREAM! (enabled subtests in the order they are run)
+    if (test->write)
+      goldC = startC;
+    if (test->copy)
+      goldC = goldA;
+    if (test->mul)
+      goldB = scalar * goldC;
+    if (test->add)
+      goldC = goldA + goldB;
+    if (test->triad)
+      goldA = goldB + scalar * goldC;
+  }
+
+  // Do the reduction
+  goldSum = goldA * goldB * ARRAY_SIZE;
+
+  // Calculate the average error
+  double errA = std::accumulate(a.begin(), a.end(), 0.0, [&](double sum, const T val){ return sum + fabs(val - goldA); });
+  errA /= a.size();
+  double errB = std::accumulate(b.begin(), b.end(), 0.0, [&](double sum, const T val){ return sum + fabs(val - goldB); });
+  errB /= b.size();
+  double errC = std::accumulate(c.begin(), c.end(), 0.0, [&](double sum, const T val){ return sum + fabs(val - goldC); });
+  errC /= c.size();
+  double errSum = goldSum != 0 ? fabs((sum - goldSum) / goldSum) : fabs(sum);
+
+  double epsi = std::numeric_limits<T>::epsilon() * 100.0;
+
+  // negated compares so that NaN errors fail the check
+  if (!(errA <= epsi)) {
+      rvs::lp::Log("Validation failed on a[]. Average error " + std::to_string(errA), rvs::logerror);
+      valid = false;
+  }
+  if (!(errB <= epsi)) {
+      rvs::lp::Log("Validation failed on b[]. Average error " + std::to_string(errB),rvs::logerror);
+      valid = false;
+  }
+  if (!(errC <= epsi)) {
+      rvs::lp::Log("Validation failed on c[]. Average error " + std::to_string(errC),rvs::logerror);
+      valid = false;
+  }
+  if (test->dot && !(errSum <= std::max(epsi, 1.0E-8))){
+    std::stringstream sstr;
+     sstr  << "Validation failed on sum. Error " << errSum
+      << std::endl << std::setprecision(15)
+      << "Sum was " << sum << " but should be " << goldSum
+      << std::endl;
+     rvs::lp::Log(sstr.str() ,rvs::logerror);
+     valid = false;
+  }
+  return valid;
+}
+
+/**
+ * Solution check under fault injection: scheduled faults are injected into
+ * host copies of a[], b[] and c[] in turn (one check each) and the outcome
+ * of check_solution() on the copies is reported back. The solution is only
+ * known for uniform data initialization, checks are skipped otherwise.
+ * Returns false if a check failed (true if fault injection is disabled).
+ */
+template <typename T>
+bool check_solution_faults(rvs::faultinject *faults, const unsigned int ntimes, std::vector<T>& a, std::vector<T>& b,
+    std::vector<T>& c, T& sum, uint64_t ARRAY_SIZE, const subtest *test, const std::string& data_init)
+{
+  if (!faults || !faults->enabled())
+    return true;
+
+  RVS_TRACE_SCOPE("babel", "babel_validation");
+
+  if (data_init != "default" && data_init != "zero_init") {
+    rvs::lp::Log("Fault injection skipped, no reference solution for data_init " + data_init, rvs::loginfo);
+    return true;
+  }
+
+  bool start_values = data_init == "default";
+  std::vector<T>* arrays[3] = {&a, &b, &c};
+  bool valid = true;
+
+  for (uint64_t check = 1; check <= 3; check++) {
+    std::vector<T>& target = *arrays[check - 1];
+    std::vector<T> clean(target);
+
+    rvs::faultinject::action_t act = faults->inject(check, target.data(), target.size(),
+        rvs::faultinject::layout_of<T>());
+    bool ok = !act.copy_fail && check_solution<T>(ntimes, a, b, c, sum, ARRAY_SIZE, test, start_values);
+
+    faults->report(check, !ok);
+    valid = valid && ok;
+    target.swap(clean);
+  }
+  return valid;
+}
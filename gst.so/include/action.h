@@ -0,0 +1,226 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GST_SO_INCLUDE_ACTION_H_
+#define GST_SO_INCLUDE_ACTION_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <pci/pci.h>
+#ifdef __cplusplus
+}
+#endif
+
+#include <vector>
+#include <string>
+#include <map>
+
+#include "include/rvsactionbase.h"
+#include "include/rvs_matrix_stage.h"
+#include "include/rvs_gemm_sweep.h"
+#include "include/rvs_rotating.h"
+
+using std::vector;
+using std::string;
+using std::map;
+
+/**
+ * @class gst_action
+ * @ingroup GST
+ *
+ * @brief GST action implementation class
+ *
+ * Derives from rvs::actionbase and implements actual action functionality
+ * in its run() method.
+ *
+ */
+class gst_action: public rvs::actionbase {
+  public:
+    gst_action();
+    virtual ~gst_action();
+
+    virtual int run(void);
+
+  protected:
+
+    //! stress test ramp duration
+    uint64_t gst_ramp_interval;
+    //! ramp steady state window (measurements)
+    uint64_t gst_ramp_window;
+    //! ramp relative confidence interval half width
+    float gst_ramp_precision;
+    //! ramp shortest measured batch in ms
+    uint64_t gst_ramp_min_batch_ms;
+    //! telemetry sampling period in ms (0 - no telemetry correlation)
+    uint64_t gst_telemetry_interval;
+    //! GFLOPS dip : fraction below the median interval
+    float gst_dip_threshold;
+    //! telemetry trace file prefix
+    std::string gst_telemetry_trace;
+    //! maximum allowed number of target_stress violations
+    int gst_max_violations;
+    //! specifies whether to copy the matrices
+    //! to the GPU before each GEMM operation
+    bool gst_copy_matrix;
+    //! target stress (in GFlops) that the GPU will try to achieve
+    float gst_target_stress;
+    //! GFlops tolerance (how much the GFlops can fluctuare after
+    //! the ramp period for the test to succeed)
+    float gst_tolerance;
+
+    //! Alpha and beta value
+    float gst_alpha_val;
+    float gst_beta_val;
+
+    //! matrix sizes for GEMM operation
+    uint64_t gst_matrix_size_a;
+    uint64_t gst_matrix_size_b;
+    uint64_t gst_matrix_size_c;
+
+    //! matrix initialization method :
+    //! default, random integer or trignometric float
+    std::string gst_matrix_init;
+    //! host matrix initialization seed
+    uint64_t gst_matrix_seed;
+
+    //Parameter to heat up
+    uint64_t gst_hot_calls;
+    //Parameter for warm-up calls before ramp
+    uint64_t gst_warm_calls;
+
+    //Tranpose set to none or enabled
+    int      gst_trans_a;
+    int      gst_trans_b;
+
+    //Leading offset values
+    int      gst_lda_offset;
+    int      gst_ldb_offset;
+    int      gst_ldc_offset;
+    int      gst_ldd_offset;
+
+    // type of gemm operation
+    std::string gst_ops_type;
+
+    // gemm data type
+    std::string gst_data_type;
+
+    // Rotating buffer size
+    uint32_t gst_rotating;
+    // Rotating buffer set sizing
+    rvs::rotating_mode gst_rotating_mode;
+
+    // gemm output self-check
+    bool gst_self_check;
+    // self-check mode : norm or bitwise
+    std::string gst_self_check_mode;
+
+    // hipBLASLt autotune candidates
+    int gst_algo_autotune;
+    // hipBLASLt algorithm selection cache file
+    std::string gst_algo_cache;
+
+    // gemm output accuracy-check
+    bool gst_accu_check;
+    // accuracy-check mode : full, sample or checksum
+    std::string gst_accu_check_mode;
+    // sampled accuracy-check probability of detecting wrong output
+    float gst_accu_confidence;
+    // sampled accuracy-check fraction of wrong elements to be detected
+    float gst_accu_error_rate;
+
+    // Inject error in gemm output
+    // Note : This is just for testing purpose. Shouldn't be enabled otherwise.
+    bool     gst_error_inject;
+    // error injection frequency (number of gemm calls per error injection)
+    uint64_t gst_error_freq;
+    // number of errors injected in gemm output
+    uint64_t gst_error_count;
+    // fault injection schedule of gemm output validation (testing only)
+    std::string gst_fault_inject;
+    // seed of fault injection decisions
+    uint64_t gst_fault_seed;
+
+    // gemm mode : basic (single), batched or strided batched
+    std::string gst_gemm_mode;
+
+    // Matrix batch count
+    int gst_batch_size;
+
+    // Stride from the start of matrix a(i)
+    // to next matrix a(i+1) in the strided batch
+    uint64_t gst_stride_a;
+
+    // Stride from the start of matrix b(i)
+    // to next matrix b(i+1) in the strided batch
+    uint64_t gst_stride_b;
+
+    // Stride from the start of matrix c(i)
+    // to next matrix c(i+1) in the strided batch
+    uint64_t gst_stride_c;
+
+    // Stride from the start of matrix d(i)
+    // to next matrix d(i+1) in the strided batch
+    uint64_t gst_stride_d;
+
+    // blas backend source library - rocblas,hipblaslt
+    std::string gst_blas_source;
+
+    // gemm compute type
+    std::string gst_compute_type;
+
+    // gemm output data type
+    std::string gst_out_data_type;
+
+    // Scale matrix a
+    std::string gst_scale_a;
+    // Scale matrix b
+    std::string gst_scale_b;
+
+    // GEMM shape sweep points (empty - regular stress test)
+    std::vector<rvs::gemm_sweep::point_t> gst_sweep_points;
+    // timed iterations (of hot_calls GEMMs) per sweep point
+    uint64_t gst_sweep_iterations;
+    // sweep peak GFLOPS override (0 - from the GPU arch)
+    float gst_sweep_peak_gflops;
+    // minimum percent of peak required for each sweep point (0 - no check)
+    float gst_sweep_min_efficiency;
+
+    friend class GSTWorker;
+
+    bool get_all_gst_config_keys(void);
+    bool sweep_requested(void);
+    bool get_sweep_config_keys(void);
+
+    /**
+     * @brief gets the number of ROCm compatible AMD GPUs
+     * @return run number of GPUs
+     */
+    int get_num_amd_gpu_devices(void);
+    int get_all_selected_gpus(void);
+    bool do_gpu_stress_test(map<int, uint16_t> gst_gpus_device_index);
+    void log_matrix_staging(const rvs::matrix_stage::stats_t& start);
+};
+
+#endif  // GST_SO_INCLUDE_ACTION_H_
@@ -0,0 +1,562 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef GST_SO_INCLUDE_GST_WORKER_H_
+#define GST_SO_INCLUDE_GST_WORKER_H_
+
+#include <string>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <atomic>
+#include "amd_smi/amdsmi.h"
+#include "include/rvsthreadbase.h"
+#include "include/rvs_blas.h"
+#include "include/rvs_gemm_sweep.h"
+#include "include/rvs_gemm_engine.h"
+#include "include/rvs_ramp_search.h"
+#include "include/rvs_telemetry_corr.h"
+#include "include/rvs_util.h"
+#include "include/rvstimer.h"
+#include "include/rvsactionbase.h"
+#include "include/action.h"
+
+#define GST_RESULT_PASS_MESSAGE         "true"
+#define GST_RESULT_FAIL_MESSAGE         "false"
+
+
+/**
+ * @class GSTWorker
+ * @ingroup GST
+ *
+ * @brief GSTWorker action implementation class
+ *
+ * Derives from rvs::ThreadBase and implements actual action functionality
+ * in its run() method.
+ *
+ */
+class GSTWorker : public rvs::ThreadBase {
+ public:
+    GSTWorker();
+    virtual ~GSTWorker();
+
+    //! sets action name
+    void set_name(const std::string& name) { action_name = name; }
+    //! sets action
+    void set_action(const gst_action& _action) { action = _action; }
+    //! returns action name
+    const std::string& get_name(void) { return action_name; }
+
+    //! sets GPU ID
+    void set_gpu_id(uint16_t _gpu_id) { gpu_id = _gpu_id; }
+    //! returns GPU ID
+    uint16_t get_gpu_id(void) { return gpu_id; }
+
+    //! sets the GPU index
+    void set_gpu_device_index(int _gpu_device_index) {
+        gpu_device_index = _gpu_device_index;
+    }
+    //! returns the GPU index
+    int get_gpu_device_index(void) { return gpu_device_index; }
+
+    //! sets the run delay
+    void set_run_wait_ms(uint64_t _run_wait_ms) { run_wait_ms = _run_wait_ms; }
+    //! returns the run delay
+    uint64_t get_run_wait_ms(void) { return run_wait_ms; }
+
+    //! sets the total stress test run duration
+    void set_run_duration_ms(uint64_t _run_duration_ms) {
+        run_duration_ms = _run_duration_ms;
+    }
+    //! returns the total stress test run duration
+    uint64_t get_run_duration_ms(void) { return run_duration_ms; }
+
+    //! sets the stress test ramp duration
+    void set_ramp_interval(uint64_t _ramp_interval) {
+        ramp_interval = _ramp_interval;
+    }
+    //! returns the stress test ramp duration
+    uint64_t get_ramp_interval(void) { return ramp_interval; }
+    //! sets the ramp steady state window, precision and shortest batch
+    void set_ramp_search(uint64_t _window, float _precision,
+        uint64_t _min_batch_ms) {
+        ramp_window = _window;
+        ramp_precision = _precision;
+        ramp_min_batch_ms = _min_batch_ms;
+    }
+    //! sets the telemetry sampling period (0 - no telemetry correlation),
+    //! the GFLOPS dip threshold and the trace file prefix
+    void set_telemetry(uint64_t _interval_ms, float _dip_threshold,
+        const std::string& _trace) {
+        telemetry_interval = _interval_ms;
+        dip_threshold = _dip_threshold;
+        telemetry_trace = _trace;
+    }
+
+    //! sets the time interval at which the module reports the average GFlops
+    void set_log_interval(uint64_t _log_interval) {
+        log_interval = _log_interval;
+    }
+    //! returns the time interval at which the module reports the average GFlops
+    uint64_t get_log_interval(void) { return log_interval; }
+
+    //! sets the maximum allowed number of target_stress violations
+    void set_max_violations(uint64_t _max_violations) {
+        max_violations = _max_violations;
+    }
+    //! returns the maximum allowed number of target_stress violations
+    uint64_t get_max_violations(void) { return max_violations; }
+
+    //! sets the copy_matrix (true = the matrix will be copied to GPU each
+    //! time a new SGEMM will run, false = the matrix will be copied only once)
+    void set_copy_matrix(bool _copy_matrix) { copy_matrix = _copy_matrix; }
+
+    //! returns the copy_matrix value
+    bool get_copy_matrix(void) { return copy_matrix; }
+
+    //! sets the target stress (in GFlops) that the GPU will try to achieve
+    void set_target_stress(float _target_stress) {
+        target_stress = _target_stress;
+    }
+    //! returns the target stress (in GFlops) that the GPU will try to achieve
+    float get_target_stress(void) { return target_stress; }
+
+    //! sets hot calls
+    void set_gst_hot_calls(uint64_t _hot_calls) {
+        gst_hot_calls = _hot_calls;
+    }
+ 
+    //! gets hot calls
+    uint64_t get_gst_hot_calls(void) {
+        return gst_hot_calls;
+    }
+
+    //! sets warm calls
+    void set_gst_warm_calls(uint64_t _warm_calls) {
+        gst_warm_calls = _warm_calls;
+    }
+
+    //! gets warm calls
+    uint64_t get_gst_warm_calls(void) {
+        return gst_warm_calls;
+    }
+
+    //! sets the matrix size
+    void set_matrix_size_a(uint64_t _matrix_size_a) {
+        matrix_size_a = _matrix_size_a;
+    }
+    //! sets the matrix size
+    void set_matrix_size_b(uint64_t _matrix_size_b) {
+        matrix_size_b = _matrix_size_b;
+    }
+    //! sets the matrix size
+    void set_matrix_size_c(uint64_t _matrix_size_c) {
+        matrix_size_c = _matrix_size_c;
+    }
+    //! sets the matrix init
+    void set_matrix_init(std::string _matrix_init) {
+        matrix_init = _matrix_init;
+    }
+    //! sets the matrix initialization seed
+    void set_matrix_seed(uint64_t _matrix_seed) {
+        matrix_seed = _matrix_seed;
+    }
+    //! sets the transpose matrix a
+    void set_matrix_transpose_a(int transa) {
+        gst_trans_a = transa;
+    }
+    //! sets the transpose matrix b
+    void set_matrix_transpose_b(int transb) {
+        gst_trans_b = transb;
+    }
+    //! sets alpha val
+    void set_alpha_val(float alpha_val) {
+        gst_alpha_val = alpha_val;
+    }
+    //! sets beta val
+    void set_beta_val(float beta_val) {
+        gst_beta_val = beta_val;
+    }
+
+    //! sets offsets
+    void set_lda_offset(int lda) {
+        gst_lda_offset = lda;
+    }
+    //! sets offsets
+    void set_ldb_offset(int ldb) {
+        gst_ldb_offset = ldb;
+    }
+    //! sets offsets
+    void set_ldc_offset(int ldc) {
+        gst_ldc_offset = ldc;
+    }
+    //! sets offsets
+    void set_ldd_offset(int ldd) {
+        gst_ldd_offset = ldd;
+    }
+
+    //! returns the matrix size
+    uint64_t get_matrix_size_a(void) { return matrix_size_a; }
+
+    //! returns the matrix size
+    uint64_t get_matrix_size_b(void) { return matrix_size_b; }
+
+    //! returns the matrix size
+    uint64_t get_matrix_size_c(void) { return matrix_size_c; }
+
+    //! sets the GFlops tolerance
+    void set_tolerance(float _tolerance) { tolerance = _tolerance; }
+
+    //! returns the GFlops tolerance
+    float get_tolerance(void) { return tolerance; }
+
+    //! sets the JSON flag
+    static void set_use_json(bool _bjson) { bjson = _bjson; }
+    //! returns the JSON flag
+    static bool get_use_json(void) { return bjson; }
+
+    //! set gemm operation type - sgemm, dgemm, hgemm
+    void set_gst_ops_type(std::string _ops_type) { gst_ops_type = _ops_type; }
+
+    //! set data format based gemm operation  - fp8, fp16, bf16
+    void set_gst_data_type(std::string _data_type) { gst_data_type = _data_type; }
+
+    //! sets gemm output self check enable/disable
+    void set_self_check(bool _self_check) { self_check = _self_check; }
+
+    //! returns the self check value
+    bool get_self_check(void) { return self_check; }
+
+    //! sets gemm output self check mode : norm or bitwise
+    void set_self_check_mode(std::string _self_check_mode) {
+      self_check_mode = _self_check_mode;
+    }
+
+    //! sets hipBLASLt algorithm autotune candidates and selection cache file
+    void set_algo_selection(int _algo_autotune, std::string _algo_cache) {
+      algo_autotune = _algo_autotune;
+      algo_cache = _algo_cache;
+    }
+
+    //! sets the GEMM shape sweep (empty - regular stress test)
+    void set_sweep(const std::vector<rvs::gemm_sweep::point_t>& _points,
+        uint64_t _iterations, float _peak_gflops, float _min_efficiency) {
+      sweep_points = _points;
+      sweep_iterations = _iterations;
+      sweep_peak_gflops = _peak_gflops;
+      sweep_min_efficiency = _min_efficiency;
+    }
+
+    //! sets gemm output accuracy check enable/disable
+    void set_accu_check(bool _accu_check) { accu_check = _accu_check; }
+
+    //! returns the accuracy check value
+    bool get_accu_check(void) { return accu_check; }
+
+    //! sets gemm output accuracy check mode and sampling parameters
+    void set_accu_check_mode(std::string _accu_check_mode,
+        float _accu_confidence, float _accu_error_rate) {
+      accu_check_mode = _accu_check_mode;
+      accu_confidence = _accu_confidence;
+      accu_error_rate = _accu_error_rate;
+    }
+
+    //! returns the accuracy check mode
+    std::string get_accu_check_mode(void) { return accu_check_mode; }
+
+    //! sets gemm output error inject enable/disable
+    void set_error_inject(bool _error_inject) { error_inject = _error_inject; }
+
+    //! returns the error inject value
+    bool get_error_inject(void) { return error_inject; }
+
+    //! sets gemm error inject frequency value
+    void set_error_frequency(uint64_t _error_freq) { error_freq = _error_freq; }
+
+    //! returns gemm error inject frequency value
+    uint64_t get_error_frequency(void) { return error_freq; }
+
+    //! sets gemm error inject count value
+    void set_error_count(uint64_t _error_count) { error_count = _error_count; }
+
+    //! returns gemm error inject count value
+    uint64_t get_error_count(void) { return error_count; }
+
+    //! sets fault injection schedule and seed of gemm output validation
+    void set_fault_injection(const std::string& _fault_inject,
+                             uint64_t _fault_seed) {
+      fault_inject = _fault_inject;
+      fault_seed = _fault_seed;
+    }
+
+    //! sets the gemm mode
+    void set_gemm_mode(std::string _gemm_mode) { gemm_mode = _gemm_mode; }
+
+    //! returns gemm mode
+    std::string get_gemm_mode(void) { return gemm_mode; }
+
+    //! sets the batch size
+    void set_batch_size(int _batch_size) { batch_size = _batch_size; }
+
+    //! returns the batch size
+    int get_batch_size(void) { return batch_size; }
+
+    //! sets the matrix a stride
+    void set_stride_a(uint64_t _stride_a) { stride_a = _stride_a; }
+
+    //! returns the matrix a stride
+    uint64_t get_stride_a(void) { return stride_a; }
+
+    //! sets the matrix b stride
+    void set_stride_b(uint64_t _stride_b) { stride_b = _stride_b; }
+
+    //! returns the matrix b stride
+    uint64_t get_stride_b(void) { return stride_b; }
+
+    //! sets the matrix c stride
+    void set_stride_c(uint64_t _stride_c) { stride_c = _stride_c; }
+
+    //! returns the matrix c stride
+    uint64_t get_stride_c(void) { return stride_c; }
+
+    //! sets the matrix d stride
+    void set_stride_d(uint64_t _stride_d) { stride_d = _stride_d; }
+
+    //! returns the matrix d stride
+    uint64_t get_stride_d(void) { return stride_d; }
+
+    //! set blas backend source library  - rocblas, hipblaslt
+    void set_blas_source(std::string _blas_source) { blas_source = _blas_source; }
+
+    //! set gemm compute type
+    void set_compute_type(std::string _compute_type) { compute_type = _compute_type; }
+
+    //! set output data format based gemm operation
+    void set_gst_out_data_type(std::string _out_data_type) { gst_out_data_type = _out_data_type; }
+
+    //! set scale matrix a
+    void set_gst_scale_a(std::string _scale_a) { gst_scale_a = _scale_a; }
+    //! set scale matrix b
+    void set_gst_scale_b(std::string _scale_b) { gst_scale_b = _scale_b; }
+    //! set rotating buffer size
+    void set_gst_rotating(uint32_t _rotating) { gst_rotating = _rotating; }
+    //! set rotating buffer set sizing
+    void set_gst_rotating_mode(rvs::rotating_mode _mode) { gst_rotating_mode = _mode; }
+    //! get worker job result
+    bool get_result(void) { return result; }
+
+ protected:
+    void setup_blas(int *error, std::string *err_description);
+    bool do_gst_ramp(int *error, std::string *err_description);
+    void log_ramp_result(const rvs::gemm_ramp_control& ctl);
+    void start_telemetry(void);
+    void sample_telemetry(void);
+    void stop_telemetry(void);
+    void log_telemetry_dips(void);
+    bool do_gst_stress_test(int *error, std::string *err_description);
+    bool do_gst_sweep(int *error, std::string *err_description);
+    bool run_sweep_point(const rvs::gemm_sweep::point_t& point,
+                         rvs::gemm_sweep::result_t* res);
+    void log_gst_test_result(bool gst_test_passed);
+    virtual void run(void);
+    void log_interval_gflops(double gflops_interval);
+    void log_interval_batch_times(const rvs::gemm_interval_t& iv);
+    void log_validation_results(void);
+    void log_fault_stats(void);
+    void check_target_stress(double gflops_interval);
+
+    //! stress engine logging and validation policy
+    struct engine_hooks {
+      //! owning worker
+      GSTWorker* worker;
+      //! reports the GFLOPS and batch time distribution of an interval
+      void interval(const rvs::gemm_interval_t& iv) {
+        worker->log_interval_gflops(iv.gflops);
+        worker->log_interval_batch_times(iv);
+        if (worker->telemetry_on)
+          worker->telemetry.add_interval({iv.end_us, iv.seconds, iv.gflops});
+      }
+      bool after_batch(uint64_t iteration);
+      void finish(void);
+    };
+
+ protected:
+    //! name of the action
+    std::string action_name;
+    //! action instance
+    gst_action action;
+    //! index of the GPU that will run the stress test
+    int gpu_device_index;
+    //Matrix transpose A
+    int gst_trans_a;
+    //Matrix transpose B
+    int gst_trans_b;
+    //! ID of the GPU that will run the stress test
+    uint16_t gpu_id;
+    //GST aplha value 
+    float gst_alpha_val;
+    //GST beta value
+    float gst_beta_val;
+    //leading offsets
+    int gst_lda_offset;
+    int gst_ldb_offset;
+    int gst_ldc_offset;
+    int gst_ldd_offset;
+    //! stress test run delay
+    uint64_t run_wait_ms;
+    //! stress test run duration
+    uint64_t run_duration_ms;
+    //! stress test ramp duration
+    uint64_t ramp_interval;
+    //! ramp steady state window (measurements)
+    uint64_t ramp_window;
+    //! ramp relative confidence interval half width
+    float ramp_precision;
+    //! ramp shortest measured batch in ms
+    uint64_t ramp_min_batch_ms;
+    //! telemetry sampling period in ms (0 - no telemetry correlation)
+    uint64_t telemetry_interval;
+    //! GFLOPS dip : fraction below the median interval
+    float dip_threshold;
+    //! telemetry trace file prefix (empty - not saved)
+    std::string telemetry_trace;
+    //! stress test intervals and telemetry samples
+    rvs::telemetry_corr telemetry;
+    //! samples the telemetry every telemetry_interval ms
+    rvs::timer<GSTWorker> telemetry_timer;
+    //! amd-smi handle of the sampled GPU
+    amdsmi_processor_handle telemetry_hdl;
+    //! true while the telemetry is sampled
+    std::atomic<bool> telemetry_on{false};
+    //! time interval at which the module reports the average GFlops
+    uint64_t log_interval;
+    //! maximum allowed number of target_stress violations
+    uint64_t max_violations;
+    //! specifies whether to copy the matrix to the GPU for each SGEMM operation
+    bool copy_matrix;
+    //! target stress (in GFlops) that the GPU will try to achieve
+    float target_stress;
+    //! GFlops tolerance (how much the GFlops can fluctuare after
+    //! the ramp period for the test to succeed)
+    float tolerance;
+    //! matrix sizes
+    uint64_t matrix_size_a;
+    uint64_t matrix_size_b;
+    uint64_t matrix_size_c;
+    //! matrix init
+    std::string matrix_init;
+    //! matrix initialization seed
+    uint64_t matrix_seed;
+    //num of hot calls
+    uint64_t gst_hot_calls;
+    //num of warm-up calls during ramp period
+    uint64_t gst_warm_calls;
+    //! actual ramp time in case the GPU achieves the given target_stress Gflops
+    uint64_t ramp_actual_time;
+    //! rvs_blas pointer
+    std::unique_ptr<rvs_blas> gpu_blas;
+    //! max gflops achieved during the stress test
+    double max_gflops;
+    //! TRUE if JSON output is required
+    static bool bjson;
+    //! Type of operation
+    std::string gst_ops_type;
+    //! Type of data
+    std::string gst_data_type;
+    //! GEMM operations synchronization mutex
+    std::mutex mutex;
+    //! GEMM operations synchronization condition variable
+    std::condition_variable cv;
+    //! blas gemm operations status
+    bool blas_status;
+    //! gemm output self-check
+    bool self_check;
+    //! self-check mode : norm or bitwise
+    std::string self_check_mode;
+    //! hipBLASLt autotune candidates (0 - first heuristic algorithm)
+    int algo_autotune;
+    //! hipBLASLt algorithm selection cache file
+    std::string algo_cache;
+    //! GEMM shapes of the sweep (empty - regular stress test)
+    std::vector<rvs::gemm_sweep::point_t> sweep_points;
+    //! timed iterations (of hot_calls GEMMs) per sweep point
+    uint64_t sweep_iterations;
+    //! peak GFLOPS override for the sweep report (0 - from the GPU arch)
+    float sweep_peak_gflops;
+    //! minimum percent of peak required for each sweep point (0 - no check)
+    float sweep_min_efficiency;
+    //! gemm output accuracy-check
+    bool accu_check;
+    //! accuracy-check mode : full, sample or checksum
+    std::string accu_check_mode;
+    //! sampled accuracy-check probability of detecting wrong output
+    float accu_confidence;
+    //! sampled accuracy-check fraction of wrong elements to be detected
+    float accu_error_rate;
+    //! Inject error in gemm output
+    bool error_inject;
+    //! error injection frequency (number of gemm calls per error injection)
+    uint64_t error_freq;
+    //! number of errors injected in gemm output
+    uint64_t error_count;
+    //! fault injection schedule of gemm output validation
+    std::string fault_inject;
+    //! seed of fault injection decisions
+    uint64_t fault_seed;
+    //! gemm mode : basic (single), batched or strided batched
+    std::string gemm_mode;
+    //! Matrix batch count
+    int batch_size;
+    //! Stride from the start of matrix a(i)
+    //! to next matrix a(i+1) in the strided batch
+    uint64_t stride_a;
+    //! Stride from the start of matrix b(i)
+    //! to next matrix b(i+1) in the strided batch
+    uint64_t stride_b;
+    //! Stride from the start of matrix c(i)
+    //! to next matrix c(i+1) in the strided batch
+    uint64_t stride_c;
+    //! Stride from the start of matrix d(i)
+    //! to next matrix d(i+1) in the strided batch
+    uint64_t stride_d;
+    //! blas backend source library - rocblas,hipblaslt
+    std::string blas_source;
+    //! gemm compute type
+    std::string compute_type;
+    //! Type of output data
+    std::string gst_out_data_type;
+    //! Scale matrix a
+    std::string gst_scale_a;
+    //! Scale matrix b
+    std::string gst_scale_b;
+    //! Rotating buffer size
+    uint32_t gst_rotating;
+    //! Rotating buffer set sizing
+    rvs::rotating_mode gst_rotating_mode;
+    //! Worker job result
+    bool result;
+};
+
+#endif  // GST_SO_INCLUDE_GST_WORKER_H_
@@ -0,0 +1,1116 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/action.h"
+
+#include <string>
+#include <vector>
+#include <iostream>
+#include <regex>
+#include <utility>
+#include <algorithm>
+#include <map>
+#include <random>
+#include <unistd.h>
+
+#define __HIP_PLATFORM_HCC__
+#include "hip/hip_runtime.h"
+#include "hip/hip_runtime_api.h"
+
+#include "include/rvs_key_def.h"
+#include "include/gst_worker.h"
+#include "include/gpu_util.h"
+#include "include/rvs_faultinject.h"
+#include "include/rvs_hostgemm.h"
+#include "include/rvs_util.h"
+#include "include/rvsactionbase.h"
+#include "include/rvsloglp.h"
+
+using std::string;
+using std::vector;
+using std::map;
+using std::regex;
+
+#if(defined(RVS_ROCBLAS_VERSION_FLAT) && (RVS_ROCBLAS_VERSION_FLAT >= 3001000 && RVS_ROCBLAS_VERSION_FLAT < 5000000))
+  #define RVS_ROCBLAS_HAS_F8_DATATYPES 1
+#endif
+
+#define RVS_CONF_RAMP_INTERVAL_KEY      "ramp_interval"
+#define RVS_CONF_RAMP_WINDOW_KEY        "ramp_window"
+#define RVS_CONF_RAMP_PRECISION_KEY     "ramp_precision"
+#define RVS_CONF_RAMP_MIN_BATCH_KEY     "ramp_min_batch_ms"
+#define RVS_CONF_TELEMETRY_INTERVAL_KEY "telemetry_interval"
+#define RVS_CONF_DIP_THRESHOLD_KEY      "dip_threshold"
+#define RVS_CONF_TELEMETRY_TRACE_KEY    "telemetry_trace"
+#define RVS_CONF_LOG_INTERVAL_KEY       "log_interval"
+#define RVS_CONF_MAX_VIOLATIONS_KEY     "max_violations"
+#define RVS_CONF_COPY_MATRIX_KEY        "copy_matrix"
+#define RVS_CONF_TARGET_STRESS_KEY      "target_stress"
+#define RVS_CONF_TOLERANCE_KEY          "tolerance"
+#define RVS_CONF_HOT_CALLS              "hot_calls"
+#define RVS_CONF_WARM_CALLS             "warm_calls"
+#define RVS_CONF_MATRIX_SIZE_KEYA       "matrix_size_a"
+#define RVS_CONF_MATRIX_SIZE_KEYB       "matrix_size_b"
+#define RVS_CONF_MATRIX_SIZE_KEYC       "matrix_size_c"
+#define RVS_CONF_MATRIX_INIT            "matrix_init"
+#define RVS_CONF_MATRIX_SEED            "matrix_seed"
+#define RVS_CONF_GST_OPS_TYPE           "ops_type"
+#define RVS_CONF_GST_DATA_TYPE          "data_type"
+#define RVS_CONF_TRANS_A                "transa"
+#define RVS_CONF_TRANS_B                "transb"
+#define RVS_CONF_ALPHA_VAL              "alpha"
+#define RVS_CONF_BETA_VAL               "beta"
+#define RVS_CONF_LDA_OFFSET             "lda"
+#define RVS_CONF_LDB_OFFSET             "ldb"
+#define RVS_CONF_LDC_OFFSET             "ldc"
+#define RVS_CONF_LDD_OFFSET             "ldd"
+#define RVS_CONF_SELF_CHECK_KEY         "self_check"
+#define RVS_CONF_SELF_CHECK_MODE_KEY    "self_check_mode"
+#define RVS_CONF_ALGO_AUTOTUNE_KEY      "algo_autotune"
+#define RVS_CONF_ALGO_CACHE_KEY         "algo_cache"
+#define RVS_CONF_ACCU_CHECK_KEY         "accuracy_check"
+#define RVS_CONF_ACCU_CHECK_MODE_KEY    "accuracy_check_mode"
+#define RVS_CONF_ACCU_CONFIDENCE_KEY    "accuracy_confidence"
+#define RVS_CONF_ACCU_ERROR_RATE_KEY    "accuracy_error_rate"
+#define RVS_CONF_ERROR_INJECT_KEY       "error_inject"
+#define RVS_CONF_ERROR_FREQUENCY_KEY    "error_freq"
+#define RVS_CONF_ERROR_COUNT_KEY        "error_count"
+#define RVS_CONF_GEMM_MODE              "gemm_mode"
+#define RVS_CONF_BATCH_SIZE             "batch_size"
+#define RVS_CONF_STRIDE_A               "stride_a"
+#define RVS_CONF_STRIDE_B               "stride_b"
+#define RVS_CONF_STRIDE_C               "stride_c"
+#define RVS_CONF_STRIDE_D               "stride_d"
+#define RVS_CONF_BLAS_SOURCE_KEY        "blas_source"
+#define RVS_CONF_COMPUTE_TYPE_KEY       "compute_type"
+#define RVS_CONF_GST_OUT_DATA_TYPE      "out_data_type"
+#define RVS_CONF_SCALE_A                "scale_a"
+#define RVS_CONF_SCALE_B                "scale_b"
+#define RVS_CONF_ROTATING               "rotating"
+#define RVS_CONF_ROTATING_MODE          "rotating_mode"
+#define RVS_CONF_SWEEP_M_KEY            "sweep_m"
+#define RVS_CONF_SWEEP_N_KEY            "sweep_n"
+#define RVS_CONF_SWEEP_K_KEY            "sweep_k"
+#define RVS_CONF_SWEEP_TRANS_A_KEY      "sweep_transa"
+#define RVS_CONF_SWEEP_TRANS_B_KEY      "sweep_transb"
+#define RVS_CONF_SWEEP_DATA_TYPE_KEY    "sweep_data_type"
+#define RVS_CONF_SWEEP_BATCH_KEY        "sweep_batch"
+#define RVS_CONF_SWEEP_ITERATIONS_KEY   "sweep_iterations"
+#define RVS_CONF_SWEEP_PEAK_KEY         "sweep_peak_gflops"
+#define RVS_CONF_SWEEP_MIN_EFF_KEY      "sweep_min_efficiency"
+
+#define TARGET_KEY                      "target"
+#define DTYPE_KEY                       "dtype"
+#define GST_DEFAULT_RAMP_INTERVAL       0
+#define GST_DEFAULT_RAMP_WINDOW         10
+#define GST_DEFAULT_RAMP_PRECISION      0.01f
+#define GST_DEFAULT_RAMP_MIN_BATCH      50
+#define GST_DEFAULT_TELEMETRY_INTERVAL  0
+#define GST_DEFAULT_DIP_THRESHOLD       0.1f
+#define GST_DEFAULT_TELEMETRY_TRACE     ""
+#define GST_DEFAULT_LOG_INTERVAL        1000
+#define GST_DEFAULT_MAX_VIOLATIONS      0
+#define GST_DEFAULT_TOLERANCE           0.05
+#define GST_DEFAULT_COPY_MATRIX         true
+#define GST_DEFAULT_MATRIX_SIZE         5760
+#define GST_DEFAULT_MATRIX_INIT         "default"
+#define GST_DEFAULT_HOT_CALLS           1
+#define GST_DEFAULT_WARM_CALLS          1
+#define GST_DEFAULT_TRANS_A             0
+#define GST_DEFAULT_TRANS_B             1
+#define GST_DEFAULT_ALPHA_VAL           1
+#define GST_DEFAULT_BETA_VAL            1
+#define GST_DEFAULT_LDA_OFFSET          0
+#define GST_DEFAULT_LDB_OFFSET          0
+#define GST_DEFAULT_LDC_OFFSET          0
+#define GST_DEFAULT_LDD_OFFSET          0
+#define GST_DEFAULT_SELF_CHECK          false
+#define GST_DEFAULT_SELF_CHECK_MODE     "norm"
+#define GST_DEFAULT_ALGO_AUTOTUNE       0
+#define GST_DEFAULT_ALGO_CACHE          ""
+#define GST_DEFAULT_ACCU_CHECK          false
+#define GST_DEFAULT_ACCU_CHECK_MODE     "full"
+#define GST_DEFAULT_ACCU_CONFIDENCE     0.999
+#define GST_DEFAULT_ACCU_ERROR_RATE     0.0001
+#define GST_DEFAULT_ERROR_INJECT        false
+#define GST_DEFAULT_ERROR_FREQUENCY     0
+#define GST_DEFAULT_ERROR_COUNT         0
+#define GST_DEFAULT_GEMM_MODE           ""
+#define GST_DEFAULT_BATCH_SIZE          0
+#define GST_DEFAULT_STRIDE_A            0
+#define GST_DEFAULT_STRIDE_B            0
+#define GST_DEFAULT_STRIDE_C            0
+#define GST_DEFAULT_STRIDE_D            0
+#define GST_DEFAULT_BLAS_SOURCE         "rocblas"
+#define GST_DEFAULT_COMPUTE_TYPE        "fp32_r"
+#define GST_DEFAULT_DURATION            0
+#define GST_DEFAULT_SWEEP_ITERATIONS    10
+#define GST_DEFAULT_SWEEP_PEAK          0
+#define GST_DEFAULT_SWEEP_MIN_EFF       0
+#define GST_MAX_SWEEP_POINTS            4096
+
+#define GST_NO_COMPATIBLE_GPUS          "No AMD compatible GPU found!"
+#define GST_MATRIX_STAGING_MSG          "matrix staging"
+
+#define FLOATING_POINT_REGEX            "^[0-9]*\\.?[0-9]+$"
+
+#define JSON_CREATE_NODE_ERROR          "JSON cannot create node"
+#define GST_DEFAULT_OPS_TYPE            ""
+#define GST_DEFAULT_DATA_TYPE           ""
+#define GST_DEFAULT_OUT_DATA_TYPE       ""
+#define GST_DEFAULT_SCALE_A             ""
+#define GST_DEFAULT_SCALE_B             ""
+#define GST_DEFAULT_ROTATING            0
+#define GST_DEFAULT_ROTATING_MODE       "fixed"
+
+static constexpr auto MODULE_NAME = "gst";
+static constexpr auto MODULE_NAME_CAPS = "GST";
+/**
+ * @brief default class constructor
+ */
+gst_action::gst_action() {
+  module_name = MODULE_NAME;
+  bjson = false;
+}
+
+/**
+ * @brief class destructor
+ */
+gst_action::~gst_action() {
+  property.clear();
+}
+
+/**
+ * @brief runs the GST test stress session
+ * @param gst_gpus_device_index <gpu_index, gpu_id> map
+ * @return true if no error occured, false otherwise
+ */
+bool gst_action::do_gpu_stress_test(map<int, uint16_t> gst_gpus_device_index) {
+
+  uint64_t k = 0;
+  vector<GSTWorker> workers(gst_gpus_device_index.size());
+  rvs::matrix_stage::stats_t stage_start = rvs::matrix_stage::get_stats();
+
+  for (;;) {
+    if (property_wait != 0)  // delay gst execution
+      sleep(property_wait);
+
+    map<int, uint16_t>::iterator it;
+    size_t i = 0;
+
+    // all worker instances have the same json settings
+    GSTWorker::set_use_json(bjson);
+
+    for (it = gst_gpus_device_index.begin();
+        it != gst_gpus_device_index.end(); ++it) {
+      // set worker thread stress test params
+      workers[i].set_name(action_name);
+      workers[i].set_action(*this);
+      workers[i].set_gpu_id(it->second);
+      workers[i].set_gpu_device_index(it->first);
+      workers[i].set_affinity_hint(it->first);
+      set_worker_affinity(&workers[i], it->second);
+      workers[i].set_run_wait_ms(property_wait);
+      workers[i].set_run_duration_ms(property_duration);
+      workers[i].set_ramp_interval(gst_ramp_interval);
+      workers[i].set_ramp_search(gst_ramp_window, gst_ramp_precision,
+          gst_ramp_min_batch_ms);
+      workers[i].set_telemetry(gst_telemetry_interval, gst_dip_threshold,
+          gst_telemetry_trace);
+      workers[i].set_log_interval(property_log_interval);
+      workers[i].set_max_violations(gst_max_violations);
+      workers[i].set_copy_matrix(gst_copy_matrix);
+      workers[i].set_target_stress(gst_target_stress);
+      workers[i].set_tolerance(gst_tolerance);
+      workers[i].set_gst_hot_calls(gst_hot_calls);
+      workers[i].set_gst_warm_calls(gst_warm_calls);
+      workers[i].set_matrix_size_a(gst_matrix_size_a);
+      workers[i].set_matrix_size_b(gst_matrix_size_b);
+      workers[i].set_matrix_size_c(gst_matrix_size_c);
+      workers[i].set_matrix_init(gst_matrix_init);
+      workers[i].set_matrix_seed(gst_matrix_seed);
+      workers[i].set_gst_ops_type(gst_ops_type);
+      workers[i].set_gst_data_type(gst_data_type);
+      workers[i].set_matrix_transpose_a(gst_trans_a);
+      workers[i].set_matrix_transpose_b(gst_trans_b);
+      workers[i].set_alpha_val(gst_alpha_val);
+      workers[i].set_beta_val(gst_beta_val);
+      workers[i].set_lda_offset(gst_lda_offset);
+      workers[i].set_ldb_offset(gst_ldb_offset);
+      workers[i].set_ldc_offset(gst_ldc_offset);
+      workers[i].set_ldd_offset(gst_ldd_offset);
+      workers[i].set_self_check(gst_self_check);
+      workers[i].set_self_check_mode(gst_self_check_mode);
+      workers[i].set_algo_selection(gst_algo_autotune, gst_algo_cache);
+      workers[i].set_accu_check(gst_accu_check);
+      workers[i].set_accu_check_mode(gst_accu_check_mode,
+          gst_accu_confidence, gst_accu_error_rate);
+      workers[i].set_error_inject(gst_error_inject);
+      workers[i].set_error_frequency(gst_error_freq);
+      workers[i].set_error_count(gst_error_count);
+      workers[i].set_fault_injection(gst_fault_inject, gst_fault_seed);
+      workers[i].set_gemm_mode(gst_gemm_mode);
+      workers[i].set_batch_size(gst_batch_size);
+      workers[i].set_stride_a(gst_stride_a);
+      workers[i].set_stride_b(gst_stride_b);
+      workers[i].set_stride_c(gst_stride_c);
+      workers[i].set_stride_d(gst_stride_d);
+      workers[i].set_blas_source(gst_blas_source);
+      workers[i].set_compute_type(gst_compute_type);
+      workers[i].set_gst_out_data_type(gst_out_data_type);
+      workers[i].set_gst_scale_a(gst_scale_a);
+      workers[i].set_gst_scale_b(gst_scale_b);
+      workers[i].set_gst_rotating(gst_rotating);
+      workers[i].set_gst_rotating_mode(gst_rotating_mode);
+      workers[i].set_sweep(gst_sweep_points, gst_sweep_iterations,
+          gst_sweep_peak_gflops, gst_sweep_min_efficiency);
+
+      i++;
+    }
+
+    if (property_parallel) {
+      // host verification GEMMs of all workers share the CPU cores
+      rvs::hostgemm::set_concurrency(gst_gpus_device_index.size());
+      for (i = 0; i < gst_gpus_device_index.size(); i++)
+        workers[i].start();
+
+      // join threads
+      for (i = 0; i < gst_gpus_device_index.size(); i++)
+        workers[i].join();
+      rvs::hostgemm::set_concurrency(1);
+    } else {
+      for (i = 0; i < gst_gpus_device_index.size(); i++) {
+        workers[i].start();
+        workers[i].join();
+
+        // check if stop signal was received
+        if (rvs::lp::Stopping())
+          return false;
+      }
+    }
+
+    // check if stop signal was received
+    if (rvs::lp::Stopping())
+      return false;
+
+    if (property_count != 0) {
+      k++;
+      if (k == property_count)
+        break;
+    }
+  }
+
+  log_matrix_staging(stage_start);
+
+  if (rvs::lp::Stopping()) {
+    return false;
+  }
+  else {
+
+    for (size_t i = 0; i < gst_gpus_device_index.size(); i++) {
+      if(false == workers[i].get_result()) {
+        return false;
+      }
+    }
+  }
+
+  /* Action passed */
+  return true;
+}
+
+/**
+ * @brief logs host memory and time saved by sharing host matrices
+ * between the workers of this action
+ * @param start staging statistics before the workers started
+ */
+void gst_action::log_matrix_staging(const rvs::matrix_stage::stats_t& start) {
+  rvs::matrix_stage::stats_t end = rvs::matrix_stage::get_stats();
+  uint64_t generated = end.generated - start.generated;
+  uint64_t shared = end.shared - start.shared;
+  uint64_t mb_saved = (end.bytes_saved - start.bytes_saved) >> 20;
+  double sec_saved = end.seconds_saved - start.seconds_saved;
+  char sec_buff[32];
+
+  if (generated == 0)
+    return;
+
+  snprintf(sec_buff, sizeof(sec_buff), "%.3f", sec_saved);
+
+  string msg = "[" + action_name + "] " + MODULE_NAME + " " +
+    GST_MATRIX_STAGING_MSG + ": generated " + std::to_string(generated) +
+    " shared " + std::to_string(shared) + " host memory saved (MB) " +
+    std::to_string(mb_saved) + " init time saved (s) " + sec_buff;
+  rvs::lp::Log(msg, rvs::loginfo);
+
+  if (bjson) {
+    unsigned int sec;
+    unsigned int usec;
+    rvs::lp::get_ticks(&sec, &usec);
+    void *json_root_node = rvs::lp::LogRecordCreate(MODULE_NAME,
+        action_name.c_str(), rvs::loginfo, sec, usec, true);
+    if (!json_root_node) {
+      msg = std::string(JSON_CREATE_NODE_ERROR);
+      rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+      return;
+    }
+
+    rvs::lp::AddString(json_root_node, "matrix_sets_generated",
+        std::to_string(generated));
+    rvs::lp::AddString(json_root_node, "matrix_sets_shared",
+        std::to_string(shared));
+    rvs::lp::AddString(json_root_node, "host_memory_saved_mb",
+        std::to_string(mb_saved));
+    rvs::lp::AddString(json_root_node, "init_time_saved_s", sec_buff);
+    rvs::lp::LogRecordFlush(json_root_node, rvs::loginfo);
+  }
+}
+
+/**
+ * @brief reads all GST-related configuration keys from
+ * the module's properties collection
+ * @return true if no fatal error occured, false otherwise
+ */
+bool gst_action::get_all_gst_config_keys(void) {
+  int error;
+  string msg, ststress;
+  bool bsts = true;
+
+  if ((error =
+        property_get(RVS_CONF_TARGET_STRESS_KEY, &gst_target_stress)) &&
+      !(error == 2 && sweep_requested())) {
+    switch (error) {  // <target_stress> is mandatory => GST cannot continue
+      case 1:
+        msg = "invalid '" + std::string(RVS_CONF_TARGET_STRESS_KEY) +
+          "' key value " + ststress;
+        rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+        break;
+
+      case 2:
+        msg = "key '" + std::string(RVS_CONF_TARGET_STRESS_KEY) +
+          "' was not found";
+        rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    }
+    bsts = false;
+  } else if (error == 2) {
+    gst_target_stress = 0;  // not used by the shape sweep
+  }
+
+  if (property_get_int<uint64_t>(RVS_CONF_RAMP_INTERVAL_KEY,
+        &gst_ramp_interval, GST_DEFAULT_RAMP_INTERVAL)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_RAMP_INTERVAL_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_RAMP_WINDOW_KEY,
+      &gst_ramp_window, GST_DEFAULT_RAMP_WINDOW);
+  if (error == 1 || gst_ramp_window < 4) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_RAMP_WINDOW_KEY) + "' key value (at least 4)";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<float>(RVS_CONF_RAMP_PRECISION_KEY,
+      &gst_ramp_precision, GST_DEFAULT_RAMP_PRECISION);
+  if (error == 1 || gst_ramp_precision <= 0 || gst_ramp_precision >= 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_RAMP_PRECISION_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get_int<uint64_t>(RVS_CONF_RAMP_MIN_BATCH_KEY,
+        &gst_ramp_min_batch_ms, GST_DEFAULT_RAMP_MIN_BATCH)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_RAMP_MIN_BATCH_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get_int<uint64_t>(RVS_CONF_TELEMETRY_INTERVAL_KEY,
+        &gst_telemetry_interval, GST_DEFAULT_TELEMETRY_INTERVAL)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_TELEMETRY_INTERVAL_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<float>(RVS_CONF_DIP_THRESHOLD_KEY,
+      &gst_dip_threshold, GST_DEFAULT_DIP_THRESHOLD);
+  if (error == 1 || gst_dip_threshold <= 0 || gst_dip_threshold >= 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_DIP_THRESHOLD_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<std::string>(RVS_CONF_TELEMETRY_TRACE_KEY,
+      &gst_telemetry_trace, GST_DEFAULT_TELEMETRY_TRACE);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_TELEMETRY_TRACE_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get_int<uint64_t>(RVS_CONF_LOG_INTERVAL_KEY,
+        &property_log_interval, GST_DEFAULT_LOG_INTERVAL)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_LOG_INTERVAL_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get_int<int>(RVS_CONF_MAX_VIOLATIONS_KEY, &gst_max_violations,
+        GST_DEFAULT_MAX_VIOLATIONS)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_MAX_VIOLATIONS_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get(RVS_CONF_COPY_MATRIX_KEY, &gst_copy_matrix,
+        GST_DEFAULT_COPY_MATRIX)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_COPY_MATRIX_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get<float>(RVS_CONF_TOLERANCE_KEY, &gst_tolerance,
+        GST_DEFAULT_TOLERANCE)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_TOLERANCE_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get<std::string>(RVS_CONF_GST_OPS_TYPE, &gst_ops_type,
+        GST_DEFAULT_OPS_TYPE)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_GST_OPS_TYPE) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get<std::string>(RVS_CONF_GST_DATA_TYPE, &gst_data_type, GST_DEFAULT_DATA_TYPE)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_GST_DATA_TYPE) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_HOT_CALLS, &gst_hot_calls, GST_DEFAULT_HOT_CALLS);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_HOT_CALLS) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_WARM_CALLS, &gst_warm_calls, GST_DEFAULT_WARM_CALLS);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_WARM_CALLS) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_MATRIX_SIZE_KEYA, &gst_matrix_size_a, GST_DEFAULT_MATRIX_SIZE);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_MATRIX_SIZE_KEYA) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_MATRIX_SIZE_KEYB, &gst_matrix_size_b, GST_DEFAULT_MATRIX_SIZE);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_MATRIX_SIZE_KEYB) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_MATRIX_SIZE_KEYC, &gst_matrix_size_c, GST_DEFAULT_MATRIX_SIZE);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_MATRIX_SIZE_KEYC) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<std::string>(RVS_CONF_MATRIX_INIT, &gst_matrix_init, GST_DEFAULT_MATRIX_INIT);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_MATRIX_INIT) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  // random seed unless configured, logged so the run can be reproduced
+  error = property_get_int<uint64_t>(RVS_CONF_MATRIX_SEED, &gst_matrix_seed,
+      static_cast<uint64_t>(std::random_device{}()));
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_MATRIX_SEED) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<int>(RVS_CONF_TRANS_A, &gst_trans_a, GST_DEFAULT_TRANS_A);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_TRANS_A) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<int>(RVS_CONF_TRANS_B, &gst_trans_b, GST_DEFAULT_TRANS_B);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_TRANS_B) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<float>(RVS_CONF_ALPHA_VAL, &gst_alpha_val, GST_DEFAULT_ALPHA_VAL);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ALPHA_VAL) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<float>(RVS_CONF_BETA_VAL, &gst_beta_val, GST_DEFAULT_BETA_VAL);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_BETA_VAL) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<int>(RVS_CONF_LDA_OFFSET, &gst_lda_offset, GST_DEFAULT_LDA_OFFSET);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_LDA_OFFSET) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<int>(RVS_CONF_LDB_OFFSET, &gst_ldb_offset, GST_DEFAULT_LDB_OFFSET);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_LDB_OFFSET) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<int>(RVS_CONF_LDC_OFFSET, &gst_ldc_offset, GST_DEFAULT_LDC_OFFSET);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_LDC_OFFSET) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<int>(RVS_CONF_LDD_OFFSET, &gst_ldd_offset, GST_DEFAULT_LDD_OFFSET);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_LDD_OFFSET) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get(RVS_CONF_SELF_CHECK_KEY, &gst_self_check, GST_DEFAULT_SELF_CHECK)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_SELF_CHECK_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<std::string>(RVS_CONF_SELF_CHECK_MODE_KEY,
+      &gst_self_check_mode, GST_DEFAULT_SELF_CHECK_MODE);
+  if (error == 1 ||
+      (gst_self_check_mode != "norm" && gst_self_check_mode != "bitwise")) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_SELF_CHECK_MODE_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<int>(RVS_CONF_ALGO_AUTOTUNE_KEY,
+      &gst_algo_autotune, GST_DEFAULT_ALGO_AUTOTUNE);
+  if (error == 1 || gst_algo_autotune < 0) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ALGO_AUTOTUNE_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<std::string>(RVS_CONF_ALGO_CACHE_KEY,
+      &gst_algo_cache, GST_DEFAULT_ALGO_CACHE);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ALGO_CACHE_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get(RVS_CONF_ACCU_CHECK_KEY, &gst_accu_check, GST_DEFAULT_ACCU_CHECK)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ACCU_CHECK_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<std::string>(RVS_CONF_ACCU_CHECK_MODE_KEY,
+      &gst_accu_check_mode, GST_DEFAULT_ACCU_CHECK_MODE);
+  if (error == 1 || (gst_accu_check_mode != "full" &&
+        gst_accu_check_mode != "sample" && gst_accu_check_mode != "checksum")) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ACCU_CHECK_MODE_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get<float>(RVS_CONF_ACCU_CONFIDENCE_KEY, &gst_accu_confidence,
+        GST_DEFAULT_ACCU_CONFIDENCE) ||
+      !(gst_accu_confidence > 0 && gst_accu_confidence < 1)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ACCU_CONFIDENCE_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get<float>(RVS_CONF_ACCU_ERROR_RATE_KEY, &gst_accu_error_rate,
+        GST_DEFAULT_ACCU_ERROR_RATE) ||
+      !(gst_accu_error_rate > 0 && gst_accu_error_rate <= 1)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ACCU_ERROR_RATE_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get(RVS_CONF_ERROR_INJECT_KEY, &gst_error_inject, GST_DEFAULT_ERROR_INJECT)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ERROR_INJECT_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_ERROR_FREQUENCY_KEY, &gst_error_freq, GST_DEFAULT_ERROR_FREQUENCY);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ERROR_FREQUENCY_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_ERROR_COUNT_KEY, &gst_error_count, GST_DEFAULT_ERROR_COUNT);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ERROR_COUNT_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  std::vector<rvs::faultinject::rule_t> fault_rules;
+  string fault_error;
+  error = property_get<std::string>(RVS_CONF_FAULT_INJECT_KEY,
+      &gst_fault_inject, DEFAULT_FAULT_INJECT);
+  if (error == 1 ||
+      !rvs::faultinject::parse(gst_fault_inject, &fault_rules, &fault_error)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_FAULT_INJECT_KEY) + "' key value";
+    if (!fault_error.empty())
+      msg += ": " + fault_error;
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_FAULT_SEED_KEY, &gst_fault_seed,
+      DEFAULT_FAULT_SEED);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_FAULT_SEED_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<std::string>(RVS_CONF_GEMM_MODE, &gst_gemm_mode, GST_DEFAULT_GEMM_MODE);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_GEMM_MODE) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<int>(RVS_CONF_BATCH_SIZE, &gst_batch_size, GST_DEFAULT_BATCH_SIZE);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_STRIDE_A) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_STRIDE_A, &gst_stride_a, GST_DEFAULT_STRIDE_A);
+  if (error == 1) {
+    msg = "invalid '" + std::string(RVS_CONF_STRIDE_A) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_STRIDE_B, &gst_stride_b, GST_DEFAULT_STRIDE_B);
+  if (error == 1) {
+    msg = "invalid '" + std::string(RVS_CONF_STRIDE_B) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_STRIDE_C, &gst_stride_c, GST_DEFAULT_STRIDE_C);
+  if (error == 1) {
+    msg = "invalid '" + std::string(RVS_CONF_STRIDE_C) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint64_t>(RVS_CONF_STRIDE_D, &gst_stride_d, GST_DEFAULT_STRIDE_D);
+  if (error == 1) {
+    msg = "invalid '" + std::string(RVS_CONF_STRIDE_D) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<std::string>(RVS_CONF_BLAS_SOURCE_KEY, &gst_blas_source, GST_DEFAULT_BLAS_SOURCE);
+  if (error == 1) {
+    msg = "invalid '" + std::string(RVS_CONF_BLAS_SOURCE_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<std::string>(RVS_CONF_COMPUTE_TYPE_KEY, &gst_compute_type, GST_DEFAULT_COMPUTE_TYPE);
+  if (error == 1) {
+    msg = "invalid '" + std::string(RVS_CONF_COMPUTE_TYPE_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get<std::string>(RVS_CONF_GST_OUT_DATA_TYPE, &gst_out_data_type, GST_DEFAULT_OUT_DATA_TYPE)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_GST_OUT_DATA_TYPE) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<std::string>(RVS_CONF_SCALE_A, &gst_scale_a, GST_DEFAULT_SCALE_A);
+  if (error == 1) {
+    msg = "invalid '" + std::string(RVS_CONF_SCALE_A) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get<std::string>(RVS_CONF_SCALE_B, &gst_scale_b, GST_DEFAULT_SCALE_B);
+  if (error == 1) {
+    msg = "invalid '" + std::string(RVS_CONF_SCALE_B) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  error = property_get_int<uint32_t>(RVS_CONF_ROTATING, &gst_rotating, GST_DEFAULT_ROTATING);
+  if (error == 1) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ROTATING) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  std::string rotating_mode;
+  error = property_get<std::string>(RVS_CONF_ROTATING_MODE, &rotating_mode,
+      GST_DEFAULT_ROTATING_MODE);
+  if (error == 1 ||
+      !rvs::rotating_mode_parse(rotating_mode, &gst_rotating_mode)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_ROTATING_MODE) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get_int<uint64_t>(RVS_CONF_DURATION_KEY, &property_duration, GST_DEFAULT_DURATION)) {
+    msg = "Invalid '" + std::string(RVS_CONF_DURATION_KEY) +
+      "' key";
+    rvs::lp::Err(msg, module_name, action_name);
+    bsts = false;
+  }
+
+  /* If operation and data type both not set, default to sgemm */
+  if ((gst_ops_type == GST_DEFAULT_OPS_TYPE) && (gst_data_type == GST_DEFAULT_OPS_TYPE)) {
+    gst_ops_type = "sgemm";
+  }
+
+  if (!get_sweep_config_keys())
+    bsts = false;
+
+  if (property_duration > 0 && (property_duration < gst_ramp_interval)) {
+    msg = "'" +
+      std::string(RVS_CONF_DURATION_KEY) + "' cannot be less than '" +
+      std::string(RVS_CONF_RAMP_INTERVAL_KEY) + "'";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+#if !defined(RVS_ROCBLAS_HAS_F8_DATATYPES)
+  if (gst_blas_source == "rocblas") {
+    if(gst_data_type == "fp8_r") {
+      msg = "The version of rocBLAS currently in use no longer supports FP8.";
+      rvs::lp::Err(msg, MODULE_NAME, action_name);
+      bsts = false;
+    }
+  }
+#endif
+
+  return bsts;
+}
+
+/**
+ * @brief checks whether any of the GEMM shape sweep keys is configured
+ * @return true if the action runs in sweep mode
+ */
+bool gst_action::sweep_requested(void) {
+  for (auto key : {RVS_CONF_SWEEP_M_KEY, RVS_CONF_SWEEP_N_KEY,
+        RVS_CONF_SWEEP_K_KEY, RVS_CONF_SWEEP_TRANS_A_KEY,
+        RVS_CONF_SWEEP_TRANS_B_KEY, RVS_CONF_SWEEP_DATA_TYPE_KEY,
+        RVS_CONF_SWEEP_BATCH_KEY}) {
+    if (has_property(key))
+      return true;
+  }
+  return false;
+}
+
+/**
+ * @brief reads the GEMM shape sweep keys and expands the sweep points.
+ * Dimensions which are not swept keep the regular GST configuration.
+ * @return true if no fatal error occured, false otherwise
+ */
+bool gst_action::get_sweep_config_keys(void) {
+  std::vector<uint64_t> m, n, k, trans_a, trans_b, batch;
+  std::vector<std::string> dtypes;
+  std::string spec, msg;
+  bool bsts = true;
+
+  gst_sweep_points.clear();
+
+  if (property_get_int<uint64_t>(RVS_CONF_SWEEP_ITERATIONS_KEY,
+        &gst_sweep_iterations, GST_DEFAULT_SWEEP_ITERATIONS) ||
+      gst_sweep_iterations == 0) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_SWEEP_ITERATIONS_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get<float>(RVS_CONF_SWEEP_PEAK_KEY, &gst_sweep_peak_gflops,
+        GST_DEFAULT_SWEEP_PEAK) || gst_sweep_peak_gflops < 0) {
+    msg = "invalid '" + std::string(RVS_CONF_SWEEP_PEAK_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (property_get<float>(RVS_CONF_SWEEP_MIN_EFF_KEY, &gst_sweep_min_efficiency,
+        GST_DEFAULT_SWEEP_MIN_EFF) || gst_sweep_min_efficiency < 0) {
+    msg = "invalid '" + std::string(RVS_CONF_SWEEP_MIN_EFF_KEY) + "' key value";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    bsts = false;
+  }
+
+  if (!sweep_requested())
+    return bsts;
+
+  // value lists default to the single configured value
+  struct { const char* key; std::vector<uint64_t>* values; uint64_t def; }
+    lists[] = {
+      {RVS_CONF_SWEEP_M_KEY, &m, gst_matrix_size_a},
+      {RVS_CONF_SWEEP_N_KEY, &n, gst_matrix_size_b},
+      {RVS_CONF_SWEEP_K_KEY, &k, gst_matrix_size_c},
+      {RVS_CONF_SWEEP_TRANS_A_KEY, &trans_a, static_cast<uint64_t>(gst_trans_a)},
+      {RVS_CONF_SWEEP_TRANS_B_KEY, &trans_b, static_cast<uint64_t>(gst_trans_b)},
+      {RVS_CONF_SWEEP_BATCH_KEY, &batch, static_cast<uint64_t>(
+          gst_batch_size > 1 ? gst_batch_size : 1)},
+    };
+
+  for (auto& l : lists) {
+    if (!has_property(l.key, &spec)) {
+      l.values->push_back(l.def);
+      continue;
+    }
+    if (!rvs::gemm_sweep::parse_values(spec, l.values)) {
+      msg = "invalid '" + std::string(l.key) + "' key value";
+      rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+      bsts = false;
+      continue;
+    }
+    for (auto v : *l.values) {
+      bool trans = l.values == &trans_a || l.values == &trans_b;
+      if ((trans && v > 1) || (!trans && (v == 0 || v > INT32_MAX))) {
+        msg = "invalid '" + std::string(l.key) + "' key value";
+        rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+        bsts = false;
+        break;
+      }
+    }
+  }
+
+  if (has_property(RVS_CONF_SWEEP_DATA_TYPE_KEY, &spec)) {
+    dtypes = rvs::gemm_sweep::parse_names(spec);
+    if (dtypes.empty()) {
+      msg = "invalid '" +
+        std::string(RVS_CONF_SWEEP_DATA_TYPE_KEY) + "' key value";
+      rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+      bsts = false;
+    }
+  } else {
+    dtypes.push_back(!gst_data_type.empty() ? gst_data_type : gst_ops_type);
+  }
+
+  if (!bsts)
+    return false;
+
+  uint64_t points = 1;
+  for (size_t count : {m.size(), n.size(), k.size(), trans_a.size(),
+        trans_b.size(), dtypes.size(), batch.size()}) {
+    points = std::min<uint64_t>(points * count, GST_MAX_SWEEP_POINTS + 1);
+  }
+  if (points > GST_MAX_SWEEP_POINTS) {
+    msg = "GEMM sweep exceeds " + std::to_string(GST_MAX_SWEEP_POINTS) +
+      " points";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    return false;
+  }
+
+  gst_sweep_points = rvs::gemm_sweep::expand(m, n, k, trans_a, trans_b,
+      dtypes, batch);
+  return true;
+}
+
+/**
+ * @brief gets the number of ROCm compatible AMD GPUs
+ * @return run number of GPUs
+ */
+int gst_action::get_num_amd_gpu_devices(void) {
+  int hip_num_gpu_devices;
+  string msg;
+
+  hipGetDeviceCount(&hip_num_gpu_devices);
+  if (hip_num_gpu_devices == 0) {  // no AMD compatible GPU
+    msg = action_name + " " + MODULE_NAME + " " + GST_NO_COMPATIBLE_GPUS;
+    rvs::lp::Log(msg, rvs::logerror);
+
+    if (bjson) {
+      unsigned int sec;
+      unsigned int usec;
+      rvs::lp::get_ticks(&sec, &usec);
+      void *json_root_node = rvs::lp::LogRecordCreate(MODULE_NAME,
+          action_name.c_str(), rvs::logerror, sec, usec, true);
+      if (!json_root_node) {
+        // log the error
+        string msg = std::string(JSON_CREATE_NODE_ERROR);
+        rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+        return -1;
+      }
+
+      rvs::lp::AddString(json_root_node, "ERROR", GST_NO_COMPATIBLE_GPUS);
+      rvs::lp::LogRecordFlush(json_root_node, rvs::logerror);
+    }
+    return -1;
+  }
+  return hip_num_gpu_devices;
+}
+
+/**
+ * @brief gets all selected GPUs and starts the worker threads
+ * @return run result
+ */
+int gst_action::get_all_selected_gpus(void) {
+  int hip_num_gpu_devices;
+  bool amd_gpus_found = false;
+  map<int, uint16_t> gst_gpus_device_index;
+  std::string msg;
+
+  hip_num_gpu_devices = get_num_amd_gpu_devices();
+  if (hip_num_gpu_devices < 1)
+    return hip_num_gpu_devices;
+
+  amd_gpus_found = fetch_gpu_list(hip_num_gpu_devices, gst_gpus_device_index, 
+      property_device, property_device_id, property_device_all,
+      property_device_index, property_device_index_all); 
+  // iterate over all available & compatible AMD GPUs
+
+  if (amd_gpus_found) {
+    if (do_gpu_stress_test(gst_gpus_device_index))
+      return 0;
+
+    return -1;
+  } else {
+    msg = "No devices match criteria from the test configuration.";
+    rvs::lp::Err(msg, MODULE_NAME_CAPS, action_name);
+    return -1;
+  }
+
+  return 0;
+}
+
+
+/**
+ * @brief runs the whole GST logic
+ * @return run result
+ */
+int gst_action::run(void) {
+  string msg;
+  rvs::action_result_t action_result;
+
+  if (!get_all_common_config_keys())
+    return -1;
+  if (!get_all_gst_config_keys())
+    return -1;
+
+  if(bjson){
+    // add prelims for each action, dtype and target stress
+    json_add_primary_fields(std::string(MODULE_NAME), action_name);
+  }
+  auto res =  get_all_selected_gpus();
+  if(bjson){
+    rvs::lp::JsonActionEndNodeCreate();
+  }
+
+  action_result.state = rvs::actionstate::ACTION_COMPLETED;
+  action_result.status = (!res) ? rvs::actionstatus::ACTION_SUCCESS : rvs::actionstatus::ACTION_FAILED;
+  action_result.output = "GST Module action " + action_name + " completed";
+  action_callback(&action_result);
+
+  return res;
+}
+
+
@@ -0,0 +1,989 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2025 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/gst_worker.h"
+
+#include <unistd.h>
+#include <string>
+#include <memory>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <vector>
+#include "include/gpu_util.h"
+#include "include/rvs_blas.h"
+#include "include/rvs_module.h"
+#include "include/rvsloglp.h"
+#include "include/rvs_util.h"
+#include "include/rvstracer.h"
+
+#define MODULE_NAME                             "gst"
+
+#define GST_MEM_ALLOC_ERROR                     "memory allocation error!"
+#define GST_BLAS_ERROR                          "blas error !!!"
+#define GST_BLAS_MEMCPY_ERROR                   "HostToDevice mem copy error!"
+
+#define GST_MAX_GFLOPS_OUTPUT_KEY               "Gflop"
+#define GST_FLOPS_PER_OP_OUTPUT_KEY             "flops_per_op"
+#define GST_BYTES_COPIED_PER_OP_OUTPUT_KEY      "bytes_copied_per_op"
+#define GST_TRY_OPS_PER_SEC_OUTPUT_KEY          "try_ops_per_sec"
+
+#define GST_LOG_SELF_CHECK_ERROR_KEY            "self-check error"
+#define GST_LOG_ACCU_CHECK_ERROR_KEY            "accu-check error"
+#define GST_LOG_ACCU_CHECK_MISMATCH_KEY         "accu-check mismatch at"
+#define GST_LOG_MAX_MISMATCHES                  8
+#define GST_LOG_GFLOPS_INTERVAL_KEY             "GFLOPS"
+#define GST_LOG_MATRIX_SEED_KEY                 "matrix_seed"
+#define GST_LOG_ALGO_KEY                        "hipblaslt algo"
+#define GST_LOG_SWEEP_KEY                       "sweep"
+#define GST_LOG_RAMP_KEY                        "ramp"
+#define GST_LOG_DIP_KEY                         "GFLOPS dip"
+#define GST_LOG_TELEMETRY_KEY                   "telemetry"
+#define GST_LOG_VALIDATION_FAILED_KEY           "validation failed"
+#define GST_LOG_FAULT_INJECT_KEY                "fault injection"
+#define GST_LOG_ROTATING_KEY                    "rotating set"
+#define GST_JSON_LOG_GPU_ID_KEY                 "gpu_id"
+
+#define NMAX_MS_GPU_RUN_PEAK_PERFORMANCE        1000
+#define GST_MAX_MS_RAMP_SEARCH                  30000
+
+#define GST_COPY_MATRIX_MSG                     "copy matrix"
+#define GST_START_MSG                           "start"
+#define GST_PASS_KEY                            "pass"
+#define GST_RAMP_EXCEEDED_MSG                   "ramp time exceeded"
+#define GST_TARGET_ACHIEVED_MSG                 "target achieved"
+#define GST_STRESS_VIOLATION_MSG                "stress violation"
+#define GST_SWEEP_POINT_FAILED_MSG              "failed to run sweep point"
+const std::string TARGET_KEY{"target"};
+const std::string DTYPE_KEY{"dtype"};
+
+using std::string;
+
+bool GSTWorker::bjson = false;
+
+GSTWorker::GSTWorker()
+  : telemetry_timer(&GSTWorker::sample_telemetry, this),
+    telemetry_hdl(nullptr) {}
+GSTWorker::~GSTWorker() {
+  stop_telemetry();
+}
+
+/**
+ * @brief maps a failed stress engine run to the GST error
+ * @param outcome stress engine outcome
+ * @param error pointer to a memory location where the error code will be stored
+ * @param err_description stores the error description if any
+ * @return true if the run failed on a HIP/BLAS error
+ */
+static bool engine_error(rvs::gemm_outcome outcome, int *error,
+                         string *err_description) {
+  *error = 0;
+  switch (outcome) {
+    case rvs::gemm_outcome::copy_error:
+      *err_description = GST_BLAS_MEMCPY_ERROR;
+      break;
+    case rvs::gemm_outcome::gemm_error:
+    case rvs::gemm_outcome::validation_error:
+      *err_description = GST_BLAS_ERROR;
+      break;
+    default:
+      return false;
+  }
+  *error = 1;
+  return true;
+}
+
+/**
+ * @brief performs the rvsBlas setup
+ * @param error pointer to a memory location where the error code will be stored
+ * @param err_description stores the error description if any
+ */
+void GSTWorker::setup_blas(int *error, string *err_description) {
+
+  *error = 0;
+
+  // setup rvsBlas
+  gpu_blas = std::unique_ptr<rvs_blas>(
+      new rvs_blas(gpu_device_index, matrix_size_a, matrix_size_b,
+        matrix_size_c, matrix_init, gst_trans_a, gst_trans_b,
+        gst_alpha_val, gst_beta_val,
+        gst_lda_offset, gst_ldb_offset, gst_ldc_offset, gst_ldd_offset, gst_ops_type, gst_data_type,
+        gemm_mode, batch_size, stride_a, stride_b, stride_c, stride_d, blas_source, compute_type,
+        gst_out_data_type, gst_scale_a, gst_scale_b, gst_rotating, gst_hot_calls,
+        gst_rotating_mode));
+
+  if (!gpu_blas) {
+    *error = 1;
+    *err_description = GST_MEM_ALLOC_ERROR;
+    return;
+  }
+
+  if (gpu_blas->error()) {
+    *error = 1;
+    *err_description = GST_MEM_ALLOC_ERROR;
+    return;
+  }
+
+  gpu_blas->set_self_check_mode(self_check_mode);
+  gpu_blas->set_accu_check_mode(accu_check_mode, accu_confidence,
+                                accu_error_rate);
+  gpu_blas->set_matrix_seed(matrix_seed);
+
+  // schedule is replaced, the legacy error_inject rule is appended after it
+  if (!gpu_blas->set_fault_injection(fault_inject, fault_seed, err_description)) {
+    *error = 1;
+    return;
+  }
+
+  if (error_inject) {
+    gpu_blas->set_gemm_error(error_freq, error_count);
+  }
+
+  // record the seed so that the matrix data can be reproduced
+  auto desc = action_descriptor{action_name, MODULE_NAME, gpu_id};
+  std::string msg = "[" + action_name + "] [GPU:: " + std::to_string(gpu_id) +
+    "] " + GST_LOG_MATRIX_SEED_KEY + " " + std::to_string(matrix_seed);
+  rvs::lp::Log(msg, rvs::loginfo);
+  if (bjson)
+    log_to_json(desc, rvs::loginfo,
+        GST_LOG_MATRIX_SEED_KEY, std::to_string(matrix_seed));
+
+  // effective working set of the rotating buffers
+  if (blas_source == "hipblaslt" &&
+      (gst_rotating || gst_rotating_mode != rvs::rotating_mode::fixed)) {
+    const rvs::rotating_plan_t& rot = gpu_blas->get_rotating_plan();
+    msg = "[" + action_name + "] [GPU:: " + std::to_string(gpu_id) + "] " +
+      GST_LOG_ROTATING_KEY + " " + gpu_blas->get_rotating_summary();
+    rvs::lp::Log(msg, rvs::loginfo);
+    if (bjson)
+      log_to_json(desc, rvs::loginfo,
+          "rotating_mode", std::string(rvs::rotating_mode_name(gst_rotating_mode)),
+          "rotating_blocks", std::to_string(rot.blocks),
+          "rotating_working_set", std::to_string(rot.working_set),
+          "rotating_cold", std::string(rot.cold ? "true" : "false"));
+  }
+
+  // generate random matrix & copy it to the GPU (once unless copy_matrix)
+  if (rvs::gemm_prepare(gpu_blas.get(), copy_matrix) !=
+      rvs::gemm_outcome::completed) {
+    *error = 1;
+    *err_description = GST_BLAS_MEMCPY_ERROR;
+    return;
+  }
+
+  if (blas_source == "hipblaslt" && (algo_autotune > 1 || !algo_cache.empty())) {
+    // candidates are timed on the test matrices
+    if (copy_matrix && !gpu_blas->copy_data_to_gpu()) {
+      *error = 1;
+      *err_description = GST_BLAS_MEMCPY_ERROR;
+      return;
+    }
+
+    if (gpu_blas->select_matmul_algo(algo_autotune, algo_cache)) {
+      char time_buff[32];
+      snprintf(time_buff, sizeof(time_buff), "%.2f", gpu_blas->get_algo_time_us());
+
+      msg = "[" + action_name + "] [GPU:: " + std::to_string(gpu_id) + "] " +
+        GST_LOG_ALGO_KEY + " " + std::to_string(gpu_blas->get_algo_index()) +
+        " (" + gpu_blas->get_algo_source() + ") time (us) " + time_buff;
+      rvs::lp::Log(msg, rvs::loginfo);
+      if (bjson)
+        log_to_json(desc, rvs::loginfo,
+            "algo_index", std::to_string(gpu_blas->get_algo_index()),
+            "algo_source", gpu_blas->get_algo_source(),
+            "algo_time_us", std::string(time_buff));
+    }
+  }
+}
+
+/**
+ * @brief performs the ramp-up on the given GPU: runs warm calls until the
+ * throughput reaches steady state (rolling window confidence interval) and
+ * checks it against the target stress Gflops
+ * @param error pointer to a memory location where the error code will be stored
+ * @param err_description stores the error description if any
+ * @return true if the steady state Gflops meet the target stress,
+ * false otherwise
+ */
+bool GSTWorker::do_gst_ramp(int *error, string *err_description) {
+
+  // make sure that the ramp_interval & duration are not less than
+  // NMAX_MS_GPU_RUN_PEAK_PERFORMANCE (e.g.: 1000)
+  if (run_duration_ms > 0 && run_duration_ms < NMAX_MS_GPU_RUN_PEAK_PERFORMANCE)
+    run_duration_ms += NMAX_MS_GPU_RUN_PEAK_PERFORMANCE;
+
+  if (ramp_interval > 0 && ramp_interval < NMAX_MS_GPU_RUN_PEAK_PERFORMANCE)
+    ramp_interval += NMAX_MS_GPU_RUN_PEAK_PERFORMANCE;
+
+  // stage 1. setup rvs blas
+  setup_blas(error, err_description);
+  if (*error)
+    return false;
+
+  // check if stop signal was received
+  if (rvs::lp::Stopping())
+    return false;
+
+  // stage 2. run warm calls until the throughput is steady, at most for
+  // ramp_interval (GST_MAX_MS_RAMP_SEARCH if not set)
+  rvs::gemm_engine_config_t cfg;
+  cfg.duration_ms = ramp_interval ? ramp_interval : GST_MAX_MS_RAMP_SEARCH;
+  cfg.interval_ms = log_interval;
+  cfg.calls = gst_warm_calls;
+  cfg.copy_matrix = copy_matrix;
+  cfg.regenerate = true;
+  cfg.stopping = rvs::lp::Stopping;
+
+  rvs::gemm_ramp_config_t rc;
+  rc.target = target_stress;
+  rc.tolerance = tolerance;
+  rc.window = ramp_window;
+  rc.precision = ramp_precision;
+  rc.min_batch_ms = ramp_min_batch_ms;
+
+  rvs::gemm_ramp_control ctl(rc, gpu_blas->gemm_gflop_count());
+  rvs::gemm_no_validation val;
+  engine_hooks hooks{this};
+  rvs::gemm_engine<rvs_blas, rvs::gemm_ramp_control, rvs::gemm_no_validation,
+    engine_hooks> engine(gpu_blas.get(), cfg, &ctl, &val, &hooks);
+
+  if (engine_error(engine.run(), error, err_description))
+    return false;
+
+  ramp_actual_time = static_cast<uint64_t>(ctl.ramp_seconds() * 1e6);
+  log_ramp_result(ctl);
+  return ctl.target_met();
+}
+
+/**
+ * @brief logs the ramp time, steady state Gflops and their variation
+ * @param ctl ramp control policy after the ramp
+ */
+void GSTWorker::log_ramp_result(const rvs::gemm_ramp_control& ctl) {
+  char gpuid_buff[12];
+  snprintf(gpuid_buff, sizeof(gpuid_buff), "%5d", gpu_id);
+
+  string msg = "[" + action_name + "] " + "[GPU:: " + gpuid_buff + "] " +
+    GST_LOG_RAMP_KEY + " time(s): " + std::to_string(ctl.ramp_seconds()) +
+    " " + GST_LOG_GFLOPS_INTERVAL_KEY + ": " +
+    std::to_string(static_cast<uint64_t>(ctl.gflops())) +
+    " cv(%): " + std::to_string(ctl.cv() * 100) +
+    " batch: " + std::to_string(ctl.batch_calls()) +
+    " steady: " + (ctl.converged() ? "TRUE" : "FALSE");
+  rvs::lp::Log(msg, rvs::loginfo);
+
+  if (bjson) {
+    auto desc = action_descriptor{action_name, MODULE_NAME, gpu_id};
+    log_to_json(desc, rvs::loginfo,
+        "ramp_time_s", std::to_string(ctl.ramp_seconds()),
+        "ramp_gflops", std::to_string(ctl.gflops()),
+        "ramp_cv", std::to_string(ctl.cv()),
+        "ramp_batch", std::to_string(ctl.batch_calls()),
+        "ramp_steady", ctl.converged() ? "true" : "false");
+  }
+}
+
+/**
+ * @brief logs the Gflops computed over the last log_interval period 
+ * @param gflops_interval the Gflops that the GPU achieved
+ */
+void GSTWorker::check_target_stress(double gflops_interval) {
+  string msg;
+  rvs::action_result_t action_result;
+  char gpuid_buff[12];
+  auto desc = action_descriptor{action_name, MODULE_NAME,gpu_id};
+  snprintf(gpuid_buff, sizeof(gpuid_buff), "%5d", gpu_id);
+
+  if(gflops_interval >= (target_stress- (target_stress * tolerance))){
+    result = true;
+  }else{
+    result = false;
+  }
+
+  msg = "[" + action_name + "] " + "[GPU:: " + gpuid_buff + "] " +
+    GST_LOG_GFLOPS_INTERVAL_KEY + " " + std::to_string(static_cast<uint64_t>(gflops_interval)) + " " +
+    "Target GFLOPS:" + " " + std::to_string(static_cast<uint64_t>(target_stress)) +
+    " met: " + (result ? "TRUE" : "FALSE");
+  rvs::lp::Log(msg, rvs::logresults); 
+
+  action_result.state = rvs::actionstate::ACTION_RUNNING;
+  action_result.status = (true == result) ? rvs::actionstatus::ACTION_SUCCESS : rvs::actionstatus::ACTION_FAILED;
+  action_result.output = msg.c_str();
+  action.action_callback(&action_result);
+  if (bjson)
+      log_to_json(desc ,rvs::logresults,
+		      TARGET_KEY, std::to_string(static_cast<uint64_t>(target_stress)),
+		      DTYPE_KEY, !gst_data_type.empty() ? gst_data_type : gst_ops_type,
+		      "gflops", std::to_string(static_cast<uint64_t>(gflops_interval)),
+		      "pass", result ? "true" : "false");
+}
+
+/**
+ * @brief logs the Gflops computed over the last log_interval period 
+ * @param gflops_interval the Gflops that the GPU achieved
+ */
+void GSTWorker::log_interval_gflops(double gflops_interval) {
+  string msg;
+  rvs::action_result_t action_result;
+  char gpuid_buff[12];
+
+  snprintf(gpuid_buff, sizeof(gpuid_buff), "%5d", gpu_id);
+
+  msg = "[" + action_name + "] " + "[GPU:: " + gpuid_buff + "] " +
+    GST_LOG_GFLOPS_INTERVAL_KEY + " " + std::to_string(static_cast<uint64_t>(gflops_interval));
+  rvs::lp::Log(msg, rvs::logresults);
+
+  if (rvs::tracer::enabled()) {
+    rvs::tracer::counter("gst", rvs::tracer::intern("gflops GPU " +
+      std::to_string(gpu_id)), static_cast<int64_t>(gflops_interval));
+  }
+
+  action_result.state = rvs::actionstate::ACTION_RUNNING;
+  action_result.status = rvs::actionstatus::ACTION_SUCCESS;
+  action_result.output = msg.c_str();
+  action.action_callback(&action_result);
+
+  //log_to_json(GST_LOG_GFLOPS_INTERVAL_KEY, std::to_string(static_cast<uint64_t>(gflops_interval)),
+    //  rvs::loginfo);
+}
+
+/**
+ * @brief logs the batch time distribution of the last log_interval period
+ *
+ * Device (GPU event) times show how fast the GPU ran the GEMMs, the host
+ * overhead (mean host time - mean device time) how much launch, wait and
+ * scheduling added on top; a high device p99 or CV points to intermittent
+ * throttling that the interval GFLOPS average hides.
+ *
+ * @param iv interval statistics
+ */
+void GSTWorker::log_interval_batch_times(const rvs::gemm_interval_t& iv) {
+  char gpuid_buff[12];
+  snprintf(gpuid_buff, sizeof(gpuid_buff), "%5d", gpu_id);
+
+  // fall back to host times if the batches were not timed on the GPU
+  bool device = iv.device.samples > 0;
+  const rvs::gemm_batch_dist_t& d = device ? iv.device : iv.host;
+  double overhead_us = device ? iv.host.mean_us - iv.device.mean_us : 0;
+
+  string msg = "[" + action_name + "] " + "[GPU:: " + gpuid_buff + "] " +
+    "batch time(us) " + (device ? "device" : "host") +
+    " min: " + std::to_string(d.min_us) +
+    " median: " + std::to_string(d.median_us) +
+    " p99: " + std::to_string(d.p99_us) +
+    " max: " + std::to_string(d.max_us) +
+    " cv(%): " + std::to_string(d.cv * 100);
+  if (device)
+    msg += " host overhead(us): " + std::to_string(overhead_us);
+  rvs::lp::Log(msg, rvs::loginfo);
+
+  if (bjson) {
+    auto desc = action_descriptor{action_name, MODULE_NAME, gpu_id};
+    log_to_json(desc, rvs::loginfo,
+        "batch_timing", device ? "device" : "host",
+        "batch_samples", std::to_string(d.samples),
+        "batch_min_us", std::to_string(d.min_us),
+        "batch_median_us", std::to_string(d.median_us),
+        "batch_p99_us", std::to_string(d.p99_us),
+        "batch_max_us", std::to_string(d.max_us),
+        "batch_cv", std::to_string(d.cv),
+        "host_overhead_us", std::to_string(overhead_us));
+  }
+}
+
+/**
+ * @brief performs the stress test on the given GPU
+ * @param error pointer to a memory location where the error code will be stored
+ * @param err_description stores the error description if any
+ * @return true if the GPU completed the test, false otherwise
+ */
+bool GSTWorker::do_gst_stress_test(int *error, std::string *err_description) {
+
+  max_gflops = 0;
+
+  rvs::gemm_engine_config_t cfg;
+  cfg.duration_ms = run_duration_ms;
+  cfg.interval_ms = log_interval;
+  cfg.calls = gst_hot_calls;
+  cfg.copy_matrix = copy_matrix;
+  cfg.stopping = rvs::lp::Stopping;
+
+  rvs::gemm_duration_control ctl;
+  engine_hooks hooks{this};
+  rvs::gemm_engine<rvs_blas, rvs::gemm_duration_control, engine_hooks,
+    engine_hooks> engine(gpu_blas.get(), cfg, &ctl, &hooks, &hooks);
+
+  start_telemetry();
+  rvs::gemm_outcome outcome = engine.run();
+  max_gflops = engine.summary().max_gflops;
+  stop_telemetry();
+  log_telemetry_dips();
+
+  return !engine_error(outcome, error, err_description) &&
+    outcome != rvs::gemm_outcome::stopped;
+}
+
+// amdsmi_get_temp_metric returns whole or millidegrees C depending on stack
+static double smi_temperature_c(int64_t raw) {
+  int64_t mag = raw >= 0 ? raw : -raw;
+  return mag > 1000 ? raw / 1000.0 : static_cast<double>(raw);
+}
+
+/**
+ * @brief reads the telemetry of a GPU, unavailable values are left
+ * negative (throttle status 0)
+ * @param hdl amd-smi handle of the GPU
+ * @param s sample to fill in (t_us is set by the caller)
+ */
+static void read_telemetry(amdsmi_processor_handle hdl,
+                           rvs::telemetry_corr::sample_t* s) {
+  s->power_w = s->power_cap_w = s->temp_c = s->temp_limit_c = -1;
+  s->gfx_mhz = s->gfx_max_mhz = -1;
+  s->throttle = 0;
+
+  amdsmi_power_info_t pwr{};
+  if (amdsmi_get_power_info(hdl, &pwr) == AMDSMI_STATUS_SUCCESS)
+    s->power_w = pwr.socket_power;
+
+  amdsmi_power_cap_info_t cap{};
+  if (amdsmi_get_power_cap_info(hdl, 0, &cap) == AMDSMI_STATUS_SUCCESS &&
+      cap.power_cap > 0)
+    s->power_cap_w = cap.power_cap / 1e6;
+
+  amdsmi_temperature_type_t sensor = AMDSMI_TEMPERATURE_TYPE_JUNCTION;
+  int64_t temp = 0;
+  amdsmi_status_t stat = amdsmi_get_temp_metric(hdl, sensor,
+      AMDSMI_TEMP_CURRENT, &temp);
+  if (stat != AMDSMI_STATUS_SUCCESS) {
+    sensor = AMDSMI_TEMPERATURE_TYPE_EDGE;
+    stat = amdsmi_get_temp_metric(hdl, sensor, AMDSMI_TEMP_CURRENT, &temp);
+  }
+  if (stat == AMDSMI_STATUS_SUCCESS) {
+    s->temp_c = smi_temperature_c(temp);
+    if (amdsmi_get_temp_metric(hdl, sensor, AMDSMI_TEMP_CRITICAL, &temp) ==
+        AMDSMI_STATUS_SUCCESS && temp > 0)
+      s->temp_limit_c = smi_temperature_c(temp);
+  }
+
+  amdsmi_frequencies_t freqs{};
+  if (amdsmi_get_clk_freq(hdl, AMDSMI_CLK_TYPE_GFX, &freqs) ==
+      AMDSMI_STATUS_SUCCESS && freqs.num_supported > 0 &&
+      freqs.current < freqs.num_supported) {
+    s->gfx_mhz = freqs.frequency[freqs.current] / 1e6;
+    s->gfx_max_mhz = freqs.frequency[freqs.num_supported - 1] / 1e6;
+  }
+
+  amdsmi_gpu_metrics_t metrics{};
+  if (amdsmi_get_gpu_metrics_info(hdl, &metrics) == AMDSMI_STATUS_SUCCESS &&
+      metrics.throttle_status != UINT32_MAX)
+    s->throttle = metrics.throttle_status;
+}
+
+/**
+ * @brief starts sampling the GPU telemetry every telemetry_interval ms
+ * in the GEMM timebase
+ */
+void GSTWorker::start_telemetry(void) {
+  amdsmi_processor_handle hdl;
+
+  telemetry.clear();
+  if (telemetry_interval == 0)
+    return;
+
+  if (gpu_hip_to_smi_hdl(gpu_device_index, &hdl) != 0) {
+    string msg = "[" + action_name + "] " + MODULE_NAME + " " +
+      std::to_string(gpu_id) + " " + GST_LOG_TELEMETRY_KEY +
+      " not available (no amd-smi handle)";
+    rvs::lp::Log(msg, rvs::logerror);
+    return;
+  }
+
+  // sampled on the shared timer service, the first sample right away
+  telemetry_hdl = hdl;
+  telemetry_on = true;
+  sample_telemetry();
+  telemetry_timer.start(static_cast<int>(telemetry_interval));
+}
+
+/**
+ * @brief takes one telemetry sample (telemetry timer callback)
+ */
+void GSTWorker::sample_telemetry(void) {
+  rvs::telemetry_corr::sample_t s;
+  read_telemetry(telemetry_hdl, &s);
+  s.t_us = gpu_blas->get_time_us();
+  telemetry.add_sample(s);
+}
+
+/**
+ * @brief stops the telemetry sampling, waits for a sample in progress
+ */
+void GSTWorker::stop_telemetry(void) {
+  if (!telemetry_on)
+    return;
+  telemetry_timer.stop();
+  telemetry_on = false;
+}
+
+/**
+ * @brief annotates each GFLOPS dip of the stress test with the telemetry
+ * sampled during the interval and optionally saves the trace
+ */
+void GSTWorker::log_telemetry_dips(void) {
+  if (telemetry_interval == 0 || telemetry.get_samples().empty())
+    return;
+
+  char gpuid_buff[12];
+  snprintf(gpuid_buff, sizeof(gpuid_buff), "%5d", gpu_id);
+  string prefix = "[" + action_name + "] " + "[GPU:: " + gpuid_buff + "] ";
+  auto desc = action_descriptor{action_name, MODULE_NAME, gpu_id};
+
+  rvs::telemetry_corr::config_t cfg;
+  cfg.dip_threshold = dip_threshold;
+  std::vector<rvs::telemetry_corr::dip_t> dips = telemetry.analyze(cfg);
+  std::map<string, size_t> causes;
+
+  for (const auto& d : dips) {
+    string cause = rvs::telemetry_corr::cause_name(d.cause);
+    causes[cause]++;
+    rvs::lp::Log(prefix + GST_LOG_DIP_KEY + " " +
+        rvs::telemetry_corr::describe(d), rvs::loginfo);
+    if (bjson)
+      log_to_json(desc, rvs::loginfo,
+          "dip_interval", std::to_string(d.index),
+          "dip_gflops", std::to_string(d.interval.gflops),
+          "dip_drop", std::to_string(d.drop),
+          "dip_cause", cause,
+          "dip_power_w", std::to_string(d.max_power_w),
+          "dip_power_cap_w", std::to_string(d.power_cap_w),
+          "dip_temp_c", std::to_string(d.max_temp_c),
+          "dip_gfx_mhz", std::to_string(d.min_gfx_mhz),
+          "dip_throttle", std::to_string(d.throttle));
+  }
+
+  string msg = prefix + GST_LOG_TELEMETRY_KEY + " " +
+    std::to_string(telemetry.get_samples().size()) + " samples " +
+    std::to_string(dips.size()) + " dips";
+  for (const auto& c : causes)
+    msg += " " + c.first + ": " + std::to_string(c.second);
+  rvs::lp::Log(msg, rvs::logresults);
+
+  if (!telemetry_trace.empty()) {
+    string path = telemetry_trace + "." + std::to_string(gpu_id);
+    std::ofstream os(path);
+    if (!os || !telemetry.save(os))
+      rvs::lp::Log(prefix + GST_LOG_TELEMETRY_KEY + " trace " + path +
+          " not saved", rvs::logerror);
+  }
+}
+
+/**
+ * @brief validates the GEMM output of the last batch on the blas validation
+ * thread while the next GEMMs run
+ * @param iteration batch number
+ * @return false if the validation could not be started
+ */
+bool GSTWorker::engine_hooks::after_batch(uint64_t iteration) {
+  if (!worker->self_check && !worker->accu_check)
+    return true;
+
+  if (!worker->gpu_blas->validate_gemm_async(worker->self_check,
+        worker->accu_check, iteration))
+    return false;
+  worker->log_validation_results();
+  return true;
+}
+
+/**
+ * @brief waits for the pending GEMM output validations
+ */
+void GSTWorker::engine_hooks::finish(void) {
+  if (!worker->self_check && !worker->accu_check)
+    return;
+
+  worker->gpu_blas->wait_validation();
+  worker->log_validation_results();
+}
+
+/**
+ * @brief logs completed GEMM output validations
+ */
+void GSTWorker::log_validation_results(void) {
+
+  std::vector<rvs_blas::validation_result_t> results;
+  string msg;
+
+  gpu_blas->get_validation_results(&results);
+
+  for (auto& res : results) {
+
+    if(!res.valid) {
+      msg = "[" + action_name + "] " + "[GPU:: " + std::to_string(gpu_id) + "] " +
+        GST_LOG_VALIDATION_FAILED_KEY + " iteration " +
+        std::to_string(res.iteration);
+      rvs::lp::Log(msg, rvs::logresults);
+    }
+
+    if(res.self_error > 0) {
+
+      std::ostringstream oss;
+      oss << std::setprecision(10) << std::noshowpoint << std::fixed << res.self_error;
+
+      msg = "[" + action_name + "] " + "[GPU:: " + std::to_string(gpu_id) + "] " +
+        GST_LOG_SELF_CHECK_ERROR_KEY + " " + oss.str() +
+        " iteration " + std::to_string(res.iteration);
+      rvs::lp::Log(msg, rvs::logresults);
+    }
+
+    if(res.accu_error > 0) {
+
+      std::ostringstream oss;
+      oss << std::setprecision(10) << std::noshowpoint << std::fixed << res.accu_error;
+
+      msg = "[" + action_name + "] " + "[GPU:: " + std::to_string(gpu_id) + "] " +
+        GST_LOG_ACCU_CHECK_ERROR_KEY + " " + oss.str() +
+        " iteration " + std::to_string(res.iteration);
+      rvs::lp::Log(msg, rvs::logresults);
+
+      // report first few wrong element locations (-1 : not known)
+      size_t count = std::min(res.mismatches.size(), size_t(GST_LOG_MAX_MISMATCHES));
+      for (size_t i = 0; i < count; i++) {
+        msg = "[" + action_name + "] " + "[GPU:: " + std::to_string(gpu_id) + "] " +
+          GST_LOG_ACCU_CHECK_MISMATCH_KEY + " row " +
+          std::to_string(res.mismatches[i].row) + " col " +
+          std::to_string(res.mismatches[i].col);
+        rvs::lp::Log(msg, rvs::loginfo);
+      }
+    }
+  }
+}
+
+/**
+ * @brief logs detection statistics of the faults injected into the GEMM
+ * output validation (fault_inject/error_inject)
+ */
+void GSTWorker::log_fault_stats(void) {
+  rvs::faultinject::stats_t st = gpu_blas->get_fault_stats();
+  uint64_t injected = 0, detected = 0;
+
+  for (int k = 0; k < rvs::faultinject::fault_kinds; k++) {
+    injected += st.injected[k];
+    detected += st.detected[k];
+  }
+  if (injected == 0)
+    return;
+
+  auto desc = action_descriptor{action_name, MODULE_NAME, gpu_id};
+  string msg = "[" + action_name + "] " + "[GPU:: " + std::to_string(gpu_id) +
+    "] " + GST_LOG_FAULT_INJECT_KEY + " " + gpu_blas->get_fault_summary();
+  rvs::lp::Log(msg, rvs::loginfo);
+  if (bjson)
+    log_to_json(desc, rvs::loginfo, GST_LOG_FAULT_INJECT_KEY,
+        gpu_blas->get_fault_summary(), "detected",
+        std::to_string(detected) + "/" + std::to_string(injected));
+}
+
+/**
+ * @brief performs the stress test on the given GPU
+ */
+void GSTWorker::run() {
+  string msg, err_description;
+  int error = 0;
+  bool gst_test_passed = true;
+  rvs::action_result_t action_result;
+  char gpuid_buff[12];
+  auto desc = action_descriptor{action_name, MODULE_NAME, gpu_id};
+  max_gflops = 0;
+
+  snprintf(gpuid_buff, sizeof(gpuid_buff), "%5d", gpu_id);
+
+  if (rvs::tracer::enabled()) {
+    rvs::tracer::set_thread_name("gst GPU " + std::to_string(gpu_id));
+  }
+
+  // log GST stress test - start message
+  msg = "[" + action_name + "] " + MODULE_NAME + " " +
+    "[GPU:: " + gpuid_buff + "] "  + " " + GST_START_MSG + " " +
+    " Starting the GST stress test ";
+  rvs::lp::Log(msg, rvs::logtrace);
+
+  // sweep mode times each configured shape instead of the ramp/stress phases
+  if (!sweep_points.empty()) {
+    {
+      RVS_TRACE_SCOPE("gst", "gst_sweep");
+      result = do_gst_sweep(&error, &err_description);
+    }
+    if (rvs::lp::Stopping())
+      return;
+
+    msg = "[" + action_name + "] " + "[GPU:: " + gpuid_buff + "] " +
+      GST_LOG_SWEEP_KEY + " " + std::to_string(sweep_points.size()) +
+      " points " + GST_PASS_KEY + ": " + (result ? "TRUE" : "FALSE");
+    if (error)
+      msg += " " + err_description;
+    rvs::lp::Log(msg, result ? rvs::logresults : rvs::logerror);
+    if (bjson)
+      log_to_json(desc, rvs::logresults, GST_LOG_SWEEP_KEY,
+          std::to_string(sweep_points.size()), GST_PASS_KEY,
+          result ? "true" : "false");
+
+    action_result.state = rvs::actionstate::ACTION_COMPLETED;
+    action_result.status = result ? rvs::actionstatus::ACTION_SUCCESS :
+      rvs::actionstatus::ACTION_FAILED;
+    action_result.output = msg.c_str();
+    action.action_callback(&action_result);
+    return;
+  }
+
+  // log GST ramp up - start message
+  msg = "[" + action_name + "] " + "[GPU:: " + gpuid_buff + "] " +
+    "Start of GPU ramp up";
+  rvs::lp::Log(msg, rvs::logresults);
+
+  // let the GPU ramp-up and check the result
+  bool ramp_up_success;
+  {
+    RVS_TRACE_SCOPE("gst", "gst_ramp");
+    ramp_up_success = do_gst_ramp(&error, &err_description);
+  }
+
+  // log GST ramp up - end message
+  msg = "[" + action_name + "] " + "[GPU:: " + gpuid_buff + "] " +
+    "End of GPU ramp up";
+  rvs::lp::Log(msg, rvs::logresults);
+
+  // GPU was not able to do the processing (HIP/rocBlas error(s) occurred)
+  if (error) {
+    string msg = "[" + action_name + "] " + MODULE_NAME + " "
+      + std::to_string(gpu_id) + " " + err_description;
+    rvs::lp::Log(msg, rvs::logerror);
+    if (bjson)
+        log_to_json(desc ,rvs::logerror,"err", err_description);
+
+    action_result.state = rvs::actionstate::ACTION_COMPLETED;
+    action_result.status = rvs::actionstatus::ACTION_FAILED;
+    action_result.output = msg.c_str();
+    action.action_callback(&action_result);
+
+    return;
+  }
+
+  // the GPU succeeded to achieve the target_stress GFLOPS
+  // continue with the same workload for the rest of the test duration
+  msg = "[" + action_name + "] " + MODULE_NAME + " " +
+    std::to_string(gpu_id) + " " + " GST ramp completed for interval :" + " " +
+    std::to_string(ramp_interval);
+  rvs::lp::Log(msg, rvs::loginfo);
+
+  {
+    RVS_TRACE_SCOPE("gst", "gst_stress");
+    gst_test_passed = do_gst_stress_test(&error, &err_description);
+  }
+  // check if stop signal was received
+  if (rvs::lp::Stopping())
+    return;
+
+  log_fault_stats();
+
+  if (error) {
+    // GPU didn't complete the test (HIP/rocBlas error(s) occurred)
+    string msg = "[" + action_name + "] " + MODULE_NAME + " " +
+      std::to_string(gpu_id) + " " + err_description;
+    rvs::lp::Log(msg, rvs::logerror);
+    if (bjson)
+      log_to_json(desc, rvs::logerror,"err", err_description);
+
+    action_result.state = rvs::actionstate::ACTION_COMPLETED;
+    action_result.status = rvs::actionstatus::ACTION_FAILED;
+    action_result.output = msg.c_str();
+    action.action_callback(&action_result);
+
+    return;
+  }
+
+  check_target_stress(max_gflops);
+}
+
+/**
+ * @brief runs and times one GEMM shape of the sweep
+ * @param point GEMM shape
+ * @param res measurement of the point
+ * @return true if the point completed, false otherwise
+ */
+bool GSTWorker::run_sweep_point(const rvs::gemm_sweep::point_t& point,
+                                rvs::gemm_sweep::result_t* res) {
+  // ops_type names select the legacy s/d/hgemm path, anything else is a data_type
+  bool is_ops = point.dtype == "sgemm" || point.dtype == "dgemm" ||
+    point.dtype == "hgemm";
+  std::string ops_type = is_ops ? point.dtype : gst_ops_type;
+  std::string data_type = is_ops ? "" : point.dtype;
+  std::string mode = point.batch > 1 ? "strided_batched" : "";
+
+  res->point = point;
+  res->valid = false;
+  res->gflops = 0;
+  res->intensity = rvs::gemm_sweep::intensity(point);
+
+  // leading dimensions and strides of 0 are derived from the shape
+  std::unique_ptr<rvs_blas> blas(
+      new rvs_blas(gpu_device_index, point.m, point.n, point.k, matrix_init,
+        point.trans_a, point.trans_b, gst_alpha_val, gst_beta_val,
+        0, 0, 0, 0,
+        ops_type, data_type, mode, static_cast<int>(point.batch), 0, 0, 0, 0,
+        blas_source, compute_type, gst_out_data_type, gst_scale_a, gst_scale_b,
+        gst_rotating, gst_hot_calls, gst_rotating_mode));
+  if (!blas || blas->error())
+    return false;
+
+  blas->set_matrix_seed(matrix_seed);
+  if (rvs::gemm_prepare(blas.get(), false) != rvs::gemm_outcome::completed)
+    return false;
+
+  if (blas_source == "hipblaslt" && (algo_autotune > 1 || !algo_cache.empty()))
+    blas->select_matmul_algo(algo_autotune, algo_cache);
+
+  if (!blas->run_blas_gemm(gst_warm_calls) || !blas->is_gemm_op_complete())
+    return false;
+
+  // sweep_iterations batches of hot calls reported as a single interval
+  rvs::gemm_engine_config_t cfg;
+  cfg.max_batches = sweep_iterations;
+  cfg.interval_ms = UINT64_MAX / 1000;
+  cfg.calls = gst_hot_calls;
+  cfg.stopping = rvs::lp::Stopping;
+
+  rvs::gemm_duration_control ctl;
+  rvs::gemm_no_validation val;
+  rvs::gemm_no_logger log;
+  rvs::gemm_engine<rvs_blas, rvs::gemm_duration_control> engine(blas.get(),
+      cfg, &ctl, &val, &log);
+  if (engine.run() != rvs::gemm_outcome::completed)
+    return false;
+
+  res->gflops = engine.summary().gflops;
+  res->valid = res->gflops > 0;
+
+  return res->valid;
+}
+
+/**
+ * @brief runs the GEMM shape sweep and reports GFLOPS, percent of peak and
+ * arithmetic intensity of each point
+ * @param error pointer to a memory location where the error code will be stored
+ * @param err_description stores the error description if any
+ * @return true if every point completed (and met sweep_min_efficiency),
+ * false otherwise
+ */
+bool GSTWorker::do_gst_sweep(int *error, string *err_description) {
+  std::vector<rvs::gemm_sweep::result_t> results;
+  auto desc = action_descriptor{action_name, MODULE_NAME, gpu_id};
+  std::string arch;
+  int cu_count = 0, clock_khz = 0;
+  bool passed = true;
+  char buff[64];
+  string msg;
+
+  *error = 0;
+
+  hipDeviceProp_t props;
+  if (hipGetDeviceProperties(&props, gpu_device_index) == hipSuccess) {
+    arch = props.gcnArchName;
+    cu_count = props.multiProcessorCount;
+    clock_khz = props.clockRate;
+  }
+
+  for (const auto& point : sweep_points) {
+    if (rvs::lp::Stopping())
+      return false;
+
+    rvs::gemm_sweep::result_t res;
+    {
+      RVS_TRACE_SCOPE("gst", "gst_sweep_point");
+      run_sweep_point(point, &res);
+    }
+    if (rvs::lp::Stopping())
+      return false;
+
+    res.peak_gflops = sweep_peak_gflops > 0 ? sweep_peak_gflops :
+      rvs::gemm_sweep::peak_gflops(arch, cu_count, clock_khz, point.dtype);
+    double eff = rvs::gemm_sweep::efficiency(res);
+    results.push_back(res);
+
+    std::string shape = std::to_string(point.m) + "x" + std::to_string(point.n) +
+      "x" + std::to_string(point.k) + " " + (point.trans_a ? "T" : "N") +
+      (point.trans_b ? "T" : "N") + " " + point.dtype + " batch " +
+      std::to_string(point.batch);
+
+    if (!res.valid) {
+      passed = false;
+      msg = "[" + action_name + "] [GPU:: " + std::to_string(gpu_id) + "] " +
+        GST_LOG_SWEEP_KEY + " " + shape + " " + GST_SWEEP_POINT_FAILED_MSG;
+      rvs::lp::Log(msg, rvs::logerror);
+      if (bjson)
+        log_to_json(desc, rvs::logerror, "shape", shape,
+            "err", GST_SWEEP_POINT_FAILED_MSG);
+      continue;
+    }
+
+    if (sweep_min_efficiency > 0 && eff >= 0 && eff < sweep_min_efficiency)
+      passed = false;
+
+    snprintf(buff, sizeof(buff), "%.1f %.1f %.2f", res.gflops, eff,
+        res.intensity);
+    msg = "[" + action_name + "] [GPU:: " + std::to_string(gpu_id) + "] " +
+      GST_LOG_SWEEP_KEY + " " + shape + " GFLOPS/%peak/intensity " + buff;
+    rvs::lp::Log(msg, rvs::loginfo);
+    if (bjson) {
+      char gflops_buff[32], eff_buff[32], ai_buff[32];
+      snprintf(gflops_buff, sizeof(gflops_buff), "%.1f", res.gflops);
+      snprintf(eff_buff, sizeof(eff_buff), "%.1f", eff);
+      snprintf(ai_buff, sizeof(ai_buff), "%.2f", res.intensity);
+      log_to_json(desc, rvs::loginfo,
+          "m", std::to_string(point.m), "n", std::to_string(point.n),
+          "k", std::to_string(point.k),
+          "transa", std::to_string(point.trans_a),
+          "transb", std::to_string(point.trans_b),
+          DTYPE_KEY, point.dtype, "batch", std::to_string(point.batch),
+          "gflops", std::string(gflops_buff),
+          "peak_percent", std::string(eff_buff),
+          "intensity", std::string(ai_buff));
+    }
+  }
+
+  msg = "[" + action_name + "] [GPU:: " + std::to_string(gpu_id) + "] " +
+    GST_LOG_SWEEP_KEY + " " + arch + "\n" +
+    rvs::gemm_sweep::format_table(results);
+  rvs::lp::Log(msg, rvs::logresults);
+
+  if (results.empty()) {
+    *error = 1;
+    *err_description = GST_SWEEP_POINT_FAILED_MSG;
+    return false;
+  }
+
+  return passed;
+}
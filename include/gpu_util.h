@@ -45,6 +45,8 @@ extern void gpu_get_all_domain_id(std::vector<uint16_t>* pgpus_domain_id,
 extern bool gpu_check_if_mcm_die (int idx);
 extern int gpu_hip_to_smi_hdl(int hip_index, amdsmi_processor_handle* smi_index);
 extern int gpu_hip_to_node(int hip_index, int* node);
+extern int gpu_get_numa_node(uint16_t node_id, int* numa_node);
+extern int gpu_get_llc_size(uint16_t node_id, uint64_t* size, uint32_t* level);
 extern void gpu_get_all_pci_bdf(std::vector<std::string>& ppci_bdf);
 extern bool gpu_check_if_gpu_indexes (const std::vector <uint16_t> &idx);
 extern std::string gpu_get_platform_name (void);
@@ -0,0 +1,102 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_AFFINITY_H_
+#define INCLUDE_RVS_AFFINITY_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#define NUMA_SYS_PATH_NODES             "/sys/devices/system/node"
+
+namespace rvs {
+
+/**
+ * @class cpu_affinity_s
+ * @ingroup RVS
+ *
+ * @brief Thread placement descriptor
+ *
+ */
+typedef struct cpu_affinity_s {
+  //! OS NUMA node for host allocations, -1 for default memory policy
+  int numa_node = -1;
+  //! logical CPUs to run on, empty for no pinning
+  std::vector<int> cpus;
+} cpu_affinity_t;
+
+/**
+ * @class thread_placement_s
+ * @ingroup RVS
+ *
+ * @brief CPU affinity and memory policy of a thread (as saved/restored
+ * around tasks run on shared threads)
+ *
+ */
+typedef struct thread_placement_s {
+  //! logical CPUs the thread may run on
+  std::vector<int> cpus;
+  //! memory policy mode (MPOL_*) including mode flags
+  int mem_mode = 0;
+  //! memory policy node mask
+  std::vector<unsigned long> mem_nodes;  // NOLINT
+} thread_placement_t;
+
+/**
+ * @class affinity
+ * @ingroup RVS
+ *
+ * @brief NUMA/CPU affinity utility class
+ *
+ * Resolves the set of logical CPUs belonging to a NUMA node and binds
+ * the calling thread to a given CPU set.
+ *
+ */
+class affinity {
+ public:
+  static int parse_cpu_list(const std::string& str,
+                            std::vector<int>* pcpus);
+  static std::string cpu_list_to_string(const std::vector<int>& cpus);
+
+  static int numa_node_cpus(uint32_t numa_node, std::vector<int>* pcpus);
+  static int numa_node_count(void);
+  static int cpu_numa_nodes(std::vector<int>* pnodes,
+                            const std::string& root = NUMA_SYS_PATH_NODES);
+  static int cpu_node_to_numa_node(uint32_t cpu_ordinal, int* pnuma_node);
+
+  static int get_thread_affinity(std::vector<int>* pcpus);
+  static int set_thread_affinity(const std::vector<int>& cpus);
+  static int set_thread_mem_node(int numa_node);
+  static int get_thread_placement(thread_placement_t* pplacement);
+  static int set_thread_placement(const thread_placement_t& placement);
+
+  static int gpu_local_affinity(uint16_t node_id, cpu_affinity_t* paff);
+  static std::string to_string(const cpu_affinity_t& aff);
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_AFFINITY_H_
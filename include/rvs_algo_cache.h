@@ -0,0 +1,83 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_ALGO_CACHE_H_
+#define INCLUDE_RVS_ALGO_CACHE_H_
+
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace rvs {
+
+/**
+ * @class algo_cache
+ * @ingroup RVS
+ *
+ * @brief Persistent GEMM algorithm selection cache
+ *
+ * Maps a GEMM problem key (GPU architecture, library version, sizes,
+ * transposes, types, compute type and batch) to the index of the selected
+ * library algorithm and its measured time. The cache is a text file with
+ * one "key index time_us" line per problem; it is re-read before each
+ * update and replaced atomically (rename), so concurrent processes sharing
+ * the file do not lose entries or read partial files.
+ *
+ */
+class algo_cache {
+ public:
+  //! cached selection
+  struct entry_t {
+    //! library algorithm (solution) index
+    int index;
+    //! measured time of one GEMM in microseconds (0 - not tuned)
+    double time_us;
+  };
+
+  explicit algo_cache(const std::string& path);
+
+  bool lookup(const std::string& key, entry_t* entry);
+  bool store(const std::string& key, const entry_t& entry);
+  const std::string& get_path(void) { return path; }
+
+  static algo_cache& get(const std::string& path);
+  static std::string make_key(const std::string& key);
+
+ protected:
+  bool load(void);
+  bool save(void);
+
+  //! cache file
+  std::string path;
+  //! protects entries and the file
+  std::mutex mtx;
+  //! true once the file was read
+  bool loaded;
+  //! cached selections
+  std::map<std::string, entry_t> entries;
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_ALGO_CACHE_H_
@@ -43,7 +43,22 @@
 #include <hiprand/hiprand.h>
 
 #include <hipblaslt/hipblaslt.h>
+#include <condition_variable>
+#include <deque>
 #include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "include/rvs_algo_cache.h"
+#include "include/rvs_blas_plan.h"
+#include "include/rvs_faultinject.h"
+#include "include/rvs_gemmverify.h"
+#include "include/rvs_matrix_stage.h"
+#include "include/rvs_philox.h"
+#include "include/rvs_rotating.h"
+#include "include/rvsthreadpool.h"
+
 using std::map;
 
 #define RVS_BLAS_HIP_DATATYPE_INVALID static_cast<hipDataType>(0XFFFF)
@@ -66,7 +81,8 @@ class rvs_blas {
        std::string _ops_type, std::string _data_type, std::string _gemm_mode,
        int _batch_count, uint64_t stride_a, uint64_t stride_b, uint64_t stride_c, uint64_t stride_d,
        std::string _blas_source, std::string _compute_type, std::string _out_data_type,
-       std::string _scale_a, std::string _scale_b, uint32_t rotating, uint64_t _hot_calls);
+       std::string _scale_a, std::string _scale_b, uint32_t rotating, uint64_t _hot_calls,
+       rvs::rotating_mode _rotating_mode = rvs::rotating_mode::fixed);
     rvs_blas() = delete;
     rvs_blas(const rvs_blas&) = delete;
     rvs_blas& operator=(const rvs_blas&) = delete;
@@ -109,8 +125,64 @@ class rvs_blas {
     template <typename Ti, typename To> bool copy_data_to_gpu(void);
     bool run_blas_gemm(uint64_t num_calls);
     bool is_gemm_op_complete(void);
+    bool set_batch_timing(bool enable);
+    size_t get_batch_times_us(std::vector<double>* ptimes);
     bool validate_gemm(bool self_check, bool accu_check, double &self_error, double &accu_error);
+
+    //! result of asynchronous gemm output validation
+    struct validation_result_t {
+      //! caller supplied iteration the validated output came from
+      uint64_t iteration;
+      //! FALSE if validation could not be performed
+      bool valid;
+      //! relative F-norm self error
+      double self_error;
+      //! relative accuracy error
+      double accu_error;
+      //! locations of wrong elements found by accuracy check
+      std::vector<rvs::gemmverify::mismatch_t> mismatches;
+    };
+
+    bool validate_gemm_async(bool self_check, bool accu_check, uint64_t iteration);
+    size_t get_validation_results(std::vector<validation_result_t>* presults);
+    void wait_validation(void);
     void set_gemm_error(uint64_t _error_freq, uint64_t _error_count);
+    bool set_fault_injection(const std::string& spec, uint64_t seed,
+                             std::string* perror);
+    //! returns detection statistics of injected faults
+    rvs::faultinject::stats_t get_fault_stats(void) { return faults.get_stats(); }
+    //! returns detection statistics of injected faults as text
+    std::string get_fault_summary(void) { return faults.summary(); }
+    //! returns the rotating buffer set in use
+    const rvs::rotating_plan_t& get_rotating_plan(void) { return rotating_set; }
+    //! returns the rotating buffer set as text
+    std::string get_rotating_summary(void) {
+      return rvs::rotating_summary(rotating_cfg, rotating_set);
+    }
+    void set_accu_check_mode(const std::string& mode, double confidence,
+                             double error_rate);
+    //! sets self-check mode : norm or bitwise (early exit if identical)
+    void set_self_check_mode(const std::string& mode) { self_check_mode = mode; }
+    //! sets the seed of host matrix initialization
+    void set_matrix_seed(uint64_t seed) {
+      matrix_seed = seed;
+      matrix_generation = 0;
+      accu_check_count = 0;
+    }
+    //! returns the seed of host matrix initialization
+    uint64_t get_matrix_seed(void) { return matrix_seed; }
+    bool select_matmul_algo(int autotune, const std::string& cache_path);
+    //! returns how the hipBLASLt algorithm was selected
+    //! (heuristic, autotune or cache)
+    const std::string& get_algo_source(void) { return algo_source; }
+    //! returns the hipBLASLt algorithm (solution) index, -1 if unknown
+    int get_algo_index(void) { return algo_index; }
+    //! returns the tuned time of one GEMM in microseconds (0 - not timed)
+    double get_algo_time_us(void) { return algo_time_us; }
+    //! returns locations of wrong elements found by last accuracy check
+    const std::vector<rvs::gemmverify::mismatch_t>& get_accu_mismatches(void) {
+      return accu_mismatches;
+    }
 
     bool set_callback(rvsBlasCallback_t callback, void *user_data);
 
@@ -169,6 +241,8 @@ class rvs_blas {
     void *dsa;
     //! pointer to device scale B memory
     void *dsb;
+    //! device allocation holding every device matrix (rotating set)
+    void *drotating;
     //! pointer to host scale A memory
     void *hsa;
     //! pointer to host scale B memory
@@ -180,8 +254,6 @@ class rvs_blas {
     void *hpo;
     //! pointer to host (CPU) gemm output (host memory)
     void* hout;
-    //! pointer to device (GPU) gemm output (host memory)
-    void* hdout;
 
     //!GST Aplha Val 
     float blas_alpha_val;
@@ -209,12 +281,88 @@ class rvs_blas {
     //! rocBlas guard (prevents executing blass_gemm when there are mem errors)
     bool is_error;
 
-    // error injection frequency (number of gemm calls per error injection)
-    uint64_t error_freq;
-    // number of errors injected in gemm output
-    uint64_t error_count;
+    //! faults injected into host copies of gemm output
+    rvs::faultinject faults;
     // gemm check counter
     uint64_t check_count;
+    //! accuracy check counter (selects the sampled elements)
+    uint64_t accu_check_count;
+
+    //! host matrix initialization seed (hipRAND seed for hiprand init)
+    uint64_t matrix_seed;
+    //! number of times host matrices were initialized since seeding
+    uint64_t matrix_generation;
+    //! host matrices A, B, C shared with workers of the same configuration
+    std::shared_ptr<const rvs::matrix_stage::buffers_t> staged;
+
+    //! self-check mode : norm or bitwise
+    std::string self_check_mode;
+
+    //! accuracy check mode : full, sample or checksum
+    std::string accu_check_mode;
+    //! sampled accuracy check - probability of detecting wrong output
+    double accu_confidence;
+    //! sampled accuracy check - fraction of wrong elements to be detected
+    double accu_error_rate;
+    //! checksum accuracy check - predicted output row/column sums
+    rvs::gemmverify::checksums_t accu_checksums;
+    //! TRUE if accu_checksums match current input matrices
+    bool accu_checksums_valid;
+    //! locations of wrong elements found by last accuracy check
+    std::vector<rvs::gemmverify::mismatch_t> accu_mismatches;
+
+    //! number of gemm output snapshots in asynchronous validation pipeline
+    static const int VALIDATION_SLOTS = 2;
+
+    //! pending asynchronous validation
+    struct validation_job_t {
+      //! snapshot slot
+      int slot;
+      //! caller supplied iteration
+      uint64_t iteration;
+      //! self-check requested
+      bool self_check;
+      //! accuracy-check requested
+      bool accu_check;
+    };
+
+    //! stream used to copy gemm output snapshots to host
+    hipStream_t val_stream;
+    //! host (pinned) gemm output snapshots
+    void* hval[VALIDATION_SLOTS];
+    //! recorded on gemm stream once gemm output is ready to be copied
+    hipEvent_t val_gemm_done[VALIDATION_SLOTS];
+    //! recorded on copy stream once gemm output snapshot is on host
+    hipEvent_t val_copy_done[VALIDATION_SLOTS];
+    //! TRUE while snapshot in slot waits for or undergoes validation
+    bool val_busy[VALIDATION_SLOTS];
+    //! slot to be used for next snapshot
+    int val_next_slot;
+    //! TRUE if validation task is to exit
+    bool val_stop;
+    //! validation task (blocking task on the shared thread pool)
+    rvs::PooledThread val_task;
+    //! guards validation jobs, results and slot states
+    std::mutex val_mutex;
+    //! signals validation job/result/slot state changes
+    std::condition_variable val_cv;
+    //! validations waiting for validation task
+    std::deque<validation_job_t> val_jobs;
+    //! validations completed and not yet collected
+    std::vector<validation_result_t> val_results;
+
+    //! number of timed gemm batches that can wait for collection
+    static const int BATCH_TIMING_SLOTS = 16;
+    //! TRUE if each gemm batch is timed with GPU events
+    bool batch_timing;
+    //! recorded on gemm stream before each batch
+    hipEvent_t batch_start[BATCH_TIMING_SLOTS];
+    //! recorded on gemm stream after each batch
+    hipEvent_t batch_stop[BATCH_TIMING_SLOTS];
+    //! slot of the oldest batch not yet collected
+    int batch_first;
+    //! number of timed batches not yet collected
+    int batch_pending;
 
     //! gemm mode : basic (single), batched or strided batched
     std::string gemm_mode;
@@ -274,7 +422,47 @@ class rvs_blas {
     //! Create hipblaslt matrix multiply descriptor
     std::vector <hipblasLtMatmulDesc_t> hbl_matmul;
 
+    //! number of rotating buffer blocks
     uint64_t block_count;
+    //! rotating buffer set sizing parameters
+    rvs::rotating_config_t rotating_cfg;
+    //! rotating buffer set in use
+    rvs::rotating_plan_t rotating_set;
+
+    //! GEMM configuration resolved at construction
+    rvs::blas_plan plan;
+    //! GEMM launch function bound to plan
+    rvs::blas_plan::launch_fn_t<rvs_blas> gemm_launch;
+
+    //! alpha/beta scalar in each launch compute type
+    struct launch_scalar_t {
+      //! fp32
+      float f;
+      //! fp64
+      double d;
+      //! fp16
+      _Float16 h;
+      //! int32
+      int32_t i;
+    };
+    //! rocblas_gemm_ex matrix data type
+    rocblas_datatype ex_datatype;
+    //! alpha in launch compute types
+    launch_scalar_t launch_alpha;
+    //! beta in launch compute types
+    launch_scalar_t launch_beta;
+    //! hipblaslt alpha in compute type
+    const void* hbl_alpha_p;
+    //! hipblaslt beta in compute type
+    const void* hbl_beta_p;
+    //! hipblaslt matrix A of each rotating block
+    std::vector<void*> hbl_block_a;
+    //! hipblaslt matrix B of each rotating block
+    std::vector<void*> hbl_block_b;
+    //! hipblaslt matrix C of each rotating block
+    std::vector<void*> hbl_block_c;
+    //! hipblaslt matrix D of each rotating block
+    std::vector<void*> hbl_block_d;
 
     //! Transpose matrix A
     hipblasOperation_t hbl_trans_a;
@@ -312,6 +500,14 @@ class rvs_blas {
 
     //! hipblaslt heuristic algorithm result
     hipblasLtMatmulHeuristicResult_t hbl_heuristic_result;
+    //! allocated hipblaslt workspace size
+    size_t hbl_workspace_size;
+    //! selected algorithm : heuristic, autotune or cache
+    std::string algo_source;
+    //! selected algorithm (solution) index
+    int algo_index;
+    //! tuned time of one GEMM in microseconds
+    double algo_time_us;
 
     //! number of gemm calls at once
     uint64_t hot_calls;
@@ -320,16 +516,52 @@ class rvs_blas {
     bool allocate_gpu_matrix_mem(void);
     template <typename Ti, typename To> bool allocate_gpu_matrix_mem(void);
     void release_gpu_matrix_mem(void);
+    void get_rotating_limits(void);
 
     bool allocate_host_matrix_mem(void);
     void release_host_matrix_mem(void);
-    float fast_pseudo_rand(uint64_t *nextr, size_t i);
+    bool get_matmul_heuristics(int count,
+        std::vector<hipblasLtMatmulHeuristicResult_t>* presults);
+    bool set_matmul_algo(const hipblasLtMatmulHeuristicResult_t& result);
+    bool time_matmul_algo(const hipblasLtMatmulHeuristicResult_t& result,
+        double* ptime_us);
+    std::string matmul_algo_key(void);
+    bool host_matrices_staged(void);
+    static void* stage_alloc(size_t bytes, bool* pinned);
+    static void stage_free(void* ptr, bool pinned);
+    static uint64_t default_matrix_seed(void);
+    rvs::philox::params_t init_params(uint64_t stream);
+    template <typename Tab, typename Tc> void init_host_matrices(void);
+
+    void bind_gemm_launch(void);
+    static bool launch_none(rvs_blas* blas, uint64_t call);
+    template <bool strided> static bool launch_sgemm(rvs_blas* blas, uint64_t call);
+    template <bool strided> static bool launch_dgemm(rvs_blas* blas, uint64_t call);
+    template <bool strided> static bool launch_hgemm(rvs_blas* blas, uint64_t call);
+    template <bool strided> static bool launch_gemm_ex(rvs_blas* blas, uint64_t call);
+    template <bool strided> static bool launch_gemm_ex3(rvs_blas* blas, uint64_t call);
+    static bool launch_matmul(rvs_blas* blas, uint64_t call);
+
+    bool get_validation_output(void** pout, size_t* psize, size_t* pelem_size);
+    bool validate_gemm_output(void** phost, bool self_check, bool accu_check,
+                              double &self_error, double &accu_error);
+    bool init_async_validation(size_t size, size_t elem_size);
+    void release_async_validation(void);
+    void release_batch_timing(void);
+    void validation_thread(void);
+
+    template <typename T>
+      bool validate_output(void** phost, size_t size, bool self_check,
+                           bool accu_check, double &self_error, double &accu_error);
+
+    template <typename T>
+      bool check_result_consistency(const void * hcur, double &error);
 
     template <typename T>
-      bool check_result_consistency(void * dout, size_t size, double &error);
+      bool check_result_accuracy(const void * hcur, size_t size, double &error);
 
     template <typename T>
-      bool check_result_accuracy(void * dout, size_t size, double &error);
+      rvs::faultinject::layout_t output_layout(void);
 
     hipDataType datatype_to_hip_datatype(const std::string& datatype)
     {
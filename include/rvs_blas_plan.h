@@ -0,0 +1,141 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_BLAS_PLAN_H_
+#define INCLUDE_RVS_BLAS_PLAN_H_
+
+#include <stdint.h>
+
+#include <string>
+
+namespace rvs {
+
+/**
+ * @class blas_plan
+ * @ingroup RVS
+ *
+ * @brief GEMM configuration resolved once from configuration strings
+ *
+ * rvs_blas resolves backend, operation, batching mode and matrix init
+ * method into this plan at construction and binds a launch function for
+ * it, so the per launch and per matrix element host paths do not compare
+ * strings.
+ *
+ */
+class blas_plan {
+ public:
+  //! BLAS backend
+  enum backend_t {
+    backend_none = 0,
+    backend_rocblas,
+    backend_hipblaslt
+  };
+
+  //! GEMM operation (rocBLAS API used)
+  enum op_t {
+    op_none = 0,
+    //! rocblas_sgemm
+    op_sgemm,
+    //! rocblas_dgemm
+    op_dgemm,
+    //! rocblas_hgemm
+    op_hgemm,
+    //! rocblas_gemm_ex3 fp8
+    op_fp8,
+    //! rocblas_gemm_ex fp16
+    op_fp16,
+    //! rocblas_gemm_ex bf16
+    op_bf16,
+    //! hipblasLtMatmul (types in matmul descriptor)
+    op_matmul
+  };
+
+  //! host matrix init method
+  enum init_t {
+    //! linear congruential generator
+    init_default = 0,
+    //! small random integers
+    init_rand,
+    //! sin(i)
+    init_trig,
+    //! device side hiprand
+    init_hiprand
+  };
+
+  //! random integer range for init_rand
+  enum rand_range_t {
+    //! [1, 2]
+    rand_1_2 = 0,
+    //! [-2, 2]
+    rand_m2_2,
+    //! [1, 3]
+    rand_1_3,
+    //! [1, 10]
+    rand_1_10
+  };
+
+  //! launch function bound by plan owner
+  template <typename Ctx>
+  using launch_fn_t = bool (*)(Ctx* ctx, uint64_t call);
+
+  blas_plan();
+
+  static blas_plan resolve(const std::string& blas_source,
+                           const std::string& ops_type,
+                           const std::string& data_type,
+                           const std::string& gemm_mode,
+                           const std::string& matrix_init);
+
+  /**
+   * @brief Launch num_calls GEMMs through bound launch function
+   *
+   * @param fn launch function
+   * @param ctx launch function context
+   * @param num_calls number of launches
+   * @return false if any launch failed
+   */
+  template <typename Ctx>
+  static bool run(launch_fn_t<Ctx> fn, Ctx* ctx, uint64_t num_calls) {
+    for (uint64_t i = 0; i < num_calls; i++) {
+      if (!fn(ctx, i))
+        return false;
+    }
+    return true;
+  }
+
+  //! BLAS backend
+  backend_t backend;
+  //! GEMM operation
+  op_t op;
+  //! TRUE for strided batched GEMM
+  bool strided;
+  //! host matrix init method
+  init_t init;
+  //! random integer range for init_rand
+  rand_range_t rand_range;
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_BLAS_PLAN_H_
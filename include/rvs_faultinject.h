@@ -0,0 +1,240 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_FAULTINJECT_H_
+#define INCLUDE_RVS_FAULTINJECT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace rvs {
+
+/**
+ * @class faultinject
+ * @ingroup RVS
+ *
+ * @brief Deterministic host side fault injection for validation paths
+ *
+ * A schedule of rules, given as text (e.g.
+ * "bitflip:every=10,count=2;nan:prob=0.01,start=5;copyfail:every=50"),
+ * decides for every check of a verification path which faults are
+ * injected into the host copy of the data about to be verified: zeroed
+ * elements, bit flips, stuck-at values, NaN/Inf, delayed results or copy
+ * failures. Every decision (whether a rule fires, which elements and bits
+ * are hit) is drawn from Philox4x32-10 keyed by the seed and indexed by
+ * (check, rule, draw), so a schedule replays identically for a given seed
+ * regardless of timing or threads.
+ *
+ * The caller reports the outcome of each check (report()); every fault
+ * injected up to that check is then counted as detected or missed, which
+ * gives the detection rate, false-negative rate and detection latency (in
+ * checks and in time) of the verification mode under test. Faults hit
+ * only elements a check is expected to cover: for matrices (layout rows and
+ * leading dimension) padding between columns is skipped.
+ *
+ */
+class faultinject {
+ public:
+  //! fault kind
+  enum kind_t {
+    //! consecutive elements set to zero
+    fault_zero = 0,
+    //! single bits flipped
+    fault_bitflip,
+    //! elements stuck at a value
+    fault_stuck,
+    //! elements set to NaN
+    fault_nan,
+    //! elements set to Inf
+    fault_inf,
+    //! result delivered late (check sleeps)
+    fault_delay,
+    //! copy of the result fails
+    fault_copy_fail,
+    //! number of kinds
+    fault_kinds
+  };
+
+  //! one rule of the schedule
+  struct rule_t {
+    //! fault kind
+    kind_t kind;
+    //! fires on checks where check % every == 0 (0 - use probability)
+    uint64_t every;
+    //! probability of firing on a check (every == 0)
+    double probability;
+    //! first check the rule may fire on
+    uint64_t start;
+    //! maximum number of injections (0 - unlimited)
+    uint64_t limit;
+    //! elements (zero, stuck, NaN, Inf) or bits (bitflip) hit per injection
+    uint64_t count;
+    //! first element hit (-1 - random)
+    int64_t index;
+    //! bit flipped (-1 - random)
+    int32_t bit;
+    //! stuck-at value (element bits)
+    uint64_t value;
+    //! delay in milliseconds
+    uint32_t delay_ms;
+  };
+
+  //! element encoding of the data faults are injected into
+  struct layout_t {
+    //! element size in bytes (1 to 8)
+    size_t elem_size;
+    //! element has a NaN encoding
+    bool has_nan;
+    //! element has an Inf encoding
+    bool has_inf;
+    //! NaN bits
+    uint64_t nan_bits;
+    //! Inf bits
+    uint64_t inf_bits;
+    //! column major matrix rows (0 - contiguous elements)
+    size_t rows;
+    //! leading dimension of the matrix in elements
+    size_t ld;
+  };
+
+  //! faults injected into one check
+  struct action_t {
+    //! data was modified
+    bool corrupted;
+    //! caller must treat the copy of the result as failed
+    bool copy_fail;
+    //! milliseconds the check was delayed by
+    uint32_t delay_ms;
+    //! elements modified
+    uint64_t elements;
+  };
+
+  //! detection statistics
+  struct stats_t {
+    //! checks reported
+    uint64_t checks;
+    //! injections per kind
+    uint64_t injected[fault_kinds];
+    //! injections detected per kind
+    uint64_t detected[fault_kinds];
+    //! injections missed per kind
+    uint64_t missed[fault_kinds];
+    //! sum of detection latencies in checks
+    uint64_t latency_checks;
+    //! largest detection latency in checks
+    uint64_t max_latency_checks;
+    //! sum of detection latencies in seconds
+    double latency_s;
+    //! largest detection latency in seconds
+    double max_latency_s;
+  };
+
+  faultinject();
+
+  static bool parse(const std::string& spec, std::vector<rule_t>* prules,
+                    std::string* perror);
+  static const char* kind_name(kind_t kind);
+
+  bool configure(const std::string& spec, uint64_t seed,
+                 std::string* perror = nullptr);
+  void add_rule(const rule_t& rule);
+  void set_seed(uint64_t seed);
+  bool enabled(void) const;
+
+  action_t inject(uint64_t check, void* data, size_t elems,
+                  const layout_t& layout);
+  void report(uint64_t check, bool detected);
+
+  stats_t get_stats(void) const;
+  std::string summary(void) const;
+
+  /**
+   * @brief Element layout of type T (NaN/Inf as produced by converting
+   * float NaN/Inf to T)
+   *
+   * */
+  template <typename T>
+  static layout_t layout_of() {
+    layout_t l = {sizeof(T), false, false, 0, 0, 0, 0};
+
+    if constexpr (std::is_floating_point<T>::value) {
+      T nan = std::numeric_limits<T>::quiet_NaN();
+      T inf = std::numeric_limits<T>::infinity();
+      memcpy(&l.nan_bits, &nan, sizeof(T));
+      memcpy(&l.inf_bits, &inf, sizeof(T));
+      l.has_nan = l.has_inf = true;
+    } else if constexpr (!std::is_integral<T>::value) {
+      T nan = static_cast<T>(std::numeric_limits<float>::quiet_NaN());
+      T inf = static_cast<T>(std::numeric_limits<float>::infinity());
+      memcpy(&l.nan_bits, static_cast<const void*>(&nan), sizeof(T));
+      memcpy(&l.inf_bits, static_cast<const void*>(&inf), sizeof(T));
+      l.has_nan = std::isnan(static_cast<float>(nan));
+      l.has_inf = std::isinf(static_cast<float>(inf));
+    }
+    return l;
+  }
+
+ protected:
+  //! fault injected and not yet reported
+  struct pending_t {
+    //! check the fault was injected on
+    uint64_t check;
+    //! injection time
+    std::chrono::steady_clock::time_point time;
+    //! fault kind
+    kind_t kind;
+  };
+
+  void draw(uint64_t check, uint32_t rule, uint32_t index,
+            uint32_t out[4]) const;
+  uint64_t apply(const rule_t& rule, uint64_t check, uint32_t rule_idx,
+                 uint8_t* data, size_t elems, const layout_t& layout);
+
+  //! protects all members (inject and report may run on other threads)
+  mutable std::mutex mtx;
+  //! schedule
+  std::vector<rule_t> rules;
+  //! injections per rule
+  std::vector<uint64_t> fired;
+  //! Philox key
+  uint64_t seed;
+  //! faults waiting for report()
+  std::deque<pending_t> pending;
+  //! statistics
+  stats_t stats;
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_FAULTINJECT_H_
@@ -0,0 +1,475 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_GEMM_ENGINE_H_
+#define INCLUDE_RVS_GEMM_ENGINE_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <vector>
+
+//! batch times kept per reporting interval for the time distribution
+#define GEMM_BATCH_RING_SIZE                    4096
+
+namespace rvs {
+
+//! distribution of the GEMM batch times of a reporting interval
+struct gemm_batch_dist_t {
+  //! batches the distribution is computed over
+  uint64_t samples;
+  //! fastest batch in microseconds
+  double min_us;
+  //! median batch time in microseconds
+  double median_us;
+  //! 99th percentile of the batch time in microseconds
+  double p99_us;
+  //! slowest batch in microseconds
+  double max_us;
+  //! mean batch time in microseconds
+  double mean_us;
+  //! coefficient of variation (standard deviation / mean)
+  double cv;
+};
+
+/**
+ * @class gemm_batch_ring
+ * @ingroup RVS
+ *
+ * @brief Ring buffer of batch times of a reporting interval
+ *
+ * Once full the oldest batch times are overwritten, so the distribution
+ * covers the last GEMM_BATCH_RING_SIZE batches of the interval.
+ *
+ */
+class gemm_batch_ring {
+ public:
+  explicit gemm_batch_ring(size_t capacity = GEMM_BATCH_RING_SIZE);
+
+  void add(double batch_us);
+  //! drops all the batch times
+  void clear(void) { next = 0; count = 0; }
+  //! returns the number of batch times held
+  size_t size(void) const { return count; }
+  gemm_batch_dist_t distribution(void) const;
+
+ protected:
+  //! batch times in microseconds
+  std::vector<double> buf;
+  //! slot of the next batch time
+  size_t next;
+  //! number of batch times held
+  size_t count;
+};
+
+//! statistics of one reporting interval of a GEMM stress run
+struct gemm_interval_t {
+  //! interval number (0 based)
+  uint64_t index;
+  //! seconds since the start of the run at the end of the interval
+  double elapsed_s;
+  //! Blas get_time_us() at the end of the interval in microseconds
+  double end_us;
+  //! wall time of the interval in seconds
+  double seconds;
+  //! GEMMs completed in the interval
+  uint64_t gemms;
+  //! GEMM batches completed in the interval
+  uint64_t batches;
+  //! GFLOPS over the time spent in GEMM batches
+  double gflops;
+  //! fastest batch in microseconds
+  double min_batch_us;
+  //! mean batch time in microseconds
+  double mean_batch_us;
+  //! slowest batch in microseconds
+  double max_batch_us;
+  //! host (launch to completion) batch time distribution
+  gemm_batch_dist_t host;
+  //! device (GPU event) batch time distribution, no samples if not timed
+  gemm_batch_dist_t device;
+};
+
+//! statistics of a whole GEMM stress run
+struct gemm_summary_t {
+  //! GEMMs completed
+  uint64_t gemms;
+  //! GEMM batches completed
+  uint64_t batches;
+  //! reporting intervals closed
+  uint64_t intervals;
+  //! time spent in GEMM batches in seconds
+  double busy_seconds;
+  //! GFLOPS over the time spent in GEMM batches
+  double gflops;
+  //! lowest interval GFLOPS
+  double min_gflops;
+  //! highest interval GFLOPS
+  double max_gflops;
+};
+
+/**
+ * @class gemm_stats
+ * @ingroup RVS
+ *
+ * @brief Per interval and per run GEMM throughput statistics
+ *
+ * GFLOPS are always computed over the time spent in GEMM batches (launch to
+ * completion), so the figures of all the modules are comparable and do not
+ * include host side pauses between the batches.
+ *
+ */
+class gemm_stats {
+ public:
+  explicit gemm_stats(double gflop_per_gemm = 0);
+
+  void reset(double gflop_per_gemm);
+  void add_batch(uint64_t gemms, double batch_us, double device_us = 0);
+  //! TRUE if the current interval has completed batches
+  bool pending(void) const { return cur.batches > 0; }
+  gemm_interval_t close_interval(double elapsed_s, double seconds);
+  //! returns the run statistics
+  const gemm_summary_t& summary(void) const { return sum; }
+
+ protected:
+  //! GFLOP of one GEMM
+  double gflop;
+  //! current interval
+  gemm_interval_t cur;
+  //! whole run
+  gemm_summary_t sum;
+  //! host batch times of the current interval
+  gemm_batch_ring host_ring;
+  //! device batch times of the current interval
+  gemm_batch_ring device_ring;
+};
+
+//! outcome of a GEMM stress run
+enum class gemm_outcome {
+  //! duration elapsed
+  completed,
+  //! control policy ended the run successfully
+  passed,
+  //! control policy ended the run unsuccessfully
+  failed,
+  //! stop requested
+  stopped,
+  //! host to device matrix copy failed
+  copy_error,
+  //! GEMM launch or completion failed
+  gemm_error,
+  //! output validation could not be run
+  validation_error
+};
+
+//! decision of a control policy at the end of an interval
+enum class gemm_action {
+  //! keep running
+  proceed,
+  //! end the run, passed
+  pass,
+  //! end the run, failed
+  fail
+};
+
+//! GEMM stress run parameters
+struct gemm_engine_config_t {
+  //! run duration in ms (0 - no time limit)
+  uint64_t duration_ms = 0;
+  //! number of batches (0 - no limit), a single batch if neither is set
+  uint64_t max_batches = 0;
+  //! reporting interval in ms
+  uint64_t interval_ms = 1000;
+  //! GEMMs per batch (launched back to back, then waited for)
+  uint64_t calls = 1;
+  //! time each batch with GPU events as well as on the host
+  bool device_timing = true;
+  //! copy the host matrices to the GPU before each batch
+  bool copy_matrix = false;
+  //! regenerate the host matrices before each copy
+  bool regenerate = false;
+  //! global stop request (e.g. rvs::lp::Stopping), may be null
+  bool (*stopping)(void) = nullptr;
+};
+
+void usleep_ex(uint64_t microseconds);
+uint64_t time_diff(std::chrono::steady_clock::time_point t_end,
+                   std::chrono::steady_clock::time_point t_start);
+
+/**
+ * @class gemm_duration_control
+ * @ingroup RVS
+ *
+ * @brief Control policy running the GEMMs for the configured duration or
+ * until an external stop flag is raised (e.g. by a telemetry thread)
+ *
+ */
+class gemm_duration_control {
+ public:
+  explicit gemm_duration_control(const std::atomic<bool>* _stop_flag = nullptr)
+    : stop_flag(_stop_flag) {}
+
+  //! TRUE if the run has to end before the next batch
+  bool stop(void) const { return stop_flag && *stop_flag; }
+  //! idle time before the next batch in microseconds
+  uint64_t idle_us(void) { return 0; }
+  //! GEMMs in the next batch
+  uint64_t calls(uint64_t configured) const { return configured; }
+  //! decision after each batch
+  gemm_action on_batch(uint64_t, double) { return gemm_action::proceed; }
+  //! decision at the end of an interval
+  gemm_action on_interval(const gemm_interval_t&) {
+    return gemm_action::proceed;
+  }
+
+ protected:
+  //! external stop flag
+  const std::atomic<bool>* stop_flag;
+};
+
+/**
+ * @class gemm_duty_control
+ * @ingroup RVS
+ *
+ * @brief Control policy running the GEMMs at an adjustable duty cycle and
+ * batch size (e.g. set by a power controller on another thread)
+ *
+ * After each batch the engine idles for batch_time * (1 - duty) / duty.
+ *
+ */
+class gemm_duty_control {
+ public:
+  explicit gemm_duty_control(const std::atomic<bool>* _stop_flag = nullptr)
+    : stop_flag(_stop_flag), duty(1.0), num_calls(0), last_batch_us(0) {}
+
+  //! TRUE if the run has to end before the next batch
+  bool stop(void) const { return stop_flag && *stop_flag; }
+  uint64_t idle_us(void);
+  //! GEMMs in the next batch (the configured number until set())
+  uint64_t calls(uint64_t configured) const {
+    uint64_t n = num_calls;
+    return n ? n : configured;
+  }
+  //! records the batch time the idle time is derived from
+  gemm_action on_batch(uint64_t, double batch_us) {
+    last_batch_us = batch_us;
+    return gemm_action::proceed;
+  }
+  //! decision at the end of an interval
+  gemm_action on_interval(const gemm_interval_t&) {
+    return gemm_action::proceed;
+  }
+
+  void set(double _duty, uint64_t _calls);
+  //! returns the current duty cycle
+  double get_duty(void) const { return duty; }
+
+ protected:
+  //! external stop flag
+  const std::atomic<bool>* stop_flag;
+  //! fraction of the time spent running GEMMs (0, 1]
+  std::atomic<double> duty;
+  //! GEMMs per batch (0 - as configured)
+  std::atomic<uint64_t> num_calls;
+  //! duration of the last batch in microseconds
+  double last_batch_us;
+};
+
+//! validation policy for runs without output validation
+struct gemm_no_validation {
+  //! called after each batch, false on validation failure
+  bool after_batch(uint64_t) { return true; }
+  //! called once at the end of the run
+  void finish(void) {}
+};
+
+//! logging policy for runs without interval reports
+struct gemm_no_logger {
+  //! called at the end of each interval
+  void interval(const gemm_interval_t&) {}
+};
+
+/**
+ * @brief Generates the host matrices and copies them to the GPU once
+ * (unless they are copied before each batch)
+ *
+ * @param blas GEMM context
+ * @param copy_matrix matrices are copied before each batch
+ * @return copy_error or completed
+ */
+template <typename Blas>
+gemm_outcome gemm_prepare(Blas* blas, bool copy_matrix) {
+  blas->generate_random_matrix_data();
+  if (!copy_matrix && !blas->copy_data_to_gpu())
+    return gemm_outcome::copy_error;
+  return gemm_outcome::completed;
+}
+
+/**
+ * @class gemm_engine
+ * @ingroup RVS
+ *
+ * @brief GEMM stress loop shared by the GEMM based modules
+ *
+ * Runs batches of GEMMs (optional matrix copy, launch, wait for completion),
+ * accumulates gemm_stats and, at each reporting interval, hands the
+ * interval statistics to the logging policy and asks the control policy
+ * whether to continue. Output validation is delegated to the validation
+ * policy after each batch.
+ *
+ * Blas provides generate_random_matrix_data(), copy_data_to_gpu(),
+ * run_blas_gemm(calls), is_gemm_op_complete(), get_time_us(),
+ * set_batch_timing(), get_batch_times_us() and gemm_gflop_count()
+ * (rvs_blas). Control provides stop(), idle_us(),
+ * calls(), on_batch() and on_interval(), Validate after_batch() and
+ * finish(), Logger interval().
+ *
+ */
+template <typename Blas, typename Control,
+          typename Validate = gemm_no_validation,
+          typename Logger = gemm_no_logger>
+class gemm_engine {
+ public:
+  gemm_engine(Blas* _blas, const gemm_engine_config_t& _cfg, Control* _ctl,
+              Validate* _val, Logger* _log)
+    : blas(_blas), cfg(_cfg), ctl(_ctl), val(_val), log(_log) {}
+
+  /**
+   * @brief Runs the stress loop
+   *
+   * @return outcome of the run
+   */
+  gemm_outcome run(void) {
+    gemm_outcome outcome = gemm_outcome::completed;
+    uint64_t iteration = 0;
+    std::vector<double> device_times;
+
+    blas->set_batch_timing(cfg.device_timing);
+    stats.reset(blas->gemm_gflop_count());
+    double start_us = blas->get_time_us();
+    double interval_start_us = start_us;
+
+    for (;;) {
+      if ((cfg.stopping && cfg.stopping()) || ctl->stop()) {
+        outcome = gemm_outcome::stopped;
+        break;
+      }
+
+      uint64_t idle = ctl->idle_us();
+      if (idle)
+        usleep_ex(idle);
+
+      if (cfg.copy_matrix) {
+        if (cfg.regenerate)
+          blas->generate_random_matrix_data();
+        if (!blas->copy_data_to_gpu()) {
+          outcome = gemm_outcome::copy_error;
+          break;
+        }
+      }
+
+      uint64_t calls = ctl->calls(cfg.calls);
+      double batch_start_us = blas->get_time_us();
+      if (!blas->run_blas_gemm(calls) || !blas->is_gemm_op_complete()) {
+        outcome = gemm_outcome::gemm_error;
+        break;
+      }
+      double now_us = blas->get_time_us();
+      double batch_us = now_us - batch_start_us;
+      double device_us = 0;
+      device_times.clear();
+      if (cfg.device_timing && blas->get_batch_times_us(&device_times)) {
+        for (double t : device_times)
+          device_us += t;
+      }
+      stats.add_batch(calls, batch_us, device_us);
+
+      if (!val->after_batch(iteration++)) {
+        outcome = gemm_outcome::validation_error;
+        break;
+      }
+
+      gemm_action act = ctl->on_batch(calls, batch_us);
+      if (act != gemm_action::proceed) {
+        // close the partial interval so that it is reported
+        gemm_interval_t iv = stats.close_interval(
+            (now_us - start_us) / 1e6, (now_us - interval_start_us) / 1e6);
+        iv.end_us = now_us;
+        log->interval(iv);
+        outcome = act == gemm_action::pass ? gemm_outcome::passed :
+          gemm_outcome::failed;
+        break;
+      }
+
+      double elapsed_ms = (now_us - start_us) / 1000;
+      bool last = (cfg.duration_ms == 0 && cfg.max_batches == 0) ||
+        (cfg.duration_ms > 0 && elapsed_ms >= cfg.duration_ms) ||
+        (cfg.max_batches > 0 && iteration >= cfg.max_batches);
+
+      if (last || now_us - interval_start_us >= cfg.interval_ms * 1000.0) {
+        gemm_interval_t iv = stats.close_interval(
+            (now_us - start_us) / 1e6, (now_us - interval_start_us) / 1e6);
+        iv.end_us = now_us;
+        interval_start_us = now_us;
+        log->interval(iv);
+
+        act = ctl->on_interval(iv);
+        if (act != gemm_action::proceed) {
+          outcome = act == gemm_action::pass ? gemm_outcome::passed :
+            gemm_outcome::failed;
+          break;
+        }
+      }
+
+      if (last)
+        break;
+    }
+
+    val->finish();
+    return outcome;
+  }
+
+  //! returns the run statistics
+  const gemm_summary_t& summary(void) const { return stats.summary(); }
+
+ protected:
+  //! GEMM context
+  Blas* blas;
+  //! run parameters
+  gemm_engine_config_t cfg;
+  //! control policy
+  Control* ctl;
+  //! validation policy
+  Validate* val;
+  //! logging policy
+  Logger* log;
+  //! throughput statistics
+  gemm_stats stats;
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_GEMM_ENGINE_H_
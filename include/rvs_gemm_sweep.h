@@ -0,0 +1,105 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_GEMM_SWEEP_H_
+#define INCLUDE_RVS_GEMM_SWEEP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace rvs {
+
+/**
+ * @class gemm_sweep
+ * @ingroup RVS
+ *
+ * @brief GEMM shape sweep definition and efficiency report
+ *
+ * A sweep is the cartesian product of lists of m, n, k, transposes, data
+ * types and batch counts. Each point is reported with its GFLOPS, the
+ * percentage of the theoretical peak of the GPU for the data type and its
+ * arithmetic intensity (flops per byte of A, B, C and D).
+ *
+ */
+class gemm_sweep {
+ public:
+  //! one GEMM shape of the sweep
+  struct point_t {
+    //! rows of A and C
+    uint64_t m;
+    //! columns of B and C
+    uint64_t n;
+    //! columns of A, rows of B
+    uint64_t k;
+    //! transpose A (0/1)
+    int trans_a;
+    //! transpose B (0/1)
+    int trans_b;
+    //! ops_type (sgemm, dgemm, hgemm) or data_type (fp16_r, ...)
+    std::string dtype;
+    //! number of GEMMs in a strided batched call (1 - not batched)
+    uint64_t batch;
+  };
+
+  //! measurement of one point
+  struct result_t {
+    //! measured shape
+    point_t point;
+    //! FALSE if the point could not be run
+    bool valid;
+    //! achieved GFLOPS
+    double gflops;
+    //! theoretical peak GFLOPS (0 - unknown)
+    double peak_gflops;
+    //! flops per byte of A, B, C and D
+    double intensity;
+  };
+
+  static bool parse_values(const std::string& spec,
+                           std::vector<uint64_t>* values);
+  static std::vector<std::string> parse_names(const std::string& spec);
+  static std::vector<point_t> expand(const std::vector<uint64_t>& m,
+      const std::vector<uint64_t>& n, const std::vector<uint64_t>& k,
+      const std::vector<uint64_t>& trans_a,
+      const std::vector<uint64_t>& trans_b,
+      const std::vector<std::string>& dtypes,
+      const std::vector<uint64_t>& batches);
+
+  static double input_bytes(const std::string& dtype);
+  static double output_bytes(const std::string& dtype);
+  static double intensity(const point_t& p);
+  static int peak_flops_per_cu_clock(const std::string& arch,
+                                     const std::string& dtype);
+  static double peak_gflops(const std::string& arch, int cu_count,
+                            int clock_khz, const std::string& dtype);
+  static double efficiency(const result_t& r);
+  static std::string format_table(const std::vector<result_t>& results);
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_GEMM_SWEEP_H_
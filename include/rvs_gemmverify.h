@@ -0,0 +1,120 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_GEMMVERIFY_H_
+#define INCLUDE_RVS_GEMMVERIFY_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace rvs {
+
+/**
+ * @class gemmverify
+ * @ingroup RVS
+ *
+ * @brief Cheap verification of GEMM output C = alpha * op(A) * op(B) + beta * C
+ *
+ * Two strategies are provided as an alternative to full host recomputation:
+ *
+ *  - sampling: K randomly chosen output elements are recomputed with O(k)
+ *    dot products. K is derived from the confidence with which an output
+ *    having a given fraction of wrong elements is to be detected. Chunks of
+ *    samples run as short tasks on rvs::ThreadPool.
+ *  - checksum (ABFT): row and column sums of the output are compared with
+ *    sums predicted from checksums of A, B and C, i.e.
+ *    e'C = alpha (e'A) B + beta e'C and Ce = alpha A (Be) + beta Ce.
+ *    Predicted sums are computed once (O(mk + kn + mn)), each check then
+ *    costs O(mn). Mismatching rows and columns locate the wrong elements.
+ *
+ * Matrix element (i, j) of X is X[i * Xs1 + j * Xs2]. Deviations are
+ * normalized by the sum of magnitudes of the terms, so thresholds are
+ * expressed in units of machine epsilon of the output type.
+ *
+ */
+class gemmverify {
+ public:
+  //! mismatch location (-1 if row or column is not known)
+  struct mismatch_t {
+    //! output row
+    int64_t row;
+    //! output column
+    int64_t col;
+    //! normalized deviation
+    double error;
+  };
+
+  //! predicted row and column sums of GEMM output
+  struct checksums_t {
+    //! predicted column sums (n)
+    std::vector<double> col;
+    //! sum of magnitudes of column terms (n)
+    std::vector<double> col_abs;
+    //! predicted row sums (m)
+    std::vector<double> row;
+    //! sum of magnitudes of row terms (m)
+    std::vector<double> row_abs;
+  };
+
+  //! default threshold in units of epsilon for checksum verification
+  static constexpr double DEFAULT_CHECKSUM_TOLERANCE = 16.0;
+  //! default threshold in units of epsilon * sqrt(k) for sampled verification
+  static constexpr double DEFAULT_SAMPLE_TOLERANCE = 16.0;
+  //! max number of mismatch locations reported
+  static const size_t MAX_MISMATCHES = 64;
+
+  static uint64_t sample_count(double confidence, double error_rate,
+                               uint64_t size);
+  static uint64_t sample_seed(uint64_t seed, uint64_t check);
+
+  template <typename T>
+  static double verify_sampled(int64_t m, int64_t n, int64_t k,
+                               double alpha,
+                               const T* A, int64_t As1, int64_t As2,
+                               const T* B, int64_t Bs1, int64_t Bs2,
+                               double beta, const T* C, int64_t Cs1,
+                               int64_t Cs2, const T* D, int64_t Ds1,
+                               int64_t Ds2, uint64_t samples, uint64_t seed,
+                               double tolerance,
+                               std::vector<mismatch_t>* pmismatches);
+
+  template <typename T>
+  static void checksum_prepare(int64_t m, int64_t n, int64_t k, double alpha,
+                               const T* A, int64_t As1, int64_t As2,
+                               const T* B, int64_t Bs1, int64_t Bs2,
+                               double beta, const T* C, int64_t Cs1,
+                               int64_t Cs2, checksums_t* psums);
+
+  template <typename T>
+  static double verify_checksum(const checksums_t& sums,
+                                const T* D, int64_t Ds1, int64_t Ds2,
+                                double tolerance,
+                                std::vector<mismatch_t>* pmismatches);
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_GEMMVERIFY_H_
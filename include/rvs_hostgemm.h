@@ -0,0 +1,347 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_HOSTGEMM_H_
+#define INCLUDE_RVS_HOSTGEMM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <type_traits>
+#include <vector>
+
+#include "include/rvs_lpconv.h"
+
+namespace rvs {
+
+/**
+ * @class hostgemm
+ * @ingroup RVS
+ *
+ * @brief Host (CPU) GEMM engine used as reference for GEMM accuracy checks
+ *
+ * Computes C = alpha * op(A) * op(B) + beta * C where element (i, p) of
+ * op(A) is A[i * As1 + p * As2], element (p, j) of op(B) is
+ * B[p * Bs1 + j * Bs2] and element (i, j) of C is C[i * Cs1 + j * Cs2], so
+ * any combination of transposes and column/row major layouts is expressed
+ * through strides.
+ *
+ * Operands are packed into cache sized panels converted to the accumulation
+ * type (float or double) and multiplied by register blocked micro-kernels
+ * selected at runtime (AVX-512, AVX2/FMA or portable C++). Tiles of C are
+ * computed in parallel with OpenMP; by default the OpenMP threads are split
+ * between the host GEMMs expected to run concurrently (set_concurrency(),
+ * e.g. one per GPU worker) or actually running, whichever is more.
+ *
+ * Element types other than float/double (fp16, bf16, fp8) are supported as
+ * long as they are convertible to and from float. Types rvs::lpconv has a
+ * format for are converted in bulk (operands before packing, C per column)
+ * instead of element by element.
+ *
+ */
+class hostgemm {
+ public:
+  //! micro-kernel instruction set
+  enum isa_t {
+    //! portable C++
+    isa_generic = 0,
+    //! AVX2 + FMA
+    isa_avx2,
+    //! AVX-512F
+    isa_avx512
+  };
+
+  static isa_t detect_isa();
+  static isa_t get_isa();
+  static void set_isa(isa_t isa);
+  static const char* isa_name(isa_t isa);
+  static int get_threads(int threads);
+  static void set_concurrency(int workers);
+  static void set_panel_bytes(size_t bytes);
+
+  /**
+   * @brief Pack block of operand into micro-panels
+   *
+   * Packs rows [r0, r0 + nrows) of length kc starting at column p0 into
+   * slivers of w rows (zero padded), sliver after sliver, each stored as kc
+   * groups of w consecutive elements.
+   *
+   */
+  template <typename Tacc>
+  using pack_fn_t = std::function<void(int64_t r0, int64_t nrows, int64_t p0,
+                                       int64_t kc, int64_t w, Tacc* dst)>;
+
+  /**
+   * @brief Blocked GEMM on packed operands: C += alpha * op(A) * op(B)
+   *
+   * @param m rows of op(A) and C
+   * @param n columns of op(B) and C
+   * @param k columns of op(A), rows of op(B)
+   * @param alpha scalar for op(A) * op(B)
+   * @param pack_a packs rows of op(A)
+   * @param pack_b packs columns of op(B) (i.e. rows of op(B)^T)
+   * @param C matrix C
+   * @param Cs1 row stride of C
+   * @param Cs2 column stride of C
+   * @param threads number of threads
+   *
+   */
+  template <typename Tacc>
+  static void gemm_packed(int64_t m, int64_t n, int64_t k, Tacc alpha,
+                          const pack_fn_t<Tacc>& pack_a,
+                          const pack_fn_t<Tacc>& pack_b,
+                          Tacc* C, int64_t Cs1, int64_t Cs2, int threads);
+
+  //! converts operand element to accumulation type
+  template <typename Tacc, typename T>
+  static Tacc load(const T& x) {
+    if constexpr (std::is_arithmetic<T>::value) {
+      return static_cast<Tacc>(x);
+    } else {
+      return static_cast<Tacc>(static_cast<float>(x));
+    }
+  }
+
+  //! converts accumulated value to element type
+  template <typename T, typename Tacc>
+  static T store(Tacc v) {
+    if constexpr (std::is_arithmetic<T>::value) {
+      return static_cast<T>(v);
+    } else {
+      return static_cast<T>(static_cast<float>(v));
+    }
+  }
+
+  /**
+   * @brief Pack rows of strided matrix X (element (r, p) at
+   * X[r * s_row + p * s_col]) converting to accumulation type
+   *
+   */
+  template <typename T, typename Tacc>
+  static void pack(const T* X, int64_t s_row, int64_t s_col, int64_t rows,
+                   int64_t r0, int64_t nrows, int64_t p0, int64_t kc,
+                   int64_t w, Tacc* dst) {
+    for (int64_t s = 0; s < nrows; s += w) {
+      int64_t valid = std::max(int64_t(0),
+                               std::min(w, std::min(nrows - s, rows - r0 - s)));
+      for (int64_t p = 0; p < kc; p++) {
+        const T* src = X + (r0 + s) * s_row + (p0 + p) * s_col;
+        for (int64_t r = 0; r < valid; r++)
+          dst[r] = load<Tacc>(src[r * s_row]);
+        for (int64_t r = valid; r < w; r++)
+          dst[r] = 0;
+        dst += w;
+      }
+    }
+  }
+
+  /**
+   * @brief Bulk conversion of type T to float (rvs::lpconv)
+   *
+   * @return conversion, fmt_none if T is float/double or has no format
+   *
+   */
+  template <typename T>
+  static lpconv::conv_t bulk_conversion() {
+    if constexpr (std::is_arithmetic<T>::value)
+      return {lpconv::fmt_none, lpconv::round_nearest_even, false};
+    else
+      return lpconv::conversion<T>();
+  }
+
+  /**
+   * @brief Converts all elements of strided rows x cols matrix X (including
+   * padding between columns) to float
+   *
+   * @return false if T has no bulk conversion
+   *
+   */
+  template <typename T>
+  static bool widen(const T* X, int64_t rows, int64_t cols, int64_t s1,
+                    int64_t s2, std::vector<float>* dst) {
+    lpconv::format_t fmt = bulk_conversion<T>().fmt;
+
+    if (fmt == lpconv::fmt_none || rows <= 0 || cols <= 0)
+      return false;
+    dst->resize((rows - 1) * s1 + (cols - 1) * s2 + 1);
+    lpconv::to_float(fmt, X, dst->data(), dst->size());
+    return true;
+  }
+
+  /**
+   * @brief C = alpha * op(A) * op(B) + beta * C
+   *
+   * Accumulates in Tacc. When C is of other type than Tacc it is computed
+   * panel by panel of columns in a temporary Tacc buffer (bounded by
+   * set_panel_bytes()) so that rounding to the output type happens only
+   * once.
+   *
+   * @param threads number of threads (0 - share of OpenMP default, see
+   * get_threads())
+   *
+   */
+  template <typename TA, typename TB, typename TC, typename Tacc>
+  static void gemm(int64_t m, int64_t n, int64_t k, Tacc alpha,
+                   const TA* A, int64_t As1, int64_t As2,
+                   const TB* B, int64_t Bs1, int64_t Bs2,
+                   Tacc beta, TC* C, int64_t Cs1, int64_t Cs2,
+                   int threads = 0) {
+    if (m <= 0 || n <= 0)
+      return;
+
+    // low precision operands are converted once, not in every packed panel
+    std::vector<float> wide;
+    if constexpr (!std::is_arithmetic<TA>::value) {
+      if (widen(A, m, k, As1, As2, &wide)) {
+        gemm<float, TB, TC, Tacc>(m, n, k, alpha, wide.data(), As1, As2,
+                                  B, Bs1, Bs2, beta, C, Cs1, Cs2, threads);
+        return;
+      }
+    }
+    if constexpr (!std::is_arithmetic<TB>::value) {
+      if (widen(B, k, n, Bs1, Bs2, &wide)) {
+        gemm<TA, float, TC, Tacc>(m, n, k, alpha, A, As1, As2,
+                                  wide.data(), Bs1, Bs2, beta, C, Cs1, Cs2,
+                                  threads);
+        return;
+      }
+    }
+
+    active_scope active;
+    int nthreads = get_threads(threads);
+
+    pack_fn_t<Tacc> pack_a = [=](int64_t r0, int64_t nrows, int64_t p0,
+                                 int64_t kc, int64_t w, Tacc* dst) {
+      pack<TA, Tacc>(A, As1, As2, m, r0, nrows, p0, kc, w, dst);
+    };
+
+    if constexpr (std::is_same<TC, Tacc>::value) {
+      pack_fn_t<Tacc> pack_b = [=](int64_t r0, int64_t nrows, int64_t p0,
+                                   int64_t kc, int64_t w, Tacc* dst) {
+        pack<TB, Tacc>(B, Bs2, Bs1, n, r0, nrows, p0, kc, w, dst);
+      };
+
+      // C = beta * C (beta == 0 clears C, also NaN/Inf in it)
+      #pragma omp parallel for num_threads(nthreads)
+      for (int64_t j = 0; j < n; j++) {
+        for (int64_t i = 0; i < m; i++) {
+          Tacc& c = C[i * Cs1 + j * Cs2];
+          c = beta == 0 ? 0 : beta * c;
+        }
+      }
+      gemm_packed<Tacc>(m, n, k, alpha, pack_a, pack_b, C, Cs1, Cs2,
+                        nthreads);
+    } else {
+      const int64_t panel = std::min(n, std::max(int64_t(16),
+          static_cast<int64_t>(panel_bytes / (m * sizeof(Tacc)))));
+      std::vector<Tacc> W(static_cast<size_t>(m) * panel);
+      // columns of C are converted in bulk when contiguous
+      const lpconv::conv_t conv = Cs1 == 1 ? bulk_conversion<TC>() :
+          lpconv::conv_t{lpconv::fmt_none, lpconv::round_nearest_even, false};
+
+      for (int64_t j0 = 0; j0 < n; j0 += panel) {
+        const int64_t nc = std::min(panel, n - j0);
+        TC* Cp = C + j0 * Cs2;
+        const TB* Bp = B + j0 * Bs2;
+        pack_fn_t<Tacc> pack_b = [=](int64_t r0, int64_t nrows, int64_t p0,
+                                     int64_t kc, int64_t w, Tacc* dst) {
+          pack<TB, Tacc>(Bp, Bs2, Bs1, nc, r0, nrows, p0, kc, w, dst);
+        };
+
+        #pragma omp parallel for num_threads(nthreads)
+        for (int64_t j = 0; j < nc; j++) {
+          std::vector<float> col(conv.fmt != lpconv::fmt_none && beta != 0 ?
+                                 m : 0);
+          if (!col.empty())
+            lpconv::to_float(conv.fmt, Cp + j * Cs2, col.data(), m);
+          for (int64_t i = 0; i < m; i++) {
+            W[i + j * m] = beta == 0 ? 0 : beta * (col.empty() ?
+                load<Tacc>(Cp[i * Cs1 + j * Cs2]) :
+                static_cast<Tacc>(col[i]));
+          }
+        }
+        gemm_packed<Tacc>(m, nc, k, alpha, pack_a, pack_b, W.data(), 1, m,
+                          nthreads);
+        #pragma omp parallel for num_threads(nthreads)
+        for (int64_t j = 0; j < nc; j++) {
+          if (conv.fmt != lpconv::fmt_none) {
+            std::vector<float> col(W.begin() + j * m,
+                                   W.begin() + (j + 1) * m);
+            lpconv::from_float(conv, col.data(), Cp + j * Cs2, m);
+            continue;
+          }
+          for (int64_t i = 0; i < m; i++) {
+            Cp[i * Cs1 + j * Cs2] = store<TC>(W[i + j * m]);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief Naive single threaded triple loop C = alpha * op(A) * op(B) +
+   * beta * C accumulating in Tacc (used for testing and benchmarking)
+   *
+   */
+  template <typename TA, typename TB, typename TC, typename Tacc>
+  static void gemm_naive(int64_t m, int64_t n, int64_t k, Tacc alpha,
+                         const TA* A, int64_t As1, int64_t As2,
+                         const TB* B, int64_t Bs1, int64_t Bs2,
+                         Tacc beta, TC* C, int64_t Cs1, int64_t Cs2) {
+    for (int64_t i = 0; i < m; i++) {
+      for (int64_t j = 0; j < n; j++) {
+        Tacc t = 0;
+        for (int64_t p = 0; p < k; p++) {
+          t += load<Tacc>(A[i * As1 + p * As2]) *
+               load<Tacc>(B[p * Bs1 + j * Bs2]);
+        }
+        TC& c = C[i * Cs1 + j * Cs2];
+        c = store<TC>((beta == 0 ? 0 : beta * load<Tacc>(c)) + alpha * t);
+      }
+    }
+  }
+
+ protected:
+  //! counts a host GEMM as running for its lifetime
+  struct active_scope {
+    active_scope() { active++; }
+    ~active_scope() { active--; }
+  };
+
+  //! forced micro-kernel ISA (-1 - detect)
+  static int forced_isa;
+  //! host GEMMs expected to run concurrently
+  static std::atomic<int> concurrency;
+  //! host GEMMs running
+  static std::atomic<int> active;
+  //! size limit of the temporary accumulation panel in bytes
+  static size_t panel_bytes;
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_HOSTGEMM_H_
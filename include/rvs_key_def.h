@@ -55,6 +55,10 @@
 #define RVS_CONF_A2A_NUM_GPUS_KEY      "a2a_num_gpus"
 #define RVS_CONF_USE_REMOTE_READ_KEY   "use_remote_read"
 #define RVS_CONF_GFX_UNROLL_KEY        "gfx_unroll"
+#define RVS_CONF_NUMA_AFFINITY_KEY     "numa_affinity"
+#define RVS_CONF_CPU_AFFINITY_KEY      "cpu_affinity"
+#define RVS_CONF_FAULT_INJECT_KEY      "fault_inject"
+#define RVS_CONF_FAULT_SEED_KEY        "fault_seed"
 
 #define DEFAULT_LOG_INTERVAL (1000u)
 #define DEFAULT_DURATION     (10000u)
@@ -75,6 +79,10 @@
 #define DEFAULT_GFX_UNROLL      (4u)
 #define DEFAULT_SRC_MEMORY "null"
 #define DEFAULT_DST_MEMORY "null"
+#define DEFAULT_NUMA_AFFINITY ""
+#define DEFAULT_CPU_AFFINITY  false
+#define DEFAULT_FAULT_INJECT  ""
+#define DEFAULT_FAULT_SEED    (0u)
 
 #define YAML_DEVICE_PROPERTY_ERROR      "Error while parsing <device> property"
 #define YAML_DEVICEID_PROPERTY_ERROR    "Error while parsing <deviceid> "\
@@ -0,0 +1,199 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_LPCONV_H_
+#define INCLUDE_RVS_LPCONV_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace rvs {
+
+/**
+ * @class lpconv
+ * @ingroup RVS
+ *
+ * @brief Bulk conversion of low precision GEMM element types to/from float
+ *
+ * Converts arrays of fp16, bf16, fp8 (OCP e4m3/e5m2 and the fnuz variants
+ * used by gfx94x) and int8 elements to float and back. Conversions are
+ * exact: decoding is lossless, encoding rounds to nearest even or toward
+ * zero with explicit overflow handling (saturation to the largest finite
+ * value or Inf/NaN as the format defines), subnormals included.
+ *
+ * fp16 uses F16C instructions when the CPU has them; the other formats use
+ * branch free bit arithmetic (8 bit formats decode through a 256 entry
+ * table) in loops vectorized for the instruction set selected by
+ * rvs::hostgemm (AVX-512, AVX2 or baseline).
+ *
+ * Storage types (rocblas_half, hipblaslt_f8, ...) are mapped to a format by
+ * conversion<T>(), which checks the library against the type's own float
+ * conversions once per process, so bulk conversion gives bit identical
+ * results to element by element casts.
+ *
+ */
+class lpconv {
+ public:
+  //! element format
+  enum format_t {
+    //! no bulk conversion, use the type's own casts
+    fmt_none = 0,
+    //! IEEE single precision (plain copy)
+    fmt_f32,
+    //! IEEE half precision
+    fmt_f16,
+    //! bfloat16
+    fmt_bf16,
+    //! OCP fp8 e4m3 (no Inf, max 448)
+    fmt_e4m3,
+    //! OCP fp8 e5m2 (IEEE like, max 57344)
+    fmt_e5m2,
+    //! fp8 e4m3 fnuz (bias 8, single NaN 0x80, max 240)
+    fmt_e4m3_fnuz,
+    //! fp8 e5m2 fnuz (bias 16, single NaN 0x80, max 57344)
+    fmt_e5m2_fnuz,
+    //! signed 8 bit integer
+    fmt_i8
+  };
+
+  //! rounding mode of float to format conversions
+  enum round_t {
+    //! round to nearest, ties to even
+    round_nearest_even = 0,
+    //! round toward zero (truncate)
+    round_toward_zero
+  };
+
+  //! float to format conversion
+  struct conv_t {
+    //! element format
+    format_t fmt;
+    //! rounding mode
+    round_t round;
+    //! clamp overflows (and Inf) to the largest finite value
+    bool saturate;
+  };
+
+  static size_t format_size(format_t fmt);
+  static const char* format_name(format_t fmt);
+
+  static void to_float(format_t fmt, const void* src, float* dst, size_t n);
+  static void from_float(const conv_t& conv, const float* src, void* dst,
+                         size_t n);
+
+  static float decode(format_t fmt, uint32_t bits);
+  static uint32_t encode(const conv_t& conv, float x);
+  static const float* decode_table(format_t fmt);
+
+  static void probe_values(format_t fmt, std::vector<float>* values);
+
+  /**
+   * @brief Conversion matching float conversions of storage type T
+   *
+   * Determined once per process: float/int8_t map directly, 16 and 8 bit
+   * storage types are matched against the candidate formats by decoding
+   * every code and encoding probe_values() with both the type's casts and
+   * the library. fmt_none means that no format matches (or T is double).
+   *
+   * @return conversion for T
+   *
+   * */
+  template <typename T>
+  static conv_t conversion() {
+    static const conv_t conv = detect<T>();
+    return conv;
+  }
+
+ protected:
+  template <typename T>
+  static conv_t detect() {
+    if constexpr (std::is_same<T, float>::value) {
+      return {fmt_f32, round_nearest_even, false};
+    } else if constexpr (std::is_same<T, int8_t>::value) {
+      // integer casts truncate (out of range values are undefined)
+      return {fmt_i8, round_toward_zero, true};
+    } else if constexpr (!std::is_arithmetic<T>::value &&
+                         (sizeof(T) == 1 || sizeof(T) == 2)) {
+      static const format_t candidates[] = {
+        fmt_f16, fmt_bf16, fmt_e4m3, fmt_e5m2, fmt_e4m3_fnuz, fmt_e5m2_fnuz
+      };
+
+      for (format_t fmt : candidates) {
+        if (format_size(fmt) != sizeof(T) || !matches_decode<T>(fmt))
+          continue;
+        for (int r = 0; r < 2; r++) {
+          for (int s = 0; s < 2; s++) {
+            conv_t conv = {fmt, static_cast<round_t>(r), s != 0};
+            if (matches_encode<T>(conv))
+              return conv;
+          }
+        }
+      }
+    }
+    return {fmt_none, round_nearest_even, false};
+  }
+
+  //! true if T decodes every code like fmt
+  template <typename T>
+  static bool matches_decode(format_t fmt) {
+    for (uint32_t c = 0; c < (1u << (8 * sizeof(T))); c++) {
+      T v;
+      memcpy(static_cast<void*>(&v), &c, sizeof(T));
+      if (!same_value(static_cast<float>(v), decode(fmt, c)))
+        return false;
+    }
+    return true;
+  }
+
+  //! true if T encodes probe values like conv
+  template <typename T>
+  static bool matches_encode(const conv_t& conv) {
+    std::vector<float> values;
+    probe_values(conv.fmt, &values);
+    for (float x : values) {
+      T v = static_cast<T>(x);
+      uint32_t c = 0;
+      memcpy(&c, &v, sizeof(T));
+      if (!same_value(decode(conv.fmt, c), decode(conv.fmt, encode(conv, x))))
+        return false;
+    }
+    return true;
+  }
+
+  //! equal values (any NaN equals any NaN, -0 differs from +0)
+  static bool same_value(float a, float b) {
+    if (std::isnan(a) || std::isnan(b))
+      return std::isnan(a) && std::isnan(b);
+    return a == b && std::signbit(a) == std::signbit(b);
+  }
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_LPCONV_H_
@@ -0,0 +1,127 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_MATRIX_STAGE_H_
+#define INCLUDE_RVS_MATRIX_STAGE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace rvs {
+
+/**
+ * @class matrix_stage
+ * @ingroup RVS
+ *
+ * @brief Host GEMM input matrices shared by all workers of a process
+ *
+ * Workers testing several GPUs with the same configuration need identical
+ * A, B and C host matrices. The first worker to ask for a key allocates
+ * one (pinned) buffer holding all three matrices and initializes it; the
+ * workers asking for the same key meanwhile wait for it and then share
+ * it read-only for their host to device copies. The buffer is released
+ * when the last worker drops its reference, or refilled for the next
+ * matrices of a worker that is its only holder.
+ *
+ */
+class matrix_stage {
+ public:
+  //! identifies the contents of staged matrices
+  struct key_t {
+    //! element types (e.g. ops_type/data_type/blas_source)
+    std::string type;
+    //! initialization method
+    uint32_t init;
+    //! initialization value range
+    uint32_t range;
+    //! initialization seed
+    uint64_t seed;
+    //! initialization sequence number for the seed
+    uint64_t generation;
+    //! size of A in bytes
+    size_t bytes_a;
+    //! size of B in bytes
+    size_t bytes_b;
+    //! size of C in bytes
+    size_t bytes_c;
+
+    bool operator<(const key_t& rhs) const;
+  };
+
+  //! staged matrices
+  struct buffers_t {
+    //! matrix A
+    void* ha;
+    //! matrix B
+    void* hb;
+    //! matrix C
+    void* hc;
+    //! total bytes allocated
+    size_t bytes;
+    //! true if allocated as pinned memory
+    bool pinned;
+  };
+
+  //! staging statistics (since process start)
+  struct stats_t {
+    //! number of matrix sets generated
+    uint64_t generated;
+    //! number of generated sets refilled in previously held buffers
+    uint64_t reused;
+    //! number of requests served by already generated matrices
+    uint64_t shared;
+    //! host memory not allocated thanks to sharing (bytes)
+    uint64_t bytes_saved;
+    //! initialization time not spent thanks to sharing (seconds)
+    double seconds_saved;
+    //! host memory currently held by staged matrices (bytes)
+    uint64_t bytes_resident;
+    //! peak of bytes_resident
+    uint64_t bytes_peak;
+  };
+
+  //! allocates bytes of host memory, sets *pinned if the memory is pinned
+  typedef void* (*alloc_fn_t)(size_t bytes, bool* pinned);
+  //! releases memory returned by alloc_fn_t
+  typedef void (*free_fn_t)(void* ptr, bool pinned);
+  //! initializes freshly allocated matrices, returns false on failure
+  typedef std::function<bool(const buffers_t&)> init_fn_t;
+
+  //! alignment of each matrix in the staged buffer
+  static const size_t ALIGNMENT = 4096;
+
+  static std::shared_ptr<const buffers_t> acquire(const key_t& key,
+      const init_fn_t& init, alloc_fn_t alloc_fn, free_fn_t free_fn,
+      std::shared_ptr<const buffers_t>* held = nullptr);
+
+  static stats_t get_stats(void);
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_MATRIX_STAGE_H_
@@ -0,0 +1,70 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_MXPACK_H_
+#define INCLUDE_RVS_MXPACK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace rvs {
+
+/**
+ * @class mxpack
+ * @ingroup RVS
+ *
+ * @brief Host side packing, scale alignment and conversion of microscaling
+ * (MX fp4/fp6/fp8) GEMM inputs
+ *
+ * Packed fp4 stores two values per byte (low nibble first), packed fp6
+ * four values per three bytes (least significant bits first). Unpacking
+ * and packing are bit-parallel: eight values are moved with a few 64 bit
+ * shifts and masks instead of per element shifts selected by position.
+ *
+ * Data generated with one scale per block of consecutive values is
+ * realigned for GEMM operands whose K dimension is not contiguous: for
+ * each K block the rows x block slice is transposed (cache blocked) so that
+ * element (r, k) stored at k * rows + r uses scale (k / block) * rows + r.
+ * Aligned values are then converted to float through per scale lookup
+ * tables built once by the caller.
+ *
+ */
+class mxpack {
+ public:
+  static void unpack_fp4(const uint8_t* in, size_t bytes, uint8_t* out);
+  static void pack_fp4(const uint8_t* in, size_t values, uint8_t* out);
+  static void unpack_fp6(const uint8_t* in, size_t bytes, uint8_t* out);
+  static void pack_fp6(const uint8_t* in, size_t values, uint8_t* out);
+
+  static void align_blocks(const uint8_t* src, uint8_t* dst, int64_t rows,
+                           int64_t cols, int64_t block);
+  static void aligned_to_float(const uint8_t* codes, const uint8_t* scales,
+                               int64_t rows, int64_t cols, int64_t block,
+                               const float* luts, int64_t lut_size,
+                               float* out);
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_MXPACK_H_
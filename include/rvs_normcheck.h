@@ -0,0 +1,67 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_NORMCHECK_H_
+#define INCLUDE_RVS_NORMCHECK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "include/rvs_lpconv.h"
+
+namespace rvs {
+
+/**
+ * @class normcheck
+ * @ingroup RVS
+ *
+ * @brief Comparison of two GEMM outputs for self-consistency checks
+ *
+ * Computes relative Frobenius norm error ||cur - ref||_F / ||ref||_F of two
+ * column major m x n matrices with leading dimension ld in a single fused
+ * pass: elements are converted to double, difference and reference sums of
+ * squares are accumulated together. Columns are processed in parallel with
+ * OpenMP, each column by a loop vectorized for the instruction set selected
+ * by rvs::hostgemm (AVX-512, AVX2 or baseline).
+ *
+ * Low precision elements (fp16, bf16, fp8, int8) are decoded in cache sized
+ * column chunks by rvs::lpconv.
+ *
+ */
+class normcheck {
+ public:
+  static double relative_error(lpconv::format_t fmt, int64_t m, int64_t n,
+                               int64_t ld, const void* ref, const void* cur,
+                               int threads = 0);
+  static double relative_error(int64_t m, int64_t n, int64_t ld,
+                               const double* ref, const double* cur,
+                               int threads = 0);
+
+  static bool equal(int64_t m, int64_t n, int64_t ld, size_t elem_size,
+                    const void* ref, const void* cur);
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_NORMCHECK_H_
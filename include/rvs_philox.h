@@ -0,0 +1,130 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_PHILOX_H_
+#define INCLUDE_RVS_PHILOX_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+
+#include "include/rvs_hostgemm.h"
+#include "include/rvs_lpconv.h"
+
+namespace rvs {
+
+/**
+ * @class philox
+ * @ingroup RVS
+ *
+ * @brief Counter based (Philox4x32-10) host matrix initialization
+ *
+ * Element i of a stream is computed from (seed, stream, i) only, so any
+ * region of a matrix can be filled independently of the others: fills are
+ * split across OpenMP threads and vectorized (AVX-512, AVX2 or baseline as
+ * selected by rvs::hostgemm) and the result does not depend on the number
+ * of threads. Each Philox block of four 32 bit words supplies four
+ * consecutive elements.
+ *
+ */
+class philox {
+ public:
+  //! value distribution
+  enum dist_t {
+    //! uniform integer in [lo, hi]
+    dist_int = 0,
+    //! (bits % modulus) / divisor
+    dist_mod,
+    //! sin(element index), seed independent
+    dist_sin
+  };
+
+  //! fill parameters
+  struct params_t {
+    //! generator seed (Philox key)
+    uint64_t seed;
+    //! stream id, gives independent sequences for the same seed
+    uint64_t stream;
+    //! value distribution
+    dist_t dist;
+    //! dist_int lower bound
+    int32_t lo;
+    //! dist_int upper bound
+    int32_t hi;
+    //! dist_mod modulus
+    uint32_t modulus;
+    //! dist_mod divisor
+    float divisor;
+  };
+
+  //! elements generated per thread work item
+  static const size_t CHUNK = 4096;
+
+  static void block(const uint32_t ctr[4], const uint32_t key[2],
+                    uint32_t out[4]);
+
+  static void fill(const params_t& p, uint64_t offset, size_t count,
+                   float* dst);
+
+  /**
+   * @brief Fills count elements of dst converting each value to T
+   *
+   * Low precision types known to rvs::lpconv are converted in bulk, with
+   * the same result as the type's own conversion from float.
+   *
+   * @param p fill parameters
+   * @param dst destination buffer
+   * @param count number of elements
+   * @param threads number of threads (0 - OpenMP default)
+   *
+   * */
+  template <typename T>
+  static void fill_as(const params_t& p, T* dst, size_t count,
+                      int threads = 0) {
+    const int64_t chunks = (count + CHUNK - 1) / CHUNK;
+    const rvs::lpconv::conv_t conv = rvs::hostgemm::bulk_conversion<T>();
+
+    threads = rvs::hostgemm::get_threads(threads);
+
+    #pragma omp parallel for num_threads(threads) schedule(static)
+    for (int64_t c = 0; c < chunks; c++) {
+      float buf[CHUNK];
+      size_t off = c * CHUNK;
+      size_t len = std::min(CHUNK, count - off);
+
+      fill(p, off, len, buf);
+      if (conv.fmt != rvs::lpconv::fmt_none) {
+        rvs::lpconv::from_float(conv, buf, dst + off, len);
+        continue;
+      }
+      for (size_t i = 0; i < len; i++)
+        dst[off + i] = static_cast<T>(buf[i]);
+    }
+  }
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_PHILOX_H_
@@ -0,0 +1,221 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_POWER_CONTROL_H_
+#define INCLUDE_RVS_POWER_CONTROL_H_
+
+#include <stdint.h>
+
+//! default minimum number of consecutive in-band samples to be settled
+#define POWER_LOOP_MIN_HOLD                     5
+
+namespace rvs {
+
+//! PID controller gains
+struct pid_gains_t {
+  //! proportional gain
+  double kp = 0;
+  //! integral gain (per second)
+  double ki = 0;
+  //! derivative gain (seconds)
+  double kd = 0;
+};
+
+/**
+ * @class pid_controller
+ * @ingroup RVS
+ *
+ * @brief PID controller with output limits and anti-windup
+ *
+ * The integral term is frozen while the output is saturated and the error
+ * would drive it further into saturation (conditional integration), so the
+ * controller recovers as soon as the error changes sign. The derivative term
+ * acts on the measurement to avoid a kick on setpoint changes.
+ *
+ */
+class pid_controller {
+ public:
+  pid_controller(const pid_gains_t& _gains, double _out_min, double _out_max);
+
+  void reset(double output);
+  double update(double setpoint, double measurement, double dt_s);
+
+  //! returns the last output
+  double output(void) const { return out; }
+  //! TRUE if the last output was clamped to a limit
+  bool saturated(void) const { return sat; }
+
+ protected:
+  //! controller gains
+  pid_gains_t gains;
+  //! lowest output
+  double out_min;
+  //! highest output
+  double out_max;
+  //! integral term
+  double integral;
+  //! previous measurement (derivative term)
+  double prev_measurement;
+  //! TRUE once a measurement was seen
+  bool have_prev;
+  //! last output
+  double out;
+  //! TRUE if the last output was clamped
+  bool sat;
+};
+
+//! parameters of first_order_power_plant
+struct power_plant_params_t {
+  //! power at zero load in W
+  double idle_w = 100;
+  //! power at full load (cold GPU) in W
+  double max_w = 500;
+  //! power response time constant in s
+  double tau_s = 0.5;
+  //! ambient (inlet) temperature in C
+  double ambient_c = 30;
+  //! thermal resistance die to ambient in C/W
+  double thermal_r = 0.12;
+  //! thermal time constant in s
+  double thermal_tau_s = 20;
+  //! leakage power increase per degree above ambient in W/C
+  double leakage_w_per_c = 0.5;
+};
+
+/**
+ * @class power_plant
+ * @ingroup RVS
+ *
+ * @brief Response of GPU power to a load command, used to develop and test
+ * power controllers without a GPU
+ *
+ */
+class power_plant {
+ public:
+  virtual ~power_plant() {}
+
+  /**
+   * @brief Advances the plant
+   *
+   * @param command load command in [0, 1]
+   * @param dt_s time step in seconds
+   * @return power at the end of the step in W
+   */
+  virtual double step(double command, double dt_s) = 0;
+};
+
+/**
+ * @class first_order_power_plant
+ * @ingroup RVS
+ *
+ * @brief First order power response with a first order thermal state
+ *
+ * Power approaches idle_w + (max_w - idle_w) * command plus the temperature
+ * dependent leakage with time constant tau_s; the die temperature approaches
+ * ambient_c + thermal_r * power with time constant thermal_tau_s.
+ *
+ */
+class first_order_power_plant : public power_plant {
+ public:
+  explicit first_order_power_plant(const power_plant_params_t& _params);
+
+  double step(double command, double dt_s) override;
+
+  //! returns the current power in W
+  double power(void) const { return pwr; }
+  //! returns the current die temperature in C
+  double temperature(void) const { return temp; }
+
+ protected:
+  //! plant parameters
+  power_plant_params_t params;
+  //! current power
+  double pwr;
+  //! current temperature
+  double temp;
+};
+
+/**
+ * @class power_loop_stats
+ * @ingroup RVS
+ *
+ * @brief Settling time and steady state error of a power control loop
+ *
+ * The loop settles at the first sample after which all samples stay
+ * within target +/- tolerance. It counts as settled only once it has held
+ * the band for at least min_hold samples and for at least hold_fraction of
+ * all samples, so a loop oscillating through the band does not pass. The
+ * steady state error is the mean relative error (power - target) / target
+ * of the settled samples.
+ *
+ */
+class power_loop_stats {
+ public:
+  power_loop_stats(double _target, double _tolerance,
+                   uint64_t _min_hold = POWER_LOOP_MIN_HOLD,
+                   double _hold_fraction = 0);
+
+  void add(double t_s, double power);
+
+  bool settled(void) const;
+  //! time of settling in seconds (-1 if not settled)
+  double settling_time(void) const { return settled() ? settle_s : -1; }
+  double steady_state_error(void) const;
+  //! number of samples seen
+  uint64_t samples(void) const { return num_samples; }
+
+ protected:
+  //! target power
+  double target;
+  //! relative tolerance
+  double tolerance;
+  //! minimum number of consecutive samples within the band
+  uint64_t min_hold;
+  //! minimum fraction of all samples held within the band
+  double hold_fraction;
+  //! time of settling (-1 if not settled)
+  double settle_s;
+  //! sum of the relative errors of the settled samples
+  double err_sum;
+  //! number of settled samples
+  uint64_t settled_samples;
+  //! number of samples
+  uint64_t num_samples;
+};
+
+//! workload intensity derived from a power controller command
+struct power_actuation_t {
+  //! fraction of the time spent running GEMMs
+  double gemm_duty;
+  //! GEMMs per batch
+  uint64_t hot_calls;
+  //! fraction of the time spent running the bandwidth kernel
+  double bw_intensity;
+};
+
+power_actuation_t power_actuation(double command, uint64_t max_hot_calls);
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_POWER_CONTROL_H_
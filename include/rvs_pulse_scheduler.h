@@ -0,0 +1,129 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_PULSE_SCHEDULER_H_
+#define INCLUDE_RVS_PULSE_SCHEDULER_H_
+
+#include <stdint.h>
+
+#include <vector>
+
+namespace rvs {
+
+//! timing of one completed pulse (high phase followed by low phase)
+struct pulse_timing_t {
+  //! pulse number (0 based)
+  uint64_t pulse;
+  //! actual high phase duration in ms
+  double high_ms;
+  //! actual low phase duration in ms
+  double low_ms;
+  //! lateness of the high phase start against the schedule in us
+  double drift_us;
+};
+
+//! phase boundary jitter summary
+struct pulse_jitter_t {
+  //! number of phase starts
+  uint64_t boundaries;
+  //! median lateness of the phase starts in us
+  double p50_us;
+  //! 90th percentile lateness in us
+  double p90_us;
+  //! 99th percentile lateness in us
+  double p99_us;
+  //! largest lateness in us
+  double max_us;
+  //! lateness of the last pulse start (cumulative drift) in us
+  double drift_us;
+};
+
+/**
+ * @class pulse_scheduler
+ * @ingroup RVS
+ *
+ * @brief High/low phase scheduler on absolute CLOCK_MONOTONIC deadlines
+ *
+ * Phase boundaries are planned from the start of the run (pulse k starts at
+ * k * period, its low phase at k * period + high), so a late phase shortens
+ * the following one instead of shifting every later boundary. Waits sleep
+ * with clock_nanosleep(TIMER_ABSTIME) and busy-wait the last spin_us.
+ *
+ * The workload drives the phases: begin_phase(), run until expired() (or
+ * wait_deadline()), end_phase().
+ *
+ */
+class pulse_scheduler {
+ public:
+  pulse_scheduler(double high_ms, double low_ms, double spin_us);
+
+  static int64_t now_ns(void);
+  void sleep_until(int64_t deadline_ns) const;
+
+  void start(void);
+  void begin_phase(void);
+  //! TRUE if the current phase is the high phase
+  bool high_phase(void) const { return is_high; }
+  //! planned end of the current phase (CLOCK_MONOTONIC ns)
+  int64_t deadline_ns(void) const { return phase_end_ns; }
+  //! TRUE once the planned end of the current phase is reached
+  bool expired(void) const { return now_ns() >= phase_end_ns; }
+  //! waits for the planned end of the current phase
+  void wait_deadline(void) const { sleep_until(phase_end_ns); }
+  bool end_phase(pulse_timing_t* timing);
+
+  pulse_jitter_t jitter(void) const;
+
+ protected:
+  //! high phase length in ns
+  int64_t high_ns;
+  //! low phase length in ns
+  int64_t low_ns;
+  //! busy-wait tail in ns
+  int64_t spin_ns;
+  //! start of the schedule
+  int64_t t0_ns;
+  //! pulses started
+  uint64_t pulse;
+  //! TRUE in the high phase
+  bool is_high;
+  //! planned start of the current phase
+  int64_t phase_plan_ns;
+  //! actual start of the current phase
+  int64_t phase_start_ns;
+  //! planned end of the current phase
+  int64_t phase_end_ns;
+  //! actual high phase duration of the current pulse in ns
+  int64_t high_actual_ns;
+  //! lateness of the current pulse start in ns
+  int64_t pulse_late_ns;
+  //! lateness of every phase start in ns
+  std::vector<int64_t> lateness_ns;
+};
+
+double percentile(std::vector<double> values, double p);
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_PULSE_SCHEDULER_H_
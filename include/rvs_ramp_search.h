@@ -0,0 +1,148 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_RAMP_SEARCH_H_
+#define INCLUDE_RVS_RAMP_SEARCH_H_
+
+#include <stdint.h>
+
+#include <deque>
+
+#include "include/rvs_gemm_engine.h"
+
+namespace rvs {
+
+double student_t95(uint64_t dof);
+
+/**
+ * @class steady_state_window
+ * @ingroup RVS
+ *
+ * @brief Rolling window of throughput measurements with a steady state test
+ *
+ * The window is steady when it is full, the 95% confidence interval of its
+ * mean is within +/- precision (relative) and the means of its older and
+ * newer halves differ by less than the precision (no trend left).
+ *
+ */
+class steady_state_window {
+ public:
+  steady_state_window(uint64_t _size, double _precision);
+
+  void clear(void);
+  void add(double x);
+
+  //! TRUE if the window holds size samples
+  bool full(void) const { return samples.size() >= size; }
+  //! number of samples in the window
+  uint64_t count(void) const { return samples.size(); }
+  double mean(void) const;
+  double stddev(void) const;
+  double ci_half_width(void) const;
+  double trend(void) const;
+  bool converged(void) const;
+
+ protected:
+  //! window length
+  uint64_t size;
+  //! relative precision
+  double precision;
+  //! measurements, oldest first
+  std::deque<double> samples;
+};
+
+//! parameters of gemm_ramp_control
+struct gemm_ramp_config_t {
+  //! target GFLOPS (0 - no target, the ramp only establishes steady state)
+  double target = 0;
+  //! relative tolerance on the target
+  double tolerance = 0;
+  //! measurements in the rolling window
+  uint64_t window = 10;
+  //! relative half width of the 95% confidence interval
+  double precision = 0.01;
+  //! shortest accepted batch in ms, shorter batches grow
+  double min_batch_ms = 50;
+  //! largest batch in GEMMs
+  uint64_t max_calls = 65536;
+};
+
+/**
+ * @class gemm_ramp_control
+ * @ingroup RVS
+ *
+ * @brief Control policy ending a ramp as soon as steady state throughput is
+ * established
+ *
+ * Each batch is one measurement. Batches shorter than min_batch_ms are not
+ * measured; the batch size grows so that the next one lasts about
+ * min_batch_ms and the window restarts. Once the window is steady the run
+ * passes if the mean throughput meets the target (within tolerance) and
+ * fails otherwise.
+ *
+ */
+class gemm_ramp_control {
+ public:
+  gemm_ramp_control(const gemm_ramp_config_t& _cfg, double _gflop_per_gemm);
+
+  //! TRUE if the run has to end before the next batch
+  bool stop(void) const { return false; }
+  //! idle time before the next batch in microseconds
+  uint64_t idle_us(void) { return 0; }
+  uint64_t calls(uint64_t configured);
+  gemm_action on_batch(uint64_t calls, double batch_us);
+  //! decision at the end of an interval
+  gemm_action on_interval(const gemm_interval_t&) {
+    return gemm_action::proceed;
+  }
+
+  //! TRUE once steady state was established
+  bool converged(void) const { return is_converged; }
+  bool target_met(void) const;
+  //! mean GFLOPS of the window
+  double gflops(void) const { return window.mean(); }
+  double cv(void) const;
+  //! GEMM time in seconds until steady state (or the end of the run)
+  double ramp_seconds(void) const { return busy_us / 1e6; }
+  //! GEMMs per batch in use
+  uint64_t batch_calls(void) const { return num_calls; }
+
+ protected:
+  //! ramp parameters
+  gemm_ramp_config_t cfg;
+  //! GFLOP of one GEMM
+  double gflop_per_gemm;
+  //! measurement window
+  steady_state_window window;
+  //! GEMMs per batch (0 - not set yet)
+  uint64_t num_calls;
+  //! GEMM time so far in microseconds
+  double busy_us;
+  //! TRUE once steady state was established
+  bool is_converged;
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_RAMP_SEARCH_H_
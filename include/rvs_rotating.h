@@ -0,0 +1,95 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_ROTATING_H_
+#define INCLUDE_RVS_ROTATING_H_
+
+#include <stdint.h>
+
+#include <string>
+
+namespace rvs {
+
+//! rotating buffer set sizing policy
+enum class rotating_mode {
+  //! working set given in MB (rotating key)
+  fixed,
+  //! working set sized from the cache so every GEMM reads cold inputs
+  cold,
+  //! working set sized to stay resident in the cache
+  cache
+};
+
+bool rotating_mode_parse(const std::string& name, rotating_mode* pmode);
+const char* rotating_mode_name(rotating_mode mode);
+
+//! parameters of rotating_plan()
+struct rotating_config_t {
+  //! sizing policy
+  rotating_mode mode = rotating_mode::fixed;
+  //! requested working set in bytes (fixed)
+  uint64_t fixed_bytes = 0;
+  //! last level cache (MALL or L2) size in bytes (0 - unknown)
+  uint64_t cache_bytes = 0;
+  //! cold: bytes touched between two uses of a block in cache sizes,
+  //! cache: cache size over working set
+  double margin = 2.0;
+  //! most blocks ever used (GEMM calls per batch)
+  uint64_t max_blocks = 1;
+  //! largest working set in bytes (0 - unlimited)
+  uint64_t max_bytes = 0;
+};
+
+//! rotating buffer set
+struct rotating_plan_t {
+  //! number of blocks (copies of the GEMM operands)
+  uint64_t blocks;
+  //! bytes one GEMM call touches
+  uint64_t block_bytes;
+  //! effective working set in bytes (blocks * block_bytes)
+  uint64_t working_set;
+  //! cache known and every block is evicted before it is used again
+  bool cold;
+  //! cache known and the working set fits in it
+  bool resident;
+  //! blocks limited by max_blocks or max_bytes
+  bool capped;
+};
+
+rotating_plan_t rotating_plan(const rotating_config_t& cfg,
+                              uint64_t block_bytes);
+std::string rotating_summary(const rotating_config_t& cfg,
+                             const rotating_plan_t& plan);
+
+/**
+ * @brief Rounds bytes up to a multiple of alignment (power of 2)
+ *
+ * */
+inline uint64_t rotating_align(uint64_t bytes, uint64_t alignment) {
+  return (bytes + alignment - 1) & ~(alignment - 1);
+}
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_ROTATING_H_
@@ -0,0 +1,171 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_TELEMETRY_CORR_H_
+#define INCLUDE_RVS_TELEMETRY_CORR_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace rvs {
+
+/**
+ * @class telemetry_corr
+ * @ingroup RVS
+ *
+ * @brief Correlates GEMM throughput intervals with GPU telemetry
+ *
+ * Telemetry samples (power, power cap, temperature, GFX clock, throttle
+ * status) and throughput intervals are stored in the same steady clock
+ * timebase (rvs_blas::get_time_us()). Every interval whose GFLOPS fall
+ * more than dip_threshold below the median interval is reported as a dip,
+ * annotated with the telemetry seen during the interval and the most
+ * likely cause. Samples may be added from a telemetry thread while the
+ * GEMM thread adds intervals. Traces can be saved and loaded as text, so
+ * the analysis can be rerun on recorded runs.
+ *
+ */
+class telemetry_corr {
+ public:
+  //! one telemetry sample, negative values (0 for throttle) if unknown
+  struct sample_t {
+    //! steady clock time in microseconds
+    double t_us;
+    //! socket power in W
+    double power_w;
+    //! power cap in W
+    double power_cap_w;
+    //! junction (or edge) temperature in C
+    double temp_c;
+    //! temperature limit in C
+    double temp_limit_c;
+    //! current GFX clock in MHz
+    double gfx_mhz;
+    //! highest GFX clock level in MHz
+    double gfx_max_mhz;
+    //! throttle status bits as reported by the GPU
+    uint64_t throttle;
+  };
+
+  //! one throughput interval
+  struct interval_t {
+    //! steady clock time at the end of the interval in microseconds
+    double end_us;
+    //! interval duration in seconds
+    double seconds;
+    //! GFLOPS achieved in the interval
+    double gflops;
+  };
+
+  //! most likely cause of a throughput dip
+  enum class cause_t {
+    //! temperature at (or near) its limit
+    thermal,
+    //! power at (or near) its cap
+    power_cap,
+    //! GPU reported throttling without thermal or power evidence
+    throttle,
+    //! GFX clock dropped without a reported reason
+    clock,
+    //! GPU state was nominal (host side or workload cause)
+    unknown,
+    //! no telemetry sample covers the interval
+    no_telemetry
+  };
+
+  //! throughput dip annotated with the concurrent telemetry
+  struct dip_t {
+    //! interval number (0 based)
+    size_t index;
+    //! the interval
+    interval_t interval;
+    //! GFLOPS below the reference as a fraction of the reference
+    double drop;
+    //! telemetry samples taken during the interval
+    size_t samples;
+    //! highest power in W
+    double max_power_w;
+    //! power cap in W
+    double power_cap_w;
+    //! highest temperature in C
+    double max_temp_c;
+    //! temperature limit in C
+    double temp_limit_c;
+    //! lowest GFX clock in MHz
+    double min_gfx_mhz;
+    //! throttle status bits seen during the interval (OR)
+    uint64_t throttle;
+    //! most likely cause
+    cause_t cause;
+  };
+
+  //! analysis parameters
+  struct config_t {
+    //! dip : GFLOPS more than this fraction below the median interval
+    double dip_threshold = 0.1;
+    //! thermal : temperature within this many C of the limit
+    double temp_margin_c = 5.0;
+    //! power cap : power within this fraction of the cap
+    double power_margin = 0.05;
+    //! clock : GFX clock more than this fraction below the run median
+    double clock_drop = 0.1;
+  };
+
+  telemetry_corr() = default;
+
+  void add_sample(const sample_t& s);
+  void add_interval(const interval_t& iv);
+  void clear(void);
+
+  std::vector<sample_t> get_samples(void) const;
+  std::vector<interval_t> get_intervals(void) const;
+
+  double reference_gflops(void) const;
+  std::vector<dip_t> analyze(const config_t& cfg) const;
+
+  bool save(std::ostream& os) const;
+  bool load(std::istream& is);
+
+  static const char* cause_name(cause_t c);
+  static std::string describe(const dip_t& d);
+
+ protected:
+  static double median(std::vector<double> v);
+
+  //! guards samples and intervals
+  mutable std::mutex mtx;
+  //! telemetry samples in time order
+  std::vector<sample_t> samples;
+  //! throughput intervals in time order
+  std::vector<interval_t> intervals;
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_TELEMETRY_CORR_H_
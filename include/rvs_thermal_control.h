@@ -0,0 +1,217 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVS_THERMAL_CONTROL_H_
+#define INCLUDE_RVS_THERMAL_CONTROL_H_
+
+#include <stdint.h>
+
+namespace rvs {
+
+/**
+ * @class thermal_model_estimator
+ * @ingroup RVS
+ *
+ * @brief Online identification of a first order thermal model
+ *
+ * The temperature rise over idle x follows x[k+1] = a * x[k] + b * u[k]
+ * for a load command u in [0, 1]. a and b are estimated by recursive least
+ * squares with exponential forgetting (suspended while the covariance is
+ * large, so a steady hold does not wind it up). The thermal time constant is
+ * -dt / ln(a) and the rise at full load b / (1 - a).
+ *
+ */
+class thermal_model_estimator {
+ public:
+  explicit thermal_model_estimator(double _forgetting = 0.995);
+
+  void reset(void);
+  void add(double x, double u, double x_next, double dt_s);
+
+  //! TRUE if the estimate describes a stable, heating plant
+  bool valid(void) const { return a > 0 && a < 1 && b > 0; }
+  //! pole of the discrete model
+  double get_a(void) const { return a; }
+  //! input gain of the discrete model
+  double get_b(void) const { return b; }
+  //! mean sample period in seconds
+  double sample_period(void) const { return dt; }
+  double time_constant(void) const;
+  double full_load_rise(void) const;
+  //! number of samples seen
+  uint64_t samples(void) const { return num_samples; }
+
+ protected:
+  //! forgetting factor
+  double forgetting;
+  //! pole estimate
+  double a;
+  //! input gain estimate
+  double b;
+  //! covariance of (a, b)
+  double p[2][2];
+  //! mean sample period
+  double dt;
+  //! number of samples
+  uint64_t num_samples;
+};
+
+//! parameters of thermal_mpc
+struct thermal_mpc_config_t {
+  //! target temperature in C
+  double target_c = 0;
+  //! prediction horizon in samples (target reached in this many samples)
+  uint32_t horizon = 8;
+  //! weight of command changes against the squared tracking error
+  double move_weight = 0;
+  //! lowest command (the GPU is never left idle)
+  double min_command = 0.05;
+  //! samples identified before the model is used
+  uint32_t min_samples = 5;
+  //! temperature rise over idle needed before the model is used in C
+  double min_rise_c = 3;
+  //! weight of a new one step prediction error in the disturbance estimate
+  double disturbance_gain = 0.3;
+  //! forgetting factor of the model estimator
+  double forgetting = 0.995;
+};
+
+/**
+ * @class thermal_mpc
+ * @ingroup RVS
+ *
+ * @brief Model predictive temperature controller
+ *
+ * The first sample is taken as the idle temperature. Until the thermal model
+ * is identified the GPU runs at full load (minimum load once at or above the
+ * target). Then, at every sample, the command held over the horizon is the
+ * one minimizing the squared tracking error over the horizon (plus the move
+ * penalty), on the approach subject to no predicted temperature above the
+ * target. The nominal closed loop approaches the target monotonically and
+ * reaches it in about horizon samples from wherever full load no longer
+ * overshoots. The model is identified on the approach and frozen once the
+ * target is reached; a disturbance estimated from the one step prediction
+ * errors then absorbs model mismatch, so it leaves no steady state offset.
+ *
+ */
+class thermal_mpc {
+ public:
+  explicit thermal_mpc(const thermal_mpc_config_t& _cfg);
+
+  double update(double t_s, double temp_c);
+
+  //! returns the last command
+  double command(void) const { return cmd; }
+  //! TRUE once the model is used
+  bool model_ready(void) const { return ready; }
+  //! TRUE once the target was reached
+  bool holding(void) const { return held; }
+  //! idle temperature in C
+  double idle_temperature(void) const { return idle_c; }
+  //! model estimator
+  const thermal_model_estimator& model(void) const { return estimator; }
+  //! temperature predicted for the next sample in C
+  double predicted(void) const { return idle_c + x_pred; }
+
+ protected:
+  double solve(double x) const;
+
+  //! controller parameters
+  thermal_mpc_config_t cfg;
+  //! model estimator
+  thermal_model_estimator estimator;
+  //! TRUE once a sample was seen
+  bool have_prev;
+  //! TRUE once the model is used
+  bool ready;
+  //! TRUE once the target was reached (model frozen, no constraint)
+  bool held;
+  //! idle temperature
+  double idle_c;
+  //! previous sample time
+  double prev_t;
+  //! previous temperature rise
+  double prev_x;
+  //! largest temperature rise so far
+  double max_x;
+  //! predicted temperature rise for the next sample
+  double x_pred;
+  //! disturbance (per sample) estimate
+  double dist;
+  //! last command
+  double cmd;
+};
+
+/**
+ * @class thermal_track_stats
+ * @ingroup RVS
+ *
+ * @brief Time to target, overshoot and hold error of a temperature loop
+ *
+ * The target is reached by the first sample at or above target - band;
+ * samples from then on are the hold phase, whose RMS and largest absolute
+ * error and fraction of samples within +/- band are reported.
+ *
+ */
+class thermal_track_stats {
+ public:
+  thermal_track_stats(double _target_c, double _band_c);
+
+  void add(double t_s, double temp_c);
+
+  //! TRUE once the target was reached
+  bool reached(void) const { return reach_s >= 0; }
+  //! time to target in seconds (-1 if not reached)
+  double time_to_target(void) const { return reach_s; }
+  //! largest temperature above the target in C
+  double overshoot(void) const { return max_over; }
+  double hold_error(void) const;
+  //! largest absolute error in the hold phase in C
+  double hold_max_error(void) const { return hold_max; }
+  double hold_in_band(void) const;
+  //! samples in the hold phase
+  uint64_t hold_samples(void) const { return num_hold; }
+
+ protected:
+  //! target temperature
+  double target_c;
+  //! band around the target
+  double band_c;
+  //! time the target was reached (-1 if not reached)
+  double reach_s;
+  //! largest temperature above the target
+  double max_over;
+  //! sum of squared hold errors
+  double hold_sq;
+  //! largest absolute hold error
+  double hold_max;
+  //! hold samples
+  uint64_t num_hold;
+  //! hold samples within the band
+  uint64_t num_in_band;
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVS_THERMAL_CONTROL_H_
@@ -31,6 +31,7 @@
 #include <type_traits>
 
 #include "include/rvs_util.h"
+#include "include/rvsthreadbase.h"
 namespace rvs {
 
 enum class actionstate {
@@ -66,6 +67,7 @@ class actionbase {
   actionbase();
   void sleep(const unsigned int ms);
   virtual bool get_all_common_config_keys();
+  void set_worker_affinity(rvs::ThreadBase* pworker, uint16_t gpu_id);
  public:
   virtual int property_set(const char*, const char*);
 
@@ -215,6 +217,8 @@ class actionbase {
   uint64_t property_duration;
   //! logging interval
   uint64_t property_log_interval;
+  //! 'true' if per-GPU worker threads are to be pinned to GPU local CPUs
+  bool property_cpu_affinity;
   //! 'true' if JSON logging is required
   bool     bjson ;
 
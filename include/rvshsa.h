@@ -36,6 +36,7 @@
 #include <string>
 #include <vector>
 #include <iomanip>
+#include <functional>
 
 #include "hsa/hsa.h"
 #include "hsa/hsa_ext_amd.h"
@@ -98,6 +99,8 @@ class hsa {
     string                        agent_device_type;
     //! NUMA node this agent belongs to
     uint32_t                      node;
+    //! OS NUMA node of a CPU agent (NO_CONN for non-CPU agents)
+    uint32_t                      numa_node;
     //! system memory pool
     hsa_amd_memory_pool_t         sys_pool;
     /** vector of memory pool HSA handles as reported during mem pool
@@ -159,11 +162,17 @@ class hsa {
       uint32_t warm_calls, uint32_t hot_calls,
       double* Duration);
 
+  int VerifyTraffic(uint32_t SrcNode, uint32_t DstNode, size_t Size,
+      uint64_t Seed, const std::function<void(void*, size_t)>& Inspect,
+      size_t* pMismatch);
+
   int GetPeerStatus(uint32_t SrcNode, uint32_t DstNode);
   int GetPeerStatusAgent(const AgentInformation& SrcAgent,
                          const AgentInformation& DstAgent);
   int GetLinkInfo(uint32_t SrcNode, uint32_t DstNode,
                   uint32_t* pDistance, std::vector<linkinfo_t>* pInfoarr);
+  uint32_t GetNumaDistance(uint32_t SrcNode, uint32_t DstNode);
+  int GetCpuNumaNode(uint32_t Node, uint32_t* pNumaNode);
   double GetCopyTime(bool bidirectional,
                      hsa_signal_t signal_fwd, hsa_signal_t signal_rev);
 
@@ -182,6 +191,9 @@ class hsa {
 
  protected:
   void InitAgents();
+  int CopyWait(void* Dst, hsa_agent_t DstAgent,
+               const void* Src, hsa_agent_t SrcAgent,
+               size_t Size, hsa_signal_t Signal);
 
   static hsa_status_t ProcessAgent(hsa_agent_t agent, void* data);
   static hsa_status_t ProcessMemPool(hsa_amd_memory_pool_t pool, void* data);
@@ -27,6 +27,8 @@
 
 #include <thread>
 
+#include "include/rvsthreadpool.h"
+
 namespace rvs {
 
 /**
@@ -34,6 +36,9 @@ namespace rvs {
  *
  *  @brief Base class for all module level threads
  *
+ *  Thread function is executed on the process-wide rvs::ThreadPool so that
+ *  pool threads are reused across workers and actions.
+ *
  */
 
 class ThreadBase {
@@ -46,6 +51,12 @@ class ThreadBase {
   virtual void detach();
   virtual void join();
   virtual void sleep(const unsigned int ms);
+  //! Set affinity hint (e.g. GPU index) used to pick preferred pool thread
+  void set_affinity_hint(const int hint) { affinity_hint = hint; }
+  //! Set CPUs/NUMA node the thread function is to run on
+  void set_cpu_affinity(const cpu_affinity_t& aff) { cpu_affinity = aff; }
+  //! Get CPUs/NUMA node the thread function runs on
+  const cpu_affinity_t& get_cpu_affinity() { return cpu_affinity; }
 
  protected:
   void runinternal(void);
@@ -54,8 +65,12 @@ class ThreadBase {
   virtual void run() = 0;
 
  protected:
-  //! Underlaying std::thread object.
-  std::thread t;
+  //! Underlaying pool thread handle.
+  PooledThread t;
+  //! Preferred pool queue, -1 if none
+  int affinity_hint;
+  //! CPUs/NUMA node placement (empty - not pinned)
+  cpu_affinity_t cpu_affinity;
 };
 
 }  // namespace rvs
@@ -0,0 +1,210 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVSTHREADPOOL_H_
+#define INCLUDE_RVSTHREADPOOL_H_
+
+#include <stddef.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "include/rvs_affinity.h"
+
+namespace rvs {
+
+/**
+ * @class ThreadPool
+ * @ingroup RVS
+ *
+ * @brief Process-wide work-stealing executor
+ *
+ * Every pool thread owns a task queue. Tasks are pushed to the queue selected
+ * by an affinity hint (e.g. GPU index) and are taken from its back by the
+ * owning thread or stolen from its front by idle threads. Threads are created
+ * on demand and are kept for reuse by subsequent actions.
+ *
+ * Blocking tasks (long running module workers) always get a thread of their
+ * own so that concurrently started workers never wait on each other, while
+ * short tasks (e.g. chunks of host side verification) are limited to
+ * max_threads threads not occupied by blocking tasks to avoid
+ * oversubscription.
+ *
+ * The CPU affinity and memory policy of a pool thread are saved before and
+ * restored after every task, so placement set by a task (through its
+ * descriptor or directly) never leaks into tasks run later on that thread.
+ * Exceptions of tasks submitted directly are logged.
+ *
+ */
+class ThreadPool {
+ public:
+  //! task function type
+  typedef std::function<void()> task_t;
+
+  static ThreadPool* Get();
+  static void Terminate();
+
+  void submit(task_t task, int hint = -1,
+              const cpu_affinity_t& aff = cpu_affinity_t(),
+              bool blocking = false);
+
+  void set_max_threads(size_t val);
+  size_t get_max_threads();
+  size_t size();
+
+ protected:
+  ThreadPool();
+  virtual ~ThreadPool();
+
+  //! task together with its placement
+  struct pool_task {
+    //! task function
+    task_t func;
+    //! CPUs and NUMA memory node to run the task on
+    cpu_affinity_t aff;
+    //! trace flow id connecting submission and execution (0 - none)
+    uint64_t flow_id = 0;
+    //! 'true' for long running task (see submit())
+    bool blocking = false;
+  };
+
+  //! per-thread task queue
+  struct task_queue {
+    //! protects tasks
+    std::mutex mtx;
+    //! queued tasks
+    std::deque<pool_task> tasks;
+  };
+
+  void add_thread();
+  bool pop_task(size_t ix, pool_task* ptask);
+  void worker_loop(size_t ix);
+
+ protected:
+  //! per-thread queues (index aligned with threads)
+  std::vector<std::unique_ptr<task_queue>> queues;
+  //! pool threads
+  std::vector<std::thread> threads;
+  //! protects queues/threads vectors against growth while stealing
+  std::shared_mutex qmtx;
+
+  //! protects counters below
+  std::mutex mtx;
+  //! signals new work or termination
+  std::condition_variable cv;
+  //! number of threads waiting for work
+  size_t idle;
+  //! number of queued tasks not yet picked up
+  size_t pending;
+  //! number of blocking tasks queued or running
+  size_t nblocking;
+  //! oversubscription limit for non-blocking tasks
+  size_t max_threads;
+  //! round robin queue index for tasks without hint
+  size_t next_queue;
+  //! last assigned trace flow id
+  std::atomic<uint64_t> last_flow_id;
+  //! 'true' when pool is shutting down
+  bool bstop;
+
+  //! pointer to pool singleton
+  static ThreadPool* pDsc;
+  //! protects singleton creation
+  static std::mutex init_mtx;
+};
+
+/**
+ * @class TaskGroup
+ * @ingroup RVS
+ *
+ * @brief Set of pool tasks that can be waited for as a whole
+ *
+ * Destroying a group neither cancels nor waits for its tasks. An exception
+ * not collected by wait() is logged once the last task is gone.
+ *
+ */
+class TaskGroup {
+ public:
+  TaskGroup();
+
+  void run(ThreadPool::task_t task, int hint = -1,
+           const cpu_affinity_t& aff = cpu_affinity_t(),
+           bool blocking = false);
+  void wait();
+  bool done();
+
+ protected:
+  //! group state shared with queued tasks
+  struct group_state {
+    ~group_state();
+
+    //! protects members below
+    std::mutex mtx;
+    //! signals completion of last task
+    std::condition_variable cv;
+    //! number of unfinished tasks
+    size_t pending = 0;
+    //! first exception thrown by a task
+    std::exception_ptr error;
+  };
+
+  //! group state
+  std::shared_ptr<group_state> state;
+};
+
+/**
+ * @class PooledThread
+ * @ingroup RVS
+ *
+ * @brief std::thread-like handle for a blocking task run on ThreadPool
+ *
+ */
+class PooledThread {
+ public:
+  PooledThread();
+
+  void start(ThreadPool::task_t task, int hint = -1,
+             const cpu_affinity_t& aff = cpu_affinity_t());
+  bool joinable() const;
+  void join();
+  void detach();
+
+ protected:
+  //! group holding the single task (null if not started/joined/detached)
+  std::unique_ptr<TaskGroup> group;
+  //! id of the pool thread executing the task
+  std::shared_ptr<std::atomic<std::thread::id>> exec_id;
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVSTHREADPOOL_H_
@@ -25,9 +25,12 @@
 #ifndef INCLUDE_RVSTIMER_H_
 #define INCLUDE_RVSTIMER_H_
 
+#include <stdint.h>
+
+#include <atomic>
 #include <chrono>
 
-#include "include/rvsthreadbase.h"
+#include "include/rvstimerservice.h"
 
 namespace rvs {
 
@@ -41,12 +44,13 @@ namespace rvs {
  * It accepts parameter T which is a class which member function will
  * be called upon expiration of timer interval.
  *
- * Timer resolution is 1ms
+ * Timers are armed on the shared rvs::TimerService so an armed timer does not
+ * occupy a thread of its own. Timer resolution is 1ms
  *
  */
 
 template<class T>
-class timer : public ThreadBase {
+class timer {
  public:
   //! helper typedef to simplify member declaration of callback function
   typedef void (T::*timerfunc_t)();
@@ -62,7 +66,10 @@ class timer : public ThreadBase {
 
     cbfunc = cbFunc;
     cbarg = cbArg;
-    brun = false; // enable it when starting the thread
+    brun = false; // enable it when starting the timer
+    brunonce = false;
+    timeset = 0;
+    id = 0;
   }
 
   //! Default destructor
@@ -73,79 +80,64 @@ class timer : public ThreadBase {
   /**
   * @brief Start timer
   *
+  * Restarting an already running timer re-arms it with new interval.
+  *
   * @param Interval Timer interval in ms
   * @param RunOnce 'true' if timer is to fire only once
   *
   * */
   void start(int Interval, bool RunOnce = false) {
+    rvs::TimerService* ptimers = rvs::TimerService::Get();
+
+    if (id != 0) {
+      ptimers->cancel(id);
+    }
+
     brunonce = RunOnce;
     timeset = Interval;
-    end_time = std::chrono::system_clock::now() +
+    end_time = std::chrono::steady_clock::now() +
                std::chrono::milliseconds(timeset);
-    // recalculate the end time and only if thread is not started start it
-    if (brun == false) {
-      brun = true;
-      rvs::ThreadBase::start();
-    }
+    brun = true;
+    id = ptimers->schedule(end_time,
+                           std::chrono::milliseconds(RunOnce ? 0 : timeset),
+                           [this]() { expired(); });
   }
 
 
 /**
  * @brief Stop timer
  *
- * Sets brun member to FALSE thus signaling end of processing.
- * Then it waits for std::thread to exit before returning.
+ * Sets brun member to FALSE and disarms the timer. When called from other
+ * than callback function, it waits for running callback to return.
  *
  * */
   void stop() {
-    // signal thread to exit
     brun = false;
 
-    // wait a bit to make sure thread has exited
-    std::this_thread::yield();
-
-    try {
-      if (t.joinable())
-        t.join();
-    } catch(...) {
+    if (id != 0) {
+      rvs::TimerService::Get()->cancel(id);
+      id = 0;
     }
   }
 
-
+ protected:
 /**
- * @brief Timer internal thread function (called from ThreadBase)
+ * @brief Timer expiration handler (called from rvs::TimerService)
  *
  * */
-  virtual void run() {
-    do {
-      std::chrono::time_point<std::chrono::system_clock> curr_time;
-      // wait for time to ellsapse (or for timer to be stopped)
-      while (brun) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        curr_time = std::chrono::system_clock::now();
-        if (std::chrono::duration_cast<std::chrono::milliseconds>
-                                         (curr_time - end_time).count() >= 0) {
-          break;
-        }
-      }
-
-      // if timer is not stopped, call the callback function
-      if (brun) {
-        (cbarg->*cbfunc)();
-      }
-
-      if (brunonce) {
-        brun = false;
-      } else {
-        end_time = std::chrono::system_clock::now() +
-                   std::chrono::milliseconds(timeset);
-      }
-    } while (brun);
+  void expired() {
+    if (brun) {
+      (cbarg->*cbfunc)();
+    }
+
+    if (brunonce) {
+      brun = false;
+    }
   }
 
  protected:
   //! true for the duration of timer activity
-  bool        brun;
+  std::atomic<bool> brun;
   //! true if timer is to fire only once
   bool        brunonce;
   //! timer interval (ms)
@@ -154,8 +146,10 @@ class timer : public ThreadBase {
   timerfunc_t cbfunc;
   //! ptr to instance of a class to be called-back through cbfunc.
   T*          cbarg;
-  //! time when timer will expire
-  std::chrono::time_point<std::chrono::system_clock> end_time;
+  //! time when timer will first expire
+  std::chrono::time_point<std::chrono::steady_clock> end_time;
+  //! id of armed timer in rvs::TimerService (0 - not armed)
+  uint64_t    id;
 };
 
 }  // namespace rvs
@@ -0,0 +1,130 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVSTIMERSERVICE_H_
+#define INCLUDE_RVSTIMERSERVICE_H_
+
+#include <stdint.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rvs {
+
+/**
+ * @class TimerService
+ * @ingroup RVS
+ *
+ * @brief Process-wide timer service
+ *
+ * All rvs::timer instances are scheduled on a hashed timer wheel served by a
+ * single thread. The thread sleeps on a condition variable until the nearest
+ * deadline (or indefinitely when no timer is armed), so idle timers cost no
+ * periodic wakeups. Deadlines are on the monotonic clock and periodic timers
+ * are rescheduled relative to their previous deadline so they do not drift.
+ *
+ * Callbacks run on the service thread and should be short.
+ *
+ */
+class TimerService {
+ public:
+  //! timer callback type
+  typedef std::function<void()> callback_t;
+  //! monotonic clock used for deadlines
+  typedef std::chrono::steady_clock clock_t;
+
+  static TimerService* Get();
+  static void Terminate();
+
+  uint64_t schedule(clock_t::time_point deadline,
+                    std::chrono::milliseconds period, callback_t callback);
+  void cancel(uint64_t id);
+  uint64_t get_wakeups();
+
+  //! number of wheel slots (1 ms each)
+  static const size_t WHEEL_SLOTS = 512;
+
+ protected:
+  TimerService();
+  virtual ~TimerService();
+
+  //! armed timer
+  struct timer_entry {
+    //! next expiration
+    clock_t::time_point deadline;
+    //! wheel tick the entry is hashed on
+    int64_t tick;
+    //! period, zero for one-shot timers
+    std::chrono::milliseconds period;
+    //! callback function
+    callback_t callback;
+  };
+
+  int64_t to_tick(clock_t::time_point tp);
+  void insert(uint64_t id, timer_entry* pentry);
+  void remove(uint64_t id);
+  bool next_deadline(int64_t now_tick, clock_t::time_point* pdeadline);
+  void run();
+
+ protected:
+  //! armed timers by id
+  std::map<uint64_t, timer_entry> timers;
+  //! wheel slots holding ids of timers due in that slot
+  std::vector<std::vector<uint64_t>> wheel;
+  //! wheel origin
+  clock_t::time_point base;
+  //! last processed wheel tick
+  int64_t last_tick;
+  //! last assigned timer id
+  uint64_t last_id;
+  //! id of timer whose callback is currently running (0 - none)
+  uint64_t running_id;
+  //! number of service thread wakeups
+  uint64_t wakeups;
+  //! 'true' when service is shutting down
+  bool bstop;
+
+  //! protects all members
+  std::mutex mtx;
+  //! wakes service thread on schedule/cancel/stop
+  std::condition_variable cv;
+  //! signals end of a callback
+  std::condition_variable cv_done;
+  //! service thread
+  std::thread thread;
+
+  //! pointer to service singleton
+  static TimerService* pDsc;
+  //! protects singleton creation
+  static std::mutex init_mtx;
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVSTIMERSERVICE_H_
@@ -0,0 +1,179 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef INCLUDE_RVSTRACER_H_
+#define INCLUDE_RVSTRACER_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#define RVS_TRACE_CAT_(a, b) a##b
+#define RVS_TRACE_VAR_(a, b) RVS_TRACE_CAT_(a, b)
+
+//! Trace span covering the rest of the enclosing scope
+#define RVS_TRACE_SCOPE(CAT, NAME) \
+  rvs::trace_scope RVS_TRACE_VAR_(rvs_trace_scope_, __LINE__)(CAT, NAME)
+//! Trace counter sample
+#define RVS_TRACE_COUNTER(CAT, NAME, VAL) \
+  do { \
+    if (rvs::tracer::enabled()) rvs::tracer::counter(CAT, NAME, VAL); \
+  } while (0)
+//! Start of flow (arrow) identified by ID
+#define RVS_TRACE_FLOW_BEGIN(CAT, NAME, ID) \
+  do { \
+    if (rvs::tracer::enabled()) rvs::tracer::flow(CAT, NAME, ID, true); \
+  } while (0)
+//! End of flow (arrow) identified by ID
+#define RVS_TRACE_FLOW_END(CAT, NAME, ID) \
+  do { \
+    if (rvs::tracer::enabled()) rvs::tracer::flow(CAT, NAME, ID, false); \
+  } while (0)
+
+namespace rvs {
+
+/**
+ * @class tracer
+ * @ingroup RVS
+ *
+ * @brief Low overhead event tracer
+ *
+ * Records spans, counters and flow events into per-thread ring buffers and
+ * dumps them in Chrome trace-event JSON format (loadable in Perfetto UI and
+ * chrome://tracing).
+ *
+ * Recording does not take any lock: each thread appends to its own buffer and
+ * publishes it with a release store. When a buffer is full the oldest events
+ * are overwritten. When tracing is disabled each trace point costs a single
+ * relaxed atomic load.
+ *
+ * Event names and categories are stored by pointer and must outlive the
+ * trace, i.e. they have to be string literals or strings returned by intern().
+ *
+ */
+class tracer {
+ public:
+  //! trace event
+  struct event {
+    //! event name
+    const char* name;
+    //! event category
+    const char* cat;
+    //! timestamp (ns since tracer start)
+    int64_t ts;
+    //! duration (ns) for spans, value for counters, id for flows
+    int64_t val;
+    //! Chrome trace event phase ('X', 'C', 's', 'f')
+    char ph;
+  };
+
+  //! per-thread event ring buffer
+  struct thread_buffer {
+    //! ring storage
+    std::vector<event> events;
+    //! total number of events written
+    std::atomic<uint64_t> head;
+    //! OS thread id
+    int tid;
+    //! thread name (empty if not set)
+    std::string name;
+  };
+
+  //! default number of events per thread buffer
+  static const size_t DEFAULT_BUFFER_EVENTS = 65536;
+
+  //! returns 'true' if tracing is enabled
+  static bool enabled() {
+    return benabled.load(std::memory_order_relaxed);
+  }
+  static void enable(bool flag, size_t buffer_events = DEFAULT_BUFFER_EVENTS);
+
+  static int64_t now();
+  static void complete(const char* cat, const char* name,
+                       int64_t start, int64_t end);
+  static void counter(const char* cat, const char* name, int64_t value);
+  static void flow(const char* cat, const char* name, uint64_t id,
+                   bool begin);
+  static void set_thread_name(const std::string& name);
+  static const char* intern(const std::string& str);
+
+  static int dump(const std::string& path);
+  static std::string to_json();
+  static void clear();
+
+ protected:
+  static thread_buffer* get_buffer();
+  static void record(const char* cat, const char* name, char ph,
+                     int64_t ts, int64_t val);
+
+ protected:
+  //! 'true' if tracing is enabled
+  static std::atomic<bool> benabled;
+  //! capacity of newly created thread buffers
+  static size_t buffer_events;
+  //! tracer time origin
+  static std::chrono::steady_clock::time_point base;
+  //! protects buffer list and interned strings
+  static std::mutex mtx;
+  //! buffers of all threads which recorded events
+  static std::vector<thread_buffer*> buffers;
+  //! interned strings
+  static std::vector<std::string*> strings;
+};
+
+/**
+ * @class trace_scope
+ * @ingroup RVS
+ *
+ * @brief RAII helper recording a span from construction to destruction
+ *
+ */
+class trace_scope {
+ public:
+  //! Starts span (if tracing is enabled)
+  trace_scope(const char* cat, const char* name)
+  : cat(cat), name(name), start(tracer::enabled() ? tracer::now() : -1) {
+  }
+  //! Ends span
+  ~trace_scope() {
+    if (start >= 0 && tracer::enabled())
+      tracer::complete(cat, name, start, tracer::now());
+  }
+
+ protected:
+  //! span category
+  const char* cat;
+  //! span name
+  const char* name;
+  //! span start (-1 when tracing was disabled at construction)
+  int64_t start;
+};
+
+}  // namespace rvs
+
+#endif  // INCLUDE_RVSTRACER_H_
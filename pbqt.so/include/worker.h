@@ -0,0 +1,227 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#ifndef PBQT_SO_INCLUDE_WORKER_H_
+#define PBQT_SO_INCLUDE_WORKER_H_
+
+#include <string>
+#include <vector>
+#include <mutex>
+
+#include "include/rvsthreadbase.h"
+#include "include/rvs_faultinject.h"
+
+
+/**
+ * @class pbqtworker
+ * @ingroup PBQT
+ *
+ * @brief Bandwidth test implementation class
+ *
+ * Derives from rvs::ThreadBase and implements actual test functionality
+ * in its run() method.
+ *
+ */
+
+struct peer_pair_t {
+  uint16_t srcnode;
+  uint16_t dstnode;
+  std::string conn_type;
+};
+
+struct gpu_pair_bw_t {
+  int srcGpu;
+  int dstGpu;
+  int srcNode;
+  int dstNode;
+  double avgBandwidthGbPerSec;
+};
+
+namespace rvs {
+class hsa;
+}
+
+class pbqtworker : public rvs::ThreadBase {
+ public:
+  //! default constructor
+  pbqtworker();
+  //! default destructor
+  virtual ~pbqtworker();
+
+  //! stop thread loop and exit thread
+  void stop();
+  //! Sets initiating action name
+  void set_name(const std::string& name) { action_name = name; }
+  //! sets stopping action name
+  void set_stop_name(const std::string& name) { stop_action_name = name; }
+  //! Sets JSON flag
+  void json(const bool flag) { bjson = flag; }
+  //! Returns initiating action name
+  const std::string& get_name(void) { return action_name; }
+
+  int initialize(uint16_t Src, uint16_t Dst, bool Bidirect);
+  int do_transfer();
+  void get_running_data(uint16_t* Src, uint16_t* Dst, bool* Bidirect,
+                        size_t* Size, double* Duration);
+  void get_final_data(uint16_t* Src, uint16_t* Dst, bool* Bidirect,
+                      size_t* Size, double* Duration, bool bReset = true);
+  //! Set transfer index
+  void set_transfer_ix(uint16_t val) { transfer_ix = val; }
+  //! Get transfer index
+  uint16_t get_transfer_ix() { return transfer_ix; }
+  //! Set total number of transfers
+  void set_transfer_num(uint16_t val) { transfer_num = val; }
+  //! Get total number of transfers
+  uint16_t get_transfer_num() { return transfer_num; }
+  //! Set list of test sizes
+  void set_block_sizes(const std::vector<uint32_t>& val) { block_size = val; }
+  void set_conn_type(const std::string& conn){
+      conn_type = conn;
+  }
+  const std::string& get_conn_type(){
+      return conn_type;
+  }
+  void set_hot_calls(uint32_t _hot_calls) { hot_calls = _hot_calls; }
+  //! Set warm calls
+  void set_warm_calls(uint32_t _warm_calls) { warm_calls = _warm_calls; }
+  //! Set b2b
+  void set_b2b(bool _b2b) { b2b = _b2b; }
+  //! Set transfer method
+  void set_transfer_method(std::string _transfer_method) { transfer_method = _transfer_method; }
+  //! Set executor
+  void set_executor(std::string _executor) { executor = _executor; }
+  //! Set subexecutor
+  void set_subexecutor(uint32_t _subexecutor) { subexecutor = _subexecutor; }
+  //! Set transferbench test type (p2p or alltoall)
+  void set_transferbench_test(std::string _test) { transferbench_test = _test; }
+  //! Set alltoall mode (0=copy, 1=read-only, 2=write-only)
+  void set_a2a_mode(uint32_t val) { a2a_mode = val; }
+  //! Set alltoall direct-only flag (1=only direct XGMI links)
+  void set_a2a_direct(uint32_t val) { a2a_direct = val; }
+  //! Set alltoall local flag (1=include self-transfers)
+  void set_a2a_local(uint32_t val) { a2a_local = val; }
+  //! Set number of GPUs for alltoall (0=all detected)
+  void set_a2a_num_gpus(uint32_t val) { a2a_num_gpus = val; }
+  //! Set remote read flag (1=use DST as executor instead of SRC)
+  void set_use_remote_read(uint32_t val) { use_remote_read = val; }
+  //! Set GFX kernel unroll factor
+  void set_gfx_unroll(uint32_t val) { gfx_unroll = val; }
+  //! Set fault injection schedule and seed (native transfers)
+  void set_fault_injection(const std::string& spec, uint64_t seed) {
+    faults.configure(spec, seed);
+    fault_seed = seed;
+  }
+  //! Get fault injection summary (empty - nothing injected)
+  std::string get_fault_summary(void);
+  //! Get per GPU-pair bandwidth results from alltoall
+  const std::vector<gpu_pair_bw_t>& get_gpu_pair_bw() const { return gpu_pair_bw; }
+ protected:
+  virtual void run(void);
+  int check_transfer(uint32_t from_node, uint32_t to_node);
+
+ protected:
+  //! TRUE if JSON output is required
+  bool    bjson;
+  //! Loops while TRUE
+  bool    brun;
+  //! Name of the action which initiated thread
+  std::string  action_name;
+  //! Name of the action which stops thread
+  std::string  stop_action_name;
+
+  //! ptr to RVS HSA singleton wrapper
+  rvs::hsa* pHsa;
+  //! source NUMA node
+  uint16_t src_node;
+  //! destination NUMA node
+  uint16_t dst_node;
+  //! 'true' for bidirectional transfer
+  bool bidirect;
+
+  //! Current size of transfer data
+  size_t current_size;
+
+  //! running total for size (bytes)
+  size_t running_size;
+  //! running total for duration (sec)
+  double running_duration;
+
+  //! final total size (bytes)
+  size_t total_size;
+  //! final total duration (sec)
+  double total_duration;
+
+  //! transfer index
+  uint16_t transfer_ix;
+  //! total number of transfers
+  uint16_t transfer_num;
+
+  //! hot calls
+  uint32_t hot_calls;
+  //! warm calls
+  uint32_t warm_calls;
+  //! 'true' if back-to-back transfers enabled
+  bool b2b;
+
+  //! transfer method - TransferBench or Native
+  std::string transfer_method;
+  //! transferbench test type - p2p or alltoall
+  std::string transferbench_test;
+  //! transfer executor to use - GPU or SDMA
+  std::string executor;
+  //! No. of subexecutors
+  uint32_t subexecutor;
+
+  //! list of test block sizes
+  std::vector<uint32_t> block_size;
+  std::string conn_type;
+
+  //! alltoall mode: 0=copy, 1=read-only, 2=write-only
+  uint32_t a2a_mode;
+  //! alltoall direct-only: 1=only direct XGMI links, 0=full all-to-all
+  uint32_t a2a_direct;
+  //! alltoall local: 1=include self-transfers, 0=exclude
+  uint32_t a2a_local;
+  //! number of GPUs for alltoall (0=all detected)
+  uint32_t a2a_num_gpus;
+  //! remote read: 1=use DST as executor, 0=use SRC
+  uint32_t use_remote_read;
+  //! GFX kernel unroll factor
+  uint32_t gfx_unroll;
+
+  //! per GPU-pair bandwidth results from alltoall
+  std::vector<gpu_pair_bw_t> gpu_pair_bw;
+
+  //! synchronization mutex
+  std::mutex cntmutex;
+
+  //! faults injected into native transfers
+  rvs::faultinject faults;
+  //! transfers checked so far (fault injection check number)
+  uint64_t fault_check;
+  //! fault injection seed (also seeds the transfer data pattern)
+  uint64_t fault_seed;
+};
+
+#endif  // PBQT_SO_INCLUDE_WORKER_H_
@@ -0,0 +1,511 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/worker.h"
+
+#ifdef __cplusplus
+extern "C" {
+  #endif
+  #include <pci/pci.h>
+  #include <linux/pci.h>
+  #ifdef __cplusplus
+}
+#endif
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <algorithm>
+#include <utility>
+#include <iostream>
+#include <mutex>
+
+#include "include/rvs_module.h"
+#include "include/pci_caps.h"
+#include "include/gpu_util.h"
+#include "include/rvsloglp.h"
+#include "include/rvshsa.h"
+#include "include/rvs_affinity.h"
+#include "include/rvstracer.h"
+
+#include <cstdio>
+#include "TransferBench.hpp"
+
+#define MODULE_NAME "PEBB"
+
+using std::string;
+using std::vector;
+using std::map;
+
+extern uint64_t time_diff(
+                std::chrono::time_point<std::chrono::system_clock> t_end,
+                std::chrono::time_point<std::chrono::system_clock> t_start);
+extern uint64_t test_duration;
+ 
+pebbworker::pebbworker() {
+  // set to 'true' so that do_transfer() will also work
+  // when parallel: false
+  brun = true;
+  loglevel = rvs::logerror;
+  numa_node = rvs::hsa::NO_CONN;
+  numa_distance = rvs::hsa::NO_CONN;
+  fault_check = 0;
+  fault_seed = 0;
+}
+pebbworker::~pebbworker() {}
+
+/**
+ * @brief Thread function
+ *
+ * Loops while brun == TRUE and performs polled monitoring avery 1msec.
+ *
+ * */
+void pebbworker::run() {
+  std::chrono::time_point<std::chrono::system_clock> pebb_start_time;
+  std::chrono::time_point<std::chrono::system_clock> pebb_end_time;
+  std::string msg;
+
+  msg = "[" + action_name + "] pebb thread " + std::to_string(src_node) + " "
+  + std::to_string(dst_node) + " has started";
+  rvs::lp::Log(msg, rvs::logdebug);
+
+  if (rvs::tracer::enabled()) {
+    rvs::tracer::set_thread_name("pebb " + std::to_string(src_node) + "->" +
+                                 std::to_string(dst_node));
+  }
+
+  pin_thread();
+
+  brun = true;
+
+  pebb_start_time = std::chrono::system_clock::now();
+  do{
+    do_transfer();
+
+    pebb_end_time = std::chrono::system_clock::now();
+
+    uint64_t test_time = time_diff(pebb_end_time, pebb_start_time) ;
+
+    if(test_time >= test_duration) {
+        break;
+    }
+  } while (brun);
+
+  msg = "[" + action_name + "] pebb thread " + std::to_string(src_node) + " "
+  + std::to_string(dst_node) + " has finished";
+  rvs::lp::Log(msg, rvs::logdebug);
+}
+
+/**
+ * @brief Pin calling thread to the CPUs of the selected NUMA node
+ *
+ * No-op if no CPU set has been assigned to this transfer.
+ *
+ * @return 0 - if successfull, non-zero otherwise
+ *
+ * */
+int pebbworker::pin_thread() {
+  std::string msg;
+
+  if (cpuset.empty())
+    return 0;
+
+  int sts = rvs::affinity::set_thread_affinity(cpuset);
+  if (sts) {
+    msg = "[" + action_name + "] pebb transfer " + std::to_string(src_node)
+        + " " + std::to_string(dst_node) + " could not pin thread to cpus "
+        + rvs::affinity::cpu_list_to_string(cpuset);
+    rvs::lp::Log(msg, rvs::logerror);
+  }
+  return sts;
+}
+
+/**
+ * @brief Stop processing
+ *
+ * Sets brun member to FALSE thus signaling end of processing.
+ * Then it waits for std::thread to exit before returning.
+ *
+ * */
+void pebbworker::stop() {
+  std::string msg;
+
+  msg = "[" + stop_action_name + "] pebb transfer " + std::to_string(src_node)
+      + " "       + std::to_string(dst_node) + " in pebbworker::stop()";
+  rvs::lp::Log(msg, rvs::logtrace);
+
+  brun = false;
+}
+
+/**
+ * @brief Init worker object and set transfer parameters
+ *
+ * @param Src source NUMA node
+ * @param Dst destination NUMA node
+ * @param h2d 'true' for host to device transfer
+ * @param d2h 'true' for device to host transfer
+ * @return 0 - if successfull, non-zero otherwise
+ *
+ * */
+int pebbworker::initialize(uint16_t Src, uint16_t Dst, bool h2d, bool d2h) {
+  src_node = Src;
+  dst_node = Dst;
+  bidirect = d2h && h2d;
+
+  prop_d2h = d2h;
+  prop_h2d = h2d;
+
+  pHsa = rvs::hsa::Get();
+
+  running_size = 0;
+  running_duration = 0;
+
+  total_size = 0;
+  total_duration = 0;
+
+  return 0;
+}
+
+/**
+ * @brief Executes data transfer
+ *
+ * Based on transfer parameters, initiates and performs one way or
+ * bidirectional data transfer. Resulting measurements are compounded in running
+ * totals for periodical printout during the test.
+ * @return 0 - if successfull, non-zero otherwise
+ *
+ * */
+int pebbworker::do_transfer() {
+
+  double duration;
+  int sts = -1;
+  unsigned int startsec;
+  unsigned int startusec;
+  unsigned int endsec;
+  unsigned int endusec;
+  std::string msg;
+
+  RVSTRACE_
+
+  brun = true;
+  if (loglevel >= rvs::logdebug)
+    rvs::lp::get_ticks(&startsec, &startusec);
+
+  if (transfer_method == "transferbench") {
+
+    size_t transfer_block_size = 0;
+    if(block_size.size() > 0) {
+      transfer_block_size = block_size[0];
+    }
+    else {
+      msg = "Transfer block size not set !";
+      rvs::lp::Err(msg, MODULE_NAME, action_name);
+      return -1;
+    }
+
+    // Configure TransferBench parameters
+    TransferBench::ConfigOptions cfg;
+
+    cfg.general.numIterations = hot_calls;
+    cfg.general.numWarmups = warm_calls;
+    cfg.gfx.unrollFactor = gfx_unroll;
+
+    // Set Memory types
+    auto str_to_memtype = [](const std::string& mem) -> TransferBench::MemType {
+      if (mem == "cpu")           return TransferBench::MEM_CPU;
+      if (mem == "gpu")           return TransferBench::MEM_GPU;
+      if (mem == "null")          return TransferBench::MEM_NULL;
+      return TransferBench::MEM_NULL;
+    };
+
+    TransferBench::MemType src_mem = str_to_memtype(source_memory);
+    TransferBench::MemType dst_mem = str_to_memtype(destination_memory);
+
+    std::vector<TransferBench::Transfer> transfers(bidirect? 2 : 1);
+
+    transfers[0].numBytes = transfer_block_size;
+
+    uint16_t _src_node;
+    uint16_t _dst_node;
+
+    if (!prop_h2d && prop_d2h) {
+      _src_node = dst_node;
+      _dst_node = src_node;
+    } else {
+      _src_node = src_node;
+      _dst_node = dst_node;
+    }
+
+    if(src_mem != TransferBench::MEM_NULL) {
+      transfers[0].srcs.push_back({src_mem,
+          src_mem == TransferBench::MEM_GPU ? _src_node - TransferBench::GetNumExecutors(TransferBench::EXE_CPU) : _src_node});
+    }
+
+    if(dst_mem != TransferBench::MEM_NULL) {
+      transfers[0].dsts.push_back({dst_mem,
+          dst_mem == TransferBench::MEM_GPU ? _dst_node - TransferBench::GetNumExecutors(TransferBench::EXE_CPU) : _dst_node});
+    }
+
+    transfers[0].exeDevice = {executor == "gfx" ? TransferBench::EXE_GPU_GFX : TransferBench::EXE_GPU_DMA,
+      dst_node - TransferBench::GetNumExecutors(TransferBench::EXE_CPU)};
+
+    transfers[0].exeSubIndex = -1;
+    transfers[0].numSubExecs = subexecutor;
+
+    if (bidirect) {
+      transfers[1].numBytes = transfer_block_size;
+
+      if(dst_mem != TransferBench::MEM_NULL) {
+        transfers[1].srcs.push_back({dst_mem,
+            dst_mem == TransferBench::MEM_GPU ? _dst_node - TransferBench::GetNumExecutors(TransferBench::EXE_CPU) : _dst_node});
+      }
+
+      if(src_mem != TransferBench::MEM_NULL) {
+        transfers[1].dsts.push_back({src_mem,
+            src_mem == TransferBench::MEM_GPU ? _src_node - TransferBench::GetNumExecutors(TransferBench::EXE_CPU) : _src_node});
+      }
+
+      transfers[1].exeDevice = {executor == "gfx" ? TransferBench::EXE_GPU_GFX : TransferBench::EXE_GPU_DMA,
+        dst_node - TransferBench::GetNumExecutors(TransferBench::EXE_CPU)};
+
+      transfers[1].exeSubIndex = -1;
+      transfers[1].numSubExecs = subexecutor;
+    }
+
+    TransferBench::TestResults results;
+    bool tb_ok;
+
+    // Initiate TransferBench transfer
+    {
+      RVS_TRACE_SCOPE("pebb", "pebb_copy");
+      tb_ok = TransferBench::RunTransfers(cfg, transfers, results);
+    }
+    if (!tb_ok) {
+      for (auto const& err : results.errResults) {
+        msg = "Transferbench error: " + err.errMsg;
+        rvs::lp::Err(msg, MODULE_NAME, action_name);
+        return -1;
+      }
+    }
+
+    // Update running totals
+    {
+      std::lock_guard<std::mutex> lk(cntmutex);
+      const auto& res = results.tfrResults[0];
+
+      running_size += results.numTimedIterations * res.numBytes;
+      running_duration += (res.avgDurationMsec/1000) * results.numTimedIterations;
+    }
+  }
+  else {
+
+    if (block_size.size() == 0) {
+      RVSTRACE_
+        block_size = pHsa->size_list;
+    }
+
+    for (size_t i = 0; brun && i < block_size.size(); i++) {
+      RVSTRACE_
+        current_size = block_size[i];
+
+      if (rvs::lp::Stopping()) {
+        RVSTRACE_
+          return -1;
+      }
+
+      // Check if unidirectional device(GPU) to host (CPU)
+      // if so, swap source and destination node
+      uint32_t from_node = src_node;
+      uint32_t to_node = dst_node;
+      if (!prop_h2d && prop_d2h) {
+        RVSTRACE_
+        std::swap(from_node, to_node);
+      }
+      {
+        RVS_TRACE_SCOPE("pebb", "pebb_copy");
+        sts = pHsa->SendTraffic(from_node, to_node, current_size,
+            bidirect, b2b, warm_calls, hot_calls, &duration);
+      }
+      if (sts == 0 && faults.enabled()) {
+        RVSTRACE_
+        sts = check_transfer(from_node, to_node);
+      }
+      if (sts) {
+        std::string msg = "internal error, src: " + std::to_string(src_node)
+          + "   dst: " + std::to_string(dst_node)
+          + "   current size: " + std::to_string(current_size)
+          + " status "+ std::to_string(sts);
+        rvs::lp::Err(msg, MODULE_NAME, action_name);
+        return sts;
+      }
+
+      {
+        RVSTRACE_
+          std::lock_guard<std::mutex> lk(cntmutex);
+        running_size += current_size * hot_calls;
+        running_duration += duration;
+      }
+    }
+  }
+
+  RVSTRACE_
+  if (loglevel >= rvs::logdebug) {
+    RVSTRACE_
+    std::string msg;
+    msg = "[" + action_name + "] pebb transfer " + std::to_string(src_node)
+        + " " + std::to_string(dst_node) + " ";
+
+    rvs::lp::get_ticks(&endsec, &endusec);
+    rvs::lp::Log(msg + "start", rvs::logdebug, startsec, startusec);
+    rvs::lp::Log(msg + "finish", rvs::logdebug, endsec, endusec);
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Get running cumulatives for data trnasferred and time ellapsed
+ *
+ * @param Src [out] source NUMA node
+ * @param Dst [out] destination NUMA node
+ * @param Bidirect [out] 'true' for bidirectional transfer
+ * @param Size [out] cumulative size of transferred data in this sampling
+ * interval (in bytes)
+ * @param Duration [out] cumulative duration of transfers in this sampling
+ * interval (in seconds)
+ *
+ * */
+void pebbworker::get_running_data(uint16_t* Src,  uint16_t* Dst, bool* Bidirect,
+                                 size_t* Size, double* Duration) {
+  // lock data until totalling has finished
+  std::lock_guard<std::mutex> lk(cntmutex);
+
+  // update total
+  total_size += running_size;
+  total_duration += running_duration;
+
+  *Src = src_node;
+  *Dst = dst_node;
+  *Bidirect = bidirect;
+  *Size = running_size;
+  *Duration = running_duration;
+
+  // reset running totas
+  running_size = 0;
+  running_duration = 0;
+}
+
+/**
+ * @brief Get final cumulatives for data transferred and time elapsed.
+ *
+ * @param Src [out] source NUMA node
+ * @param Dst [out] destination NUMA node
+ * @param Bidirect [out] 'true' for bidirectional transfer
+ * @param Size [out] cumulative size of transferred data in
+ * this test (in bytes)
+ * @param Duration [out] cumulative duration of transfers in
+ * this test (in seconds)
+ * @param bReset [in] if 'true' set final totals to zero
+ *
+ * */
+void pebbworker::get_final_data(uint16_t* Src, uint16_t* Dst, bool* Bidirect,
+                               size_t* Size, double* Duration, bool bReset) {
+  // lock data until totalling has finished
+  std::lock_guard<std::mutex> lk(cntmutex);
+
+  // update total
+  total_size += running_size;
+  total_duration += running_duration;
+
+  *Src = src_node;
+  *Dst = dst_node;
+  *Bidirect = bidirect;
+  *Size = total_size;
+  *Duration = total_duration;
+
+  // reset running totas
+  running_size = 0;
+  running_duration = 0;
+
+  // reset final totals
+  if (bReset) {
+    total_size = 0;
+    total_duration = 0;
+  }
+}
+
+/**
+ * @brief Get detection statistics of the faults injected into native
+ * transfers (fault_inject)
+ *
+ * @return summary, empty if no fault was injected
+ *
+ * */
+std::string pebbworker::get_fault_summary(void) {
+  rvs::faultinject::stats_t st = faults.get_stats();
+  uint64_t injected = 0;
+
+  for (int k = 0; k < rvs::faultinject::fault_kinds; k++)
+    injected += st.injected[k];
+  return injected ? faults.summary() : std::string();
+}
+
+/**
+ * @brief Verify the data of one transfer and inject scheduled faults into
+ * the host copy of the destination before it is compared (fault_inject)
+ *
+ * The check is untimed and runs after the timed transfers of a block size.
+ * A check is one block size; it counts as detected if the destination
+ * differs from the pattern or an injected copy failure was reported.
+ *
+ * @param from_node transfer source node
+ * @param to_node transfer destination node
+ * @return 0 - if successfull, non-zero otherwise
+ *
+ * */
+int pebbworker::check_transfer(uint32_t from_node, uint32_t to_node) {
+  RVS_TRACE_SCOPE("pebb", "pebb_validation");
+  rvs::faultinject::action_t fault = {false, false, 0, 0};
+  size_t mismatch = 0;
+
+  int sts = pHsa->VerifyTraffic(from_node, to_node, current_size,
+      fault_seed ^ (fault_check * 0xd1b54a32d192ed03ULL),
+      [&](void* data, size_t size) {
+        fault = faults.inject(fault_check, data, size / sizeof(uint32_t),
+                              rvs::faultinject::layout_of<uint32_t>());
+      }, &mismatch);
+  if (sts)
+    return sts;
+
+  faults.report(fault_check++, mismatch > 0 || fault.copy_fail);
+  if (mismatch > 0) {
+    std::string msg = "[" + action_name + "] " + MODULE_NAME
+      + " data mismatch, src: " + std::to_string(from_node)
+      + "   dst: " + std::to_string(to_node)
+      + "   current size: " + std::to_string(current_size)
+      + "   words: " + std::to_string(mismatch);
+    rvs::lp::Log(msg, rvs::loginfo);
+  }
+  return 0;
+}
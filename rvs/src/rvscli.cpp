@@ -190,6 +190,9 @@ void rvs::cli::init_grammar() {
   sp = std::make_shared<optbase>("--listTests", command);
   grammar.insert(gpair("--listTests", sp));
 
+  sp = std::make_shared<optbase>("--trace", command, value);
+  grammar.insert(gpair("--trace", sp));
+
   sp = std::make_shared<optbase>("-v", command);
   grammar.insert(gpair("-v", sp));
   grammar.insert(gpair("--verbose", sp));
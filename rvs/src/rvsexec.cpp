@@ -37,7 +37,10 @@
 #include "include/rvsmodule.h"
 #include "include/rvsliblogger.h"
 #include "include/rvsoptions.h"
+#include "include/rvsthreadpool.h"
+#include "include/rvstimerservice.h"
 #include "include/rvstrace.h"
+#include "include/rvstracer.h"
 #include "include/rvs_util.h"
 
 #define MODULE_NAME_CAPS "CLI"
@@ -127,6 +130,13 @@ int rvs::exec::run() {
     logger::set_json_log_file(s_json_log_file);
   }
 
+  // check --trace option
+  std::string s_trace_file;
+  if (rvs::options::has_option("--trace", &s_trace_file)) {
+    rvs::tracer::enable(true);
+    rvs::tracer::set_thread_name("rvs main");
+  }
+
   string config_file;
   // check -r option
   if (rvs::options::has_option("-r", &val)) {
@@ -344,6 +354,8 @@ int rvs::exec::run() {
   if (rvs::options::has_option("-g")) {
     int sts = do_gpu_list();
     rvs::module::terminate();
+    rvs::TimerService::Terminate();
+    rvs::ThreadPool::Terminate();
     logger::terminate();
     return sts;
   }
@@ -363,6 +375,22 @@ int rvs::exec::run() {
   }
 
   rvs::module::terminate();
+  // stop shared timer and pool threads before their spans are dumped and
+  // the logger they report errors through goes away
+  rvs::TimerService::Terminate();
+  rvs::ThreadPool::Terminate();
+
+  // dump while the logger can still report a failure
+  if (!s_trace_file.empty()) {
+    rvs::tracer::enable(false);
+    if (rvs::tracer::dump(s_trace_file)) {
+      char buff[1024];
+      snprintf(buff, sizeof(buff),
+               "could not write trace file: %s", s_trace_file.c_str());
+      rvs::logger::Err(buff, MODULE_NAME_CAPS);
+    }
+  }
+
   logger::terminate();
 
   DTRACE_
@@ -527,6 +555,8 @@ int rvs::exec::run(std::map<std::string, std::string>& opt) {
     }
 
   rvs::module::terminate();
+  rvs::TimerService::Terminate();
+  rvs::ThreadPool::Terminate();
   logger::terminate();
 
   DTRACE_
@@ -593,6 +623,10 @@ void rvs::exec::do_help() {
 
   cout << "   --listTests     List the test modules present in RVS.\n\n";
 
+  cout << "   --trace         Record execution trace and write it to the specified file\n";
+  cout << "                   in Chrome trace-event JSON format (open in Perfetto UI or\n";
+  cout << "                   chrome://tracing).\n\n";
+
   cout << "-v --verbose       Enable detailed logging. Equivalent to specifying -d 5 option.\n\n";
 
   cout << "-p --parallel      Enables or Disables parallel execution across multiple GPUs.\n";
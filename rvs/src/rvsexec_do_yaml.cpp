@@ -42,6 +42,7 @@
 #include "include/rvsmodule.h"
 #include "include/rvsliblogger.h"
 #include "include/rvsoptions.h"
+#include "include/rvstracer.h"
 #include "include/rvs_util.h"
 #include "include/gpu_util.h"
 
@@ -95,8 +96,12 @@ using std::string;
  */
 int rvs::exec::do_yaml(const std::string& config_file) {
   int sts = 0;
+  YAML::Node config;
 
-  YAML::Node config = YAML::LoadFile(config_file);
+  {
+    RVS_TRACE_SCOPE("config", "yaml_parse");
+    config = YAML::LoadFile(config_file);
+  }
 
   // find "actions" map
   const YAML::Node& actions = config["actions"];
@@ -200,7 +205,10 @@ int rvs::exec::do_yaml(const std::string& config_file) {
       }
 
       // load action properties from yaml file
-      sts += do_yaml_properties(action, rvsmodule, pif1);
+      {
+        RVS_TRACE_SCOPE("config", "yaml_properties");
+        sts += do_yaml_properties(action, rvsmodule, pif1);
+      }
       if (sts) {
         module::action_destroy(pa);
         return sts;
@@ -220,7 +228,11 @@ int rvs::exec::do_yaml(const std::string& config_file) {
       }
 
       // execute action
-      sts = pif1->run();
+      {
+        RVS_TRACE_SCOPE("action", rvs::tracer::enabled() ?
+          rvs::tracer::intern(rvsmodule + ": " + action_info.name) : "");
+        sts = pif1->run();
+      }
 
       // processing finished, release action object
       module::action_destroy(pa);
@@ -562,10 +574,12 @@ int rvs::exec::do_yaml(yaml_data_type_t data_type, const std::string& data) {
 
   if(yaml_data_type_t::YAML_FILE == data_type) {
 
+    RVS_TRACE_SCOPE("config", "yaml_parse");
     config = YAML::LoadFile(data);
   }
   else if(yaml_data_type_t::YAML_STRING == data_type) {
 
+    RVS_TRACE_SCOPE("config", "yaml_parse");
     config = YAML::Load(data);
   }
   else {
@@ -40,6 +40,7 @@
 #include "include/rvsaction.h"
 #include "include/rvsliblog.h"
 #include "include/rvsoptions.h"
+#include "include/rvstracer.h"
 #include "include/rvs_util.h"
 
 #define MODULE_NAME_CAPS "CLI"
@@ -91,7 +92,11 @@ int rvs::module::initialize(const char* pConfig) {
   }
 
   // load list of supported modules from config file
-  YAML::Node config = YAML::LoadFile(pConfig);
+  YAML::Node config;
+  {
+    RVS_TRACE_SCOPE("config", "modules_config_parse");
+    config = YAML::LoadFile(pConfig);
+  }
 
   // verify that that the file format is supported
   YAML::const_iterator it = config.begin();
@@ -146,6 +151,7 @@ rvs::module* rvs::module::find_create_module(const char* name) {
   // not found...
   if (it == modulemap.end()) {
     // ... try opening .so
+    RVS_TRACE_SCOPE("module", "module_load");
 
     // first find proper .so filename
     auto it = filemap.find(std::string(name));
@@ -214,7 +220,12 @@ rvs::module* rvs::module::find_create_module(const char* name) {
     }
 
     // initialize newly loaded module
-    if (m->initialize()) {
+    int init_sts;
+    {
+      RVS_TRACE_SCOPE("module", "module_init");
+      init_sts = m->initialize();
+    }
+    if (init_sts) {
       char buff[1024];
       snprintf(buff, sizeof(buff),
                "could not initialize '%s'", it->second.c_str());
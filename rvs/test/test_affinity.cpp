@@ -0,0 +1,142 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <sys/stat.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_affinity.h"
+#include "include/rvs_unit_testing_defs.h"
+
+using rvs::affinity;
+
+TEST(AffinityTest, parse_cpu_list) {
+  std::vector<int> cpus;
+
+  EXPECT_EQ(affinity::parse_cpu_list("0-3,8,10-11\n", &cpus), 0);
+  EXPECT_EQ(cpus, std::vector<int>({0, 1, 2, 3, 8, 10, 11}));
+
+  EXPECT_EQ(affinity::parse_cpu_list("5", &cpus), 0);
+  EXPECT_EQ(cpus, std::vector<int>({5}));
+
+  EXPECT_EQ(affinity::parse_cpu_list("", &cpus), 0);
+  EXPECT_TRUE(cpus.empty());
+
+  EXPECT_EQ(affinity::parse_cpu_list("3-1", &cpus), -1);
+  EXPECT_TRUE(cpus.empty());
+  EXPECT_EQ(affinity::parse_cpu_list("a-b", &cpus), -1);
+  EXPECT_TRUE(cpus.empty());
+}
+
+TEST(AffinityTest, cpu_list_to_string) {
+  EXPECT_EQ(affinity::cpu_list_to_string({}), "");
+  EXPECT_EQ(affinity::cpu_list_to_string({4}), "4");
+  EXPECT_EQ(affinity::cpu_list_to_string({11, 0, 1, 2, 3, 8, 10, 3}),
+            "0-3,8,10-11");
+}
+
+TEST(AffinityTest, thread_affinity) {
+  std::vector<int> saved;
+  std::vector<int> cpus;
+
+  ASSERT_EQ(affinity::get_thread_affinity(&saved), 0);
+  ASSERT_FALSE(saved.empty());
+
+  EXPECT_EQ(affinity::set_thread_affinity({saved[0]}), 0);
+  EXPECT_EQ(affinity::get_thread_affinity(&cpus), 0);
+  EXPECT_EQ(cpus, std::vector<int>({saved[0]}));
+
+  EXPECT_NE(affinity::set_thread_affinity({}), 0);
+  EXPECT_EQ(affinity::set_thread_affinity(saved), 0);
+}
+
+TEST(AffinityTest, placement) {
+  rvs::cpu_affinity_t aff;
+
+  EXPECT_EQ(affinity::to_string(aff), "numa:: any cpus:: any");
+  aff.numa_node = 1;
+  aff.cpus = {8, 9, 10, 11, 24};
+  EXPECT_EQ(affinity::to_string(aff), "numa:: 1 cpus:: 8-11,24");
+
+  EXPECT_EQ(affinity::set_thread_mem_node(0), 0);
+  EXPECT_EQ(affinity::set_thread_mem_node(-1), 0);
+  EXPECT_NE(affinity::set_thread_mem_node(4096), 0);
+}
+
+TEST(AffinityTest, cpu_numa_nodes) {
+  char tmpl[] = "/tmp/rvs_numa_XXXXXX";
+  ASSERT_NE(mkdtemp(tmpl), nullptr);
+  std::string root = tmpl;
+  auto put = [&root](const std::string& file, const std::string& text) {
+    std::ofstream(root + "/" + file) << text << "\n";
+  };
+
+  // node1 is memory only, node2 is offline (no directory)
+  for (const char* node : {"node0", "node1", "node3"})
+    mkdir((root + "/" + node).c_str(), 0755);
+  put("node0/cpulist", "0-3");
+  put("node1/cpulist", "");
+  put("node3/cpulist", "4-7");
+
+  std::vector<int> nodes;
+  EXPECT_EQ(affinity::cpu_numa_nodes(&nodes, root), 0);
+  EXPECT_EQ(nodes, std::vector<int>({0, 3}));
+
+  // "has_cpu" takes precedence when present
+  put("has_cpu", "0,3-4");
+  EXPECT_EQ(affinity::cpu_numa_nodes(&nodes, root), 0);
+  EXPECT_EQ(nodes, std::vector<int>({0, 3, 4}));
+
+  EXPECT_NE(affinity::cpu_numa_nodes(&nodes, root + "/none"), 0);
+  EXPECT_TRUE(nodes.empty());
+
+  std::string cmd = "rm -rf " + root;
+  ASSERT_EQ(system(cmd.c_str()), 0);
+}
+
+TEST(AffinityTest, save_restore_placement) {
+  rvs::thread_placement_t saved;
+  rvs::thread_placement_t cur;
+
+  ASSERT_EQ(affinity::get_thread_placement(&saved), 0);
+  ASSERT_FALSE(saved.cpus.empty());
+
+  EXPECT_EQ(affinity::set_thread_affinity({saved.cpus[0]}), 0);
+  EXPECT_EQ(affinity::set_thread_mem_node(0), 0);
+  EXPECT_EQ(affinity::get_thread_placement(&cur), 0);
+  EXPECT_EQ(cur.cpus, std::vector<int>({saved.cpus[0]}));
+  EXPECT_NE(cur.mem_mode, saved.mem_mode);
+
+  EXPECT_EQ(affinity::set_thread_placement(saved), 0);
+  EXPECT_EQ(affinity::get_thread_placement(&cur), 0);
+  EXPECT_EQ(cur.cpus, saved.cpus);
+  EXPECT_EQ(cur.mem_mode, saved.mem_mode);
+  EXPECT_EQ(cur.mem_nodes, saved.mem_nodes);
+}
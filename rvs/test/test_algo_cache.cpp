@@ -0,0 +1,102 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_algo_cache.h"
+#include "include/rvs_unit_testing_defs.h"
+
+using rvs::algo_cache;
+
+namespace {
+
+std::string temp_path(const std::string& name) {
+  return "/tmp/rvs_algo_cache_" + std::to_string(getpid()) + "_" + name;
+}
+
+}  // namespace
+
+TEST(AlgoCache, store_and_reload) {
+  std::string path = temp_path("reload");
+  std::remove(path.c_str());
+  algo_cache::entry_t e;
+
+  {
+    algo_cache cache(path);
+    EXPECT_FALSE(cache.lookup("gfx942|1|1024", &e));
+    EXPECT_TRUE(cache.store("gfx942|1|1024", {17, 12.5}));
+    EXPECT_TRUE(cache.lookup("gfx942|1|1024", &e));
+    EXPECT_EQ(e.index, 17);
+  }
+
+  // a new process (instance) sees the saved selection
+  algo_cache cache(path);
+  ASSERT_TRUE(cache.lookup("gfx942|1|1024", &e));
+  EXPECT_EQ(e.index, 17);
+  EXPECT_DOUBLE_EQ(e.time_us, 12.5);
+  std::remove(path.c_str());
+}
+
+// entries saved by another process since loading are kept
+TEST(AlgoCache, concurrent_writers_merge) {
+  std::string path = temp_path("merge");
+  std::remove(path.c_str());
+  algo_cache::entry_t e;
+
+  algo_cache a(path);
+  algo_cache b(path);
+  EXPECT_FALSE(a.lookup("k1", &e));
+  EXPECT_FALSE(b.lookup("k2", &e));
+  EXPECT_TRUE(a.store("k1", {1, 1.0}));
+  EXPECT_TRUE(b.store("k2", {2, 2.0}));
+
+  algo_cache c(path);
+  EXPECT_TRUE(c.lookup("k1", &e));
+  EXPECT_TRUE(c.lookup("k2", &e));
+  EXPECT_EQ(e.index, 2);
+  std::remove(path.c_str());
+}
+
+TEST(AlgoCache, file_format) {
+  std::string path = temp_path("format");
+  {
+    std::ofstream out(path);
+    out << "# comment\n\nkey_a 5 3.25\nbroken line\nkey_b 6 0\n";
+  }
+  algo_cache cache(path);
+  algo_cache::entry_t e;
+  ASSERT_TRUE(cache.lookup("key_a", &e));
+  EXPECT_EQ(e.index, 5);
+  ASSERT_TRUE(cache.lookup("key_b", &e));
+  EXPECT_EQ(e.index, 6);
+  EXPECT_FALSE(cache.lookup("broken", &e));
+  EXPECT_EQ(algo_cache::make_key("a b\tc"), "a_b_c");
+  std::remove(path.c_str());
+}
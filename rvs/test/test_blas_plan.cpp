@@ -0,0 +1,183 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_blas_plan.h"
+#include "include/rvs_unit_testing_defs.h"
+
+using rvs::blas_plan;
+
+namespace {
+
+// stub backend standing in for the BLAS library call
+struct stub_backend {
+  std::string blas_source;
+  std::string ops_type;
+  std::string data_type;
+  std::string gemm_mode;
+  uint64_t sgemm = 0;
+  uint64_t sgemm_strided = 0;
+  uint64_t other = 0;
+};
+
+__attribute__((noinline)) bool stub_sgemm(stub_backend* b) {
+  b->sgemm++;
+  return true;
+}
+
+__attribute__((noinline)) bool stub_sgemm_strided(stub_backend* b) {
+  b->sgemm_strided++;
+  return true;
+}
+
+__attribute__((noinline)) bool stub_other(stub_backend* b) {
+  b->other++;
+  return true;
+}
+
+// per call string comparisons (previous launch path)
+bool run_by_strings(stub_backend* b, uint64_t num_calls) {
+  for (uint64_t i = 0; i < num_calls; i++) {
+    if (b->blas_source == "rocblas") {
+      if (b->ops_type == "sgemm") {
+        if (b->gemm_mode == "strided_batched") {
+          if (!stub_sgemm_strided(b))
+            return false;
+        } else if (!stub_sgemm(b)) {
+          return false;
+        }
+      }
+      if (b->ops_type == "dgemm" || b->ops_type == "hgemm" ||
+          b->data_type == "fp8_r" || b->data_type == "fp16_r" ||
+          b->data_type == "bf16_r") {
+        if (!stub_other(b))
+          return false;
+      }
+    } else if (b->blas_source == "hipblaslt") {
+      if (!stub_other(b))
+        return false;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <bool strided>
+bool launch_stub_sgemm(stub_backend* b, uint64_t /*call*/) {
+  return strided ? stub_sgemm_strided(b) : stub_sgemm(b);
+}
+
+}  // namespace
+
+TEST(BlasPlanTest, resolve_rocblas) {
+  blas_plan p = blas_plan::resolve("rocblas", "sgemm", "", "basic", "rand");
+  EXPECT_EQ(p.backend, blas_plan::backend_rocblas);
+  EXPECT_EQ(p.op, blas_plan::op_sgemm);
+  EXPECT_FALSE(p.strided);
+  EXPECT_EQ(p.init, blas_plan::init_rand);
+  EXPECT_EQ(p.rand_range, blas_plan::rand_1_10);
+
+  p = blas_plan::resolve("rocblas", "", "fp16_r", "strided_batched", "trig");
+  EXPECT_EQ(p.op, blas_plan::op_fp16);
+  EXPECT_TRUE(p.strided);
+  EXPECT_EQ(p.init, blas_plan::init_trig);
+  EXPECT_EQ(p.rand_range, blas_plan::rand_m2_2);
+
+  p = blas_plan::resolve("rocblas", "", "fp8_r", "", "default");
+  EXPECT_EQ(p.op, blas_plan::op_fp8);
+  EXPECT_EQ(p.init, blas_plan::init_default);
+  EXPECT_EQ(p.rand_range, blas_plan::rand_1_2);
+
+  p = blas_plan::resolve("rocblas", "hgemm", "", "", "hiprand");
+  EXPECT_EQ(p.op, blas_plan::op_hgemm);
+  EXPECT_EQ(p.init, blas_plan::init_hiprand);
+
+  // no rocBLAS operation for data type
+  p = blas_plan::resolve("rocblas", "", "i8_r", "", "rand");
+  EXPECT_EQ(p.op, blas_plan::op_none);
+  EXPECT_EQ(p.rand_range, blas_plan::rand_1_3);
+}
+
+TEST(BlasPlanTest, resolve_hipblaslt) {
+  blas_plan p = blas_plan::resolve("hipblaslt", "", "fp8_r", "", "rand");
+  EXPECT_EQ(p.backend, blas_plan::backend_hipblaslt);
+  EXPECT_EQ(p.op, blas_plan::op_matmul);
+  // fp8 with hipblaslt uses 1..10
+  EXPECT_EQ(p.rand_range, blas_plan::rand_1_10);
+
+  p = blas_plan::resolve("cublas", "sgemm", "", "", "");
+  EXPECT_EQ(p.backend, blas_plan::backend_none);
+  EXPECT_EQ(p.op, blas_plan::op_none);
+}
+
+TEST(BlasPlanTest, run) {
+  stub_backend b;
+
+  EXPECT_TRUE(blas_plan::run(launch_stub_sgemm<false>, &b, 10));
+  EXPECT_TRUE(blas_plan::run(launch_stub_sgemm<true>, &b, 5));
+  EXPECT_EQ(b.sgemm, 10u);
+  EXPECT_EQ(b.sgemm_strided, 5u);
+
+  // stops at first failed launch
+  uint64_t calls = 0;
+  auto fail_third = [](uint64_t* c, uint64_t call) {
+    (*c)++;
+    return call != 2;
+  };
+  EXPECT_FALSE(blas_plan::run<uint64_t>(fail_third, &calls, 10));
+  EXPECT_EQ(calls, 3u);
+}
+
+TEST(BlasPlanTest, DISABLED_launch_overhead) {
+  const uint64_t calls = 10000000;
+  stub_backend b;
+  b.blas_source = "rocblas";
+  b.ops_type = "sgemm";
+  b.gemm_mode = "strided_batched";
+
+  blas_plan p = blas_plan::resolve(b.blas_source, b.ops_type, b.data_type,
+                                   b.gemm_mode, "");
+  blas_plan::launch_fn_t<stub_backend> fn =
+    p.strided ? launch_stub_sgemm<true> : launch_stub_sgemm<false>;
+
+  auto t0 = std::chrono::steady_clock::now();
+  EXPECT_TRUE(run_by_strings(&b, calls));
+  auto t1 = std::chrono::steady_clock::now();
+  EXPECT_TRUE(blas_plan::run(fn, &b, calls));
+  auto t2 = std::chrono::steady_clock::now();
+
+  double strings = std::chrono::duration<double, std::nano>(t1 - t0).count();
+  double planned = std::chrono::duration<double, std::nano>(t2 - t1).count();
+  std::cout << "launch overhead per call: string dispatch "
+            << strings / calls << " ns, plan " << planned / calls << " ns"
+            << std::endl;
+  EXPECT_EQ(b.sgemm_strided, 2 * calls);
+}
@@ -0,0 +1,187 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_faultinject.h"
+
+using rvs::faultinject;
+
+TEST(FaultInject, parse) {
+  std::vector<faultinject::rule_t> rules;
+  std::string err;
+
+  ASSERT_TRUE(faultinject::parse(
+      "bitflip:every=10,count=2; nan:prob=0.25,start=5 ;delay:delay=7;"
+      "stuck:value=0xdead,index=3,limit=2", &rules, &err)) << err;
+  ASSERT_EQ(rules.size(), 4u);
+  EXPECT_EQ(rules[0].kind, faultinject::fault_bitflip);
+  EXPECT_EQ(rules[0].every, 10u);
+  EXPECT_EQ(rules[0].count, 2u);
+  EXPECT_EQ(rules[1].kind, faultinject::fault_nan);
+  EXPECT_EQ(rules[1].every, 0u);
+  EXPECT_DOUBLE_EQ(rules[1].probability, 0.25);
+  EXPECT_EQ(rules[1].start, 5u);
+  EXPECT_EQ(rules[2].every, 1u);
+  EXPECT_EQ(rules[2].delay_ms, 7u);
+  EXPECT_EQ(rules[3].value, 0xdeadu);
+  EXPECT_EQ(rules[3].index, 3);
+  EXPECT_EQ(rules[3].limit, 2u);
+
+  EXPECT_FALSE(faultinject::parse("melt", &rules, &err));
+  EXPECT_FALSE(faultinject::parse("zero:often=1", &rules, &err));
+  EXPECT_FALSE(faultinject::parse("nan:prob=2", &rules, &err));
+  EXPECT_FALSE(faultinject::parse("bitflip:bit=x", &rules, &err));
+  EXPECT_TRUE(faultinject::parse("", &rules, &err));
+  EXPECT_TRUE(rules.empty());
+}
+
+// the same seed replays the same faults, another seed hits other elements
+TEST(FaultInject, deterministic) {
+  const size_t n = 4096;
+  std::vector<float> a(n, 1.0f), b(n, 1.0f), c(n, 1.0f);
+  faultinject fa, fb, fc;
+  const char* spec = "bitflip:count=3;nan:prob=0.5";
+  faultinject::layout_t l = faultinject::layout_of<float>();
+
+  ASSERT_TRUE(fa.configure(spec, 42));
+  ASSERT_TRUE(fb.configure(spec, 42));
+  ASSERT_TRUE(fc.configure(spec, 43));
+  for (uint64_t check = 0; check < 20; check++) {
+    fa.inject(check, a.data(), n, l);
+    fb.inject(check, b.data(), n, l);
+    fc.inject(check, c.data(), n, l);
+  }
+  EXPECT_EQ(memcmp(a.data(), b.data(), n * sizeof(float)), 0);
+  EXPECT_NE(memcmp(a.data(), c.data(), n * sizeof(float)), 0);
+}
+
+TEST(FaultInject, kinds) {
+  std::vector<double> v(16, 2.0);
+  faultinject f;
+  faultinject::layout_t l = faultinject::layout_of<double>();
+
+  ASSERT_TRUE(f.configure("zero:index=1,count=2;nan:index=4;inf:index=5;"
+                          "stuck:index=6,value=0x3ff0000000000000;"
+                          "bitflip:index=7,bit=63", 0));
+  faultinject::action_t act = f.inject(0, v.data(), v.size(), l);
+  EXPECT_TRUE(act.corrupted);
+  EXPECT_FALSE(act.copy_fail);
+  EXPECT_EQ(act.elements, 6u);
+  EXPECT_EQ(v[0], 2.0);
+  EXPECT_EQ(v[1], 0.0);
+  EXPECT_EQ(v[2], 0.0);
+  EXPECT_EQ(v[3], 2.0);
+  EXPECT_TRUE(std::isnan(v[4]));
+  EXPECT_TRUE(std::isinf(v[5]));
+  EXPECT_EQ(v[6], 1.0);
+  EXPECT_EQ(v[7], -2.0);
+
+  // matrix layout skips padding rows (3 x 2 matrix, leading dimension 4)
+  std::vector<float> m(8, 0.0f);
+  faultinject fm;
+  faultinject::layout_t ml = faultinject::layout_of<float>();
+  ml.rows = 3;
+  ml.ld = 4;
+  ASSERT_TRUE(fm.configure("stuck:index=2,count=3,value=0x3f800000", 0));
+  fm.inject(0, m.data(), 6, ml);
+  EXPECT_EQ(m, std::vector<float>({0, 0, 1, 0, 1, 1, 0, 0}));
+
+  // integers have no NaN: nothing injected, nothing pending
+  std::vector<int32_t> iv(4, 5);
+  faultinject fi;
+  ASSERT_TRUE(fi.configure("nan", 0));
+  act = fi.inject(0, iv.data(), iv.size(), faultinject::layout_of<int32_t>());
+  EXPECT_FALSE(act.corrupted);
+  fi.report(0, false);
+  EXPECT_EQ(fi.get_stats().missed[faultinject::fault_nan], 0u);
+
+  // delay and copy failure need no data
+  faultinject fd;
+  ASSERT_TRUE(fd.configure("delay:delay=20;copyfail:every=2,start=1", 0));
+  auto t0 = std::chrono::steady_clock::now();
+  act = fd.inject(1, nullptr, 0, l);
+  double ms = std::chrono::duration<double, std::milli>(
+      std::chrono::steady_clock::now() - t0).count();
+  EXPECT_EQ(act.delay_ms, 20u);
+  EXPECT_FALSE(act.copy_fail);
+  EXPECT_GE(ms, 20.0);
+  act = fd.inject(2, nullptr, 0, l);
+  EXPECT_TRUE(act.copy_fail);
+}
+
+// full comparison detects every fault, sampling every 8th element misses
+// most single element faults; latency counts checks to the next report
+TEST(FaultInject, detection_stats) {
+  const size_t n = 1024;
+  faultinject full, sampled;
+  faultinject::layout_t l = faultinject::layout_of<float>();
+
+  ASSERT_TRUE(full.configure("bitflip:every=3,bit=30", 11));
+  ASSERT_TRUE(sampled.configure("bitflip:every=3,bit=30", 11));
+  for (uint64_t check = 0; check < 300; check++) {
+    std::vector<float> a(n, 1.0f), b(n, 1.0f);
+    full.inject(check, a.data(), n, l);
+    sampled.inject(check, b.data(), n, l);
+
+    bool bad_a = false, bad_b = false;
+    for (size_t i = 0; i < n; i++) {
+      bad_a |= a[i] != 1.0f;
+      bad_b |= i % 8 == 0 && b[i] != 1.0f;
+    }
+    full.report(check, bad_a);
+    sampled.report(check, bad_b);
+  }
+
+  faultinject::stats_t s = full.get_stats();
+  EXPECT_EQ(s.checks, 300u);
+  EXPECT_EQ(s.injected[faultinject::fault_bitflip], 100u);
+  EXPECT_EQ(s.detected[faultinject::fault_bitflip], 100u);
+  EXPECT_EQ(s.missed[faultinject::fault_bitflip], 0u);
+  EXPECT_EQ(s.max_latency_checks, 0u);
+
+  s = sampled.get_stats();
+  EXPECT_EQ(s.detected[faultinject::fault_bitflip] +
+            s.missed[faultinject::fault_bitflip], 100u);
+  EXPECT_GT(s.missed[faultinject::fault_bitflip], 70u);
+  EXPECT_LT(s.missed[faultinject::fault_bitflip], 100u);
+
+  // fault found one check late
+  faultinject late;
+  ASSERT_TRUE(late.configure("zero:every=10", 0));
+  float x = 1.0f;
+  late.inject(10, &x, 1, l);
+  late.inject(11, &x, 1, l);
+  late.report(12, true);
+  EXPECT_EQ(late.get_stats().detected[faultinject::fault_zero], 1u);
+  EXPECT_EQ(late.get_stats().max_latency_checks, 2u);
+  EXPECT_NE(late.summary().find("zero 1/1"), std::string::npos);
+}
@@ -0,0 +1,355 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_gemm_engine.h"
+#include "include/rvs_unit_testing_defs.h"
+
+namespace {
+
+//! GEMM context with a virtual clock, each GEMM takes gemm_us
+struct fake_blas {
+  double now_us = 0;
+  double gemm_us = 100;
+  uint64_t gemms = 0;
+  uint64_t copies = 0;
+  uint64_t generated = 0;
+  uint64_t fail_gemm_at = UINT64_MAX;
+  bool fail_copy = false;
+  // host time added to each batch on top of the GEMM (device) time
+  double host_overhead_us = 0;
+  // every nth batch is delayed on the host only (0 - never)
+  uint64_t host_stall_every = 0;
+  double host_stall_us = 0;
+  uint64_t batches = 0;
+  bool timing = false;
+  std::vector<double> device_times;
+
+  void generate_random_matrix_data(void) { generated++; }
+  bool copy_data_to_gpu(void) { copies++; return !fail_copy; }
+  bool run_blas_gemm(uint64_t calls) {
+    if (gemms + calls > fail_gemm_at)
+      return false;
+    double device_us = gemm_us * calls;
+    now_us += device_us + host_overhead_us;
+    if (host_stall_every && ++batches % host_stall_every == 0)
+      now_us += host_stall_us;
+    if (timing)
+      device_times.push_back(device_us);
+    gemms += calls;
+    return true;
+  }
+  bool is_gemm_op_complete(void) { return true; }
+  double get_time_us(void) { return now_us; }
+  bool set_batch_timing(bool enable) { timing = enable; return true; }
+  size_t get_batch_times_us(std::vector<double>* ptimes) {
+    ptimes->insert(ptimes->end(), device_times.begin(), device_times.end());
+    size_t n = device_times.size();
+    device_times.clear();
+    return n;
+  }
+  // 1 GFLOP per GEMM
+  double gemm_gflop_count(void) { return 1.0; }
+};
+
+struct record_logger {
+  std::vector<rvs::gemm_interval_t> intervals;
+  void interval(const rvs::gemm_interval_t& iv) { intervals.push_back(iv); }
+};
+
+struct count_validation {
+  uint64_t batches = 0;
+  uint64_t fail_at = UINT64_MAX;
+  bool finished = false;
+  bool after_batch(uint64_t iteration) {
+    batches++;
+    return iteration != fail_at;
+  }
+  void finish(void) { finished = true; }
+};
+
+template <typename Control>
+using engine_t = rvs::gemm_engine<fake_blas, Control, count_validation,
+                                  record_logger>;
+
+}  // namespace
+
+// intervals and run statistics are computed over the GEMM batch time
+TEST(GemmEngine, stats) {
+  rvs::gemm_stats st(2.0);
+
+  EXPECT_FALSE(st.pending());
+  st.add_batch(10, 1000);
+  st.add_batch(10, 3000);
+  EXPECT_TRUE(st.pending());
+
+  // 20 GEMMs x 2 GFLOP in 4 ms of GEMM time
+  rvs::gemm_interval_t iv = st.close_interval(0.005, 0.005);
+  EXPECT_EQ(iv.index, 0u);
+  EXPECT_EQ(iv.gemms, 20u);
+  EXPECT_EQ(iv.batches, 2u);
+  EXPECT_DOUBLE_EQ(iv.gflops, 10000.0);
+  EXPECT_DOUBLE_EQ(iv.min_batch_us, 1000.0);
+  EXPECT_DOUBLE_EQ(iv.max_batch_us, 3000.0);
+  EXPECT_DOUBLE_EQ(iv.mean_batch_us, 2000.0);
+  EXPECT_FALSE(st.pending());
+
+  st.add_batch(10, 4000);
+  iv = st.close_interval(0.01, 0.005);
+  EXPECT_EQ(iv.index, 1u);
+  EXPECT_DOUBLE_EQ(iv.gflops, 5000.0);
+
+  const rvs::gemm_summary_t& sum = st.summary();
+  EXPECT_EQ(sum.intervals, 2u);
+  EXPECT_EQ(sum.gemms, 30u);
+  EXPECT_EQ(sum.batches, 3u);
+  EXPECT_DOUBLE_EQ(sum.busy_seconds, 0.008);
+  EXPECT_DOUBLE_EQ(sum.gflops, 7500.0);
+  EXPECT_DOUBLE_EQ(sum.min_gflops, 5000.0);
+  EXPECT_DOUBLE_EQ(sum.max_gflops, 10000.0);
+}
+
+// duration runs report one interval per interval_ms and end on time
+TEST(GemmEngine, duration_run) {
+  fake_blas blas;
+  rvs::gemm_duration_control ctl;
+  count_validation val;
+  record_logger log;
+  rvs::gemm_engine_config_t cfg;
+  cfg.duration_ms = 100;
+  cfg.interval_ms = 10;
+  cfg.calls = 4;
+  cfg.copy_matrix = true;
+  cfg.regenerate = true;
+
+  engine_t<rvs::gemm_duration_control> engine(&blas, cfg, &ctl, &val, &log);
+  EXPECT_EQ(engine.run(), rvs::gemm_outcome::completed);
+
+  // 400 us batches : 10 intervals of 10 ms, the last one ends the run
+  EXPECT_EQ(blas.gemms, 1000u);
+  EXPECT_EQ(blas.copies, 250u);
+  EXPECT_EQ(blas.generated, 250u);
+  EXPECT_EQ(val.batches, 250u);
+  EXPECT_TRUE(val.finished);
+  ASSERT_EQ(log.intervals.size(), 10u);
+  for (const auto& iv : log.intervals) {
+    EXPECT_EQ(iv.gemms, 100u);
+    EXPECT_DOUBLE_EQ(iv.gflops, 10000.0);
+    EXPECT_DOUBLE_EQ(iv.seconds, 0.01);
+  }
+  EXPECT_DOUBLE_EQ(log.intervals.back().elapsed_s, 0.1);
+  EXPECT_EQ(engine.summary().gemms, 1000u);
+  EXPECT_DOUBLE_EQ(engine.summary().gflops, 10000.0);
+
+  // duration 0 : a single batch and interval
+  fake_blas one;
+  record_logger one_log;
+  cfg.duration_ms = 0;
+  cfg.copy_matrix = false;
+  engine_t<rvs::gemm_duration_control> single(&one, cfg, &ctl, &val, &one_log);
+  EXPECT_EQ(single.run(), rvs::gemm_outcome::completed);
+  EXPECT_EQ(one.gemms, 4u);
+  EXPECT_EQ(one.copies, 0u);
+  EXPECT_EQ(one_log.intervals.size(), 1u);
+
+  // batch limited run : one interval covering all the batches
+  fake_blas counted;
+  record_logger counted_log;
+  cfg.max_batches = 7;
+  cfg.interval_ms = 1000;
+  engine_t<rvs::gemm_duration_control> batches(&counted, cfg, &ctl, &val,
+                                               &counted_log);
+  EXPECT_EQ(batches.run(), rvs::gemm_outcome::completed);
+  EXPECT_EQ(counted.gemms, 28u);
+  ASSERT_EQ(counted_log.intervals.size(), 1u);
+  EXPECT_EQ(counted_log.intervals[0].batches, 7u);
+}
+
+// stop requests and failures end the run with their outcome
+TEST(GemmEngine, stop_and_errors) {
+  rvs::gemm_engine_config_t cfg;
+  cfg.duration_ms = 1000;
+  cfg.interval_ms = 10;
+  cfg.calls = 2;
+  record_logger log;
+
+  std::atomic<bool> stop_flag(true);
+  rvs::gemm_duration_control stopped(&stop_flag);
+  fake_blas blas;
+  count_validation val;
+  engine_t<rvs::gemm_duration_control> e1(&blas, cfg, &stopped, &val, &log);
+  EXPECT_EQ(e1.run(), rvs::gemm_outcome::stopped);
+  EXPECT_EQ(blas.gemms, 0u);
+  EXPECT_TRUE(val.finished);
+
+  static std::atomic<int> polls(0);
+  cfg.stopping = []() { return ++polls > 3; };
+  rvs::gemm_duration_control ctl;
+  fake_blas b2;
+  engine_t<rvs::gemm_duration_control> e2(&b2, cfg, &ctl, &val, &log);
+  EXPECT_EQ(e2.run(), rvs::gemm_outcome::stopped);
+  EXPECT_EQ(b2.gemms, 6u);
+  cfg.stopping = nullptr;
+
+  fake_blas b3;
+  b3.fail_copy = true;
+  cfg.copy_matrix = true;
+  engine_t<rvs::gemm_duration_control> e3(&b3, cfg, &ctl, &val, &log);
+  EXPECT_EQ(e3.run(), rvs::gemm_outcome::copy_error);
+  EXPECT_EQ(rvs::gemm_prepare(&b3, false),
+            rvs::gemm_outcome::copy_error);
+  EXPECT_EQ(rvs::gemm_prepare(&b3, true),
+            rvs::gemm_outcome::completed);
+  cfg.copy_matrix = false;
+
+  fake_blas b4;
+  b4.fail_gemm_at = 9;
+  engine_t<rvs::gemm_duration_control> e4(&b4, cfg, &ctl, &val, &log);
+  EXPECT_EQ(e4.run(), rvs::gemm_outcome::gemm_error);
+  EXPECT_EQ(b4.gemms, 8u);
+
+  fake_blas b5;
+  count_validation v5;
+  v5.fail_at = 2;
+  engine_t<rvs::gemm_duration_control> e5(&b5, cfg, &ctl, &v5, &log);
+  EXPECT_EQ(e5.run(), rvs::gemm_outcome::validation_error);
+  EXPECT_EQ(v5.batches, 3u);
+  EXPECT_TRUE(v5.finished);
+}
+
+// duty cycle idle time and batch size set from another thread
+TEST(GemmEngine, duty_control) {
+  rvs::gemm_duty_control ctl;
+
+  ctl.on_batch(4, 1000);
+  EXPECT_EQ(ctl.idle_us(), 0u);
+  EXPECT_EQ(ctl.calls(4), 4u);
+
+  ctl.set(0.25, 2);
+  EXPECT_EQ(ctl.idle_us(), 3000u);
+  EXPECT_EQ(ctl.calls(4), 2u);
+  ctl.on_batch(2, 0);
+  EXPECT_EQ(ctl.idle_us(), 0u);
+
+  // the duty cycle is clamped to (0, 1]
+  ctl.set(0.0, 0);
+  EXPECT_GT(ctl.get_duty(), 0.0);
+  ctl.set(3.0, 0);
+  EXPECT_DOUBLE_EQ(ctl.get_duty(), 1.0);
+  EXPECT_EQ(ctl.calls(4), 4u);
+
+  // the engine launches the batch size chosen by the control policy
+  fake_blas blas;
+  rvs::gemm_engine_config_t cfg;
+  cfg.max_batches = 3;
+  cfg.calls = 8;
+  ctl.set(1.0, 5);
+  count_validation val;
+  record_logger log;
+  engine_t<rvs::gemm_duty_control> engine(&blas, cfg, &ctl, &val, &log);
+  EXPECT_EQ(engine.run(), rvs::gemm_outcome::completed);
+  EXPECT_EQ(blas.gemms, 15u);
+}
+
+// nearest rank percentiles and coefficient of variation of batch times
+TEST(GemmEngine, batch_ring) {
+  rvs::gemm_batch_ring ring(100);
+
+  rvs::gemm_batch_dist_t d = ring.distribution();
+  EXPECT_EQ(d.samples, 0u);
+
+  for (int i = 1; i <= 100; i++)
+    ring.add(i);
+  d = ring.distribution();
+  EXPECT_EQ(d.samples, 100u);
+  EXPECT_DOUBLE_EQ(d.min_us, 1.0);
+  EXPECT_DOUBLE_EQ(d.median_us, 50.0);
+  EXPECT_DOUBLE_EQ(d.p99_us, 99.0);
+  EXPECT_DOUBLE_EQ(d.max_us, 100.0);
+  EXPECT_DOUBLE_EQ(d.mean_us, 50.5);
+  EXPECT_NEAR(d.cv, 29.011492 / 50.5, 1e-6);
+
+  // once full the oldest times are overwritten
+  for (int i = 0; i < 50; i++)
+    ring.add(1000);
+  d = ring.distribution();
+  EXPECT_EQ(d.samples, 100u);
+  EXPECT_DOUBLE_EQ(d.min_us, 51.0);
+  EXPECT_DOUBLE_EQ(d.max_us, 1000.0);
+
+  ring.clear();
+  ring.add(7);
+  d = ring.distribution();
+  EXPECT_EQ(d.samples, 1u);
+  EXPECT_DOUBLE_EQ(d.p99_us, 7.0);
+  EXPECT_DOUBLE_EQ(d.cv, 0.0);
+}
+
+// host stalls show in the host distribution only, the device distribution
+// stays tight
+TEST(GemmEngine, device_timing) {
+  fake_blas blas;
+  blas.host_overhead_us = 20;
+  blas.host_stall_every = 10;
+  blas.host_stall_us = 1000;
+  rvs::gemm_duration_control ctl;
+  count_validation val;
+  record_logger log;
+  rvs::gemm_engine_config_t cfg;
+  cfg.duration_ms = 100;
+  cfg.interval_ms = 50;
+  cfg.calls = 4;
+
+  engine_t<rvs::gemm_duration_control> engine(&blas, cfg, &ctl, &val, &log);
+  EXPECT_EQ(engine.run(), rvs::gemm_outcome::completed);
+  ASSERT_FALSE(log.intervals.empty());
+
+  const rvs::gemm_interval_t& iv = log.intervals[0];
+  EXPECT_EQ(iv.device.samples, iv.batches);
+  EXPECT_EQ(iv.host.samples, iv.batches);
+  EXPECT_DOUBLE_EQ(iv.device.median_us, 400.0);
+  EXPECT_DOUBLE_EQ(iv.device.p99_us, 400.0);
+  EXPECT_DOUBLE_EQ(iv.device.cv, 0.0);
+  EXPECT_DOUBLE_EQ(iv.host.median_us, 420.0);
+  EXPECT_DOUBLE_EQ(iv.host.max_us, 1420.0);
+  EXPECT_GT(iv.host.cv, 0.5);
+
+  // without device timing no device samples are reported
+  fake_blas blas2;
+  record_logger log2;
+  cfg.device_timing = false;
+  engine_t<rvs::gemm_duration_control> engine2(&blas2, cfg, &ctl, &val,
+                                               &log2);
+  EXPECT_EQ(engine2.run(), rvs::gemm_outcome::completed);
+  ASSERT_FALSE(log2.intervals.empty());
+  EXPECT_EQ(log2.intervals[0].device.samples, 0u);
+  EXPECT_GT(log2.intervals[0].host.samples, 0u);
+}
@@ -0,0 +1,101 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_gemm_sweep.h"
+#include "include/rvs_unit_testing_defs.h"
+
+using rvs::gemm_sweep;
+
+TEST(GemmSweep, parse_values) {
+  std::vector<uint64_t> v;
+  EXPECT_TRUE(gemm_sweep::parse_values("1024, 4096:16384:x2,3", &v));
+  EXPECT_EQ(v, (std::vector<uint64_t>{1024, 4096, 8192, 16384, 3}));
+
+  v.clear();
+  EXPECT_TRUE(gemm_sweep::parse_values("256:1000:+256", &v));
+  EXPECT_EQ(v, (std::vector<uint64_t>{256, 512, 768}));
+
+  v.clear();
+  EXPECT_TRUE(gemm_sweep::parse_values("1:9", &v));
+  EXPECT_EQ(v, (std::vector<uint64_t>{1, 2, 4, 8}));
+
+  for (const char* bad : {"", "a", "8:4", "1:8:x1", "0:8:x2", "1:8:+0",
+                          "1:8:y2", "1:2:3:4", "-1", "1:100000:+1"}) {
+    v.clear();
+    EXPECT_FALSE(gemm_sweep::parse_values(bad, &v)) << bad;
+  }
+}
+
+TEST(GemmSweep, expand) {
+  std::vector<gemm_sweep::point_t> p = gemm_sweep::expand(
+      {1, 2}, {3}, {4, 5}, {0}, {0, 1},
+      gemm_sweep::parse_names("sgemm, fp16_r"), {1});
+
+  ASSERT_EQ(p.size(), 16u);
+  EXPECT_EQ(p[0].m, 1u);
+  EXPECT_EQ(p[1].m, 2u);
+  EXPECT_EQ(p[2].k, 5u);
+  EXPECT_EQ(p[4].trans_b, 1);
+  EXPECT_EQ(p[8].dtype, "fp16_r");
+}
+
+TEST(GemmSweep, peak_and_intensity) {
+  // MI300X: 304 CUs at 2100 MHz - 1307.4 TFLOPS fp16, 163.4 TFLOPS fp64
+  EXPECT_NEAR(gemm_sweep::peak_gflops("gfx942:sramecc+:xnack-", 304, 2100000,
+                                      "fp16_r"), 1307443, 1);
+  EXPECT_NEAR(gemm_sweep::peak_gflops("gfx942", 304, 2100000, "dgemm"),
+              163430, 1);
+  EXPECT_EQ(gemm_sweep::peak_gflops("gfx1100", 96, 2500000, "sgemm"), 0);
+  EXPECT_EQ(gemm_sweep::peak_flops_per_cu_clock("gfx950", "fp4_r"), 16384);
+
+  // square sgemm: 2n^3 / (4 * 4n^2) = n / 8
+  gemm_sweep::point_t p{4096, 4096, 4096, 0, 1, "sgemm", 1};
+  EXPECT_DOUBLE_EQ(gemm_sweep::intensity(p), 512.0);
+  p.dtype = "fp8_r";
+  EXPECT_DOUBLE_EQ(gemm_sweep::output_bytes(p.dtype), 4.0);
+
+  gemm_sweep::result_t r{p, true, 500, 1000, 1};
+  EXPECT_DOUBLE_EQ(gemm_sweep::efficiency(r), 50.0);
+  r.peak_gflops = 0;
+  EXPECT_LT(gemm_sweep::efficiency(r), 0);
+}
+
+TEST(GemmSweep, table) {
+  gemm_sweep::point_t p{8192, 8192, 8192, 0, 1, "bf16_r", 1};
+  std::vector<gemm_sweep::result_t> r = {{p, true, 650000.5, 1307443, 1365.3},
+                                         {p, false, 0, 0, 0}};
+  std::string t = gemm_sweep::format_table(r);
+
+  EXPECT_NE(t.find("GFLOPS"), std::string::npos);
+  EXPECT_NE(t.find("650000.5"), std::string::npos);
+  EXPECT_NE(t.find("49.7"), std::string::npos);
+  EXPECT_NE(t.find("error"), std::string::npos);
+  EXPECT_EQ(std::count(t.begin(), t.end(), '\n'), 3);
+}
@@ -0,0 +1,169 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_gemmverify.h"
+#include "include/rvs_hostgemm.h"
+#include "include/rvs_unit_testing_defs.h"
+
+using rvs::gemmverify;
+
+class GemmVerifyTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+    A.resize(lda * k);
+    B.resize(k * ldb);
+    C.resize(ldc * n);
+    for (auto& x : A) x = dist(gen);
+    for (auto& x : B) x = dist(gen);
+    for (auto& x : C) x = dist(gen);
+
+    // "device" output computed in float like the GPU would
+    D = C;
+    rvs::hostgemm::gemm<float, float, float, float>(m, n, k, alpha,
+      A.data(), 1, lda, B.data(), ldb, 1, beta, D.data(), 1, ldc);
+  }
+
+  const int64_t m = 300, n = 200, k = 500;
+  const int64_t lda = 301, ldb = 203, ldc = 304;
+  const double alpha = 1.25, beta = -0.75;
+  std::vector<float> A, B, C, D;
+};
+
+TEST(GemmVerifySampleCount, formula) {
+  // (1 - 0.01)^459 = 0.0099...
+  EXPECT_EQ(gemmverify::sample_count(0.99, 0.01, 1000000), 459u);
+  EXPECT_EQ(gemmverify::sample_count(0.999, 0.0001, 1000000), 69075u);
+  // bounded by number of elements
+  EXPECT_EQ(gemmverify::sample_count(0.999, 0.0001, 1000), 1000u);
+  EXPECT_EQ(gemmverify::sample_count(0.5, 1.0, 1000), 1u);
+  EXPECT_EQ(gemmverify::sample_count(0.9, 0.1, 0), 0u);
+}
+
+TEST_F(GemmVerifyTest, sampled) {
+  std::vector<gemmverify::mismatch_t> mism;
+
+  // correct output passes
+  EXPECT_EQ(gemmverify::verify_sampled<float>(m, n, k, alpha,
+    A.data(), 1, lda, B.data(), ldb, 1, beta, C.data(), 1, ldc,
+    D.data(), 1, ldc, m * n, 1, gemmverify::DEFAULT_SAMPLE_TOLERANCE,
+    &mism), 0.0);
+  EXPECT_TRUE(mism.empty());
+
+  // every sample hits one of the wrong elements in the first 10 columns
+  for (int64_t j = 0; j < 10; j++) {
+    for (int64_t i = 0; i < m; i++)
+      D[i + j * ldc] += 0.5f;
+  }
+  size_t samples = gemmverify::sample_count(0.999999, 10.0 / n, m * n);
+  EXPECT_GT(gemmverify::verify_sampled<float>(m, n, k, alpha,
+    A.data(), 1, lda, B.data(), ldb, 1, beta, C.data(), 1, ldc,
+    D.data(), 1, ldc, samples, 2, gemmverify::DEFAULT_SAMPLE_TOLERANCE,
+    &mism), 0.0);
+  ASSERT_FALSE(mism.empty());
+  for (auto& mm : mism) {
+    EXPECT_LT(mm.col, 10);
+    EXPECT_GE(mm.row, 0);
+  }
+}
+
+// consecutive accuracy checks sample different elements
+TEST_F(GemmVerifyTest, sample_seed) {
+  const uint64_t matrix_seed = 1234;
+  std::vector<gemmverify::mismatch_t> first, second;
+
+  EXPECT_NE(gemmverify::sample_seed(matrix_seed, 0),
+            gemmverify::sample_seed(matrix_seed, 1));
+  EXPECT_NE(gemmverify::sample_seed(matrix_seed, 0),
+            gemmverify::sample_seed(matrix_seed + 1, 0));
+  EXPECT_EQ(gemmverify::sample_seed(matrix_seed, 5),
+            gemmverify::sample_seed(matrix_seed, 5));
+
+  // every element is wrong: mismatches are the sampled locations
+  for (auto& x : D)
+    x += 0.5f;
+  gemmverify::verify_sampled<float>(m, n, k, alpha,
+    A.data(), 1, lda, B.data(), ldb, 1, beta, C.data(), 1, ldc,
+    D.data(), 1, ldc, 16, gemmverify::sample_seed(matrix_seed, 0),
+    gemmverify::DEFAULT_SAMPLE_TOLERANCE, &first);
+  gemmverify::verify_sampled<float>(m, n, k, alpha,
+    A.data(), 1, lda, B.data(), ldb, 1, beta, C.data(), 1, ldc,
+    D.data(), 1, ldc, 16, gemmverify::sample_seed(matrix_seed, 1),
+    gemmverify::DEFAULT_SAMPLE_TOLERANCE, &second);
+  ASSERT_EQ(first.size(), 16u);
+  ASSERT_EQ(second.size(), 16u);
+
+  size_t same = 0;
+  for (size_t s = 0; s < first.size(); s++)
+    same += first[s].row == second[s].row && first[s].col == second[s].col;
+  EXPECT_LT(same, first.size());
+}
+
+TEST_F(GemmVerifyTest, checksum) {
+  gemmverify::checksums_t sums;
+  std::vector<gemmverify::mismatch_t> mism;
+
+  gemmverify::checksum_prepare<float>(m, n, k, alpha, A.data(), 1, lda,
+    B.data(), ldb, 1, beta, C.data(), 1, ldc, &sums);
+
+  // correct output passes
+  EXPECT_EQ(gemmverify::verify_checksum<float>(sums, D.data(), 1, ldc,
+    gemmverify::DEFAULT_CHECKSUM_TOLERANCE, &mism), 0.0);
+  EXPECT_TRUE(mism.empty());
+
+  // single corrupted element is located
+  D[17 + 123 * ldc] += 8.0f;
+  EXPECT_GT(gemmverify::verify_checksum<float>(sums, D.data(), 1, ldc,
+    gemmverify::DEFAULT_CHECKSUM_TOLERANCE, &mism), 0.0);
+  ASSERT_EQ(mism.size(), 1u);
+  EXPECT_EQ(mism[0].row, 17);
+  EXPECT_EQ(mism[0].col, 123);
+
+  // NaN is detected
+  D[17 + 123 * ldc] = std::nanf("");
+  EXPECT_TRUE(std::isinf(gemmverify::verify_checksum<float>(sums, D.data(),
+    1, ldc, gemmverify::DEFAULT_CHECKSUM_TOLERANCE, &mism)));
+
+  // zeroed leading elements (as done by error injection) are detected
+  D = C;
+  rvs::hostgemm::gemm<float, float, float, float>(m, n, k, alpha,
+    A.data(), 1, lda, B.data(), ldb, 1, beta, D.data(), 1, ldc);
+  for (int64_t i = 0; i < 5; i++)
+    D[i] = 0;
+  EXPECT_GT(gemmverify::verify_checksum<float>(sums, D.data(), 1, ldc,
+    gemmverify::DEFAULT_CHECKSUM_TOLERANCE, &mism), 0.0);
+  for (auto& mm : mism) {
+    EXPECT_LT(mm.row, 5);
+    EXPECT_EQ(mm.col, 0);
+  }
+}
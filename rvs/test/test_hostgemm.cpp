@@ -0,0 +1,191 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_hostgemm.h"
+#include "include/rvs_unit_testing_defs.h"
+
+// bfloat16 like storage type convertible to/from float only
+struct test_bf16 {
+  uint16_t bits;
+  test_bf16() : bits(0) {
+  }
+  explicit test_bf16(float f) {
+    uint32_t u;
+    memcpy(&u, &f, sizeof(u));
+    bits = static_cast<uint16_t>((u + 0x7FFF + ((u >> 16) & 1)) >> 16);
+  }
+  explicit operator float() const {
+    uint32_t u = static_cast<uint32_t>(bits) << 16;
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+  }
+};
+
+template <typename T>
+static std::vector<T> random_matrix(size_t size, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<T> v(size);
+  for (auto& x : v)
+    x = T(dist(gen));
+  return v;
+}
+
+// checks blocked GEMM against naive one for all transposes (column major,
+// lda/ldb/ldc larger than needed) on given ISA and thread count
+template <typename T, typename Tacc>
+static void check_gemm(int64_t m, int64_t n, int64_t k, double tolerance,
+                       int threads) {
+  for (int ta = 0; ta < 2; ta++) {
+    for (int tb = 0; tb < 2; tb++) {
+      int64_t lda = (ta ? k : m) + 3;
+      int64_t ldb = (tb ? n : k) + 1;
+      int64_t ldc = m + 2;
+      std::vector<T> A = random_matrix<T>(lda * (ta ? m : k), 1);
+      std::vector<T> B = random_matrix<T>(ldb * (tb ? k : n), 2);
+      std::vector<T> C = random_matrix<T>(ldc * n, 3);
+      std::vector<T> Cref = C;
+
+      int64_t as1 = ta ? lda : 1, as2 = ta ? 1 : lda;
+      int64_t bs1 = tb ? ldb : 1, bs2 = tb ? 1 : ldb;
+
+      rvs::hostgemm::gemm<T, T, T, Tacc>(m, n, k, 1.5, A.data(), as1, as2,
+        B.data(), bs1, bs2, -0.5, C.data(), 1, ldc, threads);
+      rvs::hostgemm::gemm_naive<T, T, T, Tacc>(m, n, k, 1.5, A.data(), as1,
+        as2, B.data(), bs1, bs2, -0.5, Cref.data(), 1, ldc);
+
+      double max_err = 0;
+      for (int64_t j = 0; j < n; j++) {
+        for (int64_t i = 0; i < m; i++) {
+          double d = std::fabs(static_cast<double>(static_cast<float>(
+            C[i + j * ldc])) - static_cast<double>(static_cast<float>(
+            Cref[i + j * ldc])));
+          max_err = std::max(max_err, d);
+        }
+      }
+      EXPECT_LE(max_err, tolerance) << "transa " << ta << " transb " << tb
+        << " isa " << rvs::hostgemm::isa_name(rvs::hostgemm::get_isa());
+    }
+  }
+}
+
+TEST(HostGemmTest, accuracy) {
+  const rvs::hostgemm::isa_t isas[] = {rvs::hostgemm::isa_generic,
+    rvs::hostgemm::isa_avx2, rvs::hostgemm::isa_avx512};
+
+  for (auto isa : isas) {
+    rvs::hostgemm::set_isa(isa);
+
+    // sizes not multiple of any tile or block
+    check_gemm<float, double>(67, 45, 413, 1e-5, 1);
+    check_gemm<float, float>(67, 45, 413, 1e-3, 3);
+    check_gemm<double, double>(131, 29, 300, 1e-12, 2);
+    check_gemm<double, double>(1, 1, 1, 1e-15, 1);
+    // low precision storage accumulated in float, rounded once to output
+    // (converted in bulk by rvs::lpconv, naive reference converts per
+    // element)
+    ASSERT_EQ(rvs::lpconv::conversion<test_bf16>().fmt,
+              rvs::lpconv::fmt_bf16);
+    check_gemm<test_bf16, float>(35, 50, 90, 0.07, 2);
+  }
+  rvs::hostgemm::set_isa(rvs::hostgemm::detect_isa());
+}
+
+TEST(HostGemmTest, column_panels) {
+  // output type other than the accumulation type goes through the panel
+  // buffer: force many panels (16 columns each), including a partial one
+  rvs::hostgemm::set_panel_bytes(1);
+  check_gemm<float, double>(67, 45, 113, 1e-5, 2);
+  check_gemm<test_bf16, float>(35, 50, 90, 0.07, 2);
+  rvs::hostgemm::set_panel_bytes(0);
+}
+
+TEST(HostGemmTest, thread_share) {
+  int all = rvs::hostgemm::get_threads(0);
+  EXPECT_GE(all, 1);
+  EXPECT_EQ(rvs::hostgemm::get_threads(5), 5);
+
+  rvs::hostgemm::set_concurrency(4);
+  EXPECT_EQ(rvs::hostgemm::get_threads(0), std::max(1, all / 4));
+  EXPECT_EQ(rvs::hostgemm::get_threads(3), 3);
+  rvs::hostgemm::set_concurrency(0);
+  EXPECT_EQ(rvs::hostgemm::get_threads(0), all);
+}
+
+TEST(HostGemmTest, beta_zero) {
+  // beta == 0 must not propagate NaN from C
+  std::vector<double> A(4, 1.0), B(4, 1.0), C(4, std::nan(""));
+
+  rvs::hostgemm::gemm<double, double, double, double>(2, 2, 2, 1.0,
+    A.data(), 1, 2, B.data(), 1, 2, 0.0, C.data(), 1, 2);
+  for (double c : C)
+    EXPECT_EQ(c, 2.0);
+
+  // k == 0 only scales C
+  rvs::hostgemm::gemm<double, double, double, double>(2, 2, 0, 1.0,
+    A.data(), 1, 2, B.data(), 1, 2, 0.5, C.data(), 1, 2);
+  for (double c : C)
+    EXPECT_EQ(c, 1.0);
+}
+
+// run with --gtest_also_run_disabled_tests
+TEST(HostGemmTest, DISABLED_benchmark) {
+  const int64_t sizes[] = {256, 512, 1024};
+
+  for (int64_t s : sizes) {
+    std::vector<float> A = random_matrix<float>(s * s, 1);
+    std::vector<float> B = random_matrix<float>(s * s, 2);
+    std::vector<float> C(s * s);
+    double gflop = 2.0 * s * s * s * 1e-9;
+
+    auto t0 = std::chrono::steady_clock::now();
+    rvs::hostgemm::gemm_naive<float, float, float, double>(s, s, s, 1.0,
+      A.data(), 1, s, B.data(), 1, s, 0.0, C.data(), 1, s);
+    auto t1 = std::chrono::steady_clock::now();
+    rvs::hostgemm::gemm<float, float, float, double>(s, s, s, 1.0,
+      A.data(), 1, s, B.data(), 1, s, 0.0, C.data(), 1, s);
+    auto t2 = std::chrono::steady_clock::now();
+
+    double naive = std::chrono::duration<double>(t1 - t0).count();
+    double blocked = std::chrono::duration<double>(t2 - t1).count();
+    std::cout << "sgemm " << s << "^3 naive " << gflop / naive
+              << " GFLOPS, blocked (" << rvs::hostgemm::isa_name(
+                 rvs::hostgemm::get_isa()) << ", "
+              << rvs::hostgemm::get_threads(0) << " threads) "
+              << gflop / blocked << " GFLOPS, speedup " << naive / blocked
+              << std::endl;
+  }
+}
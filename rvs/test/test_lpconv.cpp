@@ -0,0 +1,306 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_hostgemm.h"
+#include "include/rvs_lpconv.h"
+
+using rvs::lpconv;
+
+// fp16 storage type converting like the compiler's _Float16
+struct test_half {
+  _Float16 v;
+  test_half() : v(0) {
+  }
+  explicit test_half(float f) : v(static_cast<_Float16>(f)) {
+  }
+  explicit operator float() const {
+    return static_cast<float>(v);
+  }
+};
+
+// fp8 storage type with its own (slow) saturating e4m3 fnuz conversion
+struct test_fp8 {
+  uint8_t bits;
+  test_fp8() : bits(0) {
+  }
+  explicit test_fp8(float f) {
+    lpconv::conv_t c = {lpconv::fmt_e4m3_fnuz, lpconv::round_nearest_even,
+                        true};
+    bits = static_cast<uint8_t>(lpconv::encode(c, f));
+  }
+  explicit operator float() const {
+    return lpconv::decode(lpconv::fmt_e4m3_fnuz, bits);
+  }
+};
+
+static const lpconv::format_t minifloats[] = {
+  lpconv::fmt_f16, lpconv::fmt_bf16, lpconv::fmt_e4m3, lpconv::fmt_e5m2,
+  lpconv::fmt_e4m3_fnuz, lpconv::fmt_e5m2_fnuz
+};
+
+static bool same(float a, float b) {
+  if (std::isnan(a) || std::isnan(b))
+    return std::isnan(a) && std::isnan(b);
+  return a == b && std::signbit(a) == std::signbit(b);
+}
+
+static bool is_fnuz(lpconv::format_t fmt) {
+  return fmt == lpconv::fmt_e4m3_fnuz || fmt == lpconv::fmt_e5m2_fnuz;
+}
+
+// largest finite value of format
+static float max_finite(lpconv::format_t fmt) {
+  float max = 0;
+  for (uint32_t c = 0; c < (1u << (8 * lpconv::format_size(fmt))); c++) {
+    float v = lpconv::decode(fmt, c);
+    if (std::isfinite(v))
+      max = std::max(max, v);
+  }
+  return max;
+}
+
+// reference rounding of |x| <= max finite: search of the neighbouring
+// values of the format, ties to even code
+static float reference(lpconv::format_t fmt, const std::vector<float>& pos,
+                       float x, bool rtz) {
+  float a = std::fabs(x);
+  size_t i = std::upper_bound(pos.begin(), pos.end(), a) - pos.begin() - 1;
+  float r = pos[i];
+
+  if (pos[i] != a && !rtz) {
+    double dl = static_cast<double>(a) - pos[i];
+    double dh = static_cast<double>(pos[i + 1]) - a;
+    if (dh < dl || (dh == dl && (i & 1)))
+      r = pos[i + 1];
+  }
+  if (r == 0 && is_fnuz(fmt))
+    return 0;
+  return std::copysign(r, x);
+}
+
+TEST(LpConvTest, decode) {
+  // every code of every format, bulk (all ISAs) vs scalar decode
+  for (lpconv::format_t fmt : minifloats) {
+    size_t codes = size_t(1) << (8 * lpconv::format_size(fmt));
+    std::vector<uint8_t> src(codes * lpconv::format_size(fmt));
+    for (size_t c = 0; c < codes; c++)
+      memcpy(&src[c * lpconv::format_size(fmt)], &c,
+             lpconv::format_size(fmt));
+
+    for (int isa = rvs::hostgemm::isa_generic;
+         isa <= rvs::hostgemm::isa_avx512; isa++) {
+      rvs::hostgemm::set_isa(static_cast<rvs::hostgemm::isa_t>(isa));
+      std::vector<float> dst(codes);
+      lpconv::to_float(fmt, src.data(), dst.data(), codes);
+      for (size_t c = 0; c < codes; c++)
+        ASSERT_TRUE(same(dst[c], lpconv::decode(fmt, c)))
+          << lpconv::format_name(fmt) << " code " << c;
+    }
+  }
+  rvs::hostgemm::set_isa(rvs::hostgemm::detect_isa());
+
+  // fp16 against the compiler's conversion
+  for (uint32_t c = 0; c < 65536; c++) {
+    uint16_t h = c;
+    _Float16 v;
+    memcpy(&v, &h, 2);
+    ASSERT_TRUE(same(lpconv::decode(lpconv::fmt_f16, c), float(v)));
+  }
+
+  EXPECT_EQ(lpconv::decode(lpconv::fmt_e4m3, 0x7e), 448.0f);
+  EXPECT_TRUE(std::isnan(lpconv::decode(lpconv::fmt_e4m3, 0x7f)));
+  EXPECT_EQ(lpconv::decode(lpconv::fmt_e5m2, 0x7b), 57344.0f);
+  EXPECT_TRUE(std::isinf(lpconv::decode(lpconv::fmt_e5m2, 0xfc)));
+  EXPECT_EQ(lpconv::decode(lpconv::fmt_e4m3_fnuz, 0x7f), 240.0f);
+  EXPECT_TRUE(std::isnan(lpconv::decode(lpconv::fmt_e4m3_fnuz, 0x80)));
+  EXPECT_EQ(lpconv::decode(lpconv::fmt_e5m2_fnuz, 0x01), 0x1p-17f);
+  EXPECT_EQ(lpconv::decode(lpconv::fmt_bf16, 0x0001), 0x1p-133f);
+}
+
+TEST(LpConvTest, encode) {
+  std::mt19937 gen(7);
+
+  for (lpconv::format_t fmt : minifloats) {
+    float max = max_finite(fmt);
+    std::vector<float> pos;
+    for (uint32_t c = 0; c < (1u << (8 * lpconv::format_size(fmt))); c++) {
+      float v = lpconv::decode(fmt, c);
+      if (std::isfinite(v) && !std::signbit(v))
+        pos.push_back(v);
+    }
+    std::sort(pos.begin(), pos.end());
+    pos.erase(std::unique(pos.begin(), pos.end()), pos.end());
+
+    std::vector<float> values;
+    lpconv::probe_values(fmt, &values);
+    std::uniform_real_distribution<float> dist(-max, max);
+    for (int i = 0; i < 100000; i++)
+      values.push_back(dist(gen) * std::ldexp(1.0f, -(i % 24)));
+
+    for (int r = 0; r < 2; r++) {
+      for (int s = 0; s < 2; s++) {
+        lpconv::conv_t conv = {fmt, static_cast<lpconv::round_t>(r), s != 0};
+        bool rtz = r == lpconv::round_toward_zero;
+        std::vector<uint8_t> bulk(values.size() * lpconv::format_size(fmt));
+
+        rvs::hostgemm::set_isa(static_cast<rvs::hostgemm::isa_t>(
+            (r * 2 + s) % 3));
+        lpconv::from_float(conv, values.data(), bulk.data(), values.size());
+        for (size_t i = 0; i < values.size(); i++) {
+          float x = values[i];
+          uint32_t c = lpconv::encode(conv, x);
+          uint32_t b = 0;
+          memcpy(&b, &bulk[i * lpconv::format_size(fmt)],
+                 lpconv::format_size(fmt));
+          float got = lpconv::decode(fmt, c);
+
+          ASSERT_TRUE(same(lpconv::decode(fmt, b), got))
+            << lpconv::format_name(fmt) << " bulk " << x;
+          if (std::isnan(x)) {
+            ASSERT_TRUE(std::isnan(got));
+          } else if (std::fabs(x) <= max) {
+            ASSERT_TRUE(same(got, reference(fmt, pos, x, rtz)))
+              << lpconv::format_name(fmt) << " " << x << " r " << r
+              << " got " << got;
+          } else if (s || (rtz && !std::isinf(x))) {
+            ASSERT_EQ(got, std::copysign(max, x)) << x;
+          } else if (fmt == lpconv::fmt_f16 || fmt == lpconv::fmt_bf16 ||
+                     fmt == lpconv::fmt_e5m2) {
+            // round to nearest only overflows past the midpoint above max
+            ASSERT_TRUE(got == std::copysign(max, x) || std::isinf(got)) << x;
+          } else {
+            ASSERT_TRUE(got == std::copysign(max, x) || std::isnan(got)) << x;
+          }
+        }
+      }
+    }
+  }
+
+  rvs::hostgemm::set_isa(rvs::hostgemm::detect_isa());
+
+  // fp16 round to nearest matches the compiler's conversion
+  lpconv::conv_t f16 = {lpconv::fmt_f16, lpconv::round_nearest_even, false};
+  std::uniform_int_distribution<uint32_t> bits;
+  for (int i = 0; i < 1000000; i++) {
+    float x = std::bit_cast<float>(bits(gen));
+    _Float16 h = static_cast<_Float16>(x);
+    ASSERT_TRUE(same(lpconv::decode(lpconv::fmt_f16, lpconv::encode(f16, x)),
+                     float(h))) << x;
+  }
+
+  // fnuz has no negative zero, int8 rounds and clamps
+  lpconv::conv_t fnuz = {lpconv::fmt_e4m3_fnuz, lpconv::round_nearest_even,
+                         false};
+  EXPECT_EQ(lpconv::encode(fnuz, -0.0f), 0u);
+  EXPECT_EQ(lpconv::encode(fnuz, -1e-9f), 0u);
+  EXPECT_EQ(lpconv::encode(fnuz, 1e6f), 0x80u);
+  lpconv::conv_t i8 = {lpconv::fmt_i8, lpconv::round_nearest_even, true};
+  EXPECT_EQ(lpconv::encode(i8, 2.5f), 2u);
+  EXPECT_EQ(lpconv::encode(i8, 3.5f), 4u);
+  EXPECT_EQ(lpconv::encode(i8, -2.5f), 0xfeu);
+  EXPECT_EQ(lpconv::encode(i8, 1000.0f), 0x7fu);
+  EXPECT_EQ(lpconv::encode(i8, -1000.0f), 0x80u);
+  EXPECT_EQ(lpconv::encode(i8, std::numeric_limits<float>::quiet_NaN()), 0u);
+  i8.round = lpconv::round_toward_zero;
+  EXPECT_EQ(lpconv::encode(i8, -2.9f), 0xfeu);
+
+  // int8 bulk conversion matches std::nearbyint / std::trunc in range
+  std::uniform_real_distribution<float> wide(-200.0f, 200.0f);
+  std::vector<float> xs(10000);
+  std::vector<int8_t> ys(xs.size());
+  for (size_t i = 0; i < xs.size(); i++)
+    xs[i] = i % 4 ? wide(gen) : std::round(wide(gen)) + 0.5f;
+  for (int r = 0; r < 2; r++) {
+    i8.round = static_cast<lpconv::round_t>(r);
+    lpconv::from_float(i8, xs.data(), ys.data(), xs.size());
+    for (size_t i = 0; i < xs.size(); i++) {
+      float v = r ? std::trunc(xs[i]) : std::nearbyint(xs[i]);
+      ASSERT_EQ(ys[i], std::min(std::max(v, -128.0f), 127.0f)) << xs[i];
+    }
+  }
+}
+
+TEST(LpConvTest, conversion) {
+  lpconv::conv_t h = lpconv::conversion<test_half>();
+  EXPECT_EQ(h.fmt, lpconv::fmt_f16);
+  EXPECT_EQ(h.round, lpconv::round_nearest_even);
+  EXPECT_FALSE(h.saturate);
+
+  lpconv::conv_t f8 = lpconv::conversion<test_fp8>();
+  EXPECT_EQ(f8.fmt, lpconv::fmt_e4m3_fnuz);
+  EXPECT_EQ(f8.round, lpconv::round_nearest_even);
+  EXPECT_TRUE(f8.saturate);
+
+  EXPECT_EQ(lpconv::conversion<double>().fmt, lpconv::fmt_none);
+  EXPECT_EQ(lpconv::conversion<int8_t>().fmt, lpconv::fmt_i8);
+}
+
+// run with --gtest_also_run_disabled_tests
+TEST(LpConvTest, DISABLED_benchmark) {
+  const size_t n = size_t(1) << 24;
+  std::vector<float> src(n);
+  std::vector<float> back(n);
+  std::vector<uint16_t> dst(n);
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+
+  for (float& x : src)
+    x = dist(gen);
+
+  for (lpconv::format_t fmt : minifloats) {
+    lpconv::conv_t conv = {fmt, lpconv::round_nearest_even, true};
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < n; i++) {
+      uint32_t c = lpconv::encode(conv, src[i]);
+      memcpy(reinterpret_cast<uint8_t*>(dst.data()) +
+             i * lpconv::format_size(fmt), &c, lpconv::format_size(fmt));
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    lpconv::from_float(conv, src.data(), dst.data(), n);
+    auto t2 = std::chrono::steady_clock::now();
+    lpconv::to_float(fmt, dst.data(), back.data(), n);
+    auto t3 = std::chrono::steady_clock::now();
+
+    double scalar = std::chrono::duration<double>(t1 - t0).count();
+    double encode = std::chrono::duration<double>(t2 - t1).count();
+    double decode = std::chrono::duration<double>(t3 - t2).count();
+    std::cout << lpconv::format_name(fmt) << " ("
+              << rvs::hostgemm::isa_name(rvs::hostgemm::get_isa())
+              << ") scalar encode " << n / scalar * 1e-6
+              << " Melem/s, bulk encode " << n / encode * 1e-6
+              << " Melem/s, bulk decode " << n / decode * 1e-6
+              << " Melem/s" << std::endl;
+  }
+}
@@ -0,0 +1,231 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_matrix_stage.h"
+#include "include/rvs_unit_testing_defs.h"
+
+using rvs::matrix_stage;
+
+namespace {
+
+std::atomic<int> live_allocs(0);
+
+void* test_alloc(size_t bytes, bool* pinned) {
+  *pinned = false;
+  live_allocs++;
+  return malloc(bytes);
+}
+
+void test_free(void* p, bool) {
+  live_allocs--;
+  free(p);
+}
+
+matrix_stage::key_t make_key(uint64_t seed) {
+  matrix_stage::key_t key;
+  key.type = "sgemm";
+  key.init = 0;
+  key.range = 0;
+  key.seed = seed;
+  key.generation = 0;
+  key.bytes_a = 1000;
+  key.bytes_b = 2000;
+  key.bytes_c = 3000;
+  return key;
+}
+
+}  // namespace
+
+// concurrent workers share one generated set of matrices
+TEST(MatrixStage, shared_by_concurrent_workers) {
+  const int workers = 8;
+  std::atomic<int> inits(0);
+  std::vector<std::shared_ptr<const matrix_stage::buffers_t>> got(workers);
+  matrix_stage::stats_t before = matrix_stage::get_stats();
+
+  auto init = [&inits](const matrix_stage::buffers_t& b) {
+    inits++;
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    memset(b.ha, 1, 1000);
+    memset(b.hb, 2, 2000);
+    memset(b.hc, 3, 3000);
+    return true;
+  };
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < workers; i++)
+    threads.emplace_back([&, i] {
+      got[i] = matrix_stage::acquire(make_key(1), init, test_alloc, test_free);
+    });
+  for (auto& t : threads)
+    t.join();
+
+  EXPECT_EQ(inits, 1);
+  EXPECT_EQ(live_allocs, 1);
+  for (int i = 0; i < workers; i++) {
+    ASSERT_TRUE(got[i]);
+    EXPECT_EQ(got[i]->ha, got[0]->ha);
+  }
+  const uint8_t* c = static_cast<const uint8_t*>(got[0]->hc);
+  EXPECT_EQ(c[0], 3);
+  EXPECT_EQ(c[2999], 3);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(got[0]->hb) % matrix_stage::ALIGNMENT,
+            reinterpret_cast<uintptr_t>(got[0]->ha) % matrix_stage::ALIGNMENT);
+
+  matrix_stage::stats_t after = matrix_stage::get_stats();
+  EXPECT_EQ(after.generated - before.generated, 1u);
+  EXPECT_EQ(after.shared - before.shared, uint64_t(workers - 1));
+  EXPECT_EQ(after.bytes_saved - before.bytes_saved,
+            (workers - 1) * got[0]->bytes);
+  EXPECT_GT(after.seconds_saved - before.seconds_saved, 0.1);
+
+  // memory goes away with the last reference
+  got.clear();
+  EXPECT_EQ(live_allocs, 0);
+  EXPECT_EQ(matrix_stage::get_stats().bytes_resident, before.bytes_resident);
+}
+
+// different keys and released keys are generated again
+TEST(MatrixStage, keys_and_release) {
+  int inits = 0;
+  auto init = [&inits](const matrix_stage::buffers_t&) {
+    inits++;
+    return true;
+  };
+
+  auto a = matrix_stage::acquire(make_key(1), init, test_alloc, test_free);
+  auto b = matrix_stage::acquire(make_key(2), init, test_alloc, test_free);
+  auto a2 = matrix_stage::acquire(make_key(1), init, test_alloc, test_free);
+  EXPECT_EQ(inits, 2);
+  EXPECT_NE(a->ha, b->ha);
+  EXPECT_EQ(a->ha, a2->ha);
+
+  a.reset();
+  a2.reset();
+  a = matrix_stage::acquire(make_key(1), init, test_alloc, test_free);
+  EXPECT_EQ(inits, 3);
+  a.reset();
+  b.reset();
+  EXPECT_EQ(live_allocs, 0);
+}
+
+// failed initialization is reported and retried by the next caller
+TEST(MatrixStage, init_failure) {
+  auto fail = [](const matrix_stage::buffers_t&) { return false; };
+  auto ok = [](const matrix_stage::buffers_t&) { return true; };
+
+  EXPECT_FALSE(matrix_stage::acquire(make_key(3), fail, test_alloc, test_free));
+  EXPECT_EQ(live_allocs, 0);
+  auto b = matrix_stage::acquire(make_key(3), ok, test_alloc, test_free);
+  EXPECT_TRUE(b);
+}
+
+// regeneration refills the buffer held by the only worker in place
+TEST(MatrixStage, regeneration_reuses_buffer) {
+  int inits = 0;
+  auto init = [&inits](const matrix_stage::buffers_t& b) {
+    inits++;
+    memset(b.ha, inits, 1000);
+    return true;
+  };
+  matrix_stage::stats_t before = matrix_stage::get_stats();
+
+  matrix_stage::key_t key = make_key(4);
+  auto a = matrix_stage::acquire(key, init, test_alloc, test_free);
+  ASSERT_TRUE(a);
+  const void* first = a->ha;
+  EXPECT_EQ(live_allocs, 1);
+
+  for (int g = 1; g <= 3; g++) {
+    key.generation = g;
+    auto held = std::move(a);
+    a = matrix_stage::acquire(key, init, test_alloc, test_free, &held);
+    ASSERT_TRUE(a);
+    EXPECT_FALSE(held);
+    EXPECT_EQ(a->ha, first);
+    EXPECT_EQ(static_cast<const uint8_t*>(a->ha)[999], g + 1);
+    EXPECT_EQ(live_allocs, 1);
+  }
+  EXPECT_EQ(inits, 4);
+
+  matrix_stage::stats_t after = matrix_stage::get_stats();
+  EXPECT_EQ(after.generated - before.generated, 4u);
+  EXPECT_EQ(after.reused - before.reused, 3u);
+
+  // re-keyed buffer is found under its new key only
+  auto b = matrix_stage::acquire(key, init, test_alloc, test_free);
+  EXPECT_EQ(b->ha, first);
+  key.generation = 0;
+  auto c = matrix_stage::acquire(key, init, test_alloc, test_free);
+  EXPECT_NE(c->ha, first);
+  EXPECT_EQ(inits, 5);
+
+  a.reset();
+  b.reset();
+  c.reset();
+  EXPECT_EQ(live_allocs, 0);
+  EXPECT_EQ(matrix_stage::get_stats().bytes_resident, before.bytes_resident);
+}
+
+// buffer shared with another worker is not overwritten by regeneration
+TEST(MatrixStage, regeneration_keeps_shared_buffer) {
+  auto init = [](const matrix_stage::buffers_t& b) {
+    memset(b.ha, 7, 1000);
+    return true;
+  };
+
+  matrix_stage::key_t key = make_key(5);
+  auto a = matrix_stage::acquire(key, init, test_alloc, test_free);
+  auto other = matrix_stage::acquire(key, init, test_alloc, test_free);
+  ASSERT_TRUE(a);
+  ASSERT_EQ(a->ha, other->ha);
+
+  key.generation = 1;
+  auto held = std::move(a);
+  a = matrix_stage::acquire(key, init, test_alloc, test_free, &held);
+  ASSERT_TRUE(a);
+  EXPECT_NE(a->ha, other->ha);
+  EXPECT_EQ(live_allocs, 2);
+
+  // size change allocates a new buffer and frees the old one
+  other.reset();
+  key.generation = 2;
+  key.bytes_c = 5000;
+  held = std::move(a);
+  a = matrix_stage::acquire(key, init, test_alloc, test_free, &held);
+  ASSERT_TRUE(a);
+  EXPECT_EQ(live_allocs, 1);
+
+  a.reset();
+  EXPECT_EQ(live_allocs, 0);
+}
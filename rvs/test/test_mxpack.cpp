@@ -0,0 +1,179 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <stdint.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_mxpack.h"
+
+namespace {
+
+// element at a time fp6 unpack as previously done in rvs_blas (over all
+// output values)
+std::vector<uint8_t> ref_unpack_fp6(const std::vector<uint8_t>& in) {
+  std::vector<uint8_t> out(in.size() * 8 / 6);
+  for (size_t i = 0; i < out.size(); i++) {
+    size_t f6_id = (i * 6) / 8;
+    uint8_t value = 0;
+    switch (i % 4) {
+      case 0:
+        value = (in[f6_id] & 0x3F);
+        break;
+      case 1:
+        value = ((in[f6_id] & 0xC0) >> 6) | ((in[f6_id + 1] & 0xF) << 2);
+        break;
+      case 2:
+        value = ((in[f6_id] & 0xF0) >> 4) | ((in[f6_id + 1] & 0x3) << 4);
+        break;
+      case 3:
+        value = ((in[f6_id] & 0xFC) >> 2);
+        break;
+    }
+    out[i] = value;
+  }
+  return out;
+}
+
+// element at a time scale alignment as previously done in rvs_blas
+void ref_align(const std::vector<uint8_t>& data,
+               const std::vector<uint8_t>& scale, int rows, int cols,
+               int block, std::vector<uint8_t>* aligned,
+               std::vector<float>* values) {
+  aligned->assign(rows * cols, 0);
+  values->assign(rows * cols, 0);
+  for (int rk = 0; rk < rows * cols; rk++) {
+    int r = rk % rows;
+    int k = rk / rows;
+    int scale_id = (k / block) * rows + r;
+    int data_id = scale_id * block + k % block;
+    (*aligned)[rk] = data[data_id];
+    // stand-in for DGen::toFloat
+    (*values)[rk] = data[data_id] * std::ldexp(1.0f, scale[scale_id] - 127);
+  }
+}
+
+}  // namespace
+
+// every byte value, all lengths up to a few SWAR groups (scalar tails)
+TEST(MxPack, fp4_exhaustive) {
+  std::vector<uint8_t> in(256 + 13);
+  for (size_t i = 0; i < in.size(); i++)
+    in[i] = static_cast<uint8_t>(i * 7 + 3);
+
+  for (size_t n = 0; n <= in.size(); n += (n < 40 ? 1 : 37)) {
+    std::vector<uint8_t> out(n * 2, 0xAA), packed(n, 0xAA);
+    rvs::mxpack::unpack_fp4(in.data(), n, out.data());
+    for (size_t i = 0; i < n; i++) {
+      ASSERT_EQ(out[2 * i], in[i] & 0x0F) << n << " " << i;
+      ASSERT_EQ(out[2 * i + 1], in[i] >> 4) << n << " " << i;
+    }
+    rvs::mxpack::pack_fp4(out.data(), n * 2, packed.data());
+    for (size_t i = 0; i < n; i++)
+      ASSERT_EQ(packed[i], in[i]) << n << " " << i;
+  }
+
+  // odd value count : last high nibble is 0
+  uint8_t odd[3] = {0x1, 0x2, 0x3}, p[2] = {0xFF, 0xFF};
+  rvs::mxpack::pack_fp4(odd, 3, p);
+  EXPECT_EQ(p[0], 0x21);
+  EXPECT_EQ(p[1], 0x03);
+}
+
+// every 3 byte group (all 4 value combinations) against the element at a
+// time unpack, then packed back
+TEST(MxPack, fp6_exhaustive) {
+  const size_t chunk = 1 << 16;
+  std::vector<uint8_t> in(chunk * 3), out(chunk * 4), packed(chunk * 3);
+
+  for (uint32_t base = 0; base < (1u << 24); base += chunk) {
+    for (size_t g = 0; g < chunk; g++) {
+      uint32_t v = base + g;
+      in[g * 3] = v & 0xFF;
+      in[g * 3 + 1] = (v >> 8) & 0xFF;
+      in[g * 3 + 2] = v >> 16;
+    }
+    rvs::mxpack::unpack_fp6(in.data(), in.size(), out.data());
+    ASSERT_EQ(out, ref_unpack_fp6(in)) << base;
+    rvs::mxpack::pack_fp6(out.data(), out.size(), packed.data());
+    ASSERT_EQ(packed, in) << base;
+  }
+
+  // lengths that are not a multiple of a SWAR group
+  std::mt19937 rng(7);
+  for (size_t n = 1; n <= 40; n++) {
+    std::vector<uint8_t> b(n);
+    for (auto& x : b)
+      x = rng() & 0xFF;
+    std::vector<uint8_t> o(n * 8 / 6);
+    rvs::mxpack::unpack_fp6(b.data(), n, o.data());
+    ASSERT_EQ(o, ref_unpack_fp6(b)) << n;
+    if (n % 3 == 0) {
+      std::vector<uint8_t> p(n, 0xAA);
+      rvs::mxpack::pack_fp6(o.data(), o.size(), p.data());
+      ASSERT_EQ(p, b) << n;
+    }
+  }
+}
+
+// cache blocked alignment and table conversion against the element at a
+// time alignment
+TEST(MxPack, align_and_convert) {
+  std::mt19937 rng(11);
+  const int shapes[][3] = {
+    {1, 32, 32}, {7, 64, 32}, {64, 32, 32}, {65, 96, 32}, {130, 64, 32},
+    {128, 128, 32}, {33, 48, 16}, {5, 40, 32}
+  };
+
+  for (const auto& sh : shapes) {
+    int rows = sh[0], cols = sh[1], block = sh[2];
+    int kblocks = (cols + block - 1) / block;
+    std::vector<uint8_t> data(kblocks * rows * block), scale(kblocks * rows);
+    for (auto& x : data)
+      x = rng() & 0x3F;
+    for (auto& x : scale)
+      x = 120 + rng() % 16;
+
+    std::vector<uint8_t> ref_aligned;
+    std::vector<float> ref_values;
+    ref_align(data, scale, rows, cols, block, &ref_aligned, &ref_values);
+
+    std::vector<uint8_t> aligned(rows * cols);
+    rvs::mxpack::align_blocks(data.data(), aligned.data(), rows, cols, block);
+    ASSERT_EQ(aligned, ref_aligned) << rows << "x" << cols;
+
+    std::vector<float> luts(256 * 64);
+    for (int s = 0; s < 256; s++)
+      for (int c = 0; c < 64; c++)
+        luts[s * 64 + c] = c * std::ldexp(1.0f, s - 127);
+    std::vector<float> values(rows * cols);
+    rvs::mxpack::aligned_to_float(aligned.data(), scale.data(), rows, cols,
+                                  block, luts.data(), 64, values.data());
+    ASSERT_EQ(values, ref_values) << rows << "x" << cols;
+  }
+}
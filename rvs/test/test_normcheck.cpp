@@ -0,0 +1,185 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_hostgemm.h"
+#include "include/rvs_normcheck.h"
+#include "include/rvs_unit_testing_defs.h"
+
+using rvs::normcheck;
+
+namespace {
+
+// reference: two pass Frobenius norms in long double
+template <typename T, typename Cvt>
+double ref_error(int64_t m, int64_t n, int64_t ld, const T* a, const T* b,
+                 Cvt cvt) {
+  long double sd = 0, sr = 0;
+  for (int64_t j = 0; j < n; j++) {
+    for (int64_t i = 0; i < m; i++) {
+      long double x = cvt(a[i + j * ld]);
+      long double y = cvt(b[i + j * ld]);
+      sd += (y - x) * (y - x);
+      sr += x * x;
+    }
+  }
+  return std::sqrt(static_cast<double>(sd / sr));
+}
+
+uint16_t float_to_bf16(float f) {
+  uint32_t u;
+  memcpy(&u, &f, 4);
+  return u >> 16;
+}
+
+// reference decoding of format fmt
+auto decoder(rvs::lpconv::format_t fmt) {
+  return [fmt](uint32_t bits) { return rvs::lpconv::decode(fmt, bits); };
+}
+
+}  // namespace
+
+class NormCheckIsa : public ::testing::TestWithParam<rvs::hostgemm::isa_t> {
+ protected:
+  void SetUp() override {
+    rvs::hostgemm::set_isa(GetParam());
+  }
+  void TearDown() override {
+    rvs::hostgemm::set_isa(rvs::hostgemm::detect_isa());
+  }
+
+  const int64_t m = 77, n = 33, ld = 80;
+};
+
+TEST_P(NormCheckIsa, float_double) {
+  std::mt19937 gen(1);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  std::vector<float> a(ld * n), b(ld * n);
+  std::vector<double> da(ld * n), db(ld * n);
+
+  for (size_t i = 0; i < a.size(); i++) {
+    da[i] = a[i] = dist(gen);
+    db[i] = b[i] = a[i] + 1e-3f * dist(gen);
+  }
+  // padding must be ignored
+  for (int64_t j = 0; j < n; j++)
+    b[m + j * ld] = db[m + j * ld] = 1e30;
+
+  auto id = [](double x) { return x; };
+  EXPECT_NEAR(normcheck::relative_error(rvs::lpconv::fmt_f32, m, n, ld,
+              a.data(), b.data()), ref_error(m, n, ld, a.data(), b.data(), id),
+              1e-12);
+  EXPECT_NEAR(normcheck::relative_error(m, n, ld, da.data(), db.data()),
+              ref_error(m, n, ld, da.data(), db.data(), id), 1e-12);
+  EXPECT_EQ(normcheck::relative_error(rvs::lpconv::fmt_f32, m, n, ld,
+            a.data(), a.data()), 0.0);
+}
+
+TEST_P(NormCheckIsa, low_precision) {
+  std::mt19937 gen(2);
+  std::uniform_real_distribution<float> dist(-4.0f, 4.0f);
+  std::vector<uint16_t> ha(ld * n), hb(ld * n), ba(ld * n), bb(ld * n);
+  std::vector<uint8_t> la(ld * n), lb(ld * n);
+
+  for (size_t i = 0; i < ha.size(); i++) {
+    _Float16 x = dist(gen), y = dist(gen);
+    memcpy(&ha[i], &x, 2);
+    memcpy(&hb[i], &y, 2);
+    ba[i] = float_to_bf16(dist(gen));
+    bb[i] = float_to_bf16(dist(gen));
+    // finite e4m3 codes (0x7f/0xff are NaN)
+    la[i] = gen() % 0x7f | (gen() & 0x80);
+    lb[i] = gen() % 0x7f | (gen() & 0x80);
+  }
+
+  EXPECT_NEAR(normcheck::relative_error(rvs::lpconv::fmt_f16, m, n, ld,
+              ha.data(), hb.data()), ref_error(m, n, ld, ha.data(), hb.data(),
+              decoder(rvs::lpconv::fmt_f16)), 1e-12);
+  EXPECT_NEAR(normcheck::relative_error(rvs::lpconv::fmt_bf16, m, n, ld,
+              ba.data(), bb.data()), ref_error(m, n, ld, ba.data(), bb.data(),
+              decoder(rvs::lpconv::fmt_bf16)), 1e-12);
+  EXPECT_NEAR(normcheck::relative_error(rvs::lpconv::fmt_e4m3, m, n, ld,
+              la.data(), lb.data()), ref_error(m, n, ld, la.data(), lb.data(),
+              decoder(rvs::lpconv::fmt_e4m3)), 1e-12);
+
+  // columns longer than a decoded chunk
+  const int64_t tall = 5000;
+  std::vector<uint16_t> ta(tall * 3), tb(tall * 3);
+  for (size_t i = 0; i < ta.size(); i++) {
+    ta[i] = float_to_bf16(dist(gen));
+    tb[i] = float_to_bf16(dist(gen));
+  }
+  EXPECT_NEAR(normcheck::relative_error(rvs::lpconv::fmt_bf16, tall, 3, tall,
+              ta.data(), tb.data()), ref_error(tall, 3, tall, ta.data(),
+              tb.data(), decoder(rvs::lpconv::fmt_bf16)), 1e-12);
+
+  // NaN decoded from a low precision format is an error
+  hb[3] = 0x7e00;
+  EXPECT_TRUE(std::isinf(normcheck::relative_error(rvs::lpconv::fmt_f16, m,
+              n, ld, ha.data(), hb.data())));
+  EXPECT_TRUE(std::isinf(normcheck::relative_error(rvs::lpconv::fmt_none, m,
+              n, ld, ha.data(), hb.data())));
+}
+
+TEST_P(NormCheckIsa, nan_and_overflow) {
+  std::vector<double> a(ld * n, 1e300), b(ld * n, 1e300);
+
+  // squares overflow - rescaled result still exact
+  b[5] = 2e300;
+  EXPECT_NEAR(normcheck::relative_error(m, n, ld, a.data(), b.data()),
+              1.0 / std::sqrt(double(m * n)), 1e-12);
+
+  b[5] = std::numeric_limits<double>::quiet_NaN();
+  EXPECT_TRUE(std::isinf(normcheck::relative_error(m, n, ld, a.data(),
+              b.data())));
+}
+
+INSTANTIATE_TEST_SUITE_P(isa, NormCheckIsa,
+    ::testing::Values(rvs::hostgemm::isa_generic, rvs::hostgemm::isa_avx2,
+                      rvs::hostgemm::isa_avx512));
+
+TEST(NormCheck, equal) {
+  std::vector<float> a(80 * 10, 1.0f), b(80 * 10, 1.0f);
+
+  // padding differences are ignored
+  b[79] = 2.0f;
+  EXPECT_TRUE(normcheck::equal(77, 10, 80, sizeof(float), a.data(), b.data()));
+  b[80 * 9 + 76] = 2.0f;
+  EXPECT_FALSE(normcheck::equal(77, 10, 80, sizeof(float), a.data(),
+                                b.data()));
+  // contiguous
+  std::vector<float> c(a);
+  EXPECT_TRUE(normcheck::equal(80, 10, 80, sizeof(float), a.data(), c.data()));
+  c[80 * 10 - 1] = 0.0f;
+  EXPECT_FALSE(normcheck::equal(80, 10, 80, sizeof(float), a.data(),
+                                c.data()));
+}
@@ -0,0 +1,191 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_hostgemm.h"
+#include "include/rvs_philox.h"
+#include "include/rvs_unit_testing_defs.h"
+
+using rvs::philox;
+
+namespace {
+
+philox::params_t int_params(uint64_t seed, uint64_t stream, int lo, int hi) {
+  philox::params_t p = {};
+  p.seed = seed;
+  p.stream = stream;
+  p.dist = philox::dist_int;
+  p.lo = lo;
+  p.hi = hi;
+  return p;
+}
+
+// fp16 storage type converting like the compiler's _Float16
+struct test_half {
+  _Float16 v;
+  test_half() : v(0) {
+  }
+  explicit test_half(float f) : v(static_cast<_Float16>(f)) {
+  }
+  explicit operator float() const {
+    return static_cast<float>(v);
+  }
+};
+
+}  // namespace
+
+// Random123 known answer tests for philox4x32-10
+TEST(Philox, known_answers) {
+  const uint32_t ctr[3][4] = {
+    {0, 0, 0, 0},
+    {0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+    {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}};
+  const uint32_t key[3][2] = {
+    {0, 0},
+    {0xffffffff, 0xffffffff},
+    {0xa4093822, 0x299f31d0}};
+  const uint32_t expect[3][4] = {
+    {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+    {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+    {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+
+  for (int t = 0; t < 3; t++) {
+    uint32_t out[4];
+    philox::block(ctr[t], key[t], out);
+    for (int w = 0; w < 4; w++)
+      EXPECT_EQ(out[w], expect[t][w]) << "vector " << t << " word " << w;
+  }
+}
+
+// fill() agrees with the block function for every ISA and any alignment
+TEST(Philox, fill_matches_block) {
+  philox::params_t p = {};
+  p.seed = 0x0123456789abcdefULL;
+  p.stream = 7;
+  p.dist = philox::dist_mod;
+  p.modulus = 0xffffffff;
+  p.divisor = 1.0f;
+
+  const uint32_t key[2] = {0x89abcdef, 0x01234567};
+  const size_t n = 1000;
+  std::vector<float> expect(n);
+  for (size_t i = 0; i < n; i++) {
+    const uint32_t ctr[4] = {static_cast<uint32_t>(i / 4), 0, 7, 0};
+    uint32_t out[4];
+    philox::block(ctr, key, out);
+    expect[i] = static_cast<float>(out[i % 4] % p.modulus);
+  }
+
+  rvs::hostgemm::isa_t saved = rvs::hostgemm::get_isa();
+  for (int isa = rvs::hostgemm::isa_generic;
+       isa <= rvs::hostgemm::detect_isa(); isa++) {
+    rvs::hostgemm::set_isa(static_cast<rvs::hostgemm::isa_t>(isa));
+    for (size_t off : {0, 1, 3, 5, 258}) {
+      std::vector<float> v(n - off);
+      philox::fill(p, off, n - off, v.data());
+      for (size_t i = 0; i < v.size(); i++)
+        ASSERT_EQ(v[i], expect[off + i]) << "isa " << isa << " offset " << off;
+    }
+  }
+  rvs::hostgemm::set_isa(saved);
+}
+
+// the result does not depend on the number of threads
+TEST(Philox, thread_count_invariant) {
+  const size_t n = 5 * philox::CHUNK + 123;
+  philox::params_t p = int_params(42, 1, -2, 2);
+  std::vector<double> ref(n);
+
+  philox::fill_as<double>(p, ref.data(), n, 1);
+  for (int threads : {2, 3, 8}) {
+    std::vector<double> v(n);
+    philox::fill_as<double>(p, v.data(), n, threads);
+    EXPECT_EQ(0, memcmp(v.data(), ref.data(), n * sizeof(double)))
+      << threads << " threads";
+  }
+}
+
+// integer distribution covers exactly [lo, hi] about uniformly
+TEST(Philox, int_range) {
+  const size_t n = 100000;
+  std::vector<int8_t> v(n);
+  philox::fill_as<int8_t>(int_params(1, 0, 1, 10), v.data(), n);
+
+  std::vector<size_t> hist(11, 0);
+  for (int8_t x : v) {
+    ASSERT_GE(x, 1);
+    ASSERT_LE(x, 10);
+    hist[x]++;
+  }
+  for (int i = 1; i <= 10; i++) {
+    EXPECT_GT(hist[i], n / 10 * 9 / 10);
+    EXPECT_LT(hist[i], n / 10 * 11 / 10);
+  }
+}
+
+// bulk conversion to low precision gives the same values as element casts
+TEST(Philox, fill_low_precision) {
+  const size_t n = 3 * philox::CHUNK + 17;
+  philox::params_t p = {};
+  p.seed = 9;
+  p.dist = philox::dist_mod;
+  p.modulus = 2000;
+  p.divisor = 7.0f;
+  std::vector<float> f(n);
+  std::vector<test_half> h(n);
+
+  ASSERT_EQ(rvs::lpconv::conversion<test_half>().fmt, rvs::lpconv::fmt_f16);
+  philox::fill_as<float>(p, f.data(), n);
+  philox::fill_as<test_half>(p, h.data(), n);
+  for (size_t i = 0; i < n; i++)
+    ASSERT_EQ(float(h[i]), float(test_half(f[i]))) << i;
+}
+
+// seeds and streams give different sequences, the same ones repeat
+TEST(Philox, seed_and_stream) {
+  const size_t n = 256;
+  std::vector<float> a(n), b(n), c(n), d(n);
+  philox::fill_as<float>(int_params(5, 0, -1000, 1000), a.data(), n);
+  philox::fill_as<float>(int_params(5, 0, -1000, 1000), b.data(), n);
+  philox::fill_as<float>(int_params(6, 0, -1000, 1000), c.data(), n);
+  philox::fill_as<float>(int_params(5, 1, -1000, 1000), d.data(), n);
+
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, c);
+  EXPECT_NE(a, d);
+}
+
+TEST(Philox, sin_values) {
+  philox::params_t p = {};
+  p.dist = philox::dist_sin;
+  std::vector<float> v(100);
+  philox::fill(p, 1000, v.size(), v.data());
+  for (size_t i = 0; i < v.size(); i++)
+    EXPECT_EQ(v[i], std::sin(static_cast<float>(1000 + i)));
+}
@@ -0,0 +1,194 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_power_control.h"
+#include "include/rvs_unit_testing_defs.h"
+
+namespace {
+
+//! default IET power controller gains (normalized power error)
+rvs::pid_gains_t iet_gains(void) {
+  rvs::pid_gains_t g;
+  g.kp = 0.3;
+  g.ki = 0.6;
+  return g;
+}
+
+//! runs the loop at a fixed sample interval, returns the loop statistics
+rvs::power_loop_stats run_loop(rvs::power_plant* plant, double target,
+                               double tolerance, double dt_s, double seconds,
+                               rvs::pid_controller* pid) {
+  rvs::power_loop_stats stats(target, tolerance);
+  double power = 0;
+  double command = pid->output();
+  for (double t = dt_s; t <= seconds + 1e-9; t += dt_s) {
+    power = plant->step(command, dt_s);
+    stats.add(t, power);
+    command = pid->update(1.0, power / target, dt_s);
+  }
+  return stats;
+}
+
+}  // namespace
+
+// output limits and conditional integration
+TEST(PowerControl, pid_anti_windup) {
+  rvs::pid_gains_t g;
+  g.kp = 1.0;
+  g.ki = 1.0;
+  rvs::pid_controller pid(g, 0.0, 1.0);
+  pid.reset(0.5);
+
+  // unreachable setpoint: the output saturates but the integral stays bounded
+  for (int i = 0; i < 1000; i++)
+    pid.update(10.0, 0.0, 1.0);
+  EXPECT_TRUE(pid.saturated());
+  EXPECT_DOUBLE_EQ(pid.output(), 1.0);
+
+  // the integral did not wind up: once the error changes sign the output
+  // leaves saturation at once
+  double out = pid.update(0.0, 0.2, 1.0);
+  EXPECT_FALSE(pid.saturated());
+  EXPECT_NEAR(out, 0.5 - 0.2 - 0.2, 1e-12);
+
+  // pure P with zero error keeps the integral value
+  rvs::pid_gains_t p;
+  p.kp = 2.0;
+  rvs::pid_controller pc(p, -1.0, 1.0);
+  pc.reset(0.25);
+  EXPECT_DOUBLE_EQ(pc.update(1.0, 1.0, 1.0), 0.25);
+  EXPECT_DOUBLE_EQ(pc.update(1.0, 0.9, 1.0), 0.25 + 0.2);
+}
+
+// first order power response and temperature dependent leakage
+TEST(PowerControl, plant_response) {
+  rvs::power_plant_params_t prm;
+  prm.leakage_w_per_c = 0;
+  rvs::first_order_power_plant plant(prm);
+
+  EXPECT_DOUBLE_EQ(plant.power(), prm.idle_w);
+  double p = plant.step(1.0, prm.tau_s);
+  EXPECT_NEAR(p, prm.idle_w + (prm.max_w - prm.idle_w) * (1 - std::exp(-1.0)),
+              1e-9);
+  for (int i = 0; i < 20; i++)
+    p = plant.step(1.0, prm.tau_s);
+  EXPECT_NEAR(p, prm.max_w, 1e-3);
+  EXPECT_GT(plant.temperature(), prm.ambient_c);
+
+  // with leakage the power keeps rising as the die heats up
+  rvs::power_plant_params_t hot = prm;
+  hot.leakage_w_per_c = 0.5;
+  rvs::first_order_power_plant leaky(hot);
+  double early = 0;
+  for (int i = 0; i < 10; i++)
+    early = leaky.step(0.5, 0.5);
+  double late = early;
+  for (int i = 0; i < 400; i++)
+    late = leaky.step(0.5, 0.5);
+  EXPECT_GT(late, early + 10);
+}
+
+// settling time resets on every excursion, error is measured after settling
+TEST(PowerControl, loop_stats) {
+  rvs::power_loop_stats st(100.0, 0.05, 2);
+  EXPECT_FALSE(st.settled());
+
+  st.add(1, 80);
+  st.add(2, 98);
+  EXPECT_FALSE(st.settled());
+  EXPECT_DOUBLE_EQ(st.settling_time(), -1);
+  st.add(3, 110);
+  EXPECT_FALSE(st.settled());
+  st.add(4, 102);
+  st.add(5, 104);
+  EXPECT_TRUE(st.settled());
+  EXPECT_DOUBLE_EQ(st.settling_time(), 4);
+  EXPECT_NEAR(st.steady_state_error(), 0.03, 1e-12);
+  EXPECT_EQ(st.samples(), 5u);
+}
+
+// a loop oscillating through the band never holds it long enough
+TEST(PowerControl, loop_stats_oscillation) {
+  rvs::power_loop_stats st(100.0, 0.05);
+  for (int i = 1; i <= 100; i++)
+    st.add(i, (i / 3) % 2 ? 110 : 100);
+  EXPECT_FALSE(st.settled());
+  EXPECT_DOUBLE_EQ(st.settling_time(), -1);
+
+  // in band for the last samples only: too short a fraction of the run
+  rvs::power_loop_stats late(100.0, 0.05, POWER_LOOP_MIN_HOLD, 0.25);
+  for (int i = 1; i <= 100; i++)
+    late.add(i, i <= 90 ? 120 : 101);
+  EXPECT_FALSE(late.settled());
+  for (int i = 101; i <= 130; i++)
+    late.add(i, 101);
+  EXPECT_TRUE(late.settled());
+  EXPECT_DOUBLE_EQ(late.settling_time(), 91);
+}
+
+// the closed loop holds the target despite leakage drift and saturation
+TEST(PowerControl, closed_loop) {
+  rvs::power_plant_params_t prm;
+  const double target = 350;
+  const double tol = 0.05;
+
+  rvs::first_order_power_plant plant(prm);
+  rvs::pid_controller pid(iet_gains(), 0.02, 1.0);
+  rvs::power_loop_stats st = run_loop(&plant, target, tol, 1.0, 300, &pid);
+
+  EXPECT_TRUE(st.settled());
+  EXPECT_LT(st.settling_time(), 20.0);
+  EXPECT_LT(std::fabs(st.steady_state_error()), 0.01);
+  EXPECT_NEAR(plant.power(), target, target * 0.01);
+
+  // a target above the full load power: the command saturates and the loop
+  // recovers quickly once the target becomes reachable
+  rvs::first_order_power_plant plant2(prm);
+  rvs::pid_controller pid2(iet_gains(), 0.02, 1.0);
+  run_loop(&plant2, 900, tol, 1.0, 120, &pid2);
+  EXPECT_DOUBLE_EQ(pid2.output(), 1.0);
+  rvs::power_loop_stats st2 = run_loop(&plant2, target, tol, 1.0, 60, &pid2);
+  EXPECT_TRUE(st2.settled());
+  EXPECT_LT(st2.settling_time(), 20.0);
+}
+
+// controller command to workload knobs
+TEST(PowerControl, actuation) {
+  rvs::power_actuation_t a = rvs::power_actuation(1.0, 8);
+  EXPECT_DOUBLE_EQ(a.gemm_duty, 1.0);
+  EXPECT_EQ(a.hot_calls, 8u);
+  EXPECT_DOUBLE_EQ(a.bw_intensity, 1.0);
+
+  a = rvs::power_actuation(0.3, 8);
+  EXPECT_DOUBLE_EQ(a.gemm_duty, 0.3);
+  EXPECT_EQ(a.hot_calls, 3u);
+
+  a = rvs::power_actuation(-1.0, 8);
+  EXPECT_EQ(a.hot_calls, 1u);
+  EXPECT_DOUBLE_EQ(a.gemm_duty, 0.0);
+}
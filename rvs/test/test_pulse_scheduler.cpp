@@ -0,0 +1,117 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <stdint.h>
+
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_pulse_scheduler.h"
+#include "include/rvs_unit_testing_defs.h"
+
+// closest rank interpolation
+TEST(PulseScheduler, percentile) {
+  EXPECT_DOUBLE_EQ(rvs::percentile({}, 50), 0.0);
+  EXPECT_DOUBLE_EQ(rvs::percentile({7}, 99), 7.0);
+  std::vector<double> v = {5, 1, 4, 2, 3};
+  EXPECT_DOUBLE_EQ(rvs::percentile(v, 0), 1.0);
+  EXPECT_DOUBLE_EQ(rvs::percentile(v, 50), 3.0);
+  EXPECT_DOUBLE_EQ(rvs::percentile(v, 100), 5.0);
+  EXPECT_DOUBLE_EQ(rvs::percentile(v, 90), 4.6);
+}
+
+// no-op workload: the phases follow the absolute schedule
+TEST(PulseScheduler, noop_workload) {
+  const int pulses = 20;
+  rvs::pulse_scheduler sched(5.0, 3.0, 200);
+
+  int64_t t0 = rvs::pulse_scheduler::now_ns();
+  sched.start();
+  std::vector<rvs::pulse_timing_t> timing;
+  for (int i = 0; i < pulses; i++) {
+    sched.begin_phase();
+    EXPECT_TRUE(sched.high_phase());
+    sched.wait_deadline();
+    EXPECT_TRUE(sched.expired());
+    EXPECT_FALSE(sched.end_phase(nullptr));
+
+    sched.begin_phase();
+    EXPECT_FALSE(sched.high_phase());
+    sched.wait_deadline();
+    rvs::pulse_timing_t t;
+    EXPECT_TRUE(sched.end_phase(&t));
+    EXPECT_EQ(t.pulse, static_cast<uint64_t>(i));
+    timing.push_back(t);
+  }
+  double elapsed_ms = (rvs::pulse_scheduler::now_ns() - t0) / 1e6;
+
+  // 20 periods of 8 ms, no accumulated drift
+  EXPECT_GE(elapsed_ms, pulses * 8.0);
+  EXPECT_LT(elapsed_ms, pulses * 8.0 + 10.0);
+  // typical phase lengths (single late wake ups on a loaded host aside)
+  std::vector<double> high, low;
+  for (const auto& t : timing) {
+    high.push_back(t.high_ms);
+    low.push_back(t.low_ms);
+  }
+  EXPECT_NEAR(rvs::percentile(high, 50), 5.0, 0.5);
+  EXPECT_NEAR(rvs::percentile(low, 50), 3.0, 0.5);
+
+  rvs::pulse_jitter_t j = sched.jitter();
+  EXPECT_EQ(j.boundaries, 2u * pulses);
+  EXPECT_LE(j.p50_us, j.p90_us);
+  EXPECT_LE(j.p90_us, j.p99_us);
+  EXPECT_LE(j.p99_us, j.max_us);
+  EXPECT_LT(j.p50_us, 500.0);
+  EXPECT_LT(j.drift_us, 10000.0);
+}
+
+// an overrunning high phase shortens the low phase, later pulses stay on
+// schedule
+TEST(PulseScheduler, overrun_does_not_drift) {
+  rvs::pulse_scheduler sched(10.0, 30.0, 100);
+  sched.start();
+
+  rvs::pulse_timing_t t;
+  for (int i = 0; i < 3; i++) {
+    sched.begin_phase();
+    // pulse 1: the workload runs 20 ms past the deadline
+    sched.sleep_until(sched.deadline_ns() + (i == 1 ? 20000000 : 0));
+    sched.end_phase(nullptr);
+    sched.begin_phase();
+    sched.wait_deadline();
+    sched.end_phase(&t);
+    if (i == 1) {
+      EXPECT_GE(t.high_ms, 28.0);
+      EXPECT_LE(t.low_ms, 12.0);
+    }
+  }
+
+  rvs::pulse_jitter_t j = sched.jitter();
+  EXPECT_GE(j.max_us, 19000.0);
+  // the pulse after the overrun starts on time
+  EXPECT_LT(t.drift_us, 10000.0);
+  EXPECT_DOUBLE_EQ(j.drift_us, t.drift_us);
+}
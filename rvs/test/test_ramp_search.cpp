@@ -0,0 +1,171 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <stdint.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_ramp_search.h"
+#include "include/rvs_unit_testing_defs.h"
+
+namespace {
+
+//! GEMM context with a virtual clock; GEMM time falls by gemm_us_step per
+//! GEMM down to floor_us (GPU clocks ramping up) with a small alternating
+//! jitter
+struct ramping_blas {
+  double now_us = 0;
+  double gemm_us = 200;
+  double gemm_us_step = -0.5;
+  double floor_us = 100;
+  double jitter = 0.002;
+  uint64_t gemms = 0;
+  bool toggle = false;
+
+  void generate_random_matrix_data(void) {}
+  bool copy_data_to_gpu(void) { return true; }
+  bool run_blas_gemm(uint64_t calls) {
+    toggle = !toggle;
+    for (uint64_t i = 0; i < calls; i++) {
+      now_us += gemm_us * (1 + (toggle ? jitter : -jitter));
+      gemm_us = std::max(floor_us, gemm_us + gemm_us_step);
+    }
+    gemms += calls;
+    return true;
+  }
+  bool is_gemm_op_complete(void) { return true; }
+  double get_time_us(void) { return now_us; }
+  bool set_batch_timing(bool) { return true; }
+  size_t get_batch_times_us(std::vector<double>*) { return 0; }
+  // 1 GFLOP per GEMM
+  double gemm_gflop_count(void) { return 1.0; }
+};
+
+rvs::gemm_outcome run_ramp(ramping_blas* blas, rvs::gemm_ramp_control* ctl,
+                           uint64_t duration_ms) {
+  rvs::gemm_engine_config_t cfg;
+  cfg.duration_ms = duration_ms;
+  cfg.calls = 1;
+  rvs::gemm_no_validation val;
+  rvs::gemm_no_logger log;
+  rvs::gemm_engine<ramping_blas, rvs::gemm_ramp_control> engine(blas, cfg,
+      ctl, &val, &log);
+  return engine.run();
+}
+
+}  // namespace
+
+// window statistics against hand computed values
+TEST(RampSearch, window_stats) {
+  EXPECT_DOUBLE_EQ(rvs::student_t95(1), 12.706);
+  EXPECT_DOUBLE_EQ(rvs::student_t95(9), 2.262);
+  EXPECT_DOUBLE_EQ(rvs::student_t95(1000), 1.960);
+
+  rvs::steady_state_window w(4, 0.01);
+  EXPECT_DOUBLE_EQ(w.mean(), 0.0);
+  w.add(1);
+  w.add(2);
+  w.add(3);
+  w.add(4);
+  EXPECT_TRUE(w.full());
+  EXPECT_DOUBLE_EQ(w.mean(), 2.5);
+  EXPECT_NEAR(w.stddev(), std::sqrt(5.0 / 3.0), 1e-12);
+  EXPECT_NEAR(w.ci_half_width(), 3.182 * std::sqrt(5.0 / 3.0) / 2, 1e-12);
+  // (3.5 - 1.5) / 2.5
+  EXPECT_NEAR(w.trend(), 0.8, 1e-12);
+
+  // rolling: the oldest sample leaves
+  w.add(5);
+  EXPECT_EQ(w.count(), 4u);
+  EXPECT_DOUBLE_EQ(w.mean(), 3.5);
+}
+
+// steady noisy data converges, a drifting series does not
+TEST(RampSearch, window_convergence) {
+  rvs::steady_state_window steady(10, 0.01);
+  for (int i = 0; i < 10; i++)
+    steady.add(1000 + (i % 2 ? 3 : -3));
+  EXPECT_TRUE(steady.converged());
+
+  rvs::steady_state_window drift(10, 0.01);
+  for (int i = 0; i < 10; i++)
+    drift.add(1000 + 5 * i);
+  EXPECT_FALSE(drift.converged());
+
+  rvs::steady_state_window noisy(10, 0.01);
+  for (int i = 0; i < 10; i++)
+    noisy.add(1000 + (i % 2 ? 100 : -100));
+  EXPECT_FALSE(noisy.converged());
+}
+
+// the batch grows to the minimum duration and the ramp ends at steady state
+TEST(RampSearch, ramp_converges) {
+  rvs::gemm_ramp_config_t rc;
+  rc.target = 9000;
+  rc.tolerance = 0.05;
+  rc.window = 8;
+  rc.precision = 0.01;
+  rc.min_batch_ms = 2;
+
+  ramping_blas blas;
+  rvs::gemm_ramp_control ctl(rc, 1.0);
+  EXPECT_EQ(run_ramp(&blas, &ctl, 60000), rvs::gemm_outcome::passed);
+  EXPECT_TRUE(ctl.converged());
+  EXPECT_TRUE(ctl.target_met());
+
+  // batches of at least 2 ms at 100-200 us per GEMM
+  EXPECT_GE(ctl.batch_calls(), 10u);
+  // the GPU reached its final speed (10000 GFLOPS) before convergence
+  EXPECT_EQ(blas.gemm_us, blas.floor_us);
+  EXPECT_NEAR(ctl.gflops(), 10000, 100);
+  EXPECT_LT(ctl.cv(), 0.01);
+  // stopped well before the 60 s ramp limit
+  EXPECT_LT(ctl.ramp_seconds(), 5.0);
+  EXPECT_NEAR(ctl.ramp_seconds(), blas.now_us / 1e6, 1e-9);
+}
+
+// steady state below the target fails without waiting for the ramp limit
+TEST(RampSearch, ramp_misses_target) {
+  rvs::gemm_ramp_config_t rc;
+  rc.target = 20000;
+  rc.tolerance = 0.05;
+  rc.window = 8;
+  rc.min_batch_ms = 2;
+
+  ramping_blas blas;
+  rvs::gemm_ramp_control ctl(rc, 1.0);
+  EXPECT_EQ(run_ramp(&blas, &ctl, 60000), rvs::gemm_outcome::failed);
+  EXPECT_TRUE(ctl.converged());
+  EXPECT_FALSE(ctl.target_met());
+
+  // the ramp limit ends a run that cannot converge
+  ramping_blas noisy;
+  noisy.jitter = 0.2;
+  rvs::gemm_ramp_control ctl2(rc, 1.0);
+  EXPECT_EQ(run_ramp(&noisy, &ctl2, 1000), rvs::gemm_outcome::completed);
+  EXPECT_FALSE(ctl2.converged());
+}
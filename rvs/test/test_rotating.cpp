@@ -0,0 +1,160 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_rotating.h"
+
+using rvs::rotating_config_t;
+using rvs::rotating_mode;
+using rvs::rotating_plan;
+using rvs::rotating_plan_t;
+
+static const uint64_t MiB = 1024ull * 1024ull;
+
+TEST(Rotating, parse) {
+  rotating_mode mode = rotating_mode::fixed;
+
+  EXPECT_TRUE(rvs::rotating_mode_parse("cold", &mode));
+  EXPECT_EQ(mode, rotating_mode::cold);
+  EXPECT_TRUE(rvs::rotating_mode_parse("cache", &mode));
+  EXPECT_EQ(mode, rotating_mode::cache);
+  EXPECT_TRUE(rvs::rotating_mode_parse("fixed", &mode));
+  EXPECT_EQ(mode, rotating_mode::fixed);
+  EXPECT_FALSE(rvs::rotating_mode_parse("warm", &mode));
+  EXPECT_STREQ(rvs::rotating_mode_name(rotating_mode::cold), "cold");
+  EXPECT_EQ(rvs::rotating_align(1, 256), 256u);
+  EXPECT_EQ(rvs::rotating_align(512, 256), 512u);
+}
+
+// fixed sizing keeps the requested working set (rotating MB)
+TEST(Rotating, fixed) {
+  rotating_config_t cfg;
+  cfg.max_blocks = 1000;
+
+  cfg.fixed_bytes = 0;
+  EXPECT_EQ(rotating_plan(cfg, 48 * MiB).blocks, 1u);
+
+  cfg.fixed_bytes = 512 * MiB;
+  rotating_plan_t p = rotating_plan(cfg, 48 * MiB);
+  EXPECT_EQ(p.blocks, 11u);
+  EXPECT_EQ(p.working_set, 11 * 48 * MiB);
+  EXPECT_FALSE(p.cold);
+  EXPECT_FALSE(p.capped);
+
+  cfg.max_blocks = 4;
+  p = rotating_plan(cfg, 48 * MiB);
+  EXPECT_EQ(p.blocks, 4u);
+  EXPECT_TRUE(p.capped);
+}
+
+// cold sizing touches margin x cache between two uses of a block
+TEST(Rotating, cold) {
+  const uint64_t caches[] = {4 * MiB, 8 * MiB, 96 * MiB, 256 * MiB};
+  const uint64_t blocks[] = {1 * MiB, 3 * MiB + 17, 48 * MiB, 600 * MiB};
+
+  for (uint64_t cache : caches) {
+    for (uint64_t block : blocks) {
+      rotating_config_t cfg;
+      cfg.mode = rotating_mode::cold;
+      cfg.cache_bytes = cache;
+      cfg.max_blocks = 1u << 20;
+
+      rotating_plan_t p = rotating_plan(cfg, block);
+      SCOPED_TRACE("cache " + std::to_string(cache) +
+                   " block " + std::to_string(block));
+      EXPECT_TRUE(p.cold);
+      EXPECT_FALSE(p.resident);
+      EXPECT_FALSE(p.capped);
+      EXPECT_GE(p.blocks, 2u);
+      EXPECT_GE((p.blocks - 1) * block, 2 * cache);
+      // smallest such set
+      EXPECT_LT((p.blocks - 2) * block, 2 * cache);
+      EXPECT_EQ(p.working_set, p.blocks * block);
+    }
+  }
+
+  rotating_config_t cfg;
+  cfg.mode = rotating_mode::cold;
+  cfg.cache_bytes = 256 * MiB;
+  cfg.max_blocks = 1000;
+
+  // 256 MiB MALL, 48 MiB per call: 12 blocks, 11 x 48 >= 512 MiB
+  EXPECT_EQ(rotating_plan(cfg, 48 * MiB).blocks, 12u);
+
+  // too few calls per batch to go cold
+  cfg.max_blocks = 8;
+  rotating_plan_t p = rotating_plan(cfg, 48 * MiB);
+  EXPECT_EQ(p.blocks, 8u);
+  EXPECT_TRUE(p.capped);
+  EXPECT_FALSE(p.cold);
+
+  // device memory budget
+  cfg.max_blocks = 1000;
+  cfg.max_bytes = 300 * MiB;
+  p = rotating_plan(cfg, 48 * MiB);
+  EXPECT_EQ(p.blocks, 6u);
+  EXPECT_LE(p.working_set, 300 * MiB);
+  EXPECT_TRUE(p.capped);
+  EXPECT_FALSE(p.cold);
+
+  // unknown cache: one block, nothing guaranteed
+  cfg.cache_bytes = 0;
+  cfg.max_bytes = 0;
+  p = rotating_plan(cfg, 48 * MiB);
+  EXPECT_EQ(p.blocks, 1u);
+  EXPECT_FALSE(p.cold);
+  EXPECT_FALSE(p.resident);
+}
+
+// cache sizing keeps the working set within 1/margin of the cache
+TEST(Rotating, cache) {
+  rotating_config_t cfg;
+  cfg.mode = rotating_mode::cache;
+  cfg.cache_bytes = 256 * MiB;
+  cfg.max_blocks = 1000;
+
+  rotating_plan_t p = rotating_plan(cfg, 16 * MiB);
+  EXPECT_EQ(p.blocks, 8u);
+  EXPECT_EQ(p.working_set, 128 * MiB);
+  EXPECT_TRUE(p.resident);
+  EXPECT_FALSE(p.cold);
+
+  cfg.margin = 1.0;
+  EXPECT_EQ(rotating_plan(cfg, 16 * MiB).blocks, 16u);
+
+  // a single call does not fit: one block, not resident
+  cfg.margin = 2.0;
+  cfg.cache_bytes = 8 * MiB;
+  p = rotating_plan(cfg, 48 * MiB);
+  EXPECT_EQ(p.blocks, 1u);
+  EXPECT_FALSE(p.resident);
+
+  std::string s = rvs::rotating_summary(cfg, p);
+  EXPECT_NE(s.find("mode: cache"), std::string::npos);
+  EXPECT_NE(s.find("blocks: 1"), std::string::npos);
+  EXPECT_NE(s.find("inputs: mixed"), std::string::npos);
+}
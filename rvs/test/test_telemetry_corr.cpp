@@ -0,0 +1,138 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_telemetry_corr.h"
+
+namespace {
+
+// recorded run : 1 s intervals at ~1000 GFLOPS, samples every 250 ms
+//  interval 3 - temperature reaches the limit
+//  interval 5 - power at the cap
+//  interval 7 - clock drops, no thermal/power evidence
+//  interval 8 - GPU nominal (host side stall)
+const char* trace =
+  "# rvs telemetry trace\n"
+  "S 1000000 500 750 70 100 2100 2100 0\n"
+  "S 3250000 520 750 97 100 1500 2100 0\n"
+  "S 3750000 510 750 99 100 1400 2100 0\n"
+  "S 5500000 748 750 80 100 1600 2100 0\n"
+  "S 7500000 500 750 75 100 1200 2100 0\n"
+  "S 8500000 500 750 75 100 2100 2100 0\n"
+  "S 9500000 500 750 75 100 2100 2100 0\n"
+  "I 1000000 1.0 1000\n"
+  "I 2000000 1.0 1010\n"
+  "I 3000000 1.0 1000\n"
+  "I 4000000 1.0 700\n"
+  "I 5000000 1.0 1005\n"
+  "I 6000000 1.0 800\n"
+  "I 7000000 1.0 1000\n"
+  "I 8000000 1.0 600\n"
+  "I 9000000 1.0 500\n"
+  "I 10000000 1.0 1002\n";
+
+}  // namespace
+
+// dips are found against the median interval and annotated with the cause
+TEST(TelemetryCorr, recorded_trace) {
+  rvs::telemetry_corr corr;
+  std::istringstream is(trace);
+  ASSERT_TRUE(corr.load(is));
+  EXPECT_EQ(corr.get_samples().size(), 7u);
+  EXPECT_EQ(corr.get_intervals().size(), 10u);
+  EXPECT_DOUBLE_EQ(corr.reference_gflops(), 1000.0);
+
+  rvs::telemetry_corr::config_t cfg;
+  std::vector<rvs::telemetry_corr::dip_t> dips = corr.analyze(cfg);
+  ASSERT_EQ(dips.size(), 4u);
+
+  EXPECT_EQ(dips[0].index, 3u);
+  EXPECT_NEAR(dips[0].drop, 0.3, 1e-9);
+  EXPECT_EQ(dips[0].samples, 2u);
+  EXPECT_DOUBLE_EQ(dips[0].max_temp_c, 99.0);
+  EXPECT_DOUBLE_EQ(dips[0].min_gfx_mhz, 1400.0);
+  EXPECT_EQ(dips[0].cause, rvs::telemetry_corr::cause_t::thermal);
+
+  EXPECT_EQ(dips[1].index, 5u);
+  EXPECT_EQ(dips[1].cause, rvs::telemetry_corr::cause_t::power_cap);
+
+  EXPECT_EQ(dips[2].index, 7u);
+  EXPECT_EQ(dips[2].cause, rvs::telemetry_corr::cause_t::clock);
+
+  EXPECT_EQ(dips[3].index, 8u);
+  EXPECT_EQ(dips[3].cause, rvs::telemetry_corr::cause_t::unknown);
+
+  std::string desc = rvs::telemetry_corr::describe(dips[0]);
+  EXPECT_NE(desc.find("thermal"), std::string::npos);
+
+  // a looser threshold only keeps the deep dips
+  cfg.dip_threshold = 0.35;
+  EXPECT_EQ(corr.analyze(cfg).size(), 2u);
+}
+
+// throttle bits, missing telemetry, save/load round trip
+TEST(TelemetryCorr, throttle_and_round_trip) {
+  rvs::telemetry_corr corr;
+  rvs::telemetry_corr::config_t cfg;
+
+  for (int i = 1; i <= 5; i++)
+    corr.add_interval({i * 1e6, 1.0, i == 2 || i == 4 ? 500.0 : 1000.0});
+  // interval 1 : throttle reported, interval 3 : no sample at all
+  corr.add_sample({0.5e6, 300, 750, 60, 100, 2000, 2100, 0});
+  corr.add_sample({1.5e6, 300, 750, 60, 100, 2000, 2100, 0x4});
+
+  std::vector<rvs::telemetry_corr::dip_t> dips = corr.analyze(cfg);
+  ASSERT_EQ(dips.size(), 2u);
+  EXPECT_EQ(dips[0].cause, rvs::telemetry_corr::cause_t::throttle);
+  EXPECT_EQ(dips[0].throttle, 0x4u);
+  // falls back to the last sample before the interval
+  EXPECT_EQ(dips[1].samples, 0u);
+  EXPECT_EQ(dips[1].cause, rvs::telemetry_corr::cause_t::throttle);
+
+  rvs::telemetry_corr empty;
+  empty.add_interval({1e6, 1.0, 1000});
+  empty.add_interval({2e6, 1.0, 100});
+  empty.add_interval({3e6, 1.0, 1000});
+  dips = empty.analyze(cfg);
+  ASSERT_EQ(dips.size(), 1u);
+  EXPECT_EQ(dips[0].cause, rvs::telemetry_corr::cause_t::no_telemetry);
+
+  std::ostringstream os;
+  ASSERT_TRUE(corr.save(os));
+  rvs::telemetry_corr copy;
+  std::istringstream is(os.str());
+  ASSERT_TRUE(copy.load(is));
+  EXPECT_EQ(copy.get_samples().size(), 2u);
+  EXPECT_EQ(copy.get_samples()[1].throttle, 0x4u);
+  EXPECT_EQ(copy.analyze(cfg).size(), 2u);
+
+  std::istringstream bad("S 1 2 3\n");
+  EXPECT_FALSE(copy.load(bad));
+  EXPECT_EQ(copy.get_intervals().size(), 5u);
+}
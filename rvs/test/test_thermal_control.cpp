@@ -0,0 +1,205 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "include/rvs_power_control.h"
+#include "include/rvs_thermal_control.h"
+#include "include/rvs_unit_testing_defs.h"
+
+namespace {
+
+//! junction over a heat sink: fast die node on a slow sink node
+class two_node_plant {
+ public:
+  two_node_plant() : sink(35), junction(35) {}
+
+  //! advances the plant by dt_s at the given load, returns the junction
+  //! temperature as reported by SMI (whole degrees)
+  double step(double command, double dt_s) {
+    double power = 80 + 420 * command;
+    const double steps = 100;
+    double h = dt_s / steps;
+    for (int i = 0; i < steps; i++) {
+      double flow = (junction - sink) / 0.03;
+      junction += h * (power - flow) / 20.0;
+      sink += h * (flow - (sink - 35) / 0.09) / 660.0;
+    }
+    return std::round(junction);
+  }
+
+  //! sink temperature in C
+  double sink;
+  //! junction temperature in C
+  double junction;
+};
+
+//! runs the controller on a plant at 1 s samples, returns the statistics
+template <typename T, typename F>
+rvs::thermal_track_stats run_loop(T* plant, F read, rvs::thermal_mpc* mpc,
+                                  double target, double band, int seconds) {
+  rvs::thermal_track_stats stats(target, band);
+  double temp = read(plant, 0.0);
+  double command = mpc->update(0, temp);
+  for (int t = 1; t <= seconds; t++) {
+    temp = read(plant, command);
+    stats.add(t, temp);
+    command = mpc->update(t, temp);
+  }
+  return stats;
+}
+
+}  // namespace
+
+// exact first order data identifies the model
+TEST(ThermalControl, estimator) {
+  const double a = std::exp(-2.0 / 30.0);
+  const double b = 0.8;
+  rvs::thermal_model_estimator est(1.0);
+  EXPECT_FALSE(est.valid());
+  EXPECT_EQ(est.time_constant(), 0);
+
+  double x = 0;
+  for (int k = 0; k < 40; k++) {
+    double u = (k / 7) % 2 ? 0.3 : 1.0;
+    double next = a * x + b * u;
+    est.add(x, u, next, 2.0);
+    x = next;
+  }
+  EXPECT_TRUE(est.valid());
+  EXPECT_EQ(est.samples(), 40u);
+  EXPECT_NEAR(est.sample_period(), 2.0, 1e-12);
+  EXPECT_NEAR(est.get_a(), a, 1e-4);
+  EXPECT_NEAR(est.get_b(), b, 1e-3);
+  EXPECT_NEAR(est.time_constant(), 30.0, 0.1);
+  EXPECT_NEAR(est.full_load_rise(), b / (1 - a), 0.1);
+
+  est.reset();
+  EXPECT_EQ(est.samples(), 0u);
+  EXPECT_FALSE(est.valid());
+}
+
+// time to target, overshoot and hold error
+TEST(ThermalControl, track_stats) {
+  rvs::thermal_track_stats st(80, 1);
+  EXPECT_FALSE(st.reached());
+  EXPECT_EQ(st.time_to_target(), -1);
+  EXPECT_EQ(st.hold_error(), 0);
+  EXPECT_EQ(st.hold_in_band(), 0);
+
+  st.add(1, 60);
+  st.add(2, 75);
+  st.add(3, 78.5);
+  EXPECT_FALSE(st.reached());
+  st.add(4, 79.5);
+  st.add(5, 82);
+  st.add(6, 80);
+  st.add(7, 80.5);
+  EXPECT_TRUE(st.reached());
+  EXPECT_EQ(st.time_to_target(), 4);
+  EXPECT_EQ(st.hold_samples(), 4u);
+  EXPECT_DOUBLE_EQ(st.overshoot(), 2);
+  EXPECT_DOUBLE_EQ(st.hold_max_error(), 2);
+  EXPECT_DOUBLE_EQ(st.hold_error(), std::sqrt((0.25 + 4 + 0 + 0.25) / 4));
+  EXPECT_DOUBLE_EQ(st.hold_in_band(), 0.75);
+}
+
+// before the model is identified: full load below the target
+TEST(ThermalControl, startup) {
+  rvs::thermal_mpc_config_t cfg;
+  cfg.target_c = 70;
+  rvs::thermal_mpc mpc(cfg);
+  EXPECT_EQ(mpc.update(0, 40), 1);
+  EXPECT_EQ(mpc.idle_temperature(), 40);
+  EXPECT_EQ(mpc.update(1, 41), 1);
+  EXPECT_FALSE(mpc.model_ready());
+  // repeated sample time is ignored
+  EXPECT_EQ(mpc.update(1, 90), 1);
+  EXPECT_EQ(mpc.model().samples(), 1u);
+
+  // already above the target: minimum load
+  cfg.target_c = 30;
+  rvs::thermal_mpc hot(cfg);
+  EXPECT_EQ(hot.update(0, 40), cfg.min_command);
+  EXPECT_EQ(hot.update(1, 40), cfg.min_command);
+}
+
+// first order plant with leakage and a power lag
+TEST(ThermalControl, closed_loop_first_order) {
+  rvs::power_plant_params_t prm;
+  rvs::first_order_power_plant plant(prm);
+  for (int t = 0; t < 300; t++)
+    plant.step(0, 1.0);
+
+  rvs::thermal_mpc_config_t cfg;
+  cfg.target_c = 80;
+  rvs::thermal_mpc mpc(cfg);
+  rvs::thermal_track_stats st =
+    run_loop(&plant, [](rvs::first_order_power_plant* p, double u) {
+      p->step(u, 1.0);
+      return p->temperature();
+    }, &mpc, cfg.target_c, 1.0, 300);
+
+  EXPECT_TRUE(mpc.model_ready());
+  // effective time constant with leakage: 20 / (1 - 0.12 * 0.5)
+  EXPECT_NEAR(mpc.model().time_constant(), 20 / 0.94, 2);
+  EXPECT_TRUE(st.reached());
+  EXPECT_LT(st.time_to_target(), 45);
+  EXPECT_LT(st.overshoot(), 0.5);
+  EXPECT_LT(st.hold_error(), 0.3);
+  EXPECT_GT(st.hold_in_band(), 0.99);
+  EXPECT_NEAR(plant.temperature(), cfg.target_c, 0.1);
+}
+
+// fast junction on a slow sink, quantized readings
+TEST(ThermalControl, closed_loop_two_node) {
+  two_node_plant plant;
+  for (int t = 0; t < 2000; t++)
+    plant.step(0, 1.0);
+
+  rvs::thermal_mpc_config_t cfg;
+  cfg.target_c = 75;
+
+  // fastest possible: full load all the way
+  two_node_plant open = plant;
+  int full_load_s = 1;
+  while (open.step(1, 1.0) < cfg.target_c - 1)
+    full_load_s++;
+
+  rvs::thermal_mpc mpc(cfg);
+  rvs::thermal_track_stats st =
+    run_loop(&plant, [](two_node_plant* p, double u) {
+      return p->step(u, 1.0);
+    }, &mpc, cfg.target_c, 1.0, 600);
+
+  EXPECT_TRUE(mpc.model_ready());
+  EXPECT_TRUE(st.reached());
+  EXPECT_TRUE(mpc.holding());
+  EXPECT_LE(st.time_to_target(), full_load_s + 5);
+  EXPECT_LE(st.overshoot(), 1);
+  EXPECT_LT(st.hold_error(), 1.0);
+  EXPECT_GT(st.hold_in_band(), 0.9);
+}
@@ -0,0 +1,180 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvsthreadbase.h"
+#include "include/rvsthreadpool.h"
+#include "include/rvs_unit_testing_defs.h"
+
+class pool_thread : public rvs::ThreadBase {
+ public:
+  virtual ~pool_thread() {
+  }
+  // indicator for thread finished
+  std::atomic<int> finished{0};
+  // run override
+  void run() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    finished = 1;
+  }
+};
+
+TEST(ThreadPoolTest, task_group) {
+  rvs::TaskGroup group;
+  std::atomic<int> sum{0};
+
+  for (int i = 0; i < 1000; i++) {
+    group.run([&sum, i]() { sum += i; }, i % 4);
+  }
+  group.wait();
+
+  EXPECT_TRUE(group.done());
+  EXPECT_EQ(sum, 999 * 1000 / 2);
+}
+
+TEST(ThreadPoolTest, task_exception) {
+  rvs::TaskGroup group;
+
+  group.run([]() { throw 5; });
+  EXPECT_THROW(group.wait(), int);
+
+  // error is reported only once
+  group.run([]() {});
+  EXPECT_NO_THROW(group.wait());
+
+  // exceptions of detached and plain tasks are logged, the pool survives
+  rvs::PooledThread t;
+  t.start([]() { throw std::runtime_error("detached"); });
+  t.detach();
+  rvs::ThreadPool::Get()->submit([]() { throw 7; });
+  group.run([]() {});
+  EXPECT_NO_THROW(group.wait());
+}
+
+TEST(ThreadPoolTest, placement_restored) {
+  std::vector<int> all;
+  ASSERT_EQ(rvs::affinity::get_thread_affinity(&all), 0);
+  ASSERT_FALSE(all.empty());
+
+  // tasks pinning their pool thread directly (as pebb does) ...
+  rvs::TaskGroup pin;
+  for (int i = 0; i < 4; i++) {
+    pin.run([&all]() {
+      rvs::affinity::set_thread_affinity({all[0]});
+      rvs::affinity::set_thread_mem_node(0);
+    }, i, rvs::cpu_affinity_t(), true);
+  }
+  pin.wait();
+
+  // ... do not leave the pin behind for later tasks on the same threads
+  std::mutex mtx;
+  std::vector<std::vector<int>> seen;
+  rvs::TaskGroup check;
+  for (int i = 0; i < 64; i++) {
+    check.run([&mtx, &seen]() {
+      std::vector<int> cpus;
+      rvs::affinity::get_thread_affinity(&cpus);
+      std::lock_guard<std::mutex> lk(mtx);
+      seen.push_back(cpus);
+    }, i % 4);
+  }
+  check.wait();
+  for (const auto& cpus : seen) {
+    EXPECT_EQ(cpus, all);
+  }
+}
+
+TEST(ThreadPoolTest, thread_reuse) {
+  std::vector<pool_thread> workers(8);
+
+  // all blocking workers run concurrently
+  auto start = std::chrono::steady_clock::now();
+  for (auto& w : workers) {
+    w.start();
+  }
+  for (auto& w : workers) {
+    w.join();
+    EXPECT_EQ(w.finished, 1);
+  }
+  auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::steady_clock::now() - start).count();
+  EXPECT_LT(ms, 8 * 20);
+
+  // repeated runs reuse pool threads (give finished threads time to go idle)
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  size_t pool_size = rvs::ThreadPool::Get()->size();
+  for (int rep = 0; rep < 3; rep++) {
+    for (auto& w : workers) {
+      w.start();
+    }
+    for (auto& w : workers) {
+      w.join();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_EQ(rvs::ThreadPool::Get()->size(), pool_size);
+}
+
+TEST(ThreadPoolTest, short_tasks_beside_blocking) {
+  // start from an empty pool so no idle thread is left from other tests
+  rvs::ThreadPool::Terminate();
+  rvs::ThreadPool::Get()->set_max_threads(2);
+
+  // long running workers occupy more threads than the short task limit ...
+  std::atomic<bool> release{false};
+  std::atomic<int> started{0};
+  std::vector<rvs::PooledThread> workers(4);
+  for (auto& w : workers) {
+    w.start([&release, &started]() {
+      started++;
+      while (!release)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+  }
+  while (started < 4)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  // ... and short tasks submitted by them still get threads of their own
+  rvs::TaskGroup group;
+  std::atomic<int> sum{0};
+  for (int i = 0; i < 100; i++) {
+    group.run([&sum, i]() { sum += i; }, i % 4);
+  }
+  group.wait();
+  EXPECT_EQ(sum, 99 * 100 / 2);
+
+  release = true;
+  for (auto& w : workers) {
+    w.join();
+  }
+  rvs::ThreadPool::Get()->set_max_threads(0);
+}
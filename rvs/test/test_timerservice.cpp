@@ -0,0 +1,140 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvstimerservice.h"
+#include "include/rvs_unit_testing_defs.h"
+
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+TEST(TimerServiceTest, idle) {
+  rvs::TimerService* ptimers = rvs::TimerService::Get();
+
+  // let any previously armed timer settle
+  std::this_thread::sleep_for(milliseconds(50));
+  uint64_t wakeups = ptimers->get_wakeups();
+  std::this_thread::sleep_for(milliseconds(500));
+
+  // no armed timer - no periodic wakeups
+  EXPECT_LE(ptimers->get_wakeups() - wakeups, 1u);
+}
+
+TEST(TimerServiceTest, periodic) {
+  rvs::TimerService* ptimers = rvs::TimerService::Get();
+  std::atomic<int> count{0};
+
+  uint64_t wakeups = ptimers->get_wakeups();
+  uint64_t id = ptimers->schedule(steady_clock::now() + milliseconds(100),
+                                  milliseconds(100), [&count]() { count++; });
+  std::this_thread::sleep_for(milliseconds(1050));
+  ptimers->cancel(id);
+
+  EXPECT_GE(count, 9);
+  EXPECT_LE(count, 11);
+  // one wakeup per expiration (plus schedule/cancel notifications)
+  EXPECT_LE(ptimers->get_wakeups() - wakeups, 20u);
+}
+
+TEST(TimerServiceTest, no_drift) {
+  rvs::TimerService* ptimers = rvs::TimerService::Get();
+  std::vector<steady_clock::time_point> ticks;
+  std::mutex mtx;
+
+  // the callback takes a quarter of the period: rescheduling relative to
+  // the callback (instead of the previous deadline) would drift by 5 ms per
+  // expiration, i.e. by ~250 ms over the run
+  steady_clock::time_point start = steady_clock::now();
+  uint64_t id = ptimers->schedule(start + milliseconds(20), milliseconds(20),
+                                  [&]() {
+    {
+      std::lock_guard<std::mutex> lk(mtx);
+      ticks.push_back(steady_clock::now());
+    }
+    std::this_thread::sleep_for(milliseconds(5));
+  });
+  std::this_thread::sleep_for(milliseconds(1010));
+  ptimers->cancel(id);
+
+  std::lock_guard<std::mutex> lk(mtx);
+  ASSERT_GE(ticks.size(), 40u);
+  // n-th expiration never fires before start + n * period and its lateness
+  // does not accumulate (bound generous for loaded machines)
+  for (size_t i = 0; i < ticks.size(); i++) {
+    auto late = std::chrono::duration_cast<milliseconds>(
+      ticks[i] - (start + milliseconds(20 * (i + 1)))).count();
+    EXPECT_GE(late, 0);
+    EXPECT_LT(late, 150);
+  }
+}
+
+TEST(TimerServiceTest, cancel) {
+  rvs::TimerService* ptimers = rvs::TimerService::Get();
+  std::atomic<int> count{0};
+
+  // one-shot cancelled before expiration
+  uint64_t id = ptimers->schedule(steady_clock::now() + milliseconds(50),
+                                  milliseconds(0), [&count]() { count++; });
+  ptimers->cancel(id);
+  std::this_thread::sleep_for(milliseconds(100));
+  EXPECT_EQ(count, 0);
+
+  // periodic with slow callback - nothing runs once cancel() returns
+  id = ptimers->schedule(steady_clock::now(), milliseconds(1), [&count]() {
+    count++;
+    std::this_thread::sleep_for(milliseconds(5));
+  });
+  std::this_thread::sleep_for(milliseconds(50));
+  ptimers->cancel(id);
+  int after_cancel = count;
+  std::this_thread::sleep_for(milliseconds(50));
+  EXPECT_GT(after_cancel, 0);
+  EXPECT_EQ(count, after_cancel);
+}
+
+TEST(TimerServiceTest, terminate) {
+  std::atomic<int> count{0};
+
+  rvs::TimerService::Get()->schedule(steady_clock::now() + milliseconds(10),
+                                     milliseconds(0), [&count]() { count++; });
+  std::this_thread::sleep_for(milliseconds(50));
+  rvs::TimerService::Terminate();
+  EXPECT_EQ(count, 1);
+
+  // service is re-created on demand
+  uint64_t id = rvs::TimerService::Get()->schedule(
+    steady_clock::now() + milliseconds(10), milliseconds(0),
+    [&count]() { count++; });
+  std::this_thread::sleep_for(milliseconds(50));
+  rvs::TimerService::Get()->cancel(id);
+  EXPECT_EQ(count, 2);
+}
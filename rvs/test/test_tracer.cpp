@@ -0,0 +1,145 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "include/rvstracer.h"
+#include "include/rvs_unit_testing_defs.h"
+
+// counts non-overlapping occurrences of pattern in str
+static size_t count_of(const std::string& str, const std::string& pattern) {
+  size_t n = 0;
+  for (size_t pos = str.find(pattern); pos != std::string::npos;
+       pos = str.find(pattern, pos + pattern.size())) {
+    n++;
+  }
+  return n;
+}
+
+TEST(TracerTest, disabled) {
+  rvs::tracer::enable(false);
+  rvs::tracer::clear();
+
+  {
+    RVS_TRACE_SCOPE("test", "disabled_span");
+    RVS_TRACE_COUNTER("test", "disabled_counter", 1);
+  }
+
+  EXPECT_EQ(count_of(rvs::tracer::to_json(), "disabled_"), 0u);
+}
+
+TEST(TracerTest, statement_macros) {
+  rvs::tracer::enable(false);
+  int taken = 0;
+
+  // trace points are single statements (safe in unbraced if/else)
+  for (bool cond : {true, false}) {
+    if (cond)
+      RVS_TRACE_COUNTER("test", "branch", 1);
+    else
+      taken++;
+    if (!cond)
+      RVS_TRACE_FLOW_BEGIN("test", "branch", 1);
+    else
+      taken++;
+  }
+  EXPECT_EQ(taken, 2);
+}
+
+TEST(TracerTest, events) {
+  rvs::tracer::enable(true);
+  rvs::tracer::clear();
+  rvs::tracer::set_thread_name("test \"main\"");
+
+  {
+    RVS_TRACE_SCOPE("test", "outer");
+    {
+      RVS_TRACE_SCOPE("test", "inner");
+      RVS_TRACE_COUNTER("test", "depth", 2);
+    }
+    RVS_TRACE_FLOW_BEGIN("test", "handoff", 42);
+  }
+
+  std::thread t([]() {
+    rvs::tracer::set_thread_name("test worker");
+    RVS_TRACE_SCOPE("test", rvs::tracer::intern(std::string("dyn") + "amic"));
+    RVS_TRACE_FLOW_END("test", "handoff", 42);
+  });
+  t.join();
+  rvs::tracer::enable(false);
+
+  std::string json = rvs::tracer::to_json();
+  EXPECT_EQ(json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0u);
+  EXPECT_EQ(count_of(json, "\"name\":\"outer\""), 1u);
+  EXPECT_EQ(count_of(json, "\"name\":\"inner\""), 1u);
+  EXPECT_EQ(count_of(json, "\"name\":\"dynamic\""), 1u);
+  EXPECT_EQ(count_of(json, "\"ph\":\"X\""), 3u);
+  EXPECT_EQ(count_of(json, "\"args\":{\"value\":2}"), 1u);
+  EXPECT_EQ(count_of(json, "\"ph\":\"s\""), 1u);
+  EXPECT_EQ(count_of(json, "\"ph\":\"f\""), 1u);
+  EXPECT_EQ(count_of(json, "\"id\":42"), 2u);
+  EXPECT_EQ(count_of(json, "test \\\"main\\\""), 1u);
+  EXPECT_EQ(count_of(json, "test worker"), 1u);
+
+  // interned strings are shared
+  EXPECT_EQ(rvs::tracer::intern("dynamic"), rvs::tracer::intern("dynamic"));
+}
+
+TEST(TracerTest, ring_wraparound) {
+  const size_t capacity = 16;
+
+  rvs::tracer::enable(true, capacity);
+  rvs::tracer::clear();
+
+  // new thread gets buffer of requested capacity; oldest events are dropped
+  std::thread t([]() {
+    for (int i = 0; i < 100; i++) {
+      RVS_TRACE_COUNTER("test", "ring", i);
+    }
+  });
+  t.join();
+  rvs::tracer::enable(false, rvs::tracer::DEFAULT_BUFFER_EVENTS);
+
+  std::string json = rvs::tracer::to_json();
+  EXPECT_EQ(count_of(json, "\"name\":\"ring\""), capacity);
+  EXPECT_EQ(count_of(json, "\"args\":{\"value\":83}"), 0u);
+  EXPECT_EQ(count_of(json, "\"args\":{\"value\":84}"), 1u);
+  EXPECT_EQ(count_of(json, "\"args\":{\"value\":99}"), 1u);
+}
+
+TEST(TracerTest, dump) {
+  EXPECT_NE(rvs::tracer::dump("/nonexistent_dir/trace.json"), 0);
+
+  std::string path = "/tmp/rvs_test_trace_" +
+                     std::to_string(::testing::UnitTest::GetInstance()
+                                    ->random_seed()) + ".json";
+  EXPECT_EQ(rvs::tracer::dump(path), 0);
+  std::remove(path.c_str());
+}
@@ -35,6 +35,8 @@
 #include "amd_smi/amdsmi.h"
 #include "include/gpu_util.h"
 #include "include/rsmi_util.h"
+#include "include/rvs_affinity.h"
+#include "include/rvstracer.h"
 #define __HIP_PLATFORM_HCC__
 #include "hip/hip_runtime.h"
 #include "hip/hip_runtime_api.h"
@@ -462,6 +464,120 @@ bool gpu_check_if_mcm_die (int idx) {
   return true;
 }
 
+/**
+ * @brief Get OS NUMA node local to the GPU from KFD topology
+ *
+ * Follows GPU node io_links to the first CPU node it is attached to and maps
+ * that CPU node's ordinal to the OS NUMA node (see
+ * rvs::affinity::cpu_node_to_numa_node()).
+ * @param node_id GPU KFD node id
+ * @param numa_node [out] OS NUMA node
+ * @return 0 if successful, -1 otherwise
+ **/
+int gpu_get_numa_node(uint16_t node_id, int* numa_node) {
+  ifstream f_id, f_prop;
+  char path[KFD_PATH_MAX_LENGTH];
+  std::string prop_name;
+  int num_nodes = gpu_num_subdirs(KFD_SYS_PATH_NODES, "");
+  std::vector<int> cpu_nodes;
+
+  // collect KFD CPU nodes (gpu_id is zero for CPU nodes)
+  for (int node = 0; node < num_nodes; node++) {
+    int gpu_id = -1;
+    snprintf(path, KFD_PATH_MAX_LENGTH, "%s/%d/gpu_id",
+        KFD_SYS_PATH_NODES, node);
+    f_id.open(path);
+    f_id >> gpu_id;
+    f_id.close();
+    if (gpu_id == 0)
+      cpu_nodes.push_back(node);
+  }
+
+  snprintf(path, KFD_PATH_MAX_LENGTH, "%s/%d/io_links",
+      KFD_SYS_PATH_NODES, node_id);
+  int num_links = gpu_num_subdirs(path, "");
+
+  for (int link = 0; link < num_links; link++) {
+    snprintf(path, KFD_PATH_MAX_LENGTH, "%s/%d/io_links/%d/properties",
+        KFD_SYS_PATH_NODES, node_id, link);
+    f_prop.open(path);
+
+    int node_to = -1;
+    while (f_prop >> prop_name) {
+      if (prop_name == "node_to") {
+        f_prop >> node_to;
+      } else {
+        std::string dummy;
+        f_prop >> dummy;
+      }
+    }
+    f_prop.close();
+
+    auto it = std::find(cpu_nodes.begin(), cpu_nodes.end(), node_to);
+    if (it != cpu_nodes.end()) {
+      return rvs::affinity::cpu_node_to_numa_node(it - cpu_nodes.begin(),
+                                                  numa_node);
+    }
+  }
+
+  return -1;
+}
+
+/**
+ * @brief Get last level cache size of the GPU from KFD topology
+ *
+ * Scans the node caches and returns the highest cache level present (MALL
+ * where reported, L2 otherwise) with the size of its largest instance.
+ * @param node_id GPU KFD node id
+ * @param size [out] cache size in bytes
+ * @param level [out] cache level
+ * @return 0 if successful, -1 otherwise
+ **/
+int gpu_get_llc_size(uint16_t node_id, uint64_t* size, uint32_t* level) {
+  ifstream f_prop;
+  char path[KFD_PATH_MAX_LENGTH];
+  std::string prop_name;
+  uint32_t llc_level = 0;
+  uint64_t llc_kb = 0;
+
+  snprintf(path, KFD_PATH_MAX_LENGTH, "%s/%d/caches",
+      KFD_SYS_PATH_NODES, node_id);
+  int num_caches = gpu_num_subdirs(path, "");
+
+  for (int cache = 0; cache < num_caches; cache++) {
+    snprintf(path, KFD_PATH_MAX_LENGTH, "%s/%d/caches/%d/properties",
+        KFD_SYS_PATH_NODES, node_id, cache);
+    f_prop.open(path);
+
+    uint32_t cache_level = 0;
+    uint64_t cache_kb = 0;
+    while (f_prop >> prop_name) {
+      if (prop_name == "level") {
+        f_prop >> cache_level;
+      } else if (prop_name == "size") {
+        f_prop >> cache_kb;
+      } else {
+        std::string dummy;
+        f_prop >> dummy;
+      }
+    }
+    f_prop.close();
+
+    if (cache_level > llc_level) {
+      llc_level = cache_level;
+      llc_kb = cache_kb;
+    } else if (cache_level == llc_level) {
+      llc_kb = std::max(llc_kb, cache_kb);
+    }
+  }
+
+  if (llc_kb == 0)
+    return -1;
+  *size = llc_kb * 1024;
+  *level = llc_level;
+  return 0;
+}
+
 /**
  * @brief Get GPU smi index from hip index.
  * @param hip_index GPU hip index
@@ -587,6 +703,7 @@ int gpu_hip_to_node(int hip_index, int* node) {
  * @return 0 if successful, -1 otherwise
  **/
 int rvs::gpulist::Initialize() {
+  RVS_TRACE_SCOPE("topology", "gpulist_init");
   amdsmi_init(AMDSMI_INIT_AMD_GPUS);
   gpu_get_all_location_id(&location_id);
   gpu_get_all_gpu_id(&gpu_id);
@@ -0,0 +1,381 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_affinity.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/mempolicy.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "include/gpu_util.h"
+#include "include/rvs_util.h"
+
+/**
+ * @brief Parse Linux CPU list format (e.g. "0-3,8,10-11")
+ *
+ * @param str CPU list string as found in sysfs
+ * @param pcpus [out] sorted list of logical CPU indexes
+ * @return 0 - OK, -1 on syntax error
+ *
+ * */
+int rvs::affinity::parse_cpu_list(const std::string& str,
+                                  std::vector<int>* pcpus) {
+  std::string trimmed = str;
+
+  pcpus->clear();
+  trimmed.erase(std::remove_if(trimmed.begin(), trimmed.end(),
+                [](char c) { return std::isspace(c); }), trimmed.end());
+  if (trimmed.empty())
+    return 0;
+
+  for (const auto& token : str_split(trimmed, ",")) {
+    size_t dash = token.find('-');
+    std::string first = token.substr(0, dash);
+    std::string last = dash == std::string::npos ?
+                       first : token.substr(dash + 1);
+
+    if (!is_positive_integer(first) || !is_positive_integer(last)) {
+      pcpus->clear();
+      return -1;
+    }
+
+    int lo = std::atoi(first.c_str());
+    int hi = std::atoi(last.c_str());
+    if (hi < lo) {
+      pcpus->clear();
+      return -1;
+    }
+    for (int cpu = lo; cpu <= hi; cpu++)
+      pcpus->push_back(cpu);
+  }
+
+  std::sort(pcpus->begin(), pcpus->end());
+  pcpus->erase(std::unique(pcpus->begin(), pcpus->end()), pcpus->end());
+  return 0;
+}
+
+/**
+ * @brief Format list of CPUs in compact Linux CPU list format
+ *
+ * @param cpus list of logical CPU indexes
+ * @return CPU list string (e.g. "0-3,8")
+ *
+ * */
+std::string rvs::affinity::cpu_list_to_string(const std::vector<int>& cpus) {
+  std::vector<int> sorted(cpus);
+  std::string str;
+
+  std::sort(sorted.begin(), sorted.end());
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+  for (size_t i = 0; i < sorted.size(); ) {
+    size_t j = i;
+    while (j + 1 < sorted.size() && sorted[j + 1] == sorted[j] + 1)
+      j++;
+
+    if (!str.empty())
+      str += ",";
+    str += std::to_string(sorted[i]);
+    if (j > i)
+      str += "-" + std::to_string(sorted[j]);
+    i = j + 1;
+  }
+
+  return str;
+}
+
+/**
+ * @brief Get logical CPUs local to given NUMA node
+ *
+ * @param numa_node OS NUMA node index
+ * @param pcpus [out] list of logical CPU indexes
+ * @return 0 - OK, -1 if node does not exist or cannot be parsed
+ *
+ * */
+int rvs::affinity::numa_node_cpus(uint32_t numa_node,
+                                  std::vector<int>* pcpus) {
+  std::string path = std::string(NUMA_SYS_PATH_NODES) + "/node" +
+                     std::to_string(numa_node) + "/cpulist";
+  std::ifstream f(path);
+  std::string line;
+
+  pcpus->clear();
+  if (!f.is_open())
+    return -1;
+
+  std::getline(f, line);
+  return parse_cpu_list(line, pcpus);
+}
+
+/**
+ * @brief Get number of NUMA nodes exposed by the OS
+ *
+ * @return number of NUMA nodes (at least 1)
+ *
+ * */
+int rvs::affinity::numa_node_count(void) {
+  int count = 0;
+  DIR* dir = opendir(NUMA_SYS_PATH_NODES);
+
+  if (dir == nullptr)
+    return 1;
+
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    if (strncmp(entry->d_name, "node", 4) == 0 &&
+        is_positive_integer(entry->d_name + 4))
+      count++;
+  }
+  closedir(dir);
+
+  return count > 0 ? count : 1;
+}
+
+/**
+ * @brief Get online OS NUMA nodes that have CPUs, in increasing order
+ *
+ * Memory-only and offline nodes are left out, so the list need not be
+ * contiguous. Read from "has_cpu", or from the per-node CPU lists if the
+ * kernel does not expose it.
+ *
+ * @param pnodes [out] NUMA node ids
+ * @param root NUMA sysfs directory
+ * @return 0 - OK, -1 if no node could be found
+ *
+ * */
+int rvs::affinity::cpu_numa_nodes(std::vector<int>* pnodes,
+                                  const std::string& root) {
+  std::ifstream f(root + "/has_cpu");
+  std::string line;
+
+  pnodes->clear();
+  if (f.is_open() && std::getline(f, line) &&
+      parse_cpu_list(line, pnodes) == 0 && !pnodes->empty())
+    return 0;
+
+  pnodes->clear();
+  DIR* dir = opendir(root.c_str());
+  if (dir == nullptr)
+    return -1;
+
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != nullptr) {
+    if (strncmp(entry->d_name, "node", 4) != 0 ||
+        !is_positive_integer(entry->d_name + 4))
+      continue;
+
+    std::ifstream fl(root + "/" + entry->d_name + "/cpulist");
+    std::vector<int> cpus;
+    if (fl.is_open() && std::getline(fl, line) &&
+        parse_cpu_list(line, &cpus) == 0 && !cpus.empty())
+      pnodes->push_back(std::atoi(entry->d_name + 4));
+  }
+  closedir(dir);
+
+  std::sort(pnodes->begin(), pnodes->end());
+  return pnodes->empty() ? -1 : 0;
+}
+
+/**
+ * @brief Map KFD/HSA CPU node ordinal to OS NUMA node
+ *
+ * KFD creates one CPU node per online NUMA node that has CPUs, in node id
+ * order, so the n-th CPU node is the n-th such NUMA node (not NUMA node n).
+ *
+ * @param cpu_ordinal position of the CPU node among KFD CPU nodes
+ * @param pnuma_node [out] OS NUMA node
+ * @return 0 - OK, -1 if there is no such node
+ *
+ * */
+int rvs::affinity::cpu_node_to_numa_node(uint32_t cpu_ordinal,
+                                         int* pnuma_node) {
+  std::vector<int> nodes;
+
+  if (cpu_numa_nodes(&nodes) || cpu_ordinal >= nodes.size())
+    return -1;
+
+  *pnuma_node = nodes[cpu_ordinal];
+  return 0;
+}
+
+/**
+ * @brief Get CPU affinity of the calling thread
+ *
+ * @param pcpus [out] list of logical CPU indexes
+ * @return 0 - OK, non-zero otherwise
+ *
+ * */
+int rvs::affinity::get_thread_affinity(std::vector<int>* pcpus) {
+  cpu_set_t set;
+
+  pcpus->clear();
+  CPU_ZERO(&set);
+  int sts = pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+  if (sts)
+    return sts;
+
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &set))
+      pcpus->push_back(cpu);
+  }
+  return 0;
+}
+
+/**
+ * @brief Bind the calling thread to the given CPUs
+ *
+ * @param cpus list of logical CPU indexes
+ * @return 0 - OK, non-zero otherwise
+ *
+ * */
+int rvs::affinity::set_thread_affinity(const std::vector<int>& cpus) {
+  cpu_set_t set;
+
+  if (cpus.empty())
+    return -1;
+
+  CPU_ZERO(&set);
+  for (int cpu : cpus) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE)
+      CPU_SET(cpu, &set);
+  }
+
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/**
+ * @brief Set preferred NUMA node for memory allocated by the calling thread
+ *
+ * @param numa_node OS NUMA node, -1 to restore default policy
+ * @return 0 - OK, non-zero otherwise
+ *
+ * */
+int rvs::affinity::set_thread_mem_node(int numa_node) {
+  if (numa_node < 0)
+    return syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0);
+
+  unsigned long mask[4] = {0};  // NOLINT
+  const int bits = sizeof(mask) * 8;
+  if (numa_node >= bits)
+    return -1;
+
+  mask[numa_node / (sizeof(mask[0]) * 8)] |=
+    1ul << (numa_node % (sizeof(mask[0]) * 8));
+  return syscall(SYS_set_mempolicy, MPOL_PREFERRED, mask, bits);
+}
+
+/**
+ * @brief Get CPU affinity and memory policy of the calling thread
+ *
+ * @param pplacement [out] current placement
+ * @return 0 - OK, non-zero otherwise
+ *
+ * */
+int rvs::affinity::get_thread_placement(thread_placement_t* pplacement) {
+  const size_t bits = 1024;
+  int sts = get_thread_affinity(&pplacement->cpus);
+
+  pplacement->mem_mode = MPOL_DEFAULT;
+  pplacement->mem_nodes.assign(bits / (sizeof(unsigned long) * 8), 0);  // NOLINT
+  if (syscall(SYS_get_mempolicy, &pplacement->mem_mode,
+              pplacement->mem_nodes.data(), bits, nullptr, 0)) {
+    pplacement->mem_mode = MPOL_DEFAULT;
+    return -1;
+  }
+  return sts;
+}
+
+/**
+ * @brief Restore CPU affinity and memory policy of the calling thread
+ *
+ * @param placement placement saved by get_thread_placement()
+ * @return 0 - OK, non-zero otherwise
+ *
+ * */
+int rvs::affinity::set_thread_placement(const thread_placement_t& placement) {
+  int sts = 0;
+
+  if (!placement.cpus.empty())
+    sts = set_thread_affinity(placement.cpus);
+
+  if (placement.mem_mode == MPOL_DEFAULT || placement.mem_nodes.empty()) {
+    if (syscall(SYS_set_mempolicy, MPOL_DEFAULT, nullptr, 0))
+      sts = -1;
+  } else if (syscall(SYS_set_mempolicy, placement.mem_mode,
+                     placement.mem_nodes.data(),
+                     placement.mem_nodes.size() * sizeof(unsigned long) * 8)) {  // NOLINT
+    sts = -1;
+  }
+  return sts;
+}
+
+/**
+ * @brief Build placement descriptor local to the given GPU
+ *
+ * @param node_id GPU KFD node id
+ * @param paff [out] NUMA node and its CPUs
+ * @return 0 - OK, -1 if GPU NUMA node or its CPUs cannot be determined
+ *
+ * */
+int rvs::affinity::gpu_local_affinity(uint16_t node_id,
+                                      cpu_affinity_t* paff) {
+  int numa_node;
+
+  paff->numa_node = -1;
+  paff->cpus.clear();
+
+  if (gpu_get_numa_node(node_id, &numa_node))
+    return -1;
+
+  if (numa_node_cpus(numa_node, &paff->cpus) || paff->cpus.empty())
+    return -1;
+
+  paff->numa_node = numa_node;
+  return 0;
+}
+
+/**
+ * @brief Format placement descriptor for logging
+ *
+ * @param aff placement descriptor
+ * @return string in "numa:: <node> cpus:: <list>" format
+ *
+ * */
+std::string rvs::affinity::to_string(const cpu_affinity_t& aff) {
+  return "numa:: " + (aff.numa_node < 0 ? std::string("any") :
+                      std::to_string(aff.numa_node))
+    + " cpus:: " + (aff.cpus.empty() ? std::string("any") :
+                    cpu_list_to_string(aff.cpus));
+}
@@ -0,0 +1,170 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_algo_cache.h"
+
+#include <unistd.h>
+
+#include <cctype>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#define ALGO_CACHE_HEADER "# rvs gemm algorithm cache v1"
+
+/**
+ * @brief Creates cache backed by path (the file is read on first use)
+ * @param _path cache file
+ * */
+rvs::algo_cache::algo_cache(const std::string& _path)
+  : path(_path), loaded(false) {
+}
+
+/**
+ * @brief Returns the process wide cache of a file
+ * @param path cache file
+ * @return cache instance (one per path)
+ * */
+rvs::algo_cache& rvs::algo_cache::get(const std::string& path) {
+  static std::mutex caches_mtx;
+  static std::map<std::string, std::unique_ptr<algo_cache>> caches;
+
+  std::lock_guard<std::mutex> lk(caches_mtx);
+  std::unique_ptr<algo_cache>& cache = caches[path];
+  if (!cache)
+    cache.reset(new algo_cache(path));
+  return *cache;
+}
+
+/**
+ * @brief Makes a key usable in the cache file (no white space)
+ * @param key problem description
+ * @return key with white space replaced by '_'
+ * */
+std::string rvs::algo_cache::make_key(const std::string& key) {
+  std::string k = key;
+  for (char& c : k) {
+    if (std::isspace(static_cast<unsigned char>(c)))
+      c = '_';
+  }
+  return k;
+}
+
+/**
+ * @brief Reads the cache file, entries in memory are replaced by the file
+ * @return true if the file was read or does not exist
+ * */
+bool rvs::algo_cache::load(void) {
+  std::ifstream in(path);
+  std::string line;
+
+  loaded = true;
+  if (!in.is_open())
+    return !std::filesystem::exists(path);
+
+  while (std::getline(in, line)) {
+    if (line.empty() || line[0] == '#')
+      continue;
+
+    std::istringstream ss(line);
+    std::string key;
+    entry_t e;
+    if (ss >> key >> e.index >> e.time_us)
+      entries[key] = e;
+  }
+  return true;
+}
+
+/**
+ * @brief Writes all entries to a temporary file and renames it over path
+ * @return true on success
+ * */
+bool rvs::algo_cache::save(void) {
+  std::filesystem::path p(path);
+  std::error_code ec;
+
+  if (p.has_parent_path())
+    std::filesystem::create_directories(p.parent_path(), ec);
+
+  std::string tmp = path + ".tmp." + std::to_string(getpid());
+  {
+    std::ofstream out(tmp, std::ios::trunc);
+    if (!out.is_open())
+      return false;
+
+    out << ALGO_CACHE_HEADER << "\n";
+    for (const auto& e : entries)
+      out << e.first << " " << e.second.index << " " << e.second.time_us
+          << "\n";
+    if (!out.good()) {
+      out.close();
+      std::remove(tmp.c_str());
+      return false;
+    }
+  }
+
+  if (std::rename(tmp.c_str(), path.c_str()) != 0) {
+    std::remove(tmp.c_str());
+    return false;
+  }
+  return true;
+}
+
+/**
+ * @brief Looks up the selection for a problem
+ * @param key problem key (see make_key())
+ * @param entry selection (if found)
+ * @return true if found
+ * */
+bool rvs::algo_cache::lookup(const std::string& key, entry_t* entry) {
+  std::lock_guard<std::mutex> lk(mtx);
+
+  if (!loaded)
+    load();
+
+  auto it = entries.find(key);
+  if (it == entries.end())
+    return false;
+  *entry = it->second;
+  return true;
+}
+
+/**
+ * @brief Records the selection for a problem and saves the cache file
+ *
+ * Entries added to the file by other processes since it was read are kept.
+ *
+ * @param key problem key (see make_key())
+ * @param entry selection
+ * @return true if the file was written
+ * */
+bool rvs::algo_cache::store(const std::string& key, const entry_t& entry) {
+  std::lock_guard<std::mutex> lk(mtx);
+
+  load();
+  entries[key] = entry;
+  return save();
+}
@@ -30,49 +30,31 @@
 #include <random>
 #include <thread>
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <hipblaslt/hipblaslt-ext.hpp>
+
+#include "include/gpu_util.h"
+#include "include/rvs_hostgemm.h"
+#include "include/rvs_normcheck.h"
+#include "include/rvs_mxpack.h"
+#include "include/rvstracer.h"
 
 #if(defined(RVS_ROCBLAS_VERSION_FLAT) && (RVS_ROCBLAS_VERSION_FLAT >= 3001000 && RVS_ROCBLAS_VERSION_FLAT < 5000000))
   #define RVS_ROCBLAS_HAS_F8_DATATYPES 1
 #endif
 
-/* ============================================================================================ */
-// Random number generator
-using rvsblas_rng_t = std::mt19937;
-
-// Random number generator
-rvsblas_rng_t rvsblas_seed(69069); // A fixed seed to start at
-
-// This records the main thread ID at startup
-std::thread::id rvsblas_main_thread_id = std::this_thread::get_id();
-
-// For the main thread, we use g_rocblas_seed; for other threads, we start with a different seed but
-// deterministically based on the thread id's hash function.
-inline rvsblas_rng_t get_seed()
-{
-  auto tid = std::this_thread::get_id();
-  return tid == rvsblas_main_thread_id ? rvsblas_seed
-    : rvsblas_rng_t(std::hash<std::thread::id>{}(tid));
-}
-
-// For the main thread, we use g_rvsblas_seed; for other threads, we start with a different seed but
-// deterministically based on the thread id's hash function.
-thread_local rvsblas_rng_t rvsblas_t_rng = get_seed();
-
-thread_local int rvsblas_t_rand_idx;
-
-// length to allow use as bitmask to wraparound
-#define RANDLEN 1024
-#define RANDWIN 256
-#define RANDBUF RANDLEN + RANDWIN
-static thread_local int    rvsblas_t_rand_init = 0;
-static thread_local float  rvsblas_t_rand_f_array[RANDBUF];
-static thread_local double rvsblas_t_rand_d_array[RANDBUF];
-
-/* ============================================================================================ */
-
 #define RANDOM_CT               320000
 #define RANDOM_DIV_CT           0.1234
 
+/* GEMM launches timed per hipBLASLt autotune candidate */
+#define AUTOTUNE_WARM_CALLS     2
+#define AUTOTUNE_TIMED_CALLS    10
+
+/* Alignment of each operand in the rotating set allocation */
+#define ROTATING_ALIGN          256
+
 /**
  * @brief class constructor
  * @param _gpu_device_index the gpu that will run the GEMM
@@ -87,13 +69,16 @@ static thread_local double rvsblas_t_rand_d_array[RANDBUF];
  * @param ldb leading dimension for matrix B
  * @param ldc leading dimension for matrix C
  * @param _ops_type type of BLAS operation to test with
+ * @param rotating rotating set size in MB (fixed sizing)
+ * @param _rotating_mode rotating set sizing (fixed, cold or cache resident)
  */
 rvs_blas::rvs_blas(int _gpu_device_index, int _m, int _n, int _k, std::string _matrix_init, int transA, int transB,
     float alpha , float beta, int lda, int ldb, int ldc, int ldd,
     std::string _ops_type, std::string _data_type, std::string _gemm_mode, int _batch_size,
     uint64_t _stride_a, uint64_t _stride_b, uint64_t _stride_c, uint64_t _stride_d,
     std::string _blas_source, std::string _compute_type, std::string _out_data_type,
-    std::string _scale_a, std::string _scale_b, uint32_t rotating, uint64_t _hot_calls)
+    std::string _scale_a, std::string _scale_b, uint32_t rotating, uint64_t _hot_calls,
+    rvs::rotating_mode _rotating_mode)
   : gpu_device_index(_gpu_device_index)
   , ops_type(_ops_type)
   , data_type(_data_type)
@@ -103,16 +88,37 @@ rvs_blas::rvs_blas(int _gpu_device_index, int _m, int _n, int _k, std::string _m
   , size_a(0), size_b(0), size_c(0), size_d(0)
   , da(nullptr), db(nullptr), dc(nullptr), dd(nullptr)
   , dsa(nullptr), dsb(nullptr)
+  , drotating(nullptr)
   , ha(nullptr), hb(nullptr), hc(nullptr)
   , hsa(nullptr), hsb(nullptr)
   , hpo(nullptr), hco(nullptr)
-  , hout(nullptr), hdout(nullptr)
+  , hout(nullptr)
   , hip_stream(nullptr)
   , hiprand_generator(nullptr)
   , blas_handle(nullptr)
   , is_handle_init(false)
   , is_error(false)
   , check_count(1)
+  , accu_check_count(0)
+  , matrix_seed(default_matrix_seed())
+  , matrix_generation(0)
+  , self_check_mode("norm")
+  , accu_check_mode("full")
+  , accu_confidence(0.999)
+  , accu_error_rate(0.0001)
+  , accu_checksums_valid(false)
+  , val_stream(nullptr)
+  , hval{}
+  , val_gemm_done{}
+  , val_copy_done{}
+  , val_busy{}
+  , val_next_slot(0)
+  , val_stop(false)
+  , batch_timing(false)
+  , batch_start{}
+  , batch_stop{}
+  , batch_first(0)
+  , batch_pending(0)
   , gemm_mode(_gemm_mode)
   , batch_size(_batch_size)
   , stride_a(_stride_a), stride_b(_stride_b), stride_c(_stride_c), stride_d(_stride_d)
@@ -125,10 +131,20 @@ rvs_blas::rvs_blas(int _gpu_device_index, int _m, int _n, int _k, std::string _m
   , hbl_scale_b(_scale_b)
   , hbl_scale_a_size(0)
   , hbl_scale_b_size(0)
+  , hbl_workspace_size(0)
+  , algo_source("heuristic")
+  , algo_index(-1)
+  , algo_time_us(0)
   , hot_calls(_hot_calls)
   , block_count(1)
+  , rotating_set{1, 0, 0, false, false, false}
+  , gemm_launch(launch_none)
+  , hbl_alpha_p(nullptr), hbl_beta_p(nullptr)
 {
 
+  /* Resolve configuration once - launch and init paths use the plan */
+  plan = rvs::blas_plan::resolve(blas_source, ops_type, data_type, gemm_mode, matrix_init);
+
   if (blas_source == "rocblas") {
 
     // Matrix a & b transpose
@@ -258,8 +274,14 @@ rvs_blas::rvs_blas(int _gpu_device_index, int _m, int _n, int _k, std::string _m
         + hbl_scale_a_size * get_hipdatatype_size(HIP_R_8U)
         + hbl_scale_b_size * get_hipdatatype_size(HIP_R_8U);
 
-      block_count = std::max((uint64_t)1,
-          std::min(hot_calls, (uint64_t)std::ceil((float)(rotating * 1024 * 1024) / total_rotating_size)));
+      // calls of a batch cycle through the blocks
+      rotating_cfg.mode = _rotating_mode;
+      rotating_cfg.fixed_bytes = (uint64_t)rotating * 1024 * 1024;
+      rotating_cfg.max_blocks = hot_calls;
+      get_rotating_limits();
+
+      rotating_set = rvs::rotating_plan(rotating_cfg, total_rotating_size);
+      block_count = rotating_set.blocks;
 
   }
   else {
@@ -278,12 +300,17 @@ rvs_blas::rvs_blas(int _gpu_device_index, int _m, int _n, int _k, std::string _m
   } else {
     is_error = true;
   }
+
+  if (!is_error)
+    bind_gemm_launch();
 }
 
 /**
  * @brief class destructor
  */
 rvs_blas::~rvs_blas() {
+    release_async_validation();
+    release_batch_timing();
     release_host_matrix_mem();
     release_gpu_matrix_mem();
 }
@@ -294,6 +321,7 @@ rvs_blas::~rvs_blas() {
  * @return true if everything went fine, otherwise false
  */
 bool rvs_blas::init_gpu_device(void) {
+  RVS_TRACE_SCOPE("blas", "setup_device");
 
   // select GPU device & allocate memory
   if (hipSetDevice(gpu_device_index) != hipSuccess) {
@@ -402,53 +430,11 @@ bool rvs_blas::init_gpu_device(void) {
       }
     }
 
-    // Request only 1 algorithm
-    constexpr int request_algo_count = 1;
-    int returned_algo_count = 0;
+    // Use the first heuristic algorithm (see select_matmul_algo())
+    std::vector<hipblasLtMatmulHeuristicResult_t> heuristic;
 
-    // Set max. workspace size to 32MB
-    constexpr size_t max_workspace_size = 32 * 1024 * 1024;
-
-    hipblasLtMatmulPreference_t pref;
-
-    if(hipblasLtMatmulPreferenceCreate(&pref) != HIPBLAS_STATUS_SUCCESS) {
-      std::cout << "\nhipblasLtMatmulPreferenceCreate() failed !!!" << "\n";
-      return false;
-    }
-
-    if(hipblasLtMatmulPreferenceSetAttribute(pref, HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
-          &max_workspace_size, sizeof(max_workspace_size)) != HIPBLAS_STATUS_SUCCESS) {
-      std::cout << "\nhipblasLtMatmulPreferenceSetAttribute() failed !!!" << "\n";
-      return false;
-    }
-
-    if(hipblasLtMatmulAlgoGetHeuristic(hbl_handle,
-          hbl_matmul[0],
-          hbl_layout_a,
-          hbl_layout_b,
-          hbl_layout_c,
-          hbl_layout_d,
-          pref,
-          request_algo_count,
-          &hbl_heuristic_result,
-          &returned_algo_count) != HIPBLAS_STATUS_SUCCESS) {
-
-      std::cout << "\nError in hipblasLtMatmulAlgoGetHeuristic() !!!" << "\n";
-      hipblasLtMatmulPreferenceDestroy(pref);
-      return false;
-    }
-
-    hipblasLtMatmulPreferenceDestroy(pref);
-
-    if(returned_algo_count != request_algo_count) {
-      std::cout << "\nIncorrect Heuristic algo. count !!!" << "\n";
+    if(!get_matmul_heuristics(1, &heuristic) || !set_matmul_algo(heuristic[0]))
       return false;
-    }
-
-    if(hbl_heuristic_result.workspaceSize) {
-      // Allocate workspace for matrix multiplication
-      hipMalloc(&hbl_workspace, hbl_heuristic_result.workspaceSize);
-    }
   }
   else {
     std::cout << "\n Invalid blas source type !!!" << "\n";
@@ -475,6 +461,7 @@ bool rvs_blas::init_gpu_device(void) {
 
 template <typename Ti, typename To>
 bool rvs_blas::copy_data_to_gpu(void) {
+  RVS_TRACE_SCOPE("blas", "copy_to_gpu");
 
   for(int i = 0; i < block_count; i++) {
 
@@ -533,6 +520,7 @@ bool rvs_blas::copy_data_to_gpu(void) {
  * @return true if everything went fine, otherwise false
  */
 bool rvs_blas::copy_data_to_gpu(void) {
+  RVS_TRACE_SCOPE("blas", "copy_to_gpu");
 
   if("hiprand" == matrix_init) {
 
@@ -617,25 +605,34 @@ bool rvs_blas::copy_data_to_gpu(void) {
 
 template <typename Ti, typename To>
 bool rvs_blas::allocate_gpu_matrix_mem(void) {
-
-  if (hipMalloc(&da, size_a * sizeof(Ti) * block_count) != hipSuccess)
-    return false;
-  if (hipMalloc(&db, size_b * sizeof(Ti) * block_count) != hipSuccess)
-    return false;
-  if (hipMalloc(&dc, size_c * sizeof(To) * block_count) != hipSuccess)
+  RVS_TRACE_SCOPE("blas", "setup_alloc_gpu");
+
+  // one allocation holds the whole rotating set: all A blocks, then all B,
+  // C, D and scale blocks, each operand aligned
+  uint64_t off_b = rvs::rotating_align(size_a * sizeof(Ti) * block_count, ROTATING_ALIGN);
+  uint64_t off_c = off_b + rvs::rotating_align(size_b * sizeof(Ti) * block_count, ROTATING_ALIGN);
+  uint64_t off_d = off_c + rvs::rotating_align(size_c * sizeof(To) * block_count, ROTATING_ALIGN);
+  uint64_t off_sa = off_d + rvs::rotating_align(size_d * sizeof(To) * block_count, ROTATING_ALIGN);
+  uint64_t off_sb = off_sa + rvs::rotating_align(hbl_scale_a_size * sizeof(uint8_t) * block_count, ROTATING_ALIGN);
+  uint64_t total = off_sb + rvs::rotating_align(hbl_scale_b_size * sizeof(uint8_t) * block_count, ROTATING_ALIGN);
+
+  if (hipMalloc(&drotating, total) != hipSuccess) {
+    drotating = nullptr;
     return false;
+  }
+
+  da = drotating;
+  db = (uint8_t *)drotating + off_b;
+  dc = (uint8_t *)drotating + off_c;
 
   if(size_d)
-    if (hipMalloc(&dd, size_d * sizeof(To) * block_count) != hipSuccess)
-      return false;
+    dd = (uint8_t *)drotating + off_d;
 
   if(hbl_scale_a_size != 0)
-    if (hipMalloc(&dsa, hbl_scale_a_size * sizeof(uint8_t) * block_count) != hipSuccess)
-      return false;
+    dsa = (uint8_t *)drotating + off_sa;
 
   if(hbl_scale_b_size != 0)
-    if (hipMalloc(&dsb, hbl_scale_b_size * sizeof(uint8_t) * block_count) != hipSuccess)
-      return false;
+    dsb = (uint8_t *)drotating + off_sb;
 
   return true;
 }
@@ -645,6 +642,7 @@ bool rvs_blas::allocate_gpu_matrix_mem(void) {
  * @return true if everything went fine, otherwise false
  */
 bool rvs_blas::allocate_gpu_matrix_mem(void) {
+  RVS_TRACE_SCOPE("blas", "setup_alloc_gpu");
 
   if(ops_type == "sgemm") {
     return allocate_gpu_matrix_mem<float, float>();
@@ -740,19 +738,11 @@ double rvs_blas::get_time_us(void) {
  */
 void rvs_blas::release_gpu_matrix_mem(void) {
 
-  if (da)
-    hipFree(da);
-  if (db)
-    hipFree(db);
-  if (dc)
-    hipFree(dc);
-  if (dd)
-    hipFree(dd);
-
-  if (dsa)
-    hipFree(dsa);
-  if (dsb)
-    hipFree(dsb);
+  // device matrices are views into the rotating set allocation
+  if (drotating)
+    hipFree(drotating);
+  drotating = nullptr;
+  da = db = dc = dd = dsa = dsb = nullptr;
 
   if (is_handle_init) {
 
@@ -787,11 +777,38 @@ void rvs_blas::release_gpu_matrix_mem(void) {
   }
 }
 
+/**
+ * @brief gets the cache size and device memory budget the rotating set is
+ * sized against: last level cache (MALL or L2) from KFD topology, HIP L2
+ * size if topology has none, and half of the free device memory
+ */
+void rvs_blas::get_rotating_limits(void) {
+  int node = 0;
+  uint32_t level = 0;
+  uint64_t llc = 0;
+
+  if (gpu_hip_to_node(gpu_device_index, &node) == 0 &&
+      gpu_get_llc_size(static_cast<uint16_t>(node), &llc, &level) == 0) {
+    rotating_cfg.cache_bytes = llc;
+  } else {
+    int l2 = 0;
+    if (hipDeviceGetAttribute(&l2, hipDeviceAttributeL2CacheSize,
+          gpu_device_index) == hipSuccess && l2 > 0)
+      rotating_cfg.cache_bytes = static_cast<uint64_t>(l2);
+  }
+
+  size_t free_mem = 0, total_mem = 0;
+  if (hipSetDevice(gpu_device_index) == hipSuccess &&
+      hipMemGetInfo(&free_mem, &total_mem) == hipSuccess)
+    rotating_cfg.max_bytes = free_mem / 2;
+}
+
 /**
  * @brief allocate host matrix memory
  * @return true if everything went fine, otherwise false
  */
 bool rvs_blas::allocate_host_matrix_mem(void) {
+  RVS_TRACE_SCOPE("blas", "setup_alloc_host");
 
   if("hiprand" == matrix_init) {
 
@@ -799,6 +816,10 @@ bool rvs_blas::allocate_host_matrix_mem(void) {
     return true;
   }
 
+  // A, B and C are acquired from rvs::matrix_stage when initialized
+  if(host_matrices_staged())
+    return true;
+
   try {
 
     if(ops_type == "sgemm") {
@@ -932,6 +953,12 @@ bool rvs_blas::allocate_host_matrix_mem(void) {
  */
 void rvs_blas::release_host_matrix_mem(void) {
 
+  if (staged) {
+    // freed with the last worker reference
+    staged.reset();
+    ha = hb = hc = nullptr;
+  }
+
   if (ha)
     delete []ha;
   if (hb)
@@ -950,8 +977,6 @@ void rvs_blas::release_host_matrix_mem(void) {
     hipHostFree(hco);
   if(hout)
     hipHostFree(hout);
-  if(hdout)
-    hipHostFree(hdout);
 }
 
 /**
@@ -959,6 +984,7 @@ void rvs_blas::release_host_matrix_mem(void) {
  * @return true if GPU finished with matrix multiplication, otherwise false
  */
 bool rvs_blas::is_gemm_op_complete(void) {
+  RVS_TRACE_SCOPE("blas", "gemm_wait");
 
   if (is_error)
     return false;
@@ -972,443 +998,743 @@ bool rvs_blas::is_gemm_op_complete(void) {
 }
 
 /**
- * @brief performs the GEMM matrix multiplication operations
- * @return true if GPU was able to enqueue the GEMM operation, otherwise false
+ * @brief Binds GEMM launch function (and its pre-computed arguments) to plan
  */
-bool rvs_blas::run_blas_gemm(uint64_t num_calls) {
+void rvs_blas::bind_gemm_launch(void) {
 
-  if (is_error)
-    return false;
-
-  /* GEMM call iterations loop */
-  for(uint64_t i = 0; i < num_calls; i++) {
-
-    if(blas_source == "rocblas") {
+  launch_alpha = launch_scalar_t{blas_alpha_val, blas_alpha_val,
+    (_Float16)blas_alpha_val, (int32_t)blas_alpha_val};
+  launch_beta = launch_scalar_t{blas_beta_val, blas_beta_val,
+    (_Float16)blas_beta_val, (int32_t)blas_beta_val};
 
-      if(ops_type == "sgemm") {
+  switch(plan.op) {
 
-        float alpha = blas_alpha_val, beta = blas_beta_val;
+    case rvs::blas_plan::op_sgemm:
+      gemm_launch = plan.strided ? launch_sgemm<true> : launch_sgemm<false>;
+      break;
 
-        if(gemm_mode == "strided_batched") {
+    case rvs::blas_plan::op_dgemm:
+      gemm_launch = plan.strided ? launch_dgemm<true> : launch_dgemm<false>;
+      break;
 
-          if (rocblas_sgemm_strided_batched(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k,
-                &alpha, (float *)da, blas_lda_offset, stride_a,
-                (float *)db, blas_ldb_offset, stride_b, &beta,
-                (float *)dc, blas_ldc_offset, stride_c, batch_size) != rocblas_status_success) {
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_sgemm_strided_batched() !!!" << "\n";
-            return false;
-          }
-        }
-        else {
-
-          if (rocblas_sgemm(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k,
-                &alpha, (float *)da, blas_lda_offset,
-                (float *)db, blas_ldb_offset, &beta,
-                (float *)dc, blas_ldc_offset) != rocblas_status_success) {
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_sgemm() !!!" << "\n";
-            return false;
-          }
-        }
-      }
+    case rvs::blas_plan::op_hgemm:
+      gemm_launch = plan.strided ? launch_hgemm<true> : launch_hgemm<false>;
+      break;
 
-      if(ops_type == "dgemm") {
+    case rvs::blas_plan::op_fp8:
+#if RVS_ROCBLAS_HAS_F8_DATATYPES
+      gemm_launch = plan.strided ? launch_gemm_ex3<true> : launch_gemm_ex3<false>;
+#else
+      gemm_launch = launch_none;
+#endif
+      break;
 
-        double alpha = blas_alpha_val, beta = blas_beta_val;
+    case rvs::blas_plan::op_fp16:
+    case rvs::blas_plan::op_bf16:
+      ex_datatype = (plan.op == rvs::blas_plan::op_fp16) ?
+        rocblas_datatype_f16_r : rocblas_datatype_bf16_r;
+      gemm_launch = plan.strided ? launch_gemm_ex<true> : launch_gemm_ex<false>;
+      break;
 
-        if(gemm_mode == "strided_batched") {
+    case rvs::blas_plan::op_matmul:
 
-          if (rocblas_dgemm_strided_batched(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k,
-                &alpha, (double *)da, blas_lda_offset, stride_a,
-                (double *)db, blas_ldb_offset, stride_b, &beta,
-                (double *)dc, blas_ldc_offset, stride_c, batch_size) != rocblas_status_success) {
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_dgemm_strided_batched() !!!" << "\n";
-            return false;
-          }
-        }
-        else {
-          if (rocblas_dgemm(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k,
-                &alpha, (double *)da, blas_lda_offset,
-                (double *)db, blas_ldb_offset, &beta,
-                (double *)dc, blas_ldc_offset) != rocblas_status_success) {
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_dgemm() !!!" << "\n";
-            return false;
-          }
-        }
+      if (hbl_computetype == HIPBLAS_COMPUTE_64F) {
+        hbl_alpha_p = &launch_alpha.d;
+        hbl_beta_p = &launch_beta.d;
+      } else if (hbl_computetype == HIPBLAS_COMPUTE_32I) {
+        hbl_alpha_p = &launch_alpha.i;
+        hbl_beta_p = &launch_beta.i;
+      } else {
+        hbl_alpha_p = &launch_alpha.f;
+        hbl_beta_p = &launch_beta.f;
       }
 
-      if(ops_type == "hgemm") {
+      /* Rotating buffer blocks */
+      hbl_block_a.resize(block_count);
+      hbl_block_b.resize(block_count);
+      hbl_block_c.resize(block_count);
+      hbl_block_d.resize(block_count);
+
+      for(uint64_t i = 0; i < block_count; i++) {
+        hbl_block_a[i] = (uint8_t *)da + i * size_a * get_hipdatatype_size(hbl_datatype);
+        hbl_block_b[i] = (uint8_t *)db + i * size_b * get_hipdatatype_size(hbl_datatype);
+        hbl_block_c[i] = (uint8_t *)dc + i * size_c * get_hipdatatype_size(hbl_out_datatype);
+        hbl_block_d[i] = (uint8_t *)dd + i * size_d * get_hipdatatype_size(hbl_out_datatype);
+      }
 
-        _Float16 alpha = (float)blas_alpha_val;
-        _Float16 beta = (float)blas_beta_val;
+      gemm_launch = launch_matmul;
+      break;
 
-        if(gemm_mode == "strided_batched") {
+    default:
+      /* Nothing to run for this configuration */
+      gemm_launch = launch_none;
+      break;
+  }
+}
 
-          if (rocblas_hgemm_strided_batched(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k,
-                &alpha, (rocblas_half *)da, blas_lda_offset, stride_a,
-                (rocblas_half *)db, blas_ldb_offset, stride_b, &beta,
-                (rocblas_half *)dc, blas_ldc_offset, stride_c, batch_size) != rocblas_status_success) {
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_hgemm_strided_batched() !!!" << "\n";
-            return false;
-          }
-        }
-        else {
-
-          if (rocblas_hgemm(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k,
-                &alpha, (rocblas_half *)da, blas_lda_offset,
-                (rocblas_half *)db, blas_ldb_offset, &beta,
-                (rocblas_half *)dc, blas_ldc_offset) != rocblas_status_success) {
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_hgemm() !!!" << "\n";
-            return false;
-          }
-        }
-      }
+/**
+ * @brief Launch for configurations without GEMM operation
+ */
+bool rvs_blas::launch_none(rvs_blas* blas, uint64_t call) {
+  return true;
+}
 
-      if(data_type == "fp8_r") {
-#if RVS_ROCBLAS_HAS_F8_DATATYPES
-        rocblas_datatype a_type = rocblas_datatype_f8_r;
-        rocblas_datatype b_type = rocblas_datatype_f8_r;
-        rocblas_datatype c_type = rocblas_datatype_f8_r;
-        rocblas_datatype d_type = rocblas_datatype_f8_r;
-
-        rocblas_computetype compute_type = rocblas_compute_type_f32;
-        rocblas_gemm_algo algo = rocblas_gemm_algo_standard;
-        int32_t sol_index = 0;
-        uint32_t flags = 0;
-
-        rocblas_float alpha = (rocblas_float) blas_alpha_val;
-        rocblas_float beta = (rocblas_float) blas_beta_val;
-
-        if(gemm_mode == "strided_batched") {
-
-          if (rocblas_gemm_strided_batched_ex3(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k, &alpha,
-                da, a_type, blas_lda_offset, stride_a,
-                db, b_type, blas_ldb_offset, stride_b, &beta,
-                dc, c_type, blas_ldc_offset, stride_c,
-                dd, d_type, blas_ldd_offset, stride_d, batch_size,
-                compute_type, algo, sol_index, flags) != rocblas_status_success) {
-
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_gemm_strided_batched_ex3() !!! " << "\n";
-            return false;
-          }
-        }
-        else {
-
-          if (rocblas_gemm_ex3(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k, &alpha,
-                da, a_type, blas_lda_offset,
-                db, b_type, blas_ldb_offset, &beta,
-                dc, c_type, blas_ldc_offset,
-                dd, d_type, blas_ldd_offset,
-                compute_type, algo, sol_index, flags) != rocblas_status_success) {
-
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_gemm_ex3() !!! " << "\n";
-            return false;
-          }
-        }
-#else
-        return true;
-#endif
-      }
+/**
+ * @brief Launch rocBLAS sgemm
+ * @param blas rvs_blas instance
+ * @param call index of launch in batch
+ */
+template <bool strided>
+bool rvs_blas::launch_sgemm(rvs_blas* blas, uint64_t call) {
 
-      if(data_type == "fp16_r") {
+  rocblas_status status;
 
-        rocblas_datatype a_type = rocblas_datatype_f16_r;
-        rocblas_datatype b_type = rocblas_datatype_f16_r;
-        rocblas_datatype c_type = rocblas_datatype_f16_r;
-        rocblas_datatype d_type = rocblas_datatype_f16_r;
-
-        rocblas_datatype compute_type = rocblas_datatype_f32_r;
-        rocblas_gemm_algo algo = rocblas_gemm_algo_standard;
-        int32_t sol_index = 0;
-        uint32_t flags = 0;
-
-        rocblas_float alpha = (rocblas_float) blas_alpha_val;
-        rocblas_float beta = (rocblas_float) blas_beta_val;
-
-        if(gemm_mode == "strided_batched") {
-
-          if (rocblas_gemm_strided_batched_ex(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k, &alpha,
-                da, a_type, blas_lda_offset, stride_a,
-                db, b_type, blas_ldb_offset, stride_b, &beta,
-                dc, c_type, blas_ldc_offset, stride_c,
-                dd, d_type, blas_ldd_offset, stride_d, batch_size,
-                compute_type, algo, sol_index, flags) != rocblas_status_success) {
-
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_gemm_strided_batched_ex() !!!" << "\n";
-            return false;
-          }
-        }
-        else {
-
-          if (rocblas_gemm_ex(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k, &alpha,
-                da, a_type, blas_lda_offset,
-                db, b_type, blas_ldb_offset, &beta,
-                dc, c_type, blas_ldc_offset,
-                dd, d_type, blas_ldd_offset,
-                compute_type, algo, sol_index, flags) != rocblas_status_success) {
-
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_gemm_ex() !!!" << "\n";
-            return false;
-          }
-        }
-      }
+  if (strided) {
+    status = rocblas_sgemm_strided_batched(blas->blas_handle, blas->transa, blas->transb,
+        blas->m, blas->n, blas->k,
+        &blas->launch_alpha.f, (float *)blas->da, blas->blas_lda_offset, blas->stride_a,
+        (float *)blas->db, blas->blas_ldb_offset, blas->stride_b, &blas->launch_beta.f,
+        (float *)blas->dc, blas->blas_ldc_offset, blas->stride_c, blas->batch_size);
+  }
+  else {
+    status = rocblas_sgemm(blas->blas_handle, blas->transa, blas->transb,
+        blas->m, blas->n, blas->k,
+        &blas->launch_alpha.f, (float *)blas->da, blas->blas_lda_offset,
+        (float *)blas->db, blas->blas_ldb_offset, &blas->launch_beta.f,
+        (float *)blas->dc, blas->blas_ldc_offset);
+  }
 
-      if(data_type == "bf16_r") {
+  if (status != rocblas_status_success) {
+    blas->is_error = true;  // GPU cannot enqueue the gemm
+    std::cout << "\nError in " << (strided ? "rocblas_sgemm_strided_batched()" : "rocblas_sgemm()")
+      << " !!!" << "\n";
+    return false;
+  }
+  return true;
+}
 
-        rocblas_datatype a_type = rocblas_datatype_bf16_r;
-        rocblas_datatype b_type = rocblas_datatype_bf16_r;
-        rocblas_datatype c_type = rocblas_datatype_bf16_r;
-        rocblas_datatype d_type = rocblas_datatype_bf16_r;
-
-        rocblas_datatype compute_type = rocblas_datatype_f32_r;
-        rocblas_gemm_algo algo = rocblas_gemm_algo_standard;
-        int32_t sol_index = 0;
-        uint32_t flags = 0;
-
-        rocblas_float alpha = (rocblas_float) blas_alpha_val;
-        rocblas_float beta = (rocblas_float) blas_beta_val;
-
-        if(gemm_mode == "strided_batched") {
-
-          if (rocblas_gemm_strided_batched_ex(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k, &alpha,
-                da, a_type, blas_lda_offset, stride_a,
-                db, b_type, blas_ldb_offset, stride_b, &beta,
-                dc, c_type, blas_ldc_offset, stride_c,
-                dd, d_type, blas_ldd_offset, stride_d, batch_size,
-                compute_type, algo, sol_index, flags) != rocblas_status_success) {
-
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_gemm_strided_batched_ex() !!!" << "\n";
-            return false;
-          }
-        }
-        else {
-
-          if (rocblas_gemm_ex(blas_handle, transa, transb,
-                rvs_blas::m, rvs_blas::n, rvs_blas::k, &alpha,
-                da, a_type, blas_lda_offset,
-                db, b_type, blas_ldb_offset, &beta,
-                dc, c_type, blas_ldc_offset,
-                dd, d_type, blas_ldd_offset,
-                compute_type, algo, sol_index, flags) != rocblas_status_success) {
-
-            is_error = true;  // GPU cannot enqueue the gemm
-            std::cout << "\nError in rocblas_gemm_ex() !!!" << "\n";
-            return false;
-          }
-        }
-      }
-    }
-    else if(blas_source == "hipblaslt") {
+/**
+ * @brief Launch rocBLAS dgemm
+ * @param blas rvs_blas instance
+ * @param call index of launch in batch
+ */
+template <bool strided>
+bool rvs_blas::launch_dgemm(rvs_blas* blas, uint64_t call) {
 
+  rocblas_status status;
 
-      void * da_p = (uint8_t *)da + (i % block_count) * size_a * get_hipdatatype_size(hbl_datatype);
-      void * db_p = (uint8_t *)db + (i % block_count) * size_b * get_hipdatatype_size(hbl_datatype);
-      void * dc_p = (uint8_t *)dc + (i % block_count) * size_c * get_hipdatatype_size(hbl_out_datatype);
-      void * dd_p = (uint8_t *)dd + (i % block_count) * size_d * get_hipdatatype_size(hbl_out_datatype);
+  if (strided) {
+    status = rocblas_dgemm_strided_batched(blas->blas_handle, blas->transa, blas->transb,
+        blas->m, blas->n, blas->k,
+        &blas->launch_alpha.d, (double *)blas->da, blas->blas_lda_offset, blas->stride_a,
+        (double *)blas->db, blas->blas_ldb_offset, blas->stride_b, &blas->launch_beta.d,
+        (double *)blas->dc, blas->blas_ldc_offset, blas->stride_c, blas->batch_size);
+  }
+  else {
+    status = rocblas_dgemm(blas->blas_handle, blas->transa, blas->transb,
+        blas->m, blas->n, blas->k,
+        &blas->launch_alpha.d, (double *)blas->da, blas->blas_lda_offset,
+        (double *)blas->db, blas->blas_ldb_offset, &blas->launch_beta.d,
+        (double *)blas->dc, blas->blas_ldc_offset);
+  }
 
-      double alpha_d, beta_d;
-      int32_t alpha_i, beta_i;
-      float alpha_f, beta_f;
-      const void *alpha_p, *beta_p;
+  if (status != rocblas_status_success) {
+    blas->is_error = true;  // GPU cannot enqueue the gemm
+    std::cout << "\nError in " << (strided ? "rocblas_dgemm_strided_batched()" : "rocblas_dgemm()")
+      << " !!!" << "\n";
+    return false;
+  }
+  return true;
+}
 
-      if (hbl_computetype == HIPBLAS_COMPUTE_64F) {
-        alpha_d = blas_alpha_val;
-        beta_d = blas_beta_val;
-        alpha_p = &alpha_d;
-        beta_p = &beta_d;
-      } else if (hbl_computetype == HIPBLAS_COMPUTE_32I) {
-        alpha_i = (int32_t)blas_alpha_val;
-        beta_i = (int32_t)blas_beta_val;
-        alpha_p = &alpha_i;
-        beta_p = &beta_i;
-      } else {
-        alpha_f = blas_alpha_val;
-        beta_f = blas_beta_val;
-        alpha_p = &alpha_f;
-        beta_p = &beta_f;
-      }
+/**
+ * @brief Launch rocBLAS hgemm
+ * @param blas rvs_blas instance
+ * @param call index of launch in batch
+ */
+template <bool strided>
+bool rvs_blas::launch_hgemm(rvs_blas* blas, uint64_t call) {
 
-      if (hipblasLtMatmul(hbl_handle, hbl_matmul[i % block_count],
-            alpha_p, da_p, hbl_layout_a,
-            db_p, hbl_layout_b, beta_p,
-            dc_p, hbl_layout_c,
-            dd_p, hbl_layout_d,
-            &hbl_heuristic_result.algo, hbl_workspace, hbl_heuristic_result.workspaceSize,
-            hip_stream) != HIPBLAS_STATUS_SUCCESS) {
+  rocblas_status status;
+  const rocblas_half* alpha = (const rocblas_half *)&blas->launch_alpha.h;
+  const rocblas_half* beta = (const rocblas_half *)&blas->launch_beta.h;
 
-        is_error = true;  // GPU cannot enqueue the gemm
-        std::cout << "\nError in hipblasLtMatmul() !!!" << "\n";
-        return false;
-      }
-    }
-    else {
-      return false;
-    }
+  if (strided) {
+    status = rocblas_hgemm_strided_batched(blas->blas_handle, blas->transa, blas->transb,
+        blas->m, blas->n, blas->k,
+        alpha, (rocblas_half *)blas->da, blas->blas_lda_offset, blas->stride_a,
+        (rocblas_half *)blas->db, blas->blas_ldb_offset, blas->stride_b, beta,
+        (rocblas_half *)blas->dc, blas->blas_ldc_offset, blas->stride_c, blas->batch_size);
+  }
+  else {
+    status = rocblas_hgemm(blas->blas_handle, blas->transa, blas->transb,
+        blas->m, blas->n, blas->k,
+        alpha, (rocblas_half *)blas->da, blas->blas_lda_offset,
+        (rocblas_half *)blas->db, blas->blas_ldb_offset, beta,
+        (rocblas_half *)blas->dc, blas->blas_ldc_offset);
   }
 
+  if (status != rocblas_status_success) {
+    blas->is_error = true;  // GPU cannot enqueue the gemm
+    std::cout << "\nError in " << (strided ? "rocblas_hgemm_strided_batched()" : "rocblas_hgemm()")
+      << " !!!" << "\n";
+    return false;
+  }
   return true;
 }
 
 /**
- * @brief generate matrix random data
- * it should be called before rocBlas GEMM
+ * @brief Launch rocBLAS gemm_ex (fp16, bf16 with fp32 compute)
+ * @param blas rvs_blas instance
+ * @param call index of launch in batch
  */
-void rvs_blas::generate_random_matrix_data(void) {
+template <bool strided>
+bool rvs_blas::launch_gemm_ex(rvs_blas* blas, uint64_t call) {
 
-  if (!is_error) {
+  rocblas_status status;
+  rocblas_datatype type = blas->ex_datatype;
 
-    if("hiprand" == matrix_init) {
+  if (strided) {
+    status = rocblas_gemm_strided_batched_ex(blas->blas_handle, blas->transa, blas->transb,
+        blas->m, blas->n, blas->k, &blas->launch_alpha.f,
+        blas->da, type, blas->blas_lda_offset, blas->stride_a,
+        blas->db, type, blas->blas_ldb_offset, blas->stride_b, &blas->launch_beta.f,
+        blas->dc, type, blas->blas_ldc_offset, blas->stride_c,
+        blas->dd, type, blas->blas_ldd_offset, blas->stride_d, blas->batch_size,
+        rocblas_datatype_f32_r, rocblas_gemm_algo_standard, 0, 0);
+  }
+  else {
+    status = rocblas_gemm_ex(blas->blas_handle, blas->transa, blas->transb,
+        blas->m, blas->n, blas->k, &blas->launch_alpha.f,
+        blas->da, type, blas->blas_lda_offset,
+        blas->db, type, blas->blas_ldb_offset, &blas->launch_beta.f,
+        blas->dc, type, blas->blas_ldc_offset,
+        blas->dd, type, blas->blas_ldd_offset,
+        rocblas_datatype_f32_r, rocblas_gemm_algo_standard, 0, 0);
+  }
+
+  if (status != rocblas_status_success) {
+    blas->is_error = true;  // GPU cannot enqueue the gemm
+    std::cout << "\nError in " << (strided ? "rocblas_gemm_strided_batched_ex()" : "rocblas_gemm_ex()")
+      << " !!!" << "\n";
+    return false;
+  }
+  return true;
+}
 
-      if((ops_type == "dgemm") || (data_type == "fp64_r")) {
+#if RVS_ROCBLAS_HAS_F8_DATATYPES
+/**
+ * @brief Launch rocBLAS gemm_ex3 (fp8 with fp32 compute)
+ * @param blas rvs_blas instance
+ * @param call index of launch in batch
+ */
+template <bool strided>
+bool rvs_blas::launch_gemm_ex3(rvs_blas* blas, uint64_t call) {
 
-        if(hiprandGenerateUniformDouble(hiprand_generator, (double *)da, size_a) != HIPRAND_STATUS_SUCCESS) {
-          std::cout << "\n hiprandGenerateUniformDouble() failed for matrix a !!!" << "\n";
-          is_error = true;
-          return;
-        }
+  rocblas_status status;
+  rocblas_datatype type = rocblas_datatype_f8_r;
 
-        if(hiprandGenerateUniformDouble(hiprand_generator, (double *)db, size_b) != HIPRAND_STATUS_SUCCESS) {
-          std::cout << "\n hiprandGenerateUniformDouble() failed for matrix b !!!" << "\n";
-          is_error = true;
-          return;
-        }
+  if (strided) {
+    status = rocblas_gemm_strided_batched_ex3(blas->blas_handle, blas->transa, blas->transb,
+        blas->m, blas->n, blas->k, &blas->launch_alpha.f,
+        blas->da, type, blas->blas_lda_offset, blas->stride_a,
+        blas->db, type, blas->blas_ldb_offset, blas->stride_b, &blas->launch_beta.f,
+        blas->dc, type, blas->blas_ldc_offset, blas->stride_c,
+        blas->dd, type, blas->blas_ldd_offset, blas->stride_d, blas->batch_size,
+        rocblas_compute_type_f32, rocblas_gemm_algo_standard, 0, 0);
+  }
+  else {
+    status = rocblas_gemm_ex3(blas->blas_handle, blas->transa, blas->transb,
+        blas->m, blas->n, blas->k, &blas->launch_alpha.f,
+        blas->da, type, blas->blas_lda_offset,
+        blas->db, type, blas->blas_ldb_offset, &blas->launch_beta.f,
+        blas->dc, type, blas->blas_ldc_offset,
+        blas->dd, type, blas->blas_ldd_offset,
+        rocblas_compute_type_f32, rocblas_gemm_algo_standard, 0, 0);
+  }
+
+  if (status != rocblas_status_success) {
+    blas->is_error = true;  // GPU cannot enqueue the gemm
+    std::cout << "\nError in " << (strided ? "rocblas_gemm_strided_batched_ex3()" : "rocblas_gemm_ex3()")
+      << " !!! " << "\n";
+    return false;
+  }
+  return true;
+}
+#endif
 
-        if(hiprandGenerateUniformDouble(hiprand_generator, (double *)dc, size_c) != HIPRAND_STATUS_SUCCESS) {
-          std::cout << "\n hiprandGenerateUniformDouble() failed for matrix c !!!" << "\n";
-          is_error = true;
-          return;
-        }
+/**
+ * @brief Launch hipBLASLt matmul on rotating buffer block
+ * @param blas rvs_blas instance
+ * @param call index of launch in batch
+ */
+bool rvs_blas::launch_matmul(rvs_blas* blas, uint64_t call) {
 
-        if(hipStreamSynchronize(hip_stream) != hipSuccess) {
-          std::cout << "hipStreamSynchronize() failed !!! for stream " << hip_stream << std::endl;
-          is_error = true;
-          return;
-        }
-      }
-      else if((ops_type == "sgemm") || (data_type == "fp32_r")) {
+  uint64_t block = call % blas->block_count;
 
-        if(hiprandGenerateUniform(hiprand_generator, (float *)da, size_a) != HIPRAND_STATUS_SUCCESS) {
-          std::cout << "\n hiprandGenerateUniform() failed for matrix a !!!" << "\n";
-          is_error = true;
-          return;
-        }
+  if (hipblasLtMatmul(blas->hbl_handle, blas->hbl_matmul[block],
+        blas->hbl_alpha_p, blas->hbl_block_a[block], blas->hbl_layout_a,
+        blas->hbl_block_b[block], blas->hbl_layout_b, blas->hbl_beta_p,
+        blas->hbl_block_c[block], blas->hbl_layout_c,
+        blas->hbl_block_d[block], blas->hbl_layout_d,
+        &blas->hbl_heuristic_result.algo, blas->hbl_workspace,
+        blas->hbl_heuristic_result.workspaceSize,
+        blas->hip_stream) != HIPBLAS_STATUS_SUCCESS) {
 
-        if(hiprandGenerateUniform(hiprand_generator, (float *)db, size_b) != HIPRAND_STATUS_SUCCESS) {
-          std::cout << "\n hiprandGenerateUniform() failed for matrix b !!!" << "\n";
-          is_error = true;
-          return;
-        }
+    blas->is_error = true;  // GPU cannot enqueue the gemm
+    std::cout << "\nError in hipblasLtMatmul() !!!" << "\n";
+    return false;
+  }
+  return true;
+}
 
-        if(hiprandGenerateUniform(hiprand_generator, (float *)dc, size_c) != HIPRAND_STATUS_SUCCESS) {
-          std::cout << "\n hiprandGenerateUniform() failed for matrix c !!!" << "\n";
-          is_error = true;
-          return;
-        }
+/**
+ * @brief queries hipBLASLt heuristic algorithms for the problem
+ * @param count number of algorithms requested
+ * @param presults returned algorithms (at least one), best first
+ * @return true on success
+ */
+bool rvs_blas::get_matmul_heuristics(int count,
+    std::vector<hipblasLtMatmulHeuristicResult_t>* presults) {
 
-        if(hipStreamSynchronize(hip_stream) != hipSuccess) {
-          std::cout << "hipStreamSynchronize() failed !!! for stream " << hip_stream << std::endl;
-          is_error = true;
-          return;
-        }
-      }
-    }
-    else {
+  // Set max. workspace size to 32MB
+  constexpr size_t max_workspace_size = 32 * 1024 * 1024;
 
-      size_t i;
-      uint64_t nextr = (uint64_t) time(NULL);
+  int returned_algo_count = 0;
+  hipblasLtMatmulPreference_t pref;
 
-      //SGEMM (float fp32_r)
-      if((ops_type == "sgemm") || (data_type == "fp32_r")) {
+  presults->resize(count);
 
-        for (i = 0; i < size_a; ++i)
-         ((float *) ha)[i] = fast_pseudo_rand(&nextr, i);
+  if(hipblasLtMatmulPreferenceCreate(&pref) != HIPBLAS_STATUS_SUCCESS) {
+    std::cout << "\nhipblasLtMatmulPreferenceCreate() failed !!!" << "\n";
+    return false;
+  }
 
-        for (i = 0; i < size_b; ++i)
-          ((float *) hb)[i] = fast_pseudo_rand(&nextr, i);
+  if(hipblasLtMatmulPreferenceSetAttribute(pref, HIPBLASLT_MATMUL_PREF_MAX_WORKSPACE_BYTES,
+        &max_workspace_size, sizeof(max_workspace_size)) != HIPBLAS_STATUS_SUCCESS) {
+    std::cout << "\nhipblasLtMatmulPreferenceSetAttribute() failed !!!" << "\n";
+    hipblasLtMatmulPreferenceDestroy(pref);
+    return false;
+  }
 
-        for (int i = 0; i < size_c; ++i)
-          ((float *) hc)[i] = fast_pseudo_rand(&nextr, i);
-      }
+  if(hipblasLtMatmulAlgoGetHeuristic(hbl_handle,
+        hbl_matmul[0],
+        hbl_layout_a,
+        hbl_layout_b,
+        hbl_layout_c,
+        hbl_layout_d,
+        pref,
+        count,
+        presults->data(),
+        &returned_algo_count) != HIPBLAS_STATUS_SUCCESS) {
 
-      //DGEMM (double fp64_r)
-      if((ops_type == "dgemm") || (data_type == "fp64_r")) {
+    std::cout << "\nError in hipblasLtMatmulAlgoGetHeuristic() !!!" << "\n";
+    hipblasLtMatmulPreferenceDestroy(pref);
+    return false;
+  }
 
-        for (i = 0; i < size_a; ++i)
-          ((double *) ha)[i] = (double)fast_pseudo_rand(&nextr, i);
+  hipblasLtMatmulPreferenceDestroy(pref);
 
-        for (i = 0; i < size_b; ++i)
-          ((double *) hb)[i] = (double)fast_pseudo_rand(&nextr, i);
+  if(returned_algo_count < 1) {
+    std::cout << "\nIncorrect Heuristic algo. count !!!" << "\n";
+    return false;
+  }
 
-        for (int i = 0; i < size_c; ++i)
-          ((double *) hc)[i] = (double)fast_pseudo_rand(&nextr, i);
-      }
+  presults->resize(returned_algo_count);
+  return true;
+}
 
-      //HGEMM (half-float fp16_r)
-      if(ops_type == "hgemm") {
+/**
+ * @brief makes an algorithm the one used by GEMM launches
+ * @param result algorithm and its workspace size
+ * @return true if the workspace could be allocated
+ */
+bool rvs_blas::set_matmul_algo(const hipblasLtMatmulHeuristicResult_t& result) {
 
-        for (i = 0; i < size_a; ++i)
-          ((rocblas_half* )ha)[i] = fast_pseudo_rand(&nextr, i);
+  if(result.workspaceSize > hbl_workspace_size) {
 
-        for (i = 0; i < size_b; ++i)
-          ((rocblas_half* )hb)[i] = fast_pseudo_rand(&nextr, i);
+    // Allocate workspace for matrix multiplication
+    if(hbl_workspace)
+      hipFree(hbl_workspace);
+    hbl_workspace = nullptr;
+    hbl_workspace_size = 0;
 
-        for (int i = 0; i < size_c; ++i)
-          ((rocblas_half* )hc)[i] = fast_pseudo_rand(&nextr, i);
-      }
+    if(hipMalloc(&hbl_workspace, result.workspaceSize) != hipSuccess) {
+      std::cout << "\n hipMalloc() failed for hipblaslt workspace !!!" << "\n";
+      return false;
+    }
+    hbl_workspace_size = result.workspaceSize;
+  }
 
-      // 8-bit floating point real (fp8_r) format
-      if(data_type == "fp8_r") {
+  hbl_heuristic_result = result;
+  return true;
+}
 
-        if (blas_source == "rocblas") {
-#if RVS_ROCBLAS_HAS_F8_DATATYPES
-          for (i = 0; i < size_a; ++i)
-            ((rocblas_f8* )ha)[i] = rocblas_f8(fast_pseudo_rand(&nextr, i));
+/**
+ * @brief measures the GEMM time of an algorithm
+ * @param result algorithm to time
+ * @param ptime_us time of one GEMM in microseconds
+ * @return false if the algorithm failed to run
+ */
+bool rvs_blas::time_matmul_algo(const hipblasLtMatmulHeuristicResult_t& result,
+    double* ptime_us) {
 
-          for (i = 0; i < size_b; ++i)
-            ((rocblas_f8* )hb)[i] = rocblas_f8(fast_pseudo_rand(&nextr, i));
+  hipEvent_t start, stop;
+  float ms = 0;
+  bool ok = false;
 
-          for (i = 0; i < size_c; ++i)
-            ((rocblas_f8* )hc)[i] = rocblas_f8(fast_pseudo_rand(&nextr, i));
-#endif
-        }
-        else if (blas_source == "hipblaslt") {
+  if(!set_matmul_algo(result))
+    return false;
 
-          for (i = 0; i < size_a; ++i)
-            ((hipblaslt_f8* )ha)[i] = hipblaslt_f8(fast_pseudo_rand(&nextr, i));
+  if(hipEventCreate(&start) != hipSuccess)
+    return false;
+  if(hipEventCreate(&stop) != hipSuccess) {
+    hipEventDestroy(start);
+    return false;
+  }
 
-          for (i = 0; i < size_b; ++i)
-            ((hipblaslt_f8* )hb)[i] = hipblaslt_f8(fast_pseudo_rand(&nextr, i));
+  if(rvs::blas_plan::run(gemm_launch, this, AUTOTUNE_WARM_CALLS) &&
+      hipEventRecord(start, hip_stream) == hipSuccess &&
+      rvs::blas_plan::run(gemm_launch, this, AUTOTUNE_TIMED_CALLS) &&
+      hipEventRecord(stop, hip_stream) == hipSuccess &&
+      hipEventSynchronize(stop) == hipSuccess &&
+      hipEventElapsedTime(&ms, start, stop) == hipSuccess) {
+    *ptime_us = 1000.0 * ms / AUTOTUNE_TIMED_CALLS;
+    ok = true;
+  }
 
-          for (i = 0; i < size_c; ++i)
-            ((float* )hc)[i] = float(fast_pseudo_rand(&nextr, i));
-        }
-      }
+  hipStreamSynchronize(hip_stream);
+  hipEventDestroy(start);
+  hipEventDestroy(stop);
 
-      if(data_type == "fp4_r" || data_type == "fp6_e3m2_r" || data_type == "fp6_e2m3_r" ||
-          data_type == "mxfp8_e4m3_r" || data_type == "mxfp8_e5m2_r") {
+  // a candidate failing to launch is not a test error
+  is_error = false;
+  return ok;
+}
 
-        generateMXInput(hbl_datatype,
+/**
+ * @brief key of the GEMM problem in the algorithm cache
+ * @return GPU architecture, hipBLASLt version and problem description
+ */
+std::string rvs_blas::matmul_algo_key(void) {
+
+  hipDeviceProp_t props;
+  int version = 0;
+  std::ostringstream key;
+
+  if(hipGetDeviceProperties(&props, gpu_device_index) != hipSuccess)
+    props.gcnArchName[0] = 0;
+  hipblasLtGetVersion(hbl_handle, &version);
+
+  key << props.gcnArchName << "|hipblaslt-" << version
+    << "|" << m << "x" << n << "x" << k
+    << "|t" << int(hbl_trans_a) << int(hbl_trans_b)
+    << "|ld" << hbl_lda_offset << "," << hbl_ldb_offset << ","
+    << hbl_ldc_offset << "," << hbl_ldd_offset
+    << "|" << data_type << "," << (out_data_type.empty() ? data_type : out_data_type)
+    << "," << compute_type
+    << "|scale" << hbl_scale_a << "," << hbl_scale_b
+    << "|batch" << batch_size;
+
+  return rvs::algo_cache::make_key(key.str());
+}
+
+/**
+ * @brief selects the hipBLASLt algorithm used by GEMM launches
+ *
+ * A selection found in the cache is used without heuristic query or
+ * tuning. Otherwise the first autotune heuristic candidates are timed on
+ * the current matrices and the fastest one is used (and cached).
+ *
+ * @param autotune number of heuristic candidates timed (0/1 - use first)
+ * @param cache_path persistent selection cache file (empty - no cache)
+ * @return true if an algorithm was selected
+ */
+bool rvs_blas::select_matmul_algo(int autotune, const std::string& cache_path) {
+
+  if(is_error || plan.backend != rvs::blas_plan::backend_hipblaslt)
+    return false;
+
+  std::string key = matmul_algo_key();
+  rvs::algo_cache::entry_t entry;
+
+  if(!cache_path.empty() &&
+      rvs::algo_cache::get(cache_path).lookup(key, &entry)) {
+
+    std::vector<int> index{entry.index};
+    std::vector<hipblasLtMatmulHeuristicResult_t> cached;
+    size_t workspace = 0;
+
+    if(hipblaslt_ext::getAlgosFromIndex(hbl_handle, index, cached) == HIPBLAS_STATUS_SUCCESS &&
+        !cached.empty() &&
+        hipblaslt_ext::matmulIsAlgoSupported(hbl_handle, hbl_matmul[0], hbl_alpha_p,
+          hbl_layout_a, hbl_layout_b, hbl_beta_p, hbl_layout_c, hbl_layout_d,
+          cached[0].algo, workspace) == HIPBLAS_STATUS_SUCCESS) {
+
+      cached[0].workspaceSize = workspace;
+      if(set_matmul_algo(cached[0])) {
+        algo_source = "cache";
+        algo_index = entry.index;
+        algo_time_us = entry.time_us;
+        return true;
+      }
+    }
+    // entry unusable with this library build - select again
+  }
+
+  std::vector<hipblasLtMatmulHeuristicResult_t> candidates;
+  size_t best = 0;
+  double best_us = 0;
+
+  if(!get_matmul_heuristics(std::max(autotune, 1), &candidates))
+    return false;
+
+  if(candidates.size() > 1) {
+
+    bool timed = false;
+
+    for(size_t i = 0; i < candidates.size(); i++) {
+      double us;
+      if(time_matmul_algo(candidates[i], &us) && (!timed || us < best_us)) {
+        best = i;
+        best_us = us;
+        timed = true;
+      }
+    }
+  }
+
+  if(!set_matmul_algo(candidates[best]))
+    return false;
+
+  algo_source = candidates.size() > 1 ? "autotune" : "heuristic";
+  algo_index = hipblaslt_ext::getIndexFromAlgo(candidates[best].algo);
+  algo_time_us = best_us;
+
+  if(!cache_path.empty() &&
+      !rvs::algo_cache::get(cache_path).store(key, {algo_index, best_us}))
+    std::cout << "\n algorithm cache " << cache_path << " not saved !!!" << "\n";
+
+  return true;
+}
+
+/**
+ * @brief performs the GEMM matrix multiplication operations
+ * @return true if GPU was able to enqueue the GEMM operation, otherwise false
+ */
+bool rvs_blas::run_blas_gemm(uint64_t num_calls) {
+  RVS_TRACE_SCOPE("blas", "gemm_enqueue");
+
+  if (is_error)
+    return false;
+
+  if (!batch_timing)
+    return rvs::blas_plan::run(gemm_launch, this, num_calls);
+
+  // ring full : the oldest batch time is dropped
+  if (batch_pending == BATCH_TIMING_SLOTS) {
+    batch_first = (batch_first + 1) % BATCH_TIMING_SLOTS;
+    batch_pending--;
+  }
+  int slot = (batch_first + batch_pending) % BATCH_TIMING_SLOTS;
+
+  /* GEMM call iterations loop, bracketed by the batch events */
+  if (hipEventRecord(batch_start[slot], hip_stream) != hipSuccess)
+    return false;
+  if (!rvs::blas_plan::run(gemm_launch, this, num_calls))
+    return false;
+  if (hipEventRecord(batch_stop[slot], hip_stream) != hipSuccess)
+    return false;
+
+  batch_pending++;
+  return true;
+}
+
+/**
+ * @brief enables or disables timing of the gemm batches with GPU events
+ * @param enable true to record an event pair around each run_blas_gemm()
+ * @return true if the timing mode was set, false if events could not be
+ * created (batches are then not timed)
+ */
+bool rvs_blas::set_batch_timing(bool enable) {
+
+  if (enable == batch_timing)
+    return true;
+
+  if (!enable) {
+    release_batch_timing();
+    return true;
+  }
+
+  for (int i = 0; i < BATCH_TIMING_SLOTS; i++) {
+    if ((hipEventCreate(&batch_start[i]) != hipSuccess) ||
+        (hipEventCreate(&batch_stop[i]) != hipSuccess)) {
+      release_batch_timing();
+      return false;
+    }
+  }
+
+  batch_first = 0;
+  batch_pending = 0;
+  batch_timing = true;
+  return true;
+}
+
+/**
+ * @brief collects the GPU time of the completed gemm batches
+ * @param ptimes batch times in microseconds are appended here, oldest first
+ * @return number of batch times collected
+ */
+size_t rvs_blas::get_batch_times_us(std::vector<double>* ptimes) {
+  size_t collected = 0;
+
+  while (batch_timing && batch_pending > 0) {
+    int slot = batch_first;
+    float ms = 0;
+
+    // batches complete in order : stop at the first one still running
+    if (hipEventQuery(batch_stop[slot]) != hipSuccess)
+      break;
+
+    if (hipEventElapsedTime(&ms, batch_start[slot], batch_stop[slot]) ==
+        hipSuccess) {
+      ptimes->push_back(1000.0 * ms);
+      collected++;
+    }
+
+    batch_first = (batch_first + 1) % BATCH_TIMING_SLOTS;
+    batch_pending--;
+  }
+
+  return collected;
+}
+
+/**
+ * @brief releases the gemm batch timing events
+ */
+void rvs_blas::release_batch_timing(void) {
+
+  if (batch_timing && hip_stream)
+    hipStreamSynchronize(hip_stream);
+
+  for (int i = 0; i < BATCH_TIMING_SLOTS; i++) {
+    if (batch_start[i])
+      hipEventDestroy(batch_start[i]);
+    if (batch_stop[i])
+      hipEventDestroy(batch_stop[i]);
+    batch_start[i] = nullptr;
+    batch_stop[i] = nullptr;
+  }
+
+  batch_timing = false;
+  batch_first = 0;
+  batch_pending = 0;
+}
+
+/**
+ * @brief generate matrix random data
+ * it should be called before rocBlas GEMM
+ */
+void rvs_blas::generate_random_matrix_data(void) {
+  RVS_TRACE_SCOPE("blas", "setup_init_data");
+
+  /* Predicted output sums depend on input matrices */
+  accu_checksums_valid = false;
+
+  if (!is_error) {
+
+    if("hiprand" == matrix_init) {
+
+      if(matrix_generation == 0 &&
+          hiprandSetPseudoRandomGeneratorSeed(hiprand_generator, matrix_seed) != HIPRAND_STATUS_SUCCESS) {
+        std::cout << "\n hiprandSetPseudoRandomGeneratorSeed() failed !!!" << "\n";
+        is_error = true;
+        return;
+      }
+
+      if((ops_type == "dgemm") || (data_type == "fp64_r")) {
+
+        if(hiprandGenerateUniformDouble(hiprand_generator, (double *)da, size_a) != HIPRAND_STATUS_SUCCESS) {
+          std::cout << "\n hiprandGenerateUniformDouble() failed for matrix a !!!" << "\n";
+          is_error = true;
+          return;
+        }
+
+        if(hiprandGenerateUniformDouble(hiprand_generator, (double *)db, size_b) != HIPRAND_STATUS_SUCCESS) {
+          std::cout << "\n hiprandGenerateUniformDouble() failed for matrix b !!!" << "\n";
+          is_error = true;
+          return;
+        }
+
+        if(hiprandGenerateUniformDouble(hiprand_generator, (double *)dc, size_c) != HIPRAND_STATUS_SUCCESS) {
+          std::cout << "\n hiprandGenerateUniformDouble() failed for matrix c !!!" << "\n";
+          is_error = true;
+          return;
+        }
+
+        if(hipStreamSynchronize(hip_stream) != hipSuccess) {
+          std::cout << "hipStreamSynchronize() failed !!! for stream " << hip_stream << std::endl;
+          is_error = true;
+          return;
+        }
+      }
+      else if((ops_type == "sgemm") || (data_type == "fp32_r")) {
+
+        if(hiprandGenerateUniform(hiprand_generator, (float *)da, size_a) != HIPRAND_STATUS_SUCCESS) {
+          std::cout << "\n hiprandGenerateUniform() failed for matrix a !!!" << "\n";
+          is_error = true;
+          return;
+        }
+
+        if(hiprandGenerateUniform(hiprand_generator, (float *)db, size_b) != HIPRAND_STATUS_SUCCESS) {
+          std::cout << "\n hiprandGenerateUniform() failed for matrix b !!!" << "\n";
+          is_error = true;
+          return;
+        }
+
+        if(hiprandGenerateUniform(hiprand_generator, (float *)dc, size_c) != HIPRAND_STATUS_SUCCESS) {
+          std::cout << "\n hiprandGenerateUniform() failed for matrix c !!!" << "\n";
+          is_error = true;
+          return;
+        }
+
+        if(hipStreamSynchronize(hip_stream) != hipSuccess) {
+          std::cout << "hipStreamSynchronize() failed !!! for stream " << hip_stream << std::endl;
+          is_error = true;
+          return;
+        }
+      }
+    }
+    else {
+
+      //SGEMM (float fp32_r)
+      if((ops_type == "sgemm") || (data_type == "fp32_r"))
+        init_host_matrices<float, float>();
+
+      //DGEMM (double fp64_r)
+      if((ops_type == "dgemm") || (data_type == "fp64_r"))
+        init_host_matrices<double, double>();
+
+      //HGEMM (half-float fp16_r)
+      if(ops_type == "hgemm")
+        init_host_matrices<rocblas_half, rocblas_half>();
+
+      // 8-bit floating point real (fp8_r) format
+      if(data_type == "fp8_r") {
+
+        if (blas_source == "rocblas") {
+#if RVS_ROCBLAS_HAS_F8_DATATYPES
+          init_host_matrices<rocblas_f8, rocblas_f8>();
+#endif
+        }
+        else if (blas_source == "hipblaslt") {
+          init_host_matrices<hipblaslt_f8, float>();
+        }
+      }
+
+      if(data_type == "fp4_r" || data_type == "fp6_e3m2_r" || data_type == "fp6_e2m3_r" ||
+          data_type == "mxfp8_e4m3_r" || data_type == "mxfp8_e5m2_r") {
+
+        generateMXInput(hbl_datatype,
             ha,
             hsa,
             hbl_row_a,
@@ -1435,149 +1761,194 @@ void rvs_blas::generate_random_matrix_data(void) {
       }
 
       // 8-bit floating point real OCP E4M3 (fp8_e4m3_r) format
-      if(data_type == "fp8_e4m3_r") {
+      if(data_type == "fp8_e4m3_r")
+        init_host_matrices<hipblaslt_f8, float>();
 
-        for (i = 0; i < size_a; ++i)
-          ((hipblaslt_f8* )ha)[i] = hipblaslt_f8(fast_pseudo_rand(&nextr, i));
+      // 8-bit floating point real OCP E5M2 (fp8_e5m2_r) format
+      if(data_type == "fp8_e5m2_r")
+        init_host_matrices<hipblaslt_bf8, float>();
 
-        for (i = 0; i < size_b; ++i)
-          ((hipblaslt_f8* )hb)[i] = hipblaslt_f8(fast_pseudo_rand(&nextr, i));
+      // 16-bit floating point real (fp16_r) format
+      if(data_type == "fp16_r") {
 
-        for (i = 0; i < size_c; ++i)
-          ((float* )hc)[i] = float(fast_pseudo_rand(&nextr, i));
+        if (blas_source == "rocblas")
+          init_host_matrices<rocblas_half, rocblas_half>();
+        else if (blas_source == "hipblaslt")
+          init_host_matrices<hipblasLtHalf, hipblasLtHalf>();
       }
 
-      // 8-bit floating point real OCP E5M2 (fp8_e5m2_r) format
-      if(data_type == "fp8_e5m2_r") {
-
-        for (i = 0; i < size_a; ++i)
-          ((hipblaslt_bf8* )ha)[i] = hipblaslt_bf8(fast_pseudo_rand(&nextr, i));
-
-        for (i = 0; i < size_b; ++i)
-          ((hipblaslt_bf8* )hb)[i] = hipblaslt_bf8(fast_pseudo_rand(&nextr, i));
+      // 16-bit brain floating point real (bf16_r) format
+      if(data_type == "bf16_r") {
 
-        for (i = 0; i < size_c; ++i)
-          ((float* )hc)[i] = float(fast_pseudo_rand(&nextr, i));
+        if (blas_source == "rocblas")
+          init_host_matrices<rocblas_bfloat16, rocblas_bfloat16>();
+        else if (blas_source == "hipblaslt")
+          init_host_matrices<hipblasLtBfloat16, hipblasLtBfloat16>();
       }
 
-      // 16-bit floating point real (fp16_r) format
-      if(data_type == "fp16_r") {
-
-        if (blas_source == "rocblas") {
-          for (i = 0; i < size_a; ++i)
-            ((rocblas_half* )ha)[i] = rocblas_half(fast_pseudo_rand(&nextr, i));
+      // 8-bit integer real (i8_r) format
+      if(data_type == "i8_r")
+        init_host_matrices<int8_t, int8_t>();
+    }
 
-          for (i = 0; i < size_b; ++i)
-            ((rocblas_half* )hb)[i] = rocblas_half(fast_pseudo_rand(&nextr, i));
+    /* Next initialization continues the sequence (fresh data, same seed) */
+    matrix_generation++;
+  }
+}
 
-          for (i = 0; i < size_c; ++i)
-            ((rocblas_half* )hc)[i] = rocblas_half(fast_pseudo_rand(&nextr, i));
-        }
-        else if (blas_source == "hipblaslt") {
-          for (i = 0; i < size_a; ++i)
-            ((hipblasLtHalf* )ha)[i] = hipblasLtHalf(fast_pseudo_rand(&nextr, i));
+/**
+ * @brief host matrix initialization parameters
+ * @param stream generator stream (one per matrix)
+ * @return counter based generator parameters for the init method
+ */
+rvs::philox::params_t rvs_blas::init_params(uint64_t stream) {
+
+  rvs::philox::params_t p = {};
+
+  p.seed = matrix_seed;
+  p.stream = (matrix_generation << 2) | stream;
+
+  switch (plan.init) {
+
+    case rvs::blas_plan::init_rand:
+
+      p.dist = rvs::philox::dist_int;
+      switch (plan.rand_range) {
+        case rvs::blas_plan::rand_1_2:
+          p.lo = 1; p.hi = 2;
+          break;
+        case rvs::blas_plan::rand_m2_2:
+          p.lo = -2; p.hi = 2;
+          break;
+        case rvs::blas_plan::rand_1_3:
+          p.lo = 1; p.hi = 3;
+          break;
+        default: /* sgemm (fp32), dgemm (fp64), fp8_e4m3_r, fp8_e5m2_r */
+          p.lo = 1; p.hi = 10;
+          break;
+      }
+      break;
 
-          for (i = 0; i < size_b; ++i)
-            ((hipblasLtHalf* )hb)[i] = hipblasLtHalf(fast_pseudo_rand(&nextr, i));
+    case rvs::blas_plan::init_trig:
+      p.dist = rvs::philox::dist_sin;
+      break;
 
-          for (i = 0; i < size_c; ++i)
-            ((hipblasLtHalf* )hc)[i] = hipblasLtHalf(fast_pseudo_rand(&nextr, i));
-        }
-      }
+    default:
+      p.dist = rvs::philox::dist_mod;
+      p.modulus = RANDOM_CT;
+      p.divisor = RANDOM_DIV_CT;
+      break;
+  }
+  return p;
+}
 
-      // 16-bit brain floating point real (bf16_r) format
-      if(data_type == "bf16_r") {
+/**
+ * @brief fills host matrices A, B (type Tab) and C (type Tc)
+ *
+ * Each matrix is a separate stream of the counter based generator, so the
+ * contents depend on matrix_seed and matrix_generation only (not on the
+ * number of threads). Workers with the same key share one copy of the
+ * matrices through rvs::matrix_stage, only the first one generates it.
+ */
+template <typename Tab, typename Tc>
+void rvs_blas::init_host_matrices(void) {
+
+  rvs::matrix_stage::key_t key;
+
+  key.type = ops_type + "/" + data_type + "/" + blas_source;
+  key.init = plan.init;
+  key.range = plan.rand_range;
+  key.seed = matrix_seed;
+  key.generation = matrix_generation;
+  key.bytes_a = size_a * sizeof(Tab);
+  key.bytes_b = size_b * sizeof(Tab);
+  key.bytes_c = size_c * sizeof(Tc);
+
+  /* Previous matrices are freed before allocating, or refilled in place
+   * if no other worker holds them (regeneration does not pin again) */
+  std::shared_ptr<const rvs::matrix_stage::buffers_t> held = std::move(staged);
+  ha = hb = hc = nullptr;
+
+  staged = rvs::matrix_stage::acquire(key,
+      [this](const rvs::matrix_stage::buffers_t& buf) {
+        rvs::philox::fill_as<Tab>(init_params(0), static_cast<Tab*>(buf.ha), size_a);
+        rvs::philox::fill_as<Tab>(init_params(1), static_cast<Tab*>(buf.hb), size_b);
+        rvs::philox::fill_as<Tc>(init_params(2), static_cast<Tc*>(buf.hc), size_c);
+        return true;
+      }, stage_alloc, stage_free, &held);
 
-        if (blas_source == "rocblas") {
-          for (i = 0; i < size_a; ++i)
-            ((rocblas_bfloat16* )ha)[i] = rocblas_bfloat16(fast_pseudo_rand(&nextr, i));
+  if (!staged) {
+    std::cout << "\n host matrix staging failed !!!" << "\n";
+    is_error = true;
+    return;
+  }
 
-          for (i = 0; i < size_b; ++i)
-            ((rocblas_bfloat16* )hb)[i] = rocblas_bfloat16(fast_pseudo_rand(&nextr, i));
+  ha = staged->ha;
+  hb = staged->hb;
+  hc = staged->hc;
+}
 
-          for (i = 0; i < size_c; ++i)
-            ((rocblas_bfloat16* )hc)[i] = rocblas_bfloat16(fast_pseudo_rand(&nextr, i));
-        }
-        else if (blas_source == "hipblaslt") {
+/**
+ * @brief tells whether host matrices A, B, C are shared (rvs::matrix_stage)
+ * @return false for device (hiprand) init and for block scaled (MX) types
+ */
+bool rvs_blas::host_matrices_staged(void) {
 
-          for (i = 0; i < size_a; ++i)
-            ((hipblasLtBfloat16* )ha)[i] = hipblasLtBfloat16(fast_pseudo_rand(&nextr, i));
+  if("hiprand" == matrix_init)
+    return false;
 
-          for (i = 0; i < size_b; ++i)
-            ((hipblasLtBfloat16* )hb)[i] = hipblasLtBfloat16(fast_pseudo_rand(&nextr, i));
+  if(data_type == "fp4_r" || data_type == "fp6_e3m2_r" || data_type == "fp6_e2m3_r" ||
+      data_type == "mxfp8_e4m3_r" || data_type == "mxfp8_e5m2_r")
+    return false;
 
-          for (i = 0; i < size_c; ++i)
-            ((hipblasLtBfloat16* )hc)[i] = hipblasLtBfloat16(fast_pseudo_rand(&nextr, i));
-        }
-      }
+#if !RVS_ROCBLAS_HAS_F8_DATATYPES
+  if(data_type == "fp8_r" && blas_source == "rocblas")
+    return false;
+#endif
 
-      // 8-bit integer real (i8_r) format
-      if(data_type == "i8_r") {
+  return true;
+}
 
-        for (i = 0; i < size_a; ++i)
-          ((int8_t* )ha)[i] = int8_t(fast_pseudo_rand(&nextr, i));
+/**
+ * @brief allocates staged host matrices
+ * @param bytes size of the allocation
+ * @param pinned set to true if pinned memory was allocated
+ * @return host memory, pinned (portable to all GPUs) if possible
+ */
+void* rvs_blas::stage_alloc(size_t bytes, bool* pinned) {
 
-        for (i = 0; i < size_b; ++i)
-          ((int8_t* )hb)[i] = int8_t(fast_pseudo_rand(&nextr, i));
+  void* ptr = nullptr;
 
-        for (i = 0; i < size_c; ++i)
-          ((int8_t* )hc)[i] = int8_t(fast_pseudo_rand(&nextr, i));
-      }
-    }
+  if(hipHostMalloc(&ptr, bytes, hipHostMallocPortable) == hipSuccess) {
+    *pinned = true;
+    return ptr;
   }
-}
 
-float rvsblas_uniform_int_1_10()
-{
-  if(!rvsblas_t_rand_init)
-  {
-    for(int i = 0; i < RANDBUF; i++)
-    {
-      rvsblas_t_rand_f_array[i]
-        = (float)std::uniform_int_distribution<unsigned>(1, 10)(rvsblas_t_rng);
-      rvsblas_t_rand_d_array[i] = (double)rvsblas_t_rand_f_array[i];
-    }
-    rvsblas_t_rand_init = 1;
-  }
-  rvsblas_t_rand_idx = (rvsblas_t_rand_idx + 1) & (RANDLEN - 1);
-  return rvsblas_t_rand_f_array[rvsblas_t_rand_idx];
+  *pinned = false;
+  return malloc(bytes);
 }
 
 /**
- * @brief fast pseudo random generator 
- * @return floating point random number
+ * @brief releases staged host matrices
+ * @param ptr memory returned by stage_alloc()
+ * @param pinned pinned flag returned by stage_alloc()
  */
-float rvs_blas::fast_pseudo_rand(uint64_t *nextr, size_t i) {
+void rvs_blas::stage_free(void* ptr, bool pinned) {
 
-  if ("rand" == matrix_init) {
+  if(pinned)
+    hipHostFree(ptr);
+  else
+    free(ptr);
+}
 
-    if(("fp8_r" == data_type) && (blas_source == "rocblas")) {
-      return (float)std::uniform_int_distribution<int>(1, 2)(rvsblas_t_rng);
-    }
-    else if (("fp16_r" == data_type) || ("hgemm" == ops_type))
-    {
-      return (float)std::uniform_int_distribution<int>(-2, 2)(rvsblas_t_rng);
-    }
-    else if("bf16_r" == data_type)
-    {
-      return (float)std::uniform_int_distribution<int>(-2, 2)(rvsblas_t_rng);
-    }
-    else if("i8_r" == data_type)
-    {
-      return (float)std::uniform_int_distribution<unsigned short>(1, 3)(rvsblas_t_rng);
-    }
-    else { /* sgemm (fp32), dgemm (fp64), fp8_e4m3_r, fp8_e5m2_r */
-      return rvsblas_uniform_int_1_10();
-    }
-  }
-  else if ("trig" == matrix_init) {
-    return sin(static_cast<float>(i));
-  }
-  else {
-    *nextr = *nextr * 1103515245 + 12345;
-    return static_cast<float>(static_cast<uint32_t>
-        ((*nextr / 65536) % RANDOM_CT)) / RANDOM_DIV_CT;
-  }
+/**
+ * @brief matrix seed used unless set_matrix_seed() is called
+ * @return random seed, the same for all instances of the process
+ */
+uint64_t rvs_blas::default_matrix_seed(void) {
+
+  static const uint64_t seed = std::random_device{}();
+  return seed;
 }
 
 /**
@@ -1629,403 +2000,98 @@ bool rvs_blas::set_callback(rvsBlasCallback_t callback, void *user_data) {
 }
 
 /**
- * Host(CPU) based Matrix multiplication -> C = alpha (A*B) + beta (C).
- * @param[in] alpha scalar for matrix A*B
- * @param[in] beta scalar for matrix C
- * @param[in] M matrix A rows
- * @param[in] N matrix B cols
- * @param[in] K matrix A/B cols/rows respectively
- * @param[in] A matrix A
- * @param[in] B matrix B
- * @param[in,out] C matrix C
+ * Relative F-norm error of gemm output (current vs previous output).
+ * Element formats known to rvs::lpconv are decoded by normcheck, other
+ * types are converted with their own casts first.
  */
 template <typename T>
-void host_matrix_mul(T alpha,
-    T        beta,
-    int      M,
-    int      N,
-    int      K,
-    const T* A,
-    int      As1,
-    int      As2,
-    const T* B,
-    int      Bs1,
-    int      Bs2,
-    T*       C,
-    int      Cs1,
-    int      Cs2)
-{
-  for(int i1 = 0; i1 < M; i1++)
-  {
-    for(int i2 = 0; i2 < N; i2++)
-    {
-      T t = 0.0;
-      for(int i3 = 0; i3 < K; i3++)
-      {
-        t += A[i1 * As1 + i3 * As2] * B[i3 * Bs1 + i2 * Bs2];
-      }
-      C[i1 * Cs1 + i2 * Cs2] = beta * C[i1 * Cs1 + i2 * Cs2] + alpha * t;
-    }
-  }
-}
-
-/*! \brief F-norm utility function that computes the scale
-  (largest absolute element in the column) and sum sqrt of the matric column */
-  template <typename T>
-void lapack_xlassq(int64_t n, T* X, int64_t incx, double& scale, double& sumsq) {
-
-  if(n > 0)
-  {
-    double abs_X = 0.0;
-    for(int64_t i = 0; i < n; i++)
-    {
-      abs_X = std::abs(X[i * incx]);
-
-      if(abs_X > 0 || std::isnan(abs_X))
-      {
-        if(scale < abs_X)
-        {
-          sumsq = 1 + sumsq * std::sqrt(scale / abs_X);
-          scale = abs_X;
-        }
-        else
-        {
-          sumsq = sumsq + std::sqrt(abs_X / scale);
-        }
-      }
-    }
-  }
-}
-
-/*! \brief F-norm utility function that acculatively computes
-  the sum sqrt of the matrix from sum sqrt of the matric column */
-template <typename T>
-void lapack_xcombssq(T* ssq, T* colssq) {
+double normcheck_relative_error(int64_t m, int64_t n, int64_t ld,
+    const void* ref, const void* cur) {
 
-  if(ssq[0] >= colssq[0])
-  {
-    if(ssq[0] != 0)
-    {
-      ssq[1] = ssq[1] + std::sqrt(colssq[0] / ssq[0]) * colssq[1];
-    }
-    else
-    {
-      ssq[1] = ssq[1] + colssq[1];
-    }
-  }
-  else
-  {
-    ssq[1] = colssq[1] + std::sqrt(ssq[0] / colssq[0]) * ssq[1];
-    ssq[0] = colssq[0];
+  if constexpr (std::is_same<T, double>{}) {
+    return rvs::normcheck::relative_error(m, n, ld,
+        static_cast<const double*>(ref), static_cast<const double*>(cur));
   }
-  return;
-}
-
-/*! \brief matrix norm function calculates the one norm,
-  infinity norm or the frobenius norm of the matrix A */
-template <typename T>
-double calculate_norm(char norm_type, int64_t m, int64_t n, T* A, int64_t lda, double* work) {
-
-  double value = 0.0;
-  double sum   = 0.0;
-
-  if(std::min(m, n) == 0)
-    return value;
-
-  int64_t a_offset = lda >= 0 ? 0 : lda * (1 - n); // e.g. vectors with negative inc
-  if(norm_type == 'O' || norm_type == 'o' || norm_type == '1')
-  {
-    //Find the one norm of Matrix A.
-    for(int64_t j = 0; j < n; j++)
-    {
-      sum = 0.0;
-      for(int64_t i = 0; i < m; i++)
-        sum = sum + std::abs(A[a_offset + i + j * lda]);
-
-      if(value < sum || std::isnan(sum))
-        value = sum;
-    }
-  }
-  else if(norm_type == 'I' || norm_type == 'i')
-  {
-    //Find the infinity norm of Matrix A.
-    for(int64_t j = 0; j < n; j++)
-      for(int64_t i = 0; i < m; i++)
-      {
-        work[i] = work[i] + std::abs(A[a_offset + i + j * lda]);
-      }
-    for(int64_t i = 0; i < m; i++)
-      if(value < work[i] || std::isnan(work[i]))
-        value = work[i];
-  }
-  else if(norm_type == 'F' || norm_type == 'f')
-  {
-    //Find the Frobenius norm of Matrix A.
-    //SSQ(1) is scale
-    //SSQ(2) is sum-of-squares
-    //For better accuracy, sum each column separately.
-    std::vector<double> ssq(2);
-    std::vector<double> colssq(2);
-
-    ssq[0] = 0.0;
-    ssq[1] = 1.0;
-    for(int64_t j = 0; j < n; j++)
-    {
-      colssq[0] = 0.0;
-      colssq[1] = 1.0;
-      lapack_xlassq(m, A + a_offset + j * lda, 1, colssq[0], colssq[1]);
-      lapack_xcombssq(ssq.data(), colssq.data());
-    }
-    value = ssq[0] * std::sqrt(ssq[1]);
-  }
-
-  return value;
-}
-
-/*! \brief Matrix utility function to create difference matrix from two matrices */
-template <typename T>
-void m_axpy_64(int64_t N, T* alpha, T* x, int64_t incx, T* y, int64_t incy) {
-
-  int64_t x_offset = incx >= 0 ? 0 : incx * (1 - N);
-  int64_t y_offset = incy >= 0 ? 0 : incy * (1 - N);
-  for(int64_t i = 0; i < N; i++)
-  {
-    y[y_offset + i * incy] = (*alpha) * x[x_offset + i * incx] + y[y_offset + i * incy];
-  }
-}
-
-/**
- * Get relative norm error for float/double data type matrices.
- * @param[in] norm_type matrix norm type to execute.
- * @param[in] M matrix rows
- * @param[in] N matrix columns
- * @param[in] Ida matrix leading dimension
- * @param[in] hA host memory matrix A
- * @param[in] hB host memory matrix B
- */
-template <
-    typename T,
-    std::enable_if<(std::is_same<T, float>{} || std::is_same<T, double>{}),int>::type = 0>
-double check_norm_error(char norm_type, int64_t M, int64_t N, int64_t lda, T* hA, T* hB) {
-
-  // norm type can be 'O', 'I', 'F', 'o', 'i', 'f' for one, infinity or Frobenius norm
-  // one norm is max column sum
-  // infinity norm is max row sum
-  // Frobenius is l2 norm of matrix entries
-
-  std::vector<double> work(std::max(int64_t(1), M));
-  int64_t             incx  = 1;
-  double              alpha = -1.0;
-
-  size_t size = M * size_t(N); // copying data so lda is M
-
-  std::vector<double> hA_double(size);
-  std::vector<double> hB_double(size);
-
-  for(int64_t i = 0; i < N; i++)
-  {
-    int64_t src_col = i * int64_t(lda);
-    int64_t dst_col = i * int64_t(M);
-    for(int64_t j = 0; j < M; j++)
-    {
-      hA_double[size_t(dst_col + j)] = double(hA[src_col + j]);
-      hB_double[size_t(dst_col + j)] = double(hB[src_col + j]);
-    }
-  }
-
-  double a_norm = calculate_norm(norm_type, M, N, hA_double.data(), M, work.data());
-  m_axpy_64(size, &alpha, hA_double.data(), incx, hB_double.data(), incx);
-  double error = calculate_norm(norm_type, M, N, hB_double.data(), M, work.data()) / a_norm;
-
-  return error;
-}
-
-/**
- * Get relative norm error for fp8 data type matrices.
- * @param[in] norm_type matrix norm type to execute.
- * @param[in] M matrix rows
- * @param[in] N matrix columns
- * @param[in] Ida matrix leading dimension
- * @param[in] hA host memory matrix A
- * @param[in] hB host memory matrix B
- */
-template <
-    typename T,
-    std::enable_if<std::is_same<T, hipblaslt_f8>{}, int>::type = 0>
-double check_norm_error(char norm_type, int64_t M, int64_t N, int64_t lda, T* hA, T* hB) {
-
-  // norm type can be 'O', 'I', 'F', 'o', 'i', 'f' for one, infinity or Frobenius norm
-  // one norm is max column sum
-  // infinity norm is max row sum
-  // Frobenius is l2 norm of matrix entries
-  size_t size = M * size_t(N); // copying data so lda is M
-
-  std::vector<double> hA_double(size);
-  std::vector<double> hB_double(size);
-
-  for(int64_t i = 0; i < N; i++)
-  {
-    int64_t src_col = i * int64_t(lda);
-    int64_t dst_col = i * int64_t(M);
-    for(int64_t j = 0; j < M; j++)
-    {
-      hA_double[size_t(dst_col + j)] = double(float(hA[src_col + j]));
-      hB_double[size_t(dst_col + j)] = double(float(hB[src_col + j]));
-    }
-  }
-
-  std::vector<double> work(std::max(int64_t(1), M));
-  int64_t             incx  = 1;
-  double              alpha = -1.0;
-
-  double a_norm = calculate_norm(norm_type, M, N, hA_double.data(), M, work.data());
-  m_axpy_64(size, &alpha, hA_double.data(), incx, hB_double.data(), incx);
-  double error = calculate_norm(norm_type, M, N, hB_double.data(), M, work.data()) / a_norm;
-
-  return error;
-}
-
-/**
- * Get relative norm error for bf16 data type matrices.
- * @param[in] norm_type matrix norm type to execute.
- * @param[in] M matrix rows
- * @param[in] N matrix columns
- * @param[in] Ida matrix leading dimension
- * @param[in] hA host memory matrix A
- * @param[in] hB host memory matrix B
- */
-template <typename T,
-         std::enable_if<(std::is_same<T, rocblas_bfloat16>{}), int>::type = 0>
-double check_norm_error(char norm_type, int64_t M, int64_t N, int64_t lda, T* hA, T* hB) {
+  else {
+    rvs::lpconv::conv_t conv = rvs::lpconv::conversion<T>();
 
-  size_t              size = N * (size_t)lda;
-  std::vector<double> hA_double(size);
-  std::vector<double> hB_double(size);
+    if (conv.fmt != rvs::lpconv::fmt_none)
+      return rvs::normcheck::relative_error(conv.fmt, m, n, ld, ref, cur);
 
-  for(int64_t i = 0; i < N; i++)
-  {
-    for(int64_t j = 0; j < M; j++)
-    {
-      size_t idx = j + i * (size_t)lda;
+    /* No matching format - encoding is target specific, let the type convert */
+    const T* r = static_cast<const T*>(ref);
+    const T* c = static_cast<const T*>(cur);
+    std::vector<float> fr(ld * n);
+    std::vector<float> fc(ld * n);
 
-      // zero extend lower 16 bits of bfloat16 to convert to IEEE float/double
-      hA_double[idx] = double(float((uint32_t)hA[idx].data << 16));
-      hB_double[idx] = double(float((uint32_t)hB[idx].data << 16));
+    for (int64_t i = 0; i < ld * n; i++) {
+      fr[i] = float(r[i]);
+      fc[i] = float(c[i]);
     }
+    return rvs::normcheck::relative_error(rvs::lpconv::fmt_f32, m, n, ld,
+        fr.data(), fc.data());
   }
-
-  return check_norm_error<double>(norm_type, M, N, lda, hA_double.data(), hB_double.data());
 }
 
 /**
- * Get relative norm error for fp16 (half) data type matrices.
- * @param[in] norm_type matrix norm type to execute.
- * @param[in] M matrix rows
- * @param[in] N matrix columns
- * @param[in] Ida matrix leading dimension
- * @param[in] hA host memory matrix A
- * @param[in] hB host memory matrix B
+ * Fault injection layout of gemm output: m x n column major matrix with
+ * leading dimension ldc, elements of type T.
  */
-template <typename T,
-         std::enable_if<(std::is_same<T, rocblas_half>{}), int>::type = 0>
-double check_norm_error(char norm_type, int64_t M, int64_t N, int64_t lda, T* hA, T* hB) {
-
-  size_t              size = N * (size_t)lda;
-  std::vector<double> hA_double(size);
-  std::vector<double> hB_double(size);
+template <typename T>
+rvs::faultinject::layout_t rvs_blas::output_layout(void) {
 
-  for(int64_t i = 0; i < N; i++)
-  {
-    for(int64_t j = 0; j < M; j++)
-    {
-      size_t idx       = j + i * (size_t)lda;
-      hA_double[idx] = double(hA[idx]);
-      hB_double[idx] = double(hB[idx]);
-    }
-  }
+  rvs::faultinject::layout_t layout = rvs::faultinject::layout_of<T>();
 
-  return check_norm_error<double>(norm_type, M, N, lda, hA_double.data(), hB_double.data());
+  layout.rows = m;
+  layout.ld = blas_ldc_offset;
+  return layout;
 }
 
 /**
  * Check gemm output for consistency (current output vs previous output).
- * @param[in] dout Device (GPU) matrix output.
- * @param[in] size No of elements in matrix output.
+ * Relative F-norm of the difference is computed in a single vectorized,
+ * multithreaded pass. In bitwise self-check mode identical outputs are
+ * accepted after an early-exit bitwise comparison. The current output
+ * becomes the previous one in validate_output().
+ * @param[in] hcur Host copy of current gemm output.
  * @param[out] error Relative F-norm self error.
  */
 template <typename T>
-bool rvs_blas::check_result_consistency(void * dout, size_t size, double &error) {
-
-  /* Allocate host memory for current gemm output */
-  if (!hco) {
-    if (hipHostMalloc(&hco, size * sizeof(T), 0) != hipSuccess)
-      return false;
+bool rvs_blas::check_result_consistency(const void * hcur, double &error) {
 
-    if (hipMemset(hco, 0, size * sizeof(T)) != hipSuccess)
-      return false;
-  }
-
-  /* Copy current device gemm output to host memory */
-  if (hipMemcpy(hco, dout, sizeof(T) * size, hipMemcpyDeviceToHost) != hipSuccess)
-    return false;
-
-  /* Allocate host memory for previous gemm output */
-  if (!hpo) {
-    if (hipHostMalloc(&hpo, size * sizeof(T), 0) != hipSuccess)
-      return false;
-
-    if (hipMemset(hpo, 0, size * sizeof(T)) != hipSuccess)
-      return false;
-
-    /* Copy current device gemm output to host memory */
-    if (hipMemcpy(hpo, dout, sizeof(T) * size, hipMemcpyDeviceToHost) != hipSuccess)
-      return false;
-
-    /* Exit first iteration of self-check as there is no previous result yet ! */
+  /* Exit first iteration of self-check as there is no previous result yet ! */
+  if (!hpo)
     return true;
-  }
-
-  /* If error injection is enabled, insert error in gemm output */
-  if(error_freq && error_count && check_count) {
-
-    /* Insert error at set error frequency */
-    if(check_count%error_freq == 0) {
-
-      if(error_count <= size) {
-
-        if (hipMemset(hco, 0,  sizeof(T) * error_count) != hipSuccess)
-          return false;
-      }
-    }
-  }
 
   /* Norm checking */
 
-  T * fp = (T *)hpo;
-  T * fc = (T *)hco;
-
   int64_t M = (int64_t)m;
   int64_t N = (int64_t)n;
   int64_t _ldc = (int64_t) blas_ldc_offset;
 
-  /* Set norm error if any by checking current vs previous gemm outputs */
-  error = std::abs(check_norm_error('F', M, N, _ldc, fp, fc));
-
-  /* Copy current device gemm output to host previous gemm output memory */
-  if (hipMemcpy(hpo, dout, sizeof(T) * size, hipMemcpyDeviceToHost) != hipSuccess)
-    return false;
+  if (self_check_mode == "bitwise" &&
+      rvs::normcheck::equal(M, N, _ldc, sizeof(T), hpo, hcur)) {
+    error = 0;
+  }
+  else {
+    /* Set norm error if any by checking current vs previous gemm outputs */
+    error = normcheck_relative_error<T>(M, N, _ldc, hpo, hcur);
+  }
 
   return true;
 }
 
 /**
  * Check gemm output for accuracy (GPU output vs CPU output).
- * @param[in] dout Device (GPU) matrix output.
+ * Depending on accuracy check mode, either whole output is recomputed on
+ * host, randomly sampled elements are recomputed or output row/column sums
+ * are compared with sums predicted from input matrices.
+ * @param[in] hcur Host copy of device (GPU) gemm output.
  * @param[in] size No of elements in matrix output.
  * @param[out] error Relative accuracy error.
  */
 template <typename T>
-bool rvs_blas::check_result_accuracy(void * dout, size_t size, double &error) {
+bool rvs_blas::check_result_accuracy(const void * hcur, size_t size, double &error) {
 
   int a_stride_1 = 1,
       a_stride_2 = blas_lda_offset,
@@ -2042,95 +2108,102 @@ bool rvs_blas::check_result_accuracy(void * dout, size_t size, double &error) {
     b_stride_2 = 1;
   }
 
-  /* Allocate host memory for host (CPU) gemm output */
-  if(!hout) {
-    if(hipHostMalloc(&hout, size * sizeof(T), 0) != hipSuccess)
-      return false;
+  const T * _hd = (const T *)hcur;
+  T * _ha = (T *)ha;
+  T * _hb = (T *)hb;
+  T * _hc = (T *)hc;
+  T alpha = (T) blas_alpha_val;
+  T beta = (T) blas_beta_val;
 
-    if (hipMemset(hout, 0, size * sizeof(T)) != hipSuccess)
-      return false;
-  }
+  accu_mismatches.clear();
 
-  /* Allocate host memory for device (GPU) gemm output */
-  if(!hdout) {
-    if(hipHostMalloc(&hdout, size * sizeof(T), 0) != hipSuccess)
-      return false;
+  /* Recompute randomly chosen output elements only */
+  if(accu_check_mode == "sample") {
 
-    if (hipMemset(hdout, 0, size * sizeof(T)) != hipSuccess)
-      return false;
+    uint64_t samples = rvs::gemmverify::sample_count(accu_confidence,
+        accu_error_rate, uint64_t(m) * n);
+
+    /* Different elements on every check, replayable for the matrix seed */
+    uint64_t seed = rvs::gemmverify::sample_seed(matrix_seed, accu_check_count++);
+
+    error = rvs::gemmverify::verify_sampled<T>(m, n, k, alpha,
+        _ha, a_stride_1, a_stride_2, _hb, b_stride_1, b_stride_2,
+        beta, _hc, 1, blas_ldc_offset, _hd, 1, blas_ldc_offset,
+        samples, seed, rvs::gemmverify::DEFAULT_SAMPLE_TOLERANCE,
+        &accu_mismatches);
+
+    return true;
   }
 
-  T * _ha;
-  T * _hb;
-  T * _hc;
-  T alpha = (T) blas_alpha_val;
-  T beta = (T) blas_beta_val;
+  /* Compare output row/column sums with sums predicted from inputs */
+  if(accu_check_mode == "checksum") {
+
+    if(!accu_checksums_valid) {
+      rvs::gemmverify::checksum_prepare<T>(m, n, k, alpha,
+          _ha, a_stride_1, a_stride_2, _hb, b_stride_1, b_stride_2,
+          beta, _hc, 1, blas_ldc_offset, &accu_checksums);
+      accu_checksums_valid = true;
+    }
 
-  if (std::is_same<T, float>{}) {
-    _ha = (T *)ha;
-    _hb = (T *)hb;
-    _hc = (T *)hc;
+    error = rvs::gemmverify::verify_checksum<T>(accu_checksums,
+        _hd, 1, blas_ldc_offset,
+        rvs::gemmverify::DEFAULT_CHECKSUM_TOLERANCE, &accu_mismatches);
+
+    return true;
   }
-  else {
-    _ha = (T *)ha;
-    _hb = (T *)hb;
-    _hc = (T *)hc;
+
+  /* Allocate host memory for host (CPU) gemm output */
+  if(!hout) {
+    if(hipHostMalloc(&hout, size * sizeof(T), hipHostMallocNumaUser) != hipSuccess)
+      return false;
+
+    if (hipMemset(hout, 0, size * sizeof(T)) != hipSuccess)
+      return false;
   }
 
   /* Copy Matrix C to host gemm output memory */
   if(hipMemcpy(hout, _hc, sizeof(T) * size, hipMemcpyHostToHost) != hipSuccess)
     return false;
 
-  /* Host (CPU) based matrix multiplication */
-  host_matrix_mul<T>(alpha,
-      beta,
-      m,
+  /* Host (CPU) based matrix multiplication (accumulated in double) */
+  rvs::hostgemm::gemm<T, T, T, double>(m,
       n,
       k,
+      alpha,
       _ha,
       a_stride_1,
       a_stride_2,
       _hb,
       b_stride_1,
       b_stride_2,
+      beta,
       (T *)hout,
       1,
       blas_ldc_offset);
 
-  /* Copy device gemm output to host memory */
-  if (hipMemcpy(hdout, dout, sizeof(T) * size, hipMemcpyDeviceToHost) != hipSuccess)
-    return false;
-
-  /* If error injection is enabled, insert error in gemm output */
-  if(error_freq && error_count && check_count) {
-
-    /* Insert error at set error frequency */
-    if(check_count%error_freq == 0) {
-
-      if(error_count <= size) {
-
-        if (hipMemset(hdout, 0,  sizeof(T) * error_count) != hipSuccess)
-          return false;
-      }
-    }
-  }
-
   /* Calculate max. relative error */
 
   T max_relative_error = 0.0;
+  T eps = std::numeric_limits<T>::epsilon();
+  T tolerance = 10;
 
   for(size_t i = 0; i < size; i++)
   {
-    T relative_error = (((T *)hout)[i] - ((T *)hdout)[i]) / ((T *)hout)[i];
+    T relative_error = (((T *)hout)[i] - _hd[i]) / ((T *)hout)[i];
 
     relative_error = relative_error > 0 ? relative_error : -relative_error;
 
     max_relative_error
       = relative_error < max_relative_error ? max_relative_error : relative_error;
-  }
 
-  T eps = std::numeric_limits<T>::epsilon();
-  T tolerance = 10;
+    /* Record location of wrong element */
+    if(relative_error > eps * tolerance &&
+        accu_mismatches.size() < rvs::gemmverify::MAX_MISMATCHES) {
+      accu_mismatches.push_back(rvs::gemmverify::mismatch_t{
+          int64_t(i % blas_ldc_offset), int64_t(i / blas_ldc_offset),
+          double(relative_error)});
+    }
+  }
 
   /* Set error if max. relative error greater than tolerance level */
   if(max_relative_error > eps * tolerance)
@@ -2142,62 +2215,365 @@ bool rvs_blas::check_result_accuracy(void * dout, size_t size, double &error) {
 }
 
 /**
- * Validate gemm output for consistency and accuracy.
+ * @brief Gemm output buffer checked by validation
+ * @param[out] pout device output buffer
+ * @param[out] psize number of elements in output buffer
+ * @param[out] pelem_size size of output element
+ * @return false if validation is not supported for gemm data type
+ */
+bool rvs_blas::get_validation_output(void** pout, size_t* psize, size_t* pelem_size) {
+
+  if(ops_type == "sgemm") {
+    *pout = dc, *psize = size_c, *pelem_size = sizeof(float);
+  }
+  else if(ops_type == "dgemm") {
+    *pout = dc, *psize = size_c, *pelem_size = sizeof(double);
+  }
+  else if(data_type == "fp8_r") {
+    *pout = dd, *psize = size_d, *pelem_size = sizeof(hipblaslt_f8);
+  }
+  else if(data_type == "fp16_r") {
+    *pout = dd, *psize = size_d, *pelem_size = sizeof(rocblas_half);
+  }
+  else if(data_type == "bf16_r") {
+    *pout = dd, *psize = size_d, *pelem_size = sizeof(rocblas_bfloat16);
+  }
+  else {
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Validate host copy of gemm output of element type T.
+ * Scheduled faults are injected into the host copy and both checks run on
+ * it. The copy then becomes the previous output of the self-check by
+ * swapping buffer ownership with hpo, so *phost returns the former previous
+ * output (nullptr after the first self-check) for the next copy. Copies
+ * with injected faults never become the reference.
+ * @param[in,out] phost Owner of the host copy of gemm output.
+ * @param[in] size No of elements in matrix output.
  * @param[in] self_check Enable self checking of gemm outputs (previous vs current).
  * @param[in] accu_check Enable accuracy checking of gemm outputs (GPU vs CPU).
  * @param[out] self_error Relative F-norm self error.
  * @param[out] accu_error Relative accuracy error.
  */
-bool rvs_blas::validate_gemm(bool self_check, bool accu_check, double &self_error, double &accu_error) {
+template <typename T>
+bool rvs_blas::validate_output(void** phost, size_t size, bool self_check,
+    bool accu_check, double &self_error, double &accu_error) {
 
-  /* Gemm output checked for consistency/repeatability
-     by comparing current output with previous output */
-  if(self_check) {
+  bool injected = false;
+  bool ok = true;
 
-    if(ops_type == "sgemm") {
-      check_result_consistency<float>(dc, size_c, self_error);
-    }
-    else if(ops_type == "dgemm") {
-      check_result_consistency<double>(dc, size_c, self_error);
-    }
-    else if(data_type == "fp8_r") {
-      check_result_consistency<hipblaslt_f8>(dd, size_d, self_error);
-    }
-    else if(data_type == "fp16_r") {
-      check_result_consistency<rocblas_half>(dd, size_d, self_error);
-    }
-    else if(data_type == "bf16_r") {
-      check_result_consistency<rocblas_bfloat16>(dd, size_d, self_error);
-    }
-    else {
+  /* Inject scheduled faults into the host copy of gemm output */
+  if(faults.enabled()) {
+
+    rvs::faultinject::action_t act = faults.inject(check_count, *phost,
+        (uint64_t)m * n, output_layout<T>());
+    if(act.copy_fail)
       return false;
-    }
+    injected = act.corrupted;
   }
 
+  /* Gemm output checked for consistency/repeatability
+     by comparing current output with previous output */
+  if(self_check)
+    ok &= check_result_consistency<T>(*phost, self_error);
+
   /* Gemm output checked for accuracy/correctness by comparing
      host(CPU) output with device(GPU) output */
   if(accu_check) {
+    if constexpr (std::is_same<T, float>::value || std::is_same<T, double>::value)
+      ok &= check_result_accuracy<T>(*phost, size, accu_error);
+    else
+      return false;
+  }
 
-    if(ops_type == "sgemm") {
-      check_result_accuracy<float>(dc, size_c, accu_error);
-    }
-    else if(ops_type == "dgemm") {
-      check_result_accuracy<double>(dc, size_c, accu_error);
-    }
-    else {
+  /* Current gemm output becomes previous gemm output */
+  if(self_check && !injected)
+    std::swap(hpo, *phost);
+
+  return ok;
+}
+
+/**
+ * Validate gemm output for consistency and accuracy.
+ * @param[in,out] phost Owner of the host copy of gemm output (see validate_output()).
+ * @param[in] self_check Enable self checking of gemm outputs (previous vs current).
+ * @param[in] accu_check Enable accuracy checking of gemm outputs (GPU vs CPU).
+ * @param[out] self_error Relative F-norm self error.
+ * @param[out] accu_error Relative accuracy error.
+ */
+bool rvs_blas::validate_gemm_output(void** phost, bool self_check, bool accu_check,
+    double &self_error, double &accu_error) {
+
+  bool ok;
+
+  if(ops_type == "sgemm") {
+    ok = validate_output<float>(phost, size_c, self_check, accu_check,
+        self_error, accu_error);
+  }
+  else if(ops_type == "dgemm") {
+    ok = validate_output<double>(phost, size_c, self_check, accu_check,
+        self_error, accu_error);
+  }
+  else if(data_type == "fp8_r") {
+    ok = validate_output<hipblaslt_f8>(phost, size_d, self_check, accu_check,
+        self_error, accu_error);
+  }
+  else if(data_type == "fp16_r") {
+    ok = validate_output<rocblas_half>(phost, size_d, self_check, accu_check,
+        self_error, accu_error);
+  }
+  else if(data_type == "bf16_r") {
+    ok = validate_output<rocblas_bfloat16>(phost, size_d, self_check, accu_check,
+        self_error, accu_error);
+  }
+  else {
+    return false;
+  }
+
+  /* Fault injection is enabled: report outcome, next check */
+  if(faults.enabled()) {
+    faults.report(check_count, !ok || self_error > 0 || accu_error > 0);
+    check_count++;
+  }
+
+  return ok;
+}
+
+/**
+ * Validate gemm output for consistency and accuracy.
+ * Device output is copied to host once and all checks run on that copy.
+ * @param[in] self_check Enable self checking of gemm outputs (previous vs current).
+ * @param[in] accu_check Enable accuracy checking of gemm outputs (GPU vs CPU).
+ * @param[out] self_error Relative F-norm self error.
+ * @param[out] accu_error Relative accuracy error.
+ */
+bool rvs_blas::validate_gemm(bool self_check, bool accu_check, double &self_error, double &accu_error) {
+  RVS_TRACE_SCOPE("blas", "validation");
+
+  void* out;
+  size_t size, elem_size;
+
+  if(!get_validation_output(&out, &size, &elem_size))
+    return false;
+
+  /* Allocate host memory for current gemm output */
+  if(!hco) {
+    if(hipHostMalloc(&hco, size * elem_size, hipHostMallocNumaUser) != hipSuccess)
+      return false;
+  }
+
+  /* Copy current device gemm output to host memory */
+  if(hipMemcpy(hco, out, size * elem_size, hipMemcpyDefault) != hipSuccess)
+    return false;
+
+  return validate_gemm_output(&hco, self_check, accu_check, self_error, accu_error);
+}
+
+/**
+ * Queue gemm output for validation on validation task.
+ * Output of gemm calls queued so far is copied to one of host snapshot
+ * buffers on a separate stream; subsequent gemm calls wait only for that
+ * copy, not for the host check. If all snapshot buffers are still being
+ * validated, caller is blocked until one is released.
+ * @param[in] self_check Enable self checking of gemm outputs (previous vs current).
+ * @param[in] accu_check Enable accuracy checking of gemm outputs (GPU vs CPU).
+ * @param[in] iteration Caller iteration reported back with the result.
+ * @return false if validation is not supported or snapshot failed
+ */
+bool rvs_blas::validate_gemm_async(bool self_check, bool accu_check, uint64_t iteration) {
+  RVS_TRACE_SCOPE("blas", "validation_snapshot");
+
+  void* out;
+  size_t size, elem_size;
+
+  if(!get_validation_output(&out, &size, &elem_size))
+    return false;
+
+  if(!val_stream && !init_async_validation(size, elem_size))
+    return false;
+
+  std::unique_lock<std::mutex> lk(val_mutex);
+
+  /* Back-pressure: wait for snapshot slot to be released */
+  int slot = val_next_slot;
+  val_cv.wait(lk, [this, slot] { return !val_busy[slot]; });
+  val_busy[slot] = true;
+  lk.unlock();
+
+  /* Snapshot buffer handed over to the self-check reference is replaced */
+  if(!hval[slot] &&
+      hipHostMalloc(&hval[slot], size * elem_size, hipHostMallocNumaUser) != hipSuccess) {
+    lk.lock();
+    val_busy[slot] = false;
+    return false;
+  }
+
+  if((hipEventRecord(val_gemm_done[slot], hip_stream) != hipSuccess) ||
+      (hipStreamWaitEvent(val_stream, val_gemm_done[slot], 0) != hipSuccess) ||
+      (hipMemcpyAsync(hval[slot], out, size * elem_size,
+                      hipMemcpyDeviceToHost, val_stream) != hipSuccess) ||
+      (hipEventRecord(val_copy_done[slot], val_stream) != hipSuccess) ||
+      (hipStreamWaitEvent(hip_stream, val_copy_done[slot], 0) != hipSuccess)) {
+    lk.lock();
+    val_busy[slot] = false;
+    return false;
+  }
+
+  lk.lock();
+  val_jobs.push_back(validation_job_t{slot, iteration, self_check, accu_check});
+  val_next_slot = (slot + 1) % VALIDATION_SLOTS;
+  lk.unlock();
+  val_cv.notify_all();
+
+  return true;
+}
+
+/**
+ * Collect completed asynchronous validations (in submission order).
+ * @param[out] presults completed validations are appended here
+ * @return number of results collected
+ */
+size_t rvs_blas::get_validation_results(std::vector<validation_result_t>* presults) {
+
+  std::lock_guard<std::mutex> lk(val_mutex);
+  size_t count = val_results.size();
+
+  for(auto& res : val_results)
+    presults->push_back(std::move(res));
+  val_results.clear();
+
+  return count;
+}
+
+/**
+ * Wait until all queued asynchronous validations are completed.
+ */
+void rvs_blas::wait_validation(void) {
+
+  std::unique_lock<std::mutex> lk(val_mutex);
+
+  val_cv.wait(lk, [this] {
+    if(!val_jobs.empty())
       return false;
+    for(int i = 0; i < VALIDATION_SLOTS; i++) {
+      if(val_busy[i])
+        return false;
     }
+    return true;
+  });
+}
+
+/**
+ * Allocate snapshot buffers, copy stream and events and start validation task.
+ * @param[in] size Number of elements in gemm output.
+ * @param[in] elem_size Size of gemm output element.
+ */
+bool rvs_blas::init_async_validation(size_t size, size_t elem_size) {
+
+  if(hipStreamCreateWithFlags(&val_stream, hipStreamNonBlocking) != hipSuccess) {
+    val_stream = nullptr;
+    return false;
   }
 
-  /* Error injection is enabled */
-  if(error_freq && error_count) {
-    /* Increment the gemm check counter */
-    check_count++;
+  for(int i = 0; i < VALIDATION_SLOTS; i++) {
+
+    if((hipHostMalloc(&hval[i], size * elem_size, hipHostMallocNumaUser) != hipSuccess) ||
+        (hipEventCreateWithFlags(&val_gemm_done[i], hipEventDisableTiming) != hipSuccess) ||
+        (hipEventCreateWithFlags(&val_copy_done[i], hipEventDisableTiming) != hipSuccess)) {
+      release_async_validation();
+      return false;
+    }
   }
 
+  // long running: blocking pool task (gets a pool thread of its own)
+  val_stop = false;
+  val_task.start([this]() { validation_thread(); }, gpu_device_index);
+
   return true;
 }
 
+/**
+ * Finish queued validations, stop validation task and release resources.
+ */
+void rvs_blas::release_async_validation(void) {
+
+  if(!val_stream)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lk(val_mutex);
+    val_stop = true;
+  }
+  val_cv.notify_all();
+
+  if(val_task.joinable())
+    val_task.join();
+
+  hipStreamSynchronize(val_stream);
+
+  for(int i = 0; i < VALIDATION_SLOTS; i++) {
+    if(hval[i])
+      hipHostFree(hval[i]);
+    if(val_gemm_done[i])
+      hipEventDestroy(val_gemm_done[i]);
+    if(val_copy_done[i])
+      hipEventDestroy(val_copy_done[i]);
+    hval[i] = nullptr;
+    val_gemm_done[i] = nullptr;
+    val_copy_done[i] = nullptr;
+  }
+
+  hipStreamDestroy(val_stream);
+  val_stream = nullptr;
+}
+
+/**
+ * Validation task: validates gemm output snapshots in submission order.
+ */
+void rvs_blas::validation_thread(void) {
+
+  // host checks may use HIP memory functions on this device
+  hipSetDevice(gpu_device_index);
+
+  for(;;) {
+
+    validation_job_t job;
+    {
+      std::unique_lock<std::mutex> lk(val_mutex);
+      val_cv.wait(lk, [this] { return val_stop || !val_jobs.empty(); });
+
+      // exit only once all queued snapshots are validated
+      if(val_jobs.empty())
+        return;
+
+      job = val_jobs.front();
+      val_jobs.pop_front();
+    }
+
+    validation_result_t res{job.iteration, false, 0.0, 0.0, {}};
+
+    if(hipEventSynchronize(val_copy_done[job.slot]) == hipSuccess) {
+      RVS_TRACE_SCOPE("blas", "validation");
+
+      res.valid = validate_gemm_output(&hval[job.slot], job.self_check,
+          job.accu_check, res.self_error, res.accu_error);
+      if(job.accu_check)
+        res.mismatches = accu_mismatches;
+    }
+
+    {
+      std::lock_guard<std::mutex> lk(val_mutex);
+      val_results.push_back(std::move(res));
+      val_busy[job.slot] = false;
+    }
+    val_cv.notify_all();
+  }
+}
+
 /**
  * Set gemm error stimulation parameters.
  * Note: This function is meant only for test purpose !!!
@@ -2206,59 +2582,70 @@ bool rvs_blas::validate_gemm(bool self_check, bool accu_check, double &self_erro
  */
 void rvs_blas::set_gemm_error(uint64_t _error_freq, uint64_t _error_count) {
 
-  error_freq = _error_freq;
-  error_count = _error_count;
+  if(!_error_freq || !_error_count)
+    return;
+
+  /* first _error_count elements zeroed every _error_freq checks */
+  rvs::faultinject::rule_t rule = {rvs::faultinject::fault_zero, _error_freq,
+      0.0, 1, 0, _error_count, 0, -1, 0, 0};
+  faults.add_rule(rule);
+}
+
+/**
+ * Set fault injection schedule for gemm output validation.
+ * Faults are injected into host copies of gemm output before self and
+ * accuracy checks; outcome of every check is reported back so that
+ * detection rate and latency can be read with get_fault_stats().
+ * @param[in] spec schedule (see rvs::faultinject::parse()), empty - none.
+ * @param[in] seed seed of all injection decisions.
+ * @param[out] perror schedule error description.
+ * @return false if schedule is invalid.
+ */
+bool rvs_blas::set_fault_injection(const std::string& spec, uint64_t seed,
+                                   std::string* perror) {
+
+  return faults.configure(spec, seed, perror);
+}
+
+/**
+ * @brief Select how gemm output accuracy is checked against host
+ * @param mode "full" (host gemm of the whole output), "sample" (random
+ * output elements) or "checksum" (output row/column sums)
+ * @param confidence sample mode - probability of detecting wrong output
+ * @param error_rate sample mode - fraction of wrong elements to be detected
+ */
+void rvs_blas::set_accu_check_mode(const std::string& mode, double confidence,
+                                   double error_rate) {
+
+  accu_check_mode = mode;
+  accu_confidence = confidence;
+  accu_error_rate = error_rate;
+  accu_checksums_valid = false;
 }
 
 #include <DataGenerator.hpp>
 
+//! true for MX types stored with fewer than 8 bits per value
+template <typename DT>
+constexpr bool is_mx_fp6 = std::is_same_v<DT, DGen::ocp_e3m2_mxfp6> ||
+                           std::is_same_v<DT, DGen::ocp_e2m3_mxfp6>;
+
 template <typename DT>
 std::vector<uint8_t> unpackData(std::vector<uint8_t> const& dataBytes)
 {
     // Only F4 and F6 need to unpack data.
-    static_assert(
-        std::is_same_v<
-            DT,
-            DGen::
-                ocp_e2m1_mxfp4> || std::is_same_v<DT, DGen::ocp_e3m2_mxfp6> || std::is_same_v<DT, DGen::ocp_e2m3_mxfp6>);
+    static_assert(std::is_same_v<DT, DGen::ocp_e2m1_mxfp4> || is_mx_fp6<DT>);
 
-    if constexpr(std::is_same_v<DT,
-                                DGen::ocp_e3m2_mxfp6> || std::is_same_v<DT, DGen::ocp_e2m3_mxfp6>)
+    if constexpr(is_mx_fp6<DT>)
     {
         std::vector<uint8_t> unpackedDataBytes(dataBytes.size() * 8 / 6);
-#pragma omp parallel for
-        for(int i = 0; i < dataBytes.size(); i++)
-        {
-            int const f6_id = (i * 6) / 8;
-            uint8_t   value = 0;
-            switch(i % 4)
-            {
-            case 0:
-                value = (dataBytes[f6_id] & 0x3F);
-                break;
-            case 1:
-                value = ((dataBytes[f6_id] & 0xC0) >> 6) | ((dataBytes[f6_id + 1] & 0xF) << 2);
-                break;
-            case 2:
-                value = ((dataBytes[f6_id] & 0xF0) >> 4) | ((dataBytes[f6_id + 1] & 0x3) << 4);
-                break;
-            case 3:
-                value = ((dataBytes[f6_id] & 0xFC) >> 2);
-                break;
-            }
-            unpackedDataBytes[i] = value;
-        }
+        rvs::mxpack::unpack_fp6(dataBytes.data(), dataBytes.size(), unpackedDataBytes.data());
         return unpackedDataBytes;
     }
     else
     {
         std::vector<uint8_t> unpackedDataBytes(dataBytes.size() * 2);
-#pragma omp parallel for
-        for(int i = 0; i < dataBytes.size(); i++)
-        {
-            unpackedDataBytes[i * 2]     = (dataBytes[i] & 0x0F);
-            unpackedDataBytes[i * 2 + 1] = (dataBytes[i] >> 4);
-        }
+        rvs::mxpack::unpack_fp4(dataBytes.data(), dataBytes.size(), unpackedDataBytes.data());
         return unpackedDataBytes;
     }
 }
@@ -2267,40 +2654,12 @@ template <typename DT>
 void packData(std::vector<uint8_t> const& dataBytes, uint8_t* packedData)
 {
     // Only F4 and F6 need to unpack data.
-    static_assert(
-        std::is_same_v<
-            DT,
-            DGen::
-                ocp_e2m1_mxfp4> || std::is_same_v<DT, DGen::ocp_e3m2_mxfp6> || std::is_same_v<DT, DGen::ocp_e2m3_mxfp6>);
-
-    if constexpr(std::is_same_v<DT,
-                                DGen::ocp_e3m2_mxfp6> || std::is_same_v<DT, DGen::ocp_e2m3_mxfp6>)
-    {
-        auto const total = dataBytes.size() * 6 / 8;
-#pragma omp parallel for
-        for(int i = 0; i < total; i += 3)
-        {
-            auto const f8_id = i * 8 / 6;
+    static_assert(std::is_same_v<DT, DGen::ocp_e2m1_mxfp4> || is_mx_fp6<DT>);
 
-            packedData[i] = (dataBytes[f8_id] & 0x3F);
-            packedData[i] |= ((dataBytes[f8_id + 1] & 0x03) << 6);
-
-            packedData[i + 1] = ((dataBytes[f8_id + 1] & 0xFC) >> 2);
-            packedData[i + 1] |= ((dataBytes[f8_id + 2] & 0x03) << 6);
-
-            packedData[i + 2] = ((dataBytes[f8_id + 2] & 0xFC) >> 6);
-            packedData[i + 2] |= ((dataBytes[f8_id + 3] & 0x3F) << 2);
-        }
-    }
+    if constexpr(is_mx_fp6<DT>)
+        rvs::mxpack::pack_fp6(dataBytes.data(), dataBytes.size(), packedData);
     else
-    {
-#pragma omp parallel for
-        for(int i = 0; i < dataBytes.size() / 2; i++)
-        {
-            packedData[i] = (dataBytes[2 * i] & 0x0F);
-            packedData[i] |= (dataBytes[2 * i + 1] << 4);
-        }
-    }
+        rvs::mxpack::pack_fp4(dataBytes.data(), dataBytes.size(), packedData);
 }
 
 /**
@@ -2310,10 +2669,15 @@ void packData(std::vector<uint8_t> const& dataBytes, uint8_t* packedData)
  * 32 data share a scale (i.e., data 0-31 use scale 0, data 32-63 use
  * scale 1, etc.). But when doing matrix multiplication with non-transpose
  * matrix A or transpose matrix B, the data and scale are accessed in a
- * different order (see the example in comment below). This function
- * re-arranges the data to let the data use the correct scale.
+ * different order: element (m, k) of A (or (n, k) of B) stored at
+ * k * M + m has to use scale (k / 32) * M + m. This function re-arranges
+ * the data to let the data use the correct scale, see
+ * rvs::mxpack::align_blocks().
  * Note, the passed-in dataBytes will be changed due to the rearrangement.
  *
+ * Float values are looked up in a table per scale value present, built
+ * with DGen::toFloat once per (scale, code) instead of once per element.
+ *
  * @return float values of generated MX type data aligned with scale
  */
 template <typename DT>
@@ -2323,75 +2687,42 @@ std::vector<float> getAlignedFloat(std::vector<uint8_t>&       dataBytes,
                                    int                         elementsPerMXBlock,
                                    bool                        isMatrixA)
 {
-    std::vector<float>   refFloat(sizes[0] * sizes[1], 0.0);
+    // sizes are M x K for matrix A, N x K for transposed matrix B : both
+    // are the same K block transpose
+    (void)isMatrixA;
+    int rows = sizes[0];
+    int cols = sizes[1];
+    std::vector<float>   refFloat(rows * cols, 0.0);
     std::vector<uint8_t> alignedDataBytes(dataBytes.size());
 
-    if(isMatrixA) // non-transpose
+    rvs::mxpack::align_blocks(dataBytes.data(), alignedDataBytes.data(),
+                              rows, cols, elementsPerMXBlock);
+
+    // one table of code -> float per scale value used
+    const int codes = std::is_same_v<DT, DGen::ocp_e2m1_mxfp4> ? 16 :
+                      is_mx_fp6<DT> ? 64 : 256;
+    bool used[256] = {};
+    for(uint8_t s : scaleBytes)
+        used[s] = true;
+
+    std::vector<float> luts(256 * codes, 0.0f);
+    for(int s = 0; s < 256; s++)
     {
-        int M = sizes[0];
-        int K = sizes[1];
-
-        // For example, assume matrix A is 128x128 and elementsPerMXBlock is 32.
-        // Before aligned,
-        //
-        //  mk     m     k       scale ID
-        //  0      0     0           0
-        //  1      1     0           1     (data at index 1 use scale 1 not 0)
-        //  2      2     0           2
-        //            ...
-        //  127   127    0          127
-        //
-        //  128    0     1           0
-        //  129    1     1           1
-        //            ...
-        //  255   127    1          127
-        //            ...
-        //
-        // To align data with scale,
-        //
-        //  mk     m     k       scale ID      data id
-        //  0      0     0           0            0
-        //  1      1     0           1           32
-        //  2      2     0           2           64
-        //            ...
-        // 127    127    0          127        4064 (127 x 32)
-        //
-        // We move data at index 32 to index 1 (because the index 1
-        // is using scale 1), data at index 64 to index 2, and so on.
-
-#pragma omp parallel for
-        for(size_t mk = 0; mk < M * K; ++mk)
+        if(!used[s])
+            continue;
+        uint8_t scale = static_cast<uint8_t>(s);
+        for(int c = 0; c < codes; c++)
         {
-            auto m        = mk % M;
-            auto k        = mk / M;
-            auto scale_id = (k / elementsPerMXBlock) * M + m;
-
-            auto data_id         = scale_id * elementsPerMXBlock + k % elementsPerMXBlock;
-            alignedDataBytes[mk] = dataBytes[data_id];
-            refFloat[mk]
-                = DGen::toFloat<DT>(scaleBytes.data(), dataBytes.data(), scale_id, data_id);
+            uint8_t code = static_cast<uint8_t>(c);
+            luts[s * codes + c] = DGen::toFloat<DT>(&scale, &code, 0, 0);
         }
-        std::swap(dataBytes, alignedDataBytes);
     }
-    else // transpose matrixB
-    {
-        int N = sizes[0];
-        int K = sizes[1];
 
-#pragma omp parallel for
-        for(size_t kn = 0; kn < K * N; ++kn)
-        {
-            auto k        = kn / N;
-            auto n        = kn % N;
-            auto scale_id = (k / elementsPerMXBlock) * N + n;
-
-            auto data_id         = scale_id * elementsPerMXBlock + k % elementsPerMXBlock;
-            alignedDataBytes[kn] = dataBytes[data_id];
-            refFloat[kn]
-                = DGen::toFloat<DT>(scaleBytes.data(), dataBytes.data(), scale_id, data_id);
-        }
-        std::swap(dataBytes, alignedDataBytes);
-    }
+    rvs::mxpack::aligned_to_float(alignedDataBytes.data(), scaleBytes.data(),
+                                  rows, cols, elementsPerMXBlock,
+                                  luts.data(), codes, refFloat.data());
+
+    std::swap(dataBytes, alignedDataBytes);
     return refFloat;
 }
 
@@ -0,0 +1,97 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_blas_plan.h"
+
+rvs::blas_plan::blas_plan()
+  : backend(backend_none), op(op_none), strided(false),
+    init(init_default), rand_range(rand_1_10) {
+}
+
+/**
+ * @brief Resolve GEMM configuration strings into plan
+ *
+ * rocBLAS operation is selected by ops_type (sgemm, dgemm, hgemm) or,
+ * if ops_type is not one of those, by data_type (fp8_r, fp16_r, bf16_r).
+ * Unsupported combinations resolve to op_none.
+ *
+ * @param blas_source rocblas or hipblaslt
+ * @param ops_type operation type
+ * @param data_type data type
+ * @param gemm_mode gemm mode (strided_batched or basic)
+ * @param matrix_init matrix init method
+ * @return plan
+ *
+ * */
+rvs::blas_plan rvs::blas_plan::resolve(const std::string& blas_source,
+                                       const std::string& ops_type,
+                                       const std::string& data_type,
+                                       const std::string& gemm_mode,
+                                       const std::string& matrix_init) {
+  blas_plan plan;
+
+  if (blas_source == "rocblas") {
+    plan.backend = backend_rocblas;
+
+    if (ops_type == "sgemm")
+      plan.op = op_sgemm;
+    else if (ops_type == "dgemm")
+      plan.op = op_dgemm;
+    else if (ops_type == "hgemm")
+      plan.op = op_hgemm;
+    else if (data_type == "fp8_r")
+      plan.op = op_fp8;
+    else if (data_type == "fp16_r")
+      plan.op = op_fp16;
+    else if (data_type == "bf16_r")
+      plan.op = op_bf16;
+  } else if (blas_source == "hipblaslt") {
+    plan.backend = backend_hipblaslt;
+    plan.op = op_matmul;
+  }
+
+  plan.strided = (gemm_mode == "strided_batched");
+
+  if (matrix_init == "rand")
+    plan.init = init_rand;
+  else if (matrix_init == "trig")
+    plan.init = init_trig;
+  else if (matrix_init == "hiprand")
+    plan.init = init_hiprand;
+  else
+    plan.init = init_default;
+
+  if (data_type == "fp8_r" && blas_source == "rocblas")
+    plan.rand_range = rand_1_2;
+  else if (data_type == "fp16_r" || ops_type == "hgemm")
+    plan.rand_range = rand_m2_2;
+  else if (data_type == "bf16_r")
+    plan.rand_range = rand_m2_2;
+  else if (data_type == "i8_r")
+    plan.rand_range = rand_1_3;
+  else  // sgemm (fp32), dgemm (fp64), fp8_e4m3_r, fp8_e5m2_r
+    plan.rand_range = rand_1_10;
+
+  return plan;
+}
@@ -0,0 +1,402 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_faultinject.h"
+
+#include <algorithm>
+#include <sstream>
+#include <thread>
+
+#include "include/rvs_philox.h"
+
+namespace {
+
+const char* kind_names[rvs::faultinject::fault_kinds] = {
+  "zero", "bitflip", "stuck", "nan", "inf", "delay", "copyfail"
+};
+
+//! splits s at sep (empty parts are dropped)
+std::vector<std::string> split(const std::string& s, char sep) {
+  std::vector<std::string> parts;
+  std::string part;
+  std::istringstream is(s);
+
+  while (std::getline(is, part, sep)) {
+    part.erase(0, part.find_first_not_of(" \t"));
+    part.erase(part.find_last_not_of(" \t") + 1);
+    if (!part.empty())
+      parts.push_back(part);
+  }
+  return parts;
+}
+
+//! reads element bits
+uint64_t load_elem(const uint8_t* p, size_t size) {
+  uint64_t v = 0;
+  memcpy(&v, p, size);
+  return v;
+}
+
+//! writes element bits
+void store_elem(uint8_t* p, size_t size, uint64_t v) {
+  memcpy(p, &v, size);
+}
+
+//! address of logical element e (column major matrix or contiguous)
+uint8_t* elem_at(uint8_t* data, uint64_t e,
+                 const rvs::faultinject::layout_t& l) {
+  uint64_t off = l.rows ? e % l.rows + e / l.rows * l.ld : e;
+  return data + off * l.elem_size;
+}
+
+}  // namespace
+
+rvs::faultinject::faultinject() : seed(0), stats{} {
+}
+
+//! Returns fault kind name
+const char* rvs::faultinject::kind_name(kind_t kind) {
+  if (kind < 0 || kind >= fault_kinds)
+    return "unknown";
+  return kind_names[kind];
+}
+
+/**
+ * @brief Parses fault schedule
+ *
+ * Rules are separated by ';', each is a kind (zero, bitflip, stuck, nan,
+ * inf, delay, copyfail) optionally followed by ':' and comma separated
+ * key=value options: every, prob, start, limit, count, index, bit, value
+ * (stuck-at bits, 0x prefix for hex) and delay (ms). A rule without every
+ * and prob fires on every check.
+ *
+ * @param spec schedule text
+ * @param[out] prules parsed rules
+ * @param[out] perror description of the first error
+ * @return true on success
+ *
+ * */
+bool rvs::faultinject::parse(const std::string& spec,
+                             std::vector<rule_t>* prules,
+                             std::string* perror) {
+  prules->clear();
+
+  for (const std::string& text : split(spec, ';')) {
+    rule_t r = {fault_zero, 0, 0.0, 0, 0, 1, -1, -1, 0, 100};
+    size_t colon = text.find(':');
+    std::string kind = text.substr(0, colon);
+    bool has_rate = false;
+
+    kind.erase(kind.find_last_not_of(" \t") + 1);
+    const char** name = std::find_if(kind_names, kind_names + fault_kinds,
+        [&kind](const char* n) { return kind == n; });
+    if (name == kind_names + fault_kinds) {
+      *perror = "unknown fault kind '" + kind + "'";
+      return false;
+    }
+    r.kind = static_cast<kind_t>(name - kind_names);
+
+    std::vector<std::string> opts;
+    if (colon != std::string::npos)
+      opts = split(text.substr(colon + 1), ',');
+
+    for (const std::string& opt : opts) {
+      size_t eq = opt.find('=');
+      std::string key = opt.substr(0, eq);
+      std::string val = eq == std::string::npos ? "" : opt.substr(eq + 1);
+
+      try {
+        size_t used = 0;
+        if (key == "every") {
+          r.every = std::stoull(val, &used, 0);
+          has_rate = true;
+        } else if (key == "prob") {
+          r.probability = std::stod(val, &used);
+          has_rate = true;
+          if (r.probability < 0 || r.probability > 1)
+            throw std::out_of_range(val);
+        } else if (key == "start") {
+          r.start = std::stoull(val, &used, 0);
+        } else if (key == "limit") {
+          r.limit = std::stoull(val, &used, 0);
+        } else if (key == "count") {
+          r.count = std::stoull(val, &used, 0);
+        } else if (key == "index") {
+          r.index = std::stoll(val, &used, 0);
+        } else if (key == "bit") {
+          r.bit = std::stoi(val, &used, 0);
+          if (r.bit < 0 || r.bit > 63)
+            throw std::out_of_range(val);
+        } else if (key == "value") {
+          r.value = std::stoull(val, &used, 0);
+        } else if (key == "delay") {
+          r.delay_ms = std::stoul(val, &used, 0);
+        } else {
+          *perror = "unknown fault option '" + key + "'";
+          return false;
+        }
+        if (used != val.size())
+          throw std::invalid_argument(val);
+      } catch (const std::exception&) {
+        *perror = "invalid value of fault option '" + opt + "'";
+        return false;
+      }
+    }
+
+    if (!has_rate)
+      r.every = 1;
+    prules->push_back(r);
+  }
+  return true;
+}
+
+/**
+ * @brief Sets schedule and seed (statistics are reset)
+ *
+ * @param spec schedule text (see parse())
+ * @param seed Philox key of all decisions
+ * @param[out] perror description of a schedule error
+ * @return false if schedule is invalid (injection stays disabled)
+ *
+ * */
+bool rvs::faultinject::configure(const std::string& spec, uint64_t seed,
+                                 std::string* perror) {
+  std::vector<rule_t> parsed;
+  std::string error;
+
+  if (!parse(spec, &parsed, &error)) {
+    if (perror)
+      *perror = error;
+    parsed.clear();
+  }
+
+  std::lock_guard<std::mutex> lk(mtx);
+  rules = parsed;
+  fired.assign(rules.size(), 0);
+  this->seed = seed;
+  pending.clear();
+  stats = stats_t{};
+  return error.empty();
+}
+
+//! Appends rule to the schedule
+void rvs::faultinject::add_rule(const rule_t& rule) {
+  std::lock_guard<std::mutex> lk(mtx);
+  rules.push_back(rule);
+  fired.push_back(0);
+}
+
+//! Sets Philox key of all decisions
+void rvs::faultinject::set_seed(uint64_t seed) {
+  std::lock_guard<std::mutex> lk(mtx);
+  this->seed = seed;
+}
+
+//! true if schedule has rules
+bool rvs::faultinject::enabled(void) const {
+  std::lock_guard<std::mutex> lk(mtx);
+  return !rules.empty();
+}
+
+//! Four random words for (check, rule, index)
+void rvs::faultinject::draw(uint64_t check, uint32_t rule, uint32_t index,
+                            uint32_t out[4]) const {
+  const uint32_t ctr[4] = {static_cast<uint32_t>(check),
+                           static_cast<uint32_t>(check >> 32), rule, index};
+  const uint32_t key[2] = {static_cast<uint32_t>(seed),
+                           static_cast<uint32_t>(seed >> 32)};
+  rvs::philox::block(ctr, key, out);
+}
+
+//! Applies data fault of rule, returns number of elements modified
+uint64_t rvs::faultinject::apply(const rule_t& r, uint64_t check,
+                                 uint32_t rule_idx, uint8_t* data,
+                                 size_t elems, const layout_t& layout) {
+  const size_t es = layout.elem_size;
+  uint32_t rnd[4];
+
+  if (r.kind == fault_bitflip) {
+    for (uint64_t b = 0; b < r.count; b++) {
+      draw(check, rule_idx, static_cast<uint32_t>(b + 1), rnd);
+      uint64_t e = r.index >= 0 ? std::min<uint64_t>(r.index, elems - 1) :
+          ((uint64_t(rnd[1]) << 32) | rnd[0]) % elems;
+      uint32_t bit = (r.bit >= 0 ? r.bit : rnd[2]) % (8 * es);
+      uint8_t* p = elem_at(data, e, layout);
+      store_elem(p, es, load_elem(p, es) ^ (uint64_t(1) << bit));
+    }
+    return r.count;
+  }
+
+  uint64_t bits = 0;
+  if (r.kind == fault_stuck) {
+    bits = r.value;
+  } else if (r.kind == fault_nan || r.kind == fault_inf) {
+    if (r.kind == fault_nan ? !layout.has_nan : !layout.has_inf)
+      return 0;
+    bits = r.kind == fault_nan ? layout.nan_bits : layout.inf_bits;
+  }
+
+  draw(check, rule_idx, 1, rnd);
+  uint64_t first = r.index >= 0 ? std::min<uint64_t>(r.index, elems - 1) :
+      ((uint64_t(rnd[1]) << 32) | rnd[0]) % elems;
+  uint64_t count = std::min<uint64_t>(r.count, elems - first);
+  for (uint64_t e = first; e < first + count; e++)
+    store_elem(elem_at(data, e, layout), es, bits);
+  return count;
+}
+
+/**
+ * @brief Injects the faults scheduled for a check
+ *
+ * Data faults modify elems elements of data (skipped if data is null);
+ * delays are slept here, copy failures are returned to the caller.
+ *
+ * @param check check number (schedule position)
+ * @param data host copy of the data about to be verified
+ * @param elems number of elements (rows x columns for matrices)
+ * @param layout element encoding
+ * @return faults injected
+ *
+ * */
+rvs::faultinject::action_t rvs::faultinject::inject(uint64_t check,
+    void* data, size_t elems, const layout_t& layout) {
+  action_t act = {false, false, 0, 0};
+  {
+    std::lock_guard<std::mutex> lk(mtx);
+    auto now = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < rules.size(); i++) {
+      const rule_t& r = rules[i];
+      uint32_t rnd[4];
+
+      if (check < r.start || (r.limit && fired[i] >= r.limit))
+        continue;
+      if (r.every) {
+        if (check % r.every)
+          continue;
+      } else {
+        draw(check, static_cast<uint32_t>(i), 0, rnd);
+        if (!(rnd[0] * 0x1p-32 < r.probability))
+          continue;
+      }
+
+      if (r.kind == fault_delay) {
+        act.delay_ms += r.delay_ms;
+      } else if (r.kind == fault_copy_fail) {
+        act.copy_fail = true;
+      } else {
+        uint64_t n = 0;
+        if (data && elems && layout.elem_size >= 1 && layout.elem_size <= 8)
+          n = apply(r, check, static_cast<uint32_t>(i),
+                    static_cast<uint8_t*>(data), elems, layout);
+        if (!n)
+          continue;
+        act.corrupted = true;
+        act.elements += n;
+      }
+
+      fired[i]++;
+      stats.injected[r.kind]++;
+      pending.push_back(pending_t{check, now, r.kind});
+    }
+  }
+
+  if (act.delay_ms)
+    std::this_thread::sleep_for(std::chrono::milliseconds(act.delay_ms));
+  return act;
+}
+
+/**
+ * @brief Reports outcome of a check
+ *
+ * All faults injected up to and including check are resolved: detected
+ * if the check failed, missed (false negative) otherwise.
+ *
+ * @param check check number
+ * @param detected verification reported an error
+ *
+ * */
+void rvs::faultinject::report(uint64_t check, bool detected) {
+  std::lock_guard<std::mutex> lk(mtx);
+  auto now = std::chrono::steady_clock::now();
+
+  stats.checks++;
+  while (!pending.empty() && pending.front().check <= check) {
+    const pending_t& p = pending.front();
+    if (detected) {
+      uint64_t lat = check - p.check;
+      double lat_s = std::chrono::duration<double>(now - p.time).count();
+      stats.detected[p.kind]++;
+      stats.latency_checks += lat;
+      stats.max_latency_checks = std::max(stats.max_latency_checks, lat);
+      stats.latency_s += lat_s;
+      stats.max_latency_s = std::max(stats.max_latency_s, lat_s);
+    } else {
+      stats.missed[p.kind]++;
+    }
+    pending.pop_front();
+  }
+}
+
+//! Returns detection statistics
+rvs::faultinject::stats_t rvs::faultinject::get_stats(void) const {
+  std::lock_guard<std::mutex> lk(mtx);
+  return stats;
+}
+
+/**
+ * @brief Detection statistics as text
+ *
+ * Totals, false negative rate and detection latency followed by
+ * detected/injected per fault kind that was injected.
+ *
+ * */
+std::string rvs::faultinject::summary(void) const {
+  stats_t s = get_stats();
+  uint64_t injected = 0, detected = 0, missed = 0;
+  std::ostringstream os;
+
+  for (int k = 0; k < fault_kinds; k++) {
+    injected += s.injected[k];
+    detected += s.detected[k];
+    missed += s.missed[k];
+  }
+
+  os << "checks " << s.checks << " injected " << injected << " detected "
+     << detected << " missed " << missed;
+  if (detected + missed)
+    os << " false negative rate "
+       << 100.0 * missed / (detected + missed) << "%";
+  if (detected)
+    os << " latency mean " << double(s.latency_checks) / detected
+       << " checks " << 1e3 * s.latency_s / detected << " ms max "
+       << s.max_latency_checks << " checks " << 1e3 * s.max_latency_s
+       << " ms";
+  for (int k = 0; k < fault_kinds; k++) {
+    if (s.injected[k])
+      os << " " << kind_names[k] << " " << s.detected[k] << "/"
+         << s.injected[k];
+  }
+  return os.str();
+}
@@ -0,0 +1,232 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_gemm_engine.h"
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+
+#define USLEEP_MAX_VAL                          (1000000 - 1)
+//! lowest GEMM duty cycle accepted by gemm_duty_control
+#define GEMM_MIN_DUTY                           0.02
+
+/**
+ * @brief Constructor
+ *
+ * @param capacity maximum number of batch times held
+ * */
+rvs::gemm_batch_ring::gemm_batch_ring(size_t capacity)
+  : buf(std::max<size_t>(capacity, 1)), next(0), count(0) {
+}
+
+/**
+ * @brief Adds a batch time, overwriting the oldest one when full
+ *
+ * @param batch_us batch time in microseconds
+ * */
+void rvs::gemm_batch_ring::add(double batch_us) {
+  buf[next] = batch_us;
+  next = (next + 1) % buf.size();
+  if (count < buf.size())
+    count++;
+}
+
+/**
+ * @brief Computes the distribution of the batch times held
+ *
+ * Percentiles are nearest rank, so they are always observed batch times.
+ *
+ * @return batch time distribution (all zero if empty)
+ * */
+rvs::gemm_batch_dist_t rvs::gemm_batch_ring::distribution(void) const {
+  gemm_batch_dist_t d = {};
+  if (count == 0)
+    return d;
+
+  std::vector<double> v(buf.begin(), buf.begin() + count);
+  std::sort(v.begin(), v.end());
+
+  double sum = 0;
+  for (double t : v)
+    sum += t;
+  double mean = sum / count;
+  double var = 0;
+  for (double t : v)
+    var += (t - mean) * (t - mean);
+  var = count > 1 ? var / (count - 1) : 0;
+
+  // nearest rank : smallest time with at least p of the batches at or below
+  auto rank = [&](double p) {
+    size_t r = static_cast<size_t>(std::ceil(p * count));
+    return v[r > 0 ? r - 1 : 0];
+  };
+
+  d.samples = count;
+  d.min_us = v.front();
+  d.median_us = rank(0.5);
+  d.p99_us = rank(0.99);
+  d.max_us = v.back();
+  d.mean_us = mean;
+  d.cv = mean > 0 ? std::sqrt(var) / mean : 0;
+  return d;
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param _gflop_per_gemm GFLOP of one GEMM
+ * */
+rvs::gemm_stats::gemm_stats(double _gflop_per_gemm) {
+  reset(_gflop_per_gemm);
+}
+
+/**
+ * @brief Clears the statistics
+ *
+ * @param gflop_per_gemm GFLOP of one GEMM
+ * */
+void rvs::gemm_stats::reset(double gflop_per_gemm) {
+  gflop = gflop_per_gemm;
+  cur = {};
+  sum = {};
+  host_ring.clear();
+  device_ring.clear();
+}
+
+/**
+ * @brief Records a completed batch
+ *
+ * @param gemms GEMMs in the batch
+ * @param batch_us batch time (launch to completion) in microseconds
+ * @param device_us batch time measured with GPU events (0 - not timed)
+ * */
+void rvs::gemm_stats::add_batch(uint64_t gemms, double batch_us,
+                                double device_us) {
+  if (cur.batches == 0) {
+    cur.min_batch_us = batch_us;
+    cur.max_batch_us = batch_us;
+  } else {
+    cur.min_batch_us = std::min(cur.min_batch_us, batch_us);
+    cur.max_batch_us = std::max(cur.max_batch_us, batch_us);
+  }
+  cur.gemms += gemms;
+  cur.batches++;
+  // accumulated as the mean is only computed on close
+  cur.mean_batch_us += batch_us;
+  host_ring.add(batch_us);
+  if (device_us > 0)
+    device_ring.add(device_us);
+}
+
+/**
+ * @brief Closes the current interval and adds it to the run statistics
+ *
+ * @param elapsed_s seconds since the start of the run
+ * @param seconds wall time of the interval
+ * @return statistics of the interval
+ * */
+rvs::gemm_interval_t rvs::gemm_stats::close_interval(double elapsed_s,
+                                                     double seconds) {
+  gemm_interval_t iv = cur;
+  double busy_us = cur.mean_batch_us;
+
+  iv.index = sum.intervals;
+  iv.elapsed_s = elapsed_s;
+  iv.seconds = seconds;
+  iv.mean_batch_us = iv.batches ? busy_us / iv.batches : 0;
+  iv.gflops = busy_us > 0 ? gflop * iv.gemms / (busy_us / 1e6) : 0;
+  iv.host = host_ring.distribution();
+  iv.device = device_ring.distribution();
+  host_ring.clear();
+  device_ring.clear();
+
+  if (sum.intervals == 0) {
+    sum.min_gflops = iv.gflops;
+    sum.max_gflops = iv.gflops;
+  } else {
+    sum.min_gflops = std::min(sum.min_gflops, iv.gflops);
+    sum.max_gflops = std::max(sum.max_gflops, iv.gflops);
+  }
+  sum.intervals++;
+  sum.gemms += iv.gemms;
+  sum.batches += iv.batches;
+  sum.busy_seconds += busy_us / 1e6;
+  sum.gflops = sum.busy_seconds > 0 ?
+    gflop * sum.gemms / sum.busy_seconds : 0;
+
+  cur = {};
+  return iv;
+}
+
+/**
+ * @brief Idle time keeping the GEMM duty cycle
+ *
+ * @return microseconds to idle before the next batch
+ * */
+uint64_t rvs::gemm_duty_control::idle_us(void) {
+  double d = duty;
+  if (d >= 1.0 || last_batch_us <= 0)
+    return 0;
+  return static_cast<uint64_t>(last_batch_us * (1.0 - d) / d);
+}
+
+/**
+ * @brief Sets the duty cycle and batch size (thread safe)
+ *
+ * @param _duty fraction of the time spent running GEMMs, clamped to
+ * [GEMM_MIN_DUTY, 1]
+ * @param _calls GEMMs per batch (0 - as configured)
+ * */
+void rvs::gemm_duty_control::set(double _duty, uint64_t _calls) {
+  duty = std::min(1.0, std::max(GEMM_MIN_DUTY, _duty));
+  num_calls = _calls;
+}
+
+/**
+ * @brief Sleeps for any number of microseconds (usleep is limited to 1 s)
+ *
+ * @param microseconds time to sleep
+ * */
+void rvs::usleep_ex(uint64_t microseconds) {
+  while (microseconds > USLEEP_MAX_VAL) {
+    usleep(USLEEP_MAX_VAL);
+    microseconds -= USLEEP_MAX_VAL;
+  }
+  usleep(microseconds);
+}
+
+/**
+ * @brief Computes the difference (in milliseconds) between 2 points in time
+ *
+ * @param t_end second point in time
+ * @param t_start first point in time
+ * @return time difference in milliseconds
+ * */
+uint64_t rvs::time_diff(std::chrono::steady_clock::time_point t_end,
+                        std::chrono::steady_clock::time_point t_start) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+      t_end - t_start).count();
+}
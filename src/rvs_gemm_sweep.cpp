@@ -0,0 +1,330 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_gemm_sweep.h"
+
+#include <cstdio>
+#include <sstream>
+
+namespace {
+
+//! largest number of values a single list may expand to
+const size_t MAX_SWEEP_VALUES = 4096;
+
+bool parse_number(const std::string& s, uint64_t* value) {
+  if (s.empty() || s.find_first_not_of("0123456789") != std::string::npos)
+    return false;
+  try {
+    *value = std::stoull(s);
+  } catch (...) {
+    return false;
+  }
+  return true;
+}
+
+std::string trim(const std::string& s) {
+  size_t b = s.find_first_not_of(" \t");
+  if (b == std::string::npos)
+    return "";
+  size_t e = s.find_last_not_of(" \t");
+  return s.substr(b, e - b + 1);
+}
+
+//! matrix engine data type class of an ops_type/data_type
+enum dclass_t { dc_unknown, dc_fp64, dc_fp32, dc_fp16, dc_fp8, dc_i8, dc_fp4 };
+
+dclass_t data_class(const std::string& dtype) {
+  if (dtype == "dgemm" || dtype == "fp64_r")
+    return dc_fp64;
+  if (dtype == "sgemm" || dtype == "fp32_r")
+    return dc_fp32;
+  if (dtype == "hgemm" || dtype == "fp16_r" || dtype == "bf16_r")
+    return dc_fp16;
+  if (dtype == "fp8_r" || dtype == "fp8_e4m3_r" || dtype == "fp8_e5m2_r" ||
+      dtype == "mxfp8_e4m3_r" || dtype == "mxfp8_e5m2_r")
+    return dc_fp8;
+  if (dtype == "i8_r")
+    return dc_i8;
+  if (dtype == "fp6_e3m2_r" || dtype == "fp6_e2m3_r" || dtype == "fp4_r")
+    return dc_fp4;
+  return dc_unknown;
+}
+
+}  // namespace
+
+/**
+ * @brief Parses a list of values
+ *
+ * Comma separated items, each a value, a geometric range "lo:hi:xF"
+ * (lo, lo*F, ... up to hi), an arithmetic range "lo:hi:+S" or "lo:hi"
+ * (same as "lo:hi:x2").
+ *
+ * @param spec list specification
+ * @param values parsed values (appended)
+ * @return false if the specification is invalid
+ * */
+bool rvs::gemm_sweep::parse_values(const std::string& spec,
+                                   std::vector<uint64_t>* values) {
+  std::stringstream ss(spec);
+  std::string item;
+  size_t count = 0;
+
+  while (std::getline(ss, item, ',')) {
+    item = trim(item);
+    std::vector<std::string> f;
+    std::stringstream is(item);
+    std::string tok;
+    while (std::getline(is, tok, ':'))
+      f.push_back(trim(tok));
+
+    uint64_t lo, hi, step = 2;
+    bool geometric = true;
+
+    if (f.size() == 1) {
+      if (!parse_number(f[0], &lo))
+        return false;
+      values->push_back(lo);
+      count++;
+      continue;
+    }
+    if (f.size() < 2 || f.size() > 3)
+      return false;
+    if (!parse_number(f[0], &lo) || !parse_number(f[1], &hi) || lo > hi)
+      return false;
+    if (f.size() == 3) {
+      if (f[2].size() < 2 || (f[2][0] != 'x' && f[2][0] != '+'))
+        return false;
+      geometric = f[2][0] == 'x';
+      if (!parse_number(f[2].substr(1), &step))
+        return false;
+    }
+    if ((geometric && (step < 2 || lo == 0)) || (!geometric && step == 0))
+      return false;
+
+    for (uint64_t v = lo; v <= hi; v = geometric ? v * step : v + step) {
+      if (++count > MAX_SWEEP_VALUES)
+        return false;
+      values->push_back(v);
+      if ((geometric && v > hi / step) || (!geometric && v > hi - step))
+        break;
+    }
+  }
+  return !values->empty();
+}
+
+/**
+ * @brief Splits a comma separated list of names
+ * @param spec list specification
+ * @return names (empty items dropped)
+ * */
+std::vector<std::string> rvs::gemm_sweep::parse_names(const std::string& spec) {
+  std::vector<std::string> names;
+  std::stringstream ss(spec);
+  std::string item;
+
+  while (std::getline(ss, item, ',')) {
+    item = trim(item);
+    if (!item.empty())
+      names.push_back(item);
+  }
+  return names;
+}
+
+/**
+ * @brief Cartesian product of the sweep lists (m varies fastest)
+ * @return sweep points
+ * */
+std::vector<rvs::gemm_sweep::point_t> rvs::gemm_sweep::expand(
+    const std::vector<uint64_t>& m, const std::vector<uint64_t>& n,
+    const std::vector<uint64_t>& k, const std::vector<uint64_t>& trans_a,
+    const std::vector<uint64_t>& trans_b,
+    const std::vector<std::string>& dtypes,
+    const std::vector<uint64_t>& batches) {
+  std::vector<point_t> points;
+
+  for (const std::string& dt : dtypes)
+    for (uint64_t b : batches)
+      for (uint64_t ta : trans_a)
+        for (uint64_t tb : trans_b)
+          for (uint64_t kk : k)
+            for (uint64_t nn : n)
+              for (uint64_t mm : m)
+                points.push_back(point_t{mm, nn, kk, static_cast<int>(ta),
+                                         static_cast<int>(tb), dt, b});
+  return points;
+}
+
+/**
+ * @brief Bytes per element of A and B
+ * @param dtype ops_type or data_type
+ * @return element size (fractional for 6 and 4 bit types, 0 if unknown)
+ * */
+double rvs::gemm_sweep::input_bytes(const std::string& dtype) {
+  if (dtype == "fp6_e3m2_r" || dtype == "fp6_e2m3_r")
+    return 0.75;
+  if (dtype == "fp4_r")
+    return 0.5;
+
+  switch (data_class(dtype)) {
+    case dc_fp64: return 8;
+    case dc_fp32: return 4;
+    case dc_fp16: return 2;
+    case dc_fp8:
+    case dc_i8:   return 1;
+    default:      return 0;
+  }
+}
+
+/**
+ * @brief Bytes per element of C and D
+ * @param dtype ops_type or data_type
+ * @return element size (8 bit and narrower inputs accumulate to 32 bit)
+ * */
+double rvs::gemm_sweep::output_bytes(const std::string& dtype) {
+  double in = input_bytes(dtype);
+  return (in > 0 && in < 2) ? 4 : in;
+}
+
+/**
+ * @brief Arithmetic intensity of a point
+ * @param p sweep point
+ * @return flops per byte of A, B read, C read and D written (0 if unknown)
+ * */
+double rvs::gemm_sweep::intensity(const point_t& p) {
+  double in = input_bytes(p.dtype);
+  double out = output_bytes(p.dtype);
+  double m = static_cast<double>(p.m);
+  double n = static_cast<double>(p.n);
+  double k = static_cast<double>(p.k);
+  double bytes = in * (m * k + k * n) + 2 * out * m * n;
+
+  return bytes > 0 ? 2.0 * m * n * k / bytes : 0;
+}
+
+/**
+ * @brief Dense matrix engine flops per compute unit per clock
+ * @param arch GPU architecture (gcnArchName, features after ':' ignored)
+ * @param dtype ops_type or data_type
+ * @return flops per CU per clock, 0 if unknown
+ * */
+int rvs::gemm_sweep::peak_flops_per_cu_clock(const std::string& arch,
+                                             const std::string& dtype) {
+  std::string a = arch.substr(0, arch.find(':'));
+  dclass_t dc = data_class(dtype);
+
+  if (a == "gfx90a") {
+    switch (dc) {
+      case dc_fp64:
+      case dc_fp32: return 256;
+      case dc_fp16:
+      case dc_i8:   return 1024;
+      default:      return 0;
+    }
+  }
+  if (a == "gfx940" || a == "gfx941" || a == "gfx942") {
+    switch (dc) {
+      case dc_fp64:
+      case dc_fp32: return 256;
+      case dc_fp16: return 2048;
+      case dc_fp8:
+      case dc_i8:   return dtype.compare(0, 2, "mx") == 0 ? 0 : 4096;
+      default:      return 0;
+    }
+  }
+  if (a == "gfx950") {
+    switch (dc) {
+      case dc_fp64: return 128;
+      case dc_fp32: return 256;
+      case dc_fp16: return 4096;
+      case dc_fp8:
+      case dc_i8:   return 8192;
+      case dc_fp4:  return 16384;
+      default:      return 0;
+    }
+  }
+  return 0;
+}
+
+/**
+ * @brief Theoretical peak GFLOPS of a GPU for a data type
+ * @param arch GPU architecture (gcnArchName)
+ * @param cu_count number of compute units
+ * @param clock_khz peak engine clock in kHz
+ * @param dtype ops_type or data_type
+ * @return peak GFLOPS, 0 if unknown
+ * */
+double rvs::gemm_sweep::peak_gflops(const std::string& arch, int cu_count,
+                                    int clock_khz, const std::string& dtype) {
+  return static_cast<double>(peak_flops_per_cu_clock(arch, dtype)) *
+         cu_count * clock_khz / 1e6;
+}
+
+/**
+ * @brief Percentage of the peak achieved
+ * @param r point result
+ * @return efficiency in percent, negative if the peak is unknown
+ * */
+double rvs::gemm_sweep::efficiency(const result_t& r) {
+  if (!r.valid || r.peak_gflops <= 0)
+    return -1;
+  return 100.0 * r.gflops / r.peak_gflops;
+}
+
+/**
+ * @brief Formats results as a fixed width table (one line per point)
+ * @param results sweep results
+ * @return table with header line
+ * */
+std::string rvs::gemm_sweep::format_table(
+    const std::vector<result_t>& results) {
+  std::string table;
+  char line[160];
+
+  snprintf(line, sizeof(line), "%8s %8s %8s %2s %2s %-13s %6s %12s %8s %10s\n",
+           "m", "n", "k", "tA", "tB", "type", "batch", "GFLOPS", "peak%",
+           "flops/B");
+  table += line;
+
+  for (const result_t& r : results) {
+    const point_t& p = r.point;
+    char gflops[16] = "error";
+    char eff[16] = "-";
+    double e = efficiency(r);
+
+    if (r.valid)
+      snprintf(gflops, sizeof(gflops), "%.1f", r.gflops);
+    if (e >= 0)
+      snprintf(eff, sizeof(eff), "%.1f", e);
+
+    snprintf(line, sizeof(line),
+             "%8llu %8llu %8llu %2d %2d %-13s %6llu %12s %8s %10.1f\n",
+             static_cast<unsigned long long>(p.m),
+             static_cast<unsigned long long>(p.n),
+             static_cast<unsigned long long>(p.k), p.trans_a, p.trans_b,
+             p.dtype.c_str(), static_cast<unsigned long long>(p.batch),
+             gflops, eff, r.intensity);
+    table += line;
+  }
+  return table;
+}
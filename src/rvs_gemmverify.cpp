@@ -0,0 +1,372 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_gemmverify.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <utility>
+
+#include "include/rvsthreadpool.h"
+
+//! samples checked by one pool task in verify_sampled()
+#define GEMMVERIFY_SAMPLE_CHUNK 256
+
+constexpr double rvs::gemmverify::DEFAULT_CHECKSUM_TOLERANCE;
+constexpr double rvs::gemmverify::DEFAULT_SAMPLE_TOLERANCE;
+const size_t rvs::gemmverify::MAX_MISMATCHES;
+
+/**
+ * @brief Number of samples needed to detect erroneous output
+ *
+ * Returns smallest K such that probability of K random samples all missing
+ * wrong elements of an output in which error_rate fraction of elements is
+ * wrong is below 1 - confidence, i.e. (1 - error_rate)^K <= 1 - confidence.
+ *
+ * @param confidence detection probability (0..1)
+ * @param error_rate fraction of wrong elements to be detected (0..1]
+ * @param size number of output elements (upper bound for K)
+ * @return number of samples
+ *
+ * */
+uint64_t rvs::gemmverify::sample_count(double confidence, double error_rate,
+                                       uint64_t size) {
+  if (size == 0)
+    return 0;
+  if (!(confidence > 0) || !(error_rate > 0))
+    return 1;
+  if (confidence >= 1 || error_rate >= 1)
+    return confidence >= 1 ? size : 1;
+
+  double k = std::ceil(std::log1p(-confidence) / std::log1p(-error_rate));
+  if (k >= static_cast<double>(size))
+    return size;
+  return std::max(static_cast<uint64_t>(k), uint64_t(1));
+}
+
+/**
+ * @brief Sampler seed of one accuracy check
+ *
+ * Mixes the matrix seed with the check number (splitmix64 finalizer), so
+ * every check samples a different set of elements and a run replays for
+ * the same matrix seed.
+ *
+ * @param seed matrix seed
+ * @param check accuracy check number
+ * @return seed for verify_sampled()
+ *
+ * */
+uint64_t rvs::gemmverify::sample_seed(uint64_t seed, uint64_t check) {
+  uint64_t z = seed + (check + 1) * 0x9e3779b97f4a7c15ULL;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return z ^ (z >> 31);
+}
+
+/**
+ * @brief Verify randomly chosen output elements
+ *
+ * @param C GEMM input C
+ * @param D GEMM output (may be the same layout as C)
+ * @param samples number of elements to check
+ * @param seed random generator seed
+ * @param tolerance threshold in units of epsilon * sqrt(k)
+ * @param pmismatches [out] locations of wrong elements (up to MAX_MISMATCHES)
+ * @return max normalized deviation of wrong elements, 0 if none
+ *
+ * */
+template <typename T>
+double rvs::gemmverify::verify_sampled(int64_t m, int64_t n, int64_t k,
+    double alpha, const T* A, int64_t As1, int64_t As2,
+    const T* B, int64_t Bs1, int64_t Bs2, double beta,
+    const T* C, int64_t Cs1, int64_t Cs2,
+    const T* D, int64_t Ds1, int64_t Ds2, uint64_t samples, uint64_t seed,
+    double tolerance, std::vector<mismatch_t>* pmismatches) {
+  double threshold = tolerance * std::numeric_limits<T>::epsilon() *
+                     std::sqrt(static_cast<double>(std::max(k, int64_t(1))));
+  double max_error = 0;
+  std::mt19937_64 gen(seed);
+
+  if (pmismatches)
+    pmismatches->clear();
+  if (m <= 0 || n <= 0 || samples == 0)
+    return 0;
+
+  // positions are drawn up front so the result does not depend on how the
+  // samples are split between pool tasks
+  std::vector<std::pair<int64_t, int64_t>> pos(samples);
+  for (auto& ij : pos) {
+    ij.first = static_cast<int64_t>(gen() % static_cast<uint64_t>(m));
+    ij.second = static_cast<int64_t>(gen() % static_cast<uint64_t>(n));
+  }
+
+  size_t nchunks = (samples + GEMMVERIFY_SAMPLE_CHUNK - 1) /
+                   GEMMVERIFY_SAMPLE_CHUNK;
+  std::vector<double> chunk_error(nchunks, 0);
+  std::vector<std::vector<mismatch_t>> chunk_mismatches(nchunks);
+
+  auto check_chunk = [&](size_t c) {
+    uint64_t first = c * GEMMVERIFY_SAMPLE_CHUNK;
+    uint64_t last = std::min<uint64_t>(samples,
+                                       first + GEMMVERIFY_SAMPLE_CHUNK);
+
+    for (uint64_t s = first; s < last; s++) {
+      int64_t i = pos[s].first;
+      int64_t j = pos[s].second;
+      double dot = 0;
+      double dot_abs = 0;
+
+      for (int64_t p = 0; p < k; p++) {
+        double t = static_cast<double>(A[i * As1 + p * As2]) *
+                   static_cast<double>(B[p * Bs1 + j * Bs2]);
+        dot += t;
+        dot_abs += std::fabs(t);
+      }
+
+      double ref = alpha * dot;
+      double scale = std::fabs(alpha) * dot_abs;
+      if (beta != 0) {
+        double c_ij = static_cast<double>(C[i * Cs1 + j * Cs2]);
+        ref += beta * c_ij;
+        scale += std::fabs(beta * c_ij);
+      }
+
+      double diff = std::fabs(static_cast<double>(D[i * Ds1 + j * Ds2]) - ref);
+      double dev = scale > 0 ? diff / scale : diff;
+      if (dev <= threshold)
+        continue;
+
+      // also NaN
+      if (!(dev <= std::numeric_limits<double>::max()))
+        dev = std::numeric_limits<double>::infinity();
+      chunk_error[c] = std::max(chunk_error[c], dev);
+      if (chunk_mismatches[c].size() < MAX_MISMATCHES)
+        chunk_mismatches[c].push_back(mismatch_t{i, j, dev});
+    }
+  };
+
+  // chunks run as short pool tasks; the caller takes the first one
+  rvs::TaskGroup group;
+  for (size_t c = 1; c < nchunks; c++) {
+    group.run([&check_chunk, c]() { check_chunk(c); });
+  }
+  check_chunk(0);
+  group.wait();
+
+  // merge in sample order
+  for (size_t c = 0; c < nchunks; c++) {
+    max_error = std::max(max_error, chunk_error[c]);
+    for (const auto& mm : chunk_mismatches[c]) {
+      if (pmismatches && pmismatches->size() < MAX_MISMATCHES)
+        pmismatches->push_back(mm);
+    }
+  }
+
+  return max_error;
+}
+
+/**
+ * @brief Compute predicted row and column sums of GEMM output
+ *
+ * Needs to be called again only when A, B, C, alpha or beta change.
+ *
+ * @param psums [out] predicted sums
+ *
+ * */
+template <typename T>
+void rvs::gemmverify::checksum_prepare(int64_t m, int64_t n, int64_t k,
+    double alpha, const T* A, int64_t As1, int64_t As2,
+    const T* B, int64_t Bs1, int64_t Bs2, double beta,
+    const T* C, int64_t Cs1, int64_t Cs2, checksums_t* psums) {
+  std::vector<double> a_col(k, 0), a_col_abs(k, 0);
+  std::vector<double> b_row(k, 0), b_row_abs(k, 0);
+
+  psums->col.assign(n, 0);
+  psums->col_abs.assign(n, 0);
+  psums->row.assign(m, 0);
+  psums->row_abs.assign(m, 0);
+
+  // e'A and Be
+  #pragma omp parallel for
+  for (int64_t p = 0; p < k; p++) {
+    for (int64_t i = 0; i < m; i++) {
+      double a = static_cast<double>(A[i * As1 + p * As2]);
+      a_col[p] += a;
+      a_col_abs[p] += std::fabs(a);
+    }
+    for (int64_t j = 0; j < n; j++) {
+      double b = static_cast<double>(B[p * Bs1 + j * Bs2]);
+      b_row[p] += b;
+      b_row_abs[p] += std::fabs(b);
+    }
+  }
+
+  // column sums: alpha (e'A) B + beta e'C
+  #pragma omp parallel for
+  for (int64_t j = 0; j < n; j++) {
+    double s = 0;
+    double s_abs = 0;
+    for (int64_t p = 0; p < k; p++) {
+      double b = static_cast<double>(B[p * Bs1 + j * Bs2]);
+      s += a_col[p] * b;
+      s_abs += a_col_abs[p] * std::fabs(b);
+    }
+    psums->col[j] = alpha * s;
+    psums->col_abs[j] = std::fabs(alpha) * s_abs;
+
+    if (beta != 0) {
+      for (int64_t i = 0; i < m; i++) {
+        double c = static_cast<double>(C[i * Cs1 + j * Cs2]);
+        psums->col[j] += beta * c;
+        psums->col_abs[j] += std::fabs(beta * c);
+      }
+    }
+  }
+
+  // row sums: alpha A (Be) + beta Ce
+  #pragma omp parallel for
+  for (int64_t i = 0; i < m; i++) {
+    double s = 0;
+    double s_abs = 0;
+    for (int64_t p = 0; p < k; p++) {
+      double a = static_cast<double>(A[i * As1 + p * As2]);
+      s += a * b_row[p];
+      s_abs += std::fabs(a) * b_row_abs[p];
+    }
+    psums->row[i] = alpha * s;
+    psums->row_abs[i] = std::fabs(alpha) * s_abs;
+
+    if (beta != 0) {
+      for (int64_t j = 0; j < n; j++) {
+        double c = static_cast<double>(C[i * Cs1 + j * Cs2]);
+        psums->row[i] += beta * c;
+        psums->row_abs[i] += std::fabs(beta * c);
+      }
+    }
+  }
+}
+
+/**
+ * @brief Verify GEMM output against predicted row and column sums
+ *
+ * Wrong elements are located at intersections of mismatching rows and
+ * columns. If only rows (columns) mismatch, column (row) is reported as -1.
+ *
+ * @param sums predicted sums from checksum_prepare()
+ * @param D GEMM output
+ * @param tolerance threshold in units of epsilon
+ * @param pmismatches [out] locations of wrong elements (up to MAX_MISMATCHES)
+ * @return max normalized deviation of row/column sums, 0 if none
+ *
+ * */
+template <typename T>
+double rvs::gemmverify::verify_checksum(const checksums_t& sums,
+    const T* D, int64_t Ds1, int64_t Ds2, double tolerance,
+    std::vector<mismatch_t>* pmismatches) {
+  int64_t m = sums.row.size();
+  int64_t n = sums.col.size();
+  double threshold = tolerance * std::numeric_limits<T>::epsilon();
+  std::vector<double> col(n, 0), row(m, 0);
+  std::vector<std::pair<int64_t, double>> bad_rows, bad_cols;
+  double max_error = 0;
+
+  if (pmismatches)
+    pmismatches->clear();
+
+  for (int64_t j = 0; j < n; j++) {
+    double s = 0;
+    for (int64_t i = 0; i < m; i++) {
+      double d = static_cast<double>(D[i * Ds1 + j * Ds2]);
+      s += d;
+      row[i] += d;
+    }
+    col[j] = s;
+  }
+
+  auto deviation = [](double got, double expected, double scale) {
+    double diff = std::fabs(got - expected);
+    double dev = scale > 0 ? diff / scale : diff;
+    if (!(dev <= std::numeric_limits<double>::max()))
+      dev = std::numeric_limits<double>::infinity();
+    return dev;
+  };
+
+  for (int64_t j = 0; j < n; j++) {
+    double dev = deviation(col[j], sums.col[j], sums.col_abs[j]);
+    if (dev > threshold)
+      bad_cols.push_back(std::make_pair(j, dev));
+  }
+  for (int64_t i = 0; i < m; i++) {
+    double dev = deviation(row[i], sums.row[i], sums.row_abs[i]);
+    if (dev > threshold)
+      bad_rows.push_back(std::make_pair(i, dev));
+  }
+
+  for (auto& c : bad_cols)
+    max_error = std::max(max_error, c.second);
+  for (auto& r : bad_rows)
+    max_error = std::max(max_error, r.second);
+
+  if (pmismatches) {
+    if (!bad_rows.empty() && !bad_cols.empty()) {
+      for (auto& r : bad_rows) {
+        for (auto& c : bad_cols) {
+          if (pmismatches->size() >= MAX_MISMATCHES)
+            break;
+          pmismatches->push_back(mismatch_t{r.first, c.first,
+                                            std::max(r.second, c.second)});
+        }
+      }
+    } else {
+      for (auto& r : bad_rows) {
+        if (pmismatches->size() >= MAX_MISMATCHES)
+          break;
+        pmismatches->push_back(mismatch_t{r.first, -1, r.second});
+      }
+      for (auto& c : bad_cols) {
+        if (pmismatches->size() >= MAX_MISMATCHES)
+          break;
+        pmismatches->push_back(mismatch_t{-1, c.first, c.second});
+      }
+    }
+  }
+
+  return max_error;
+}
+
+#define RVS_GEMMVERIFY_INSTANTIATE(T) \
+  template double rvs::gemmverify::verify_sampled<T>(int64_t, int64_t, \
+    int64_t, double, const T*, int64_t, int64_t, const T*, int64_t, \
+    int64_t, double, const T*, int64_t, int64_t, const T*, int64_t, \
+    int64_t, uint64_t, uint64_t, double, std::vector<mismatch_t>*); \
+  template void rvs::gemmverify::checksum_prepare<T>(int64_t, int64_t, \
+    int64_t, double, const T*, int64_t, int64_t, const T*, int64_t, \
+    int64_t, double, const T*, int64_t, int64_t, checksums_t*); \
+  template double rvs::gemmverify::verify_checksum<T>(const checksums_t&, \
+    const T*, int64_t, int64_t, double, std::vector<mismatch_t>*);
+
+RVS_GEMMVERIFY_INSTANTIATE(float)
+RVS_GEMMVERIFY_INSTANTIATE(double)
@@ -0,0 +1,415 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_hostgemm.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <cstring>
+
+//! default size limit of the temporary accumulation panel (32 MiB)
+#define HOSTGEMM_PANEL_BYTES (size_t(32) << 20)
+
+int rvs::hostgemm::forced_isa = -1;
+std::atomic<int> rvs::hostgemm::concurrency{1};
+std::atomic<int> rvs::hostgemm::active{0};
+size_t rvs::hostgemm::panel_bytes = HOSTGEMM_PANEL_BYTES;
+
+namespace {
+
+/**
+ * @brief Micro-kernel and blocking parameters
+ *
+ * The micro-kernel computes MR x NR tile of op(A) * op(B) from packed MR-row
+ * sliver of op(A) and NR-column sliver of op(B) of length kc and stores it
+ * column major (leading dimension MR) into c.
+ *
+ */
+template <typename T>
+struct ukernel {
+  //! rows of C tile
+  int64_t mr;
+  //! columns of C tile
+  int64_t nr;
+  //! rows of op(A) block packed per task (multiple of mr)
+  int64_t mc;
+  //! depth of packed panels
+  int64_t kc;
+  //! columns of op(B) panel packed per iteration (multiple of nr)
+  int64_t nc;
+  //! micro-kernel
+  void (*fn)(int64_t kc, const T* a, const T* b, T* c);
+};
+
+//! Portable micro-kernel (vectorized by the compiler for the base ISA)
+template <typename T, int MR, int NR>
+void ukernel_generic(int64_t kc, const T* a, const T* b, T* c) {
+  T acc[NR][MR] = {};
+
+  for (int64_t p = 0; p < kc; p++) {
+    for (int j = 0; j < NR; j++) {
+      T bj = b[j];
+      for (int r = 0; r < MR; r++)
+        acc[j][r] += a[r] * bj;
+    }
+    a += MR;
+    b += NR;
+  }
+  memcpy(c, acc, sizeof(acc));
+}
+
+#if defined(__x86_64__)
+
+//! AVX2/FMA float micro-kernel, 16 x 6 tile
+__attribute__((target("avx2,fma")))
+void ukernel_f32_avx2(int64_t kc, const float* a, const float* b, float* c) {
+  __m256 acc[6][2];
+
+#pragma GCC unroll 6
+  for (int j = 0; j < 6; j++) {
+    acc[j][0] = _mm256_setzero_ps();
+    acc[j][1] = _mm256_setzero_ps();
+  }
+  for (int64_t p = 0; p < kc; p++) {
+    __m256 a0 = _mm256_loadu_ps(a);
+    __m256 a1 = _mm256_loadu_ps(a + 8);
+#pragma GCC unroll 6
+    for (int j = 0; j < 6; j++) {
+      __m256 bj = _mm256_broadcast_ss(b + j);
+      acc[j][0] = _mm256_fmadd_ps(a0, bj, acc[j][0]);
+      acc[j][1] = _mm256_fmadd_ps(a1, bj, acc[j][1]);
+    }
+    a += 16;
+    b += 6;
+  }
+#pragma GCC unroll 6
+  for (int j = 0; j < 6; j++) {
+    _mm256_storeu_ps(c + j * 16, acc[j][0]);
+    _mm256_storeu_ps(c + j * 16 + 8, acc[j][1]);
+  }
+}
+
+//! AVX2/FMA double micro-kernel, 8 x 6 tile
+__attribute__((target("avx2,fma")))
+void ukernel_f64_avx2(int64_t kc, const double* a, const double* b,
+                      double* c) {
+  __m256d acc[6][2];
+
+#pragma GCC unroll 6
+  for (int j = 0; j < 6; j++) {
+    acc[j][0] = _mm256_setzero_pd();
+    acc[j][1] = _mm256_setzero_pd();
+  }
+  for (int64_t p = 0; p < kc; p++) {
+    __m256d a0 = _mm256_loadu_pd(a);
+    __m256d a1 = _mm256_loadu_pd(a + 4);
+#pragma GCC unroll 6
+    for (int j = 0; j < 6; j++) {
+      __m256d bj = _mm256_broadcast_sd(b + j);
+      acc[j][0] = _mm256_fmadd_pd(a0, bj, acc[j][0]);
+      acc[j][1] = _mm256_fmadd_pd(a1, bj, acc[j][1]);
+    }
+    a += 8;
+    b += 6;
+  }
+#pragma GCC unroll 6
+  for (int j = 0; j < 6; j++) {
+    _mm256_storeu_pd(c + j * 8, acc[j][0]);
+    _mm256_storeu_pd(c + j * 8 + 4, acc[j][1]);
+  }
+}
+
+//! AVX-512 float micro-kernel, 32 x 12 tile
+__attribute__((target("avx512f")))
+void ukernel_f32_avx512(int64_t kc, const float* a, const float* b,
+                        float* c) {
+  __m512 acc[12][2];
+
+#pragma GCC unroll 12
+  for (int j = 0; j < 12; j++) {
+    acc[j][0] = _mm512_setzero_ps();
+    acc[j][1] = _mm512_setzero_ps();
+  }
+  for (int64_t p = 0; p < kc; p++) {
+    __m512 a0 = _mm512_loadu_ps(a);
+    __m512 a1 = _mm512_loadu_ps(a + 16);
+#pragma GCC unroll 12
+    for (int j = 0; j < 12; j++) {
+      __m512 bj = _mm512_set1_ps(b[j]);
+      acc[j][0] = _mm512_fmadd_ps(a0, bj, acc[j][0]);
+      acc[j][1] = _mm512_fmadd_ps(a1, bj, acc[j][1]);
+    }
+    a += 32;
+    b += 12;
+  }
+#pragma GCC unroll 12
+  for (int j = 0; j < 12; j++) {
+    _mm512_storeu_ps(c + j * 32, acc[j][0]);
+    _mm512_storeu_ps(c + j * 32 + 16, acc[j][1]);
+  }
+}
+
+//! AVX-512 double micro-kernel, 16 x 12 tile
+__attribute__((target("avx512f")))
+void ukernel_f64_avx512(int64_t kc, const double* a, const double* b,
+                        double* c) {
+  __m512d acc[12][2];
+
+#pragma GCC unroll 12
+  for (int j = 0; j < 12; j++) {
+    acc[j][0] = _mm512_setzero_pd();
+    acc[j][1] = _mm512_setzero_pd();
+  }
+  for (int64_t p = 0; p < kc; p++) {
+    __m512d a0 = _mm512_loadu_pd(a);
+    __m512d a1 = _mm512_loadu_pd(a + 8);
+#pragma GCC unroll 12
+    for (int j = 0; j < 12; j++) {
+      __m512d bj = _mm512_set1_pd(b[j]);
+      acc[j][0] = _mm512_fmadd_pd(a0, bj, acc[j][0]);
+      acc[j][1] = _mm512_fmadd_pd(a1, bj, acc[j][1]);
+    }
+    a += 16;
+    b += 12;
+  }
+#pragma GCC unroll 12
+  for (int j = 0; j < 12; j++) {
+    _mm512_storeu_pd(c + j * 16, acc[j][0]);
+    _mm512_storeu_pd(c + j * 16 + 8, acc[j][1]);
+  }
+}
+
+#endif  // __x86_64__
+
+//! Select micro-kernel and blocking for accumulation type and ISA
+template <typename T>
+ukernel<T> select_ukernel(rvs::hostgemm::isa_t isa);
+
+template <>
+ukernel<float> select_ukernel<float>(rvs::hostgemm::isa_t isa) {
+#if defined(__x86_64__)
+  if (isa == rvs::hostgemm::isa_avx512)
+    return ukernel<float>{32, 12, 32 * 8, 384, 12 * 340, ukernel_f32_avx512};
+  if (isa == rvs::hostgemm::isa_avx2)
+    return ukernel<float>{16, 6, 16 * 12, 384, 6 * 680, ukernel_f32_avx2};
+#endif
+  return ukernel<float>{8, 4, 8 * 16, 256, 4 * 1024,
+                        ukernel_generic<float, 8, 4>};
+}
+
+template <>
+ukernel<double> select_ukernel<double>(rvs::hostgemm::isa_t isa) {
+#if defined(__x86_64__)
+  if (isa == rvs::hostgemm::isa_avx512)
+    return ukernel<double>{16, 12, 16 * 8, 256, 12 * 340, ukernel_f64_avx512};
+  if (isa == rvs::hostgemm::isa_avx2)
+    return ukernel<double>{8, 6, 8 * 12, 256, 6 * 680, ukernel_f64_avx2};
+#endif
+  return ukernel<double>{4, 4, 4 * 24, 256, 4 * 1024,
+                         ukernel_generic<double, 4, 4>};
+}
+
+}  // namespace
+
+/**
+ * @brief Detect best micro-kernel ISA supported by CPU and OS
+ *
+ * @return ISA
+ *
+ * */
+rvs::hostgemm::isa_t rvs::hostgemm::detect_isa() {
+#if defined(__x86_64__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    return isa_avx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return isa_avx2;
+#endif
+  return isa_generic;
+}
+
+//! Returns ISA used by micro-kernels (forced or detected)
+rvs::hostgemm::isa_t rvs::hostgemm::get_isa() {
+  static const isa_t detected = detect_isa();
+
+  if (forced_isa >= 0 && forced_isa <= detected)
+    return static_cast<isa_t>(forced_isa);
+  return detected;
+}
+
+/**
+ * @brief Force micro-kernel ISA (e.g. for testing or benchmarking)
+ *
+ * ISA not supported by CPU is ignored in favor of the detected one.
+ *
+ * @param isa ISA to use
+ *
+ * */
+void rvs::hostgemm::set_isa(isa_t isa) {
+  forced_isa = static_cast<int>(isa);
+}
+
+//! Returns ISA name
+const char* rvs::hostgemm::isa_name(isa_t isa) {
+  switch (isa) {
+    case isa_avx512:
+      return "avx512";
+    case isa_avx2:
+      return "avx2";
+    default:
+      return "generic";
+  }
+}
+
+/**
+ * @brief Resolve number of threads to use
+ *
+ * By default the OpenMP threads are split evenly between the host GEMMs
+ * expected to run concurrently or actually running, so that e.g. eight GPU
+ * workers verifying at the same time do not each use every core.
+ *
+ * @param threads requested number of threads (0 - share of OpenMP default)
+ * @return number of threads
+ *
+ * */
+int rvs::hostgemm::get_threads(int threads) {
+  if (threads > 0)
+    return threads;
+#ifdef _OPENMP
+  int share = std::max(concurrency.load(), active.load());
+  return std::max(1, omp_get_max_threads() / std::max(1, share));
+#else
+  return 1;
+#endif
+}
+
+/**
+ * @brief Set number of host GEMMs expected to run concurrently
+ *
+ * @param workers number of concurrent callers (e.g. GPU workers), 0 or 1
+ * for none
+ *
+ * */
+void rvs::hostgemm::set_concurrency(int workers) {
+  concurrency = std::max(1, workers);
+}
+
+/**
+ * @brief Set size limit of the temporary accumulation panel
+ *
+ * @param bytes panel size in bytes (0 - default)
+ *
+ * */
+void rvs::hostgemm::set_panel_bytes(size_t bytes) {
+  panel_bytes = bytes ? bytes : HOSTGEMM_PANEL_BYTES;
+}
+
+template <typename Tacc>
+void rvs::hostgemm::gemm_packed(int64_t m, int64_t n, int64_t k, Tacc alpha,
+                                const pack_fn_t<Tacc>& pack_a,
+                                const pack_fn_t<Tacc>& pack_b,
+                                Tacc* C, int64_t Cs1, int64_t Cs2,
+                                int threads) {
+  const ukernel<Tacc> uk = select_ukernel<Tacc>(get_isa());
+  const int64_t mr = uk.mr;
+  const int64_t nr = uk.nr;
+
+  if (m <= 0 || n <= 0 || k <= 0 || alpha == 0)
+    return;
+
+  int nthreads = get_threads(threads);
+  int64_t mblocks = (m + uk.mc - 1) / uk.mc;
+  std::vector<Tacc> bpack(uk.kc * ((std::min(uk.nc, n) + nr - 1) / nr) * nr);
+
+  for (int64_t jc = 0; jc < n; jc += uk.nc) {
+    int64_t nc = std::min(uk.nc, n - jc);
+    int64_t nslivers = (nc + nr - 1) / nr;
+
+    // split columns of the panel between threads when op(A) has too few
+    // row blocks to keep all threads busy
+    int64_t nsplit = std::max(int64_t(1), std::min(nslivers,
+      static_cast<int64_t>(nthreads) / mblocks));
+    int64_t ntasks = mblocks * nsplit;
+
+    for (int64_t pc = 0; pc < k; pc += uk.kc) {
+      int64_t kc = std::min(uk.kc, k - pc);
+
+      #pragma omp parallel for num_threads(nthreads)
+      for (int64_t s = 0; s < nslivers; s++) {
+        pack_b(jc + s * nr, nr, pc, kc, nr, bpack.data() + s * nr * kc);
+      }
+
+      #pragma omp parallel num_threads(nthreads)
+      {
+        std::vector<Tacc> apack(uk.mc * kc);
+        Tacc tile[32 * 12];
+        int64_t packed_block = -1;
+
+        #pragma omp for schedule(dynamic)
+        for (int64_t t = 0; t < ntasks; t++) {
+          int64_t ib = t / nsplit;
+          int64_t ic = ib * uk.mc;
+          int64_t mc = std::min(uk.mc, m - ic);
+          int64_t s0 = nslivers * (t % nsplit) / nsplit;
+          int64_t s1 = nslivers * (t % nsplit + 1) / nsplit;
+
+          if (packed_block != ib) {
+            pack_a(ic, mc, pc, kc, mr, apack.data());
+            packed_block = ib;
+          }
+
+          for (int64_t s = s0; s < s1; s++) {
+            int64_t j0 = jc + s * nr;
+            int64_t nv = std::min(nr, n - j0);
+            const Tacc* bp = bpack.data() + s * nr * kc;
+
+            for (int64_t ir = 0; ir < mc; ir += mr) {
+              int64_t mv = std::min(mr, mc - ir);
+              uk.fn(kc, apack.data() + ir * kc, bp, tile);
+
+              for (int64_t j = 0; j < nv; j++) {
+                Tacc* c = C + (ic + ir) * Cs1 + (j0 + j) * Cs2;
+                for (int64_t i = 0; i < mv; i++)
+                  c[i * Cs1] += alpha * tile[j * mr + i];
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+template void rvs::hostgemm::gemm_packed<float>(int64_t, int64_t, int64_t,
+  float, const pack_fn_t<float>&, const pack_fn_t<float>&, float*, int64_t,
+  int64_t, int);
+template void rvs::hostgemm::gemm_packed<double>(int64_t, int64_t, int64_t,
+  double, const pack_fn_t<double>&, const pack_fn_t<double>&, double*,
+  int64_t, int64_t, int);
@@ -0,0 +1,602 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_lpconv.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#include "include/rvs_hostgemm.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+//! minifloat encoding (fp16, bf16 and fp8 formats)
+struct mini_t {
+  //! mantissa bits
+  int32_t man;
+  //! exponent bias
+  int32_t bias;
+  //! largest finite magnitude code
+  uint32_t max_code;
+  //! Inf magnitude code (0 - no Inf, NaN uses nan_code)
+  uint32_t inf_code;
+  //! NaN code for formats without Inf
+  uint32_t nan_code;
+  //! position of the sign bit
+  int32_t sign_bit;
+  //! no negative zero, 0x80 is the only NaN (0 or 1)
+  uint32_t fnuz;
+};
+
+const mini_t mini_f16 = {10, 15, 0x7bff, 0x7c00, 0, 15, false};
+const mini_t mini_bf16 = {7, 127, 0x7f7f, 0x7f80, 0, 15, false};
+const mini_t mini_e4m3 = {3, 7, 0x7e, 0, 0x7f, 7, false};
+const mini_t mini_e5m2 = {2, 15, 0x7b, 0x7c, 0, 7, false};
+const mini_t mini_e4m3_fnuz = {3, 8, 0x7f, 0, 0x80, 7, true};
+const mini_t mini_e5m2_fnuz = {2, 16, 0x7f, 0, 0x80, 7, true};
+
+const mini_t* mini_desc(rvs::lpconv::format_t fmt) {
+  switch (fmt) {
+    case rvs::lpconv::fmt_f16:
+      return &mini_f16;
+    case rvs::lpconv::fmt_bf16:
+      return &mini_bf16;
+    case rvs::lpconv::fmt_e4m3:
+      return &mini_e4m3;
+    case rvs::lpconv::fmt_e5m2:
+      return &mini_e5m2;
+    case rvs::lpconv::fmt_e4m3_fnuz:
+      return &mini_e4m3_fnuz;
+    case rvs::lpconv::fmt_e5m2_fnuz:
+      return &mini_e5m2_fnuz;
+    default:
+      return nullptr;
+  }
+}
+
+//! selects a where mask is all ones, b where it is zero
+__attribute__((always_inline))
+inline uint32_t select(uint32_t mask, uint32_t a, uint32_t b) {
+  return (a & mask) | (b & ~mask);
+}
+
+//! all ones if c is true
+__attribute__((always_inline))
+inline uint32_t mask_of(bool c) {
+  return -static_cast<uint32_t>(c);
+}
+
+/**
+ * @brief Encodes float bits to minifloat (branch free, vectorizable)
+ *
+ * The float significand (with implicit bit) is shifted right so that its
+ * last bit has the weight of the target quantum at the value's exponent,
+ * which is fixed below the smallest normal (subnormals). Adding the biased
+ * exponent to the rounded significand lets a rounding carry move into the
+ * exponent field by itself.
+ *
+ */
+__attribute__((always_inline))
+inline uint32_t encode_mini(uint32_t u, const mini_t& f, bool rtz, bool sat) {
+  uint32_t sign = u >> 31;
+  uint32_t a = u & 0x7fffffff;
+  int32_t ef = static_cast<int32_t>(a >> 23);
+  uint32_t m = (a & 0x7fffff) | select(mask_of(ef != 0), 0x800000, 0);
+  int32_t e = std::max(ef, 1) - 127;
+  int32_t s = std::min((23 - f.man) + std::max(1 - f.bias - e, 0), 31);
+
+  uint32_t q = m >> s;
+  uint32_t rem = m & ((1u << s) - 1);
+  uint32_t half = 1u << (s - 1);
+  q += ((rem > half) | ((rem == half) & q)) & 1 & !rtz;
+  uint32_t out = (static_cast<uint32_t>(std::max(e + f.bias - 1, 0)) << f.man)
+                 + q;
+
+  uint32_t inf = mask_of(a == 0x7f800000);
+  uint32_t nan = mask_of(a > 0x7f800000);
+  uint32_t ovf = mask_of(out > f.max_code) | inf;
+
+  // overflow: round toward zero stops at the largest finite value, round to
+  // nearest goes to Inf (NaN for formats without Inf) unless saturating
+  uint32_t big = select(mask_of(f.inf_code != 0), f.inf_code, f.nan_code);
+  uint32_t to_max = mask_of(sat) | (mask_of(rtz) & ~inf);
+  out = select(ovf, select(to_max, f.max_code, big), out);
+
+  // NaN keeps the upper payload bits and is made quiet
+  uint32_t payload = f.inf_code | (1u << (f.man - 1)) |
+                     ((a & 0x7fffff) >> (23 - f.man));
+  out = select(nan, select(mask_of(f.inf_code != 0), payload, f.nan_code),
+               out);
+
+  // fnuz: no negative zero, NaN is unsigned
+  uint32_t unsigned_code = mask_of(f.fnuz) &
+                           mask_of(out == 0 || out == f.nan_code);
+  return out | (~unsigned_code & (sign << f.sign_bit));
+}
+
+//! Decodes minifloat bits to float
+float decode_mini(uint32_t c, const mini_t& f) {
+  uint32_t mag = c & ((1u << f.sign_bit) - 1);
+  float sign = (c >> f.sign_bit) & 1 ? -1.0f : 1.0f;
+  uint32_t mant = mag & ((1u << f.man) - 1);
+  int exp = static_cast<int>(mag >> f.man);
+
+  if (f.fnuz && c == f.nan_code)
+    return std::numeric_limits<float>::quiet_NaN();
+  if (f.inf_code && mag >= f.inf_code) {
+    return mag == f.inf_code ? sign * std::numeric_limits<float>::infinity()
+                             : std::numeric_limits<float>::quiet_NaN();
+  }
+  if (!f.inf_code && !f.fnuz && mag == f.nan_code)
+    return std::numeric_limits<float>::quiet_NaN();
+  if (exp == 0)
+    return sign * std::ldexp(static_cast<float>(mant), 1 - f.bias - f.man);
+  return sign * std::ldexp(static_cast<float>(mant | (1u << f.man)),
+                           exp - f.bias - f.man);
+}
+
+//! Converts half bits to float (bit arithmetic)
+__attribute__((always_inline))
+inline float f16_bits_to_float(uint16_t h) {
+  uint32_t sign = uint32_t(h & 0x8000) << 16;
+  uint32_t em = h & 0x7fff;
+
+  // rebias exponent by scaling (handles subnormals too)
+  uint32_t bits = std::bit_cast<uint32_t>(
+      std::bit_cast<float>(em << 13) * 0x1p112f);
+  bits = select(mask_of(em >= 0x7c00), (em << 13) | 0x7f800000, bits);
+  return std::bit_cast<float>(bits | sign);
+}
+
+//! Rounds float to int8 (clamped, NaN to 0), integer arithmetic only
+__attribute__((always_inline))
+inline int8_t encode_i8(float x, bool rtz) {
+  uint32_t u = std::bit_cast<uint32_t>(x);
+  uint32_t a = u & 0x7fffffff;
+  int32_t ef = static_cast<int32_t>(a >> 23);
+  uint32_t m = (a & 0x7fffff) | select(mask_of(ef != 0), 0x800000, 0);
+  int32_t s = std::min(std::max(150 - std::max(ef, 1), 1), 31);
+
+  uint32_t q = m >> s;
+  uint32_t rem = m & ((1u << s) - 1);
+  uint32_t half = 1u << (s - 1);
+  q += ((rem > half) | ((rem == half) & q)) & 1 & !rtz;
+  q = std::min(q, 127u + (u >> 31));
+  q = select(mask_of(a > 0x7f800000), 0, q);
+  return static_cast<int8_t>(select(mask_of(u >> 31), -q, q));
+}
+
+//! conversion loops (inlined into one kernel per ISA)
+struct op_f16_to_float {
+  __attribute__((always_inline))
+  static inline void run(const uint16_t* s, float* d, size_t n) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++)
+      d[i] = f16_bits_to_float(s[i]);
+  }
+};
+
+struct op_bf16_to_float {
+  __attribute__((always_inline))
+  static inline void run(const uint16_t* s, float* d, size_t n) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++)
+      d[i] = std::bit_cast<float>(uint32_t(s[i]) << 16);
+  }
+};
+
+struct op_lut_to_float {
+  __attribute__((always_inline))
+  static inline void run(const uint8_t* s, float* d, size_t n,
+                         const float* lut) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++)
+      d[i] = lut[s[i]];
+  }
+};
+
+struct op_i8_to_float {
+  __attribute__((always_inline))
+  static inline void run(const int8_t* s, float* d, size_t n) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++)
+      d[i] = s[i];
+  }
+};
+
+template <typename T>
+struct op_to_mini {
+  __attribute__((always_inline))
+  static inline void run(const float* s, T* d, size_t n, const mini_t* f,
+                         bool rtz, bool sat) {
+    const mini_t c = *f;
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++)
+      d[i] = static_cast<T>(encode_mini(std::bit_cast<uint32_t>(s[i]), c,
+                                        rtz, sat));
+  }
+};
+
+struct op_to_i8 {
+  __attribute__((always_inline))
+  static inline void run(const float* s, int8_t* d, size_t n, bool rtz) {
+    #pragma omp simd
+    for (size_t i = 0; i < n; i++)
+      d[i] = encode_i8(s[i], rtz);
+  }
+};
+
+template <typename Op, typename... Args>
+void run_generic(Args... args) {
+  Op::run(args...);
+}
+
+#if defined(__x86_64__)
+
+template <typename Op, typename... Args>
+__attribute__((target("avx2,fma")))
+void run_avx2(Args... args) {
+  Op::run(args...);
+}
+
+template <typename Op, typename... Args>
+__attribute__((target("avx512f,avx512bw")))
+void run_avx512(Args... args) {
+  Op::run(args...);
+}
+
+#endif
+
+//! conversion routines of one ISA
+struct kernels_t {
+  void (*f16_to_float)(const uint16_t*, float*, size_t);
+  void (*bf16_to_float)(const uint16_t*, float*, size_t);
+  void (*lut_to_float)(const uint8_t*, float*, size_t, const float*);
+  void (*i8_to_float)(const int8_t*, float*, size_t);
+  void (*to_mini16)(const float*, uint16_t*, size_t, const mini_t*, bool,
+                    bool);
+  void (*to_mini8)(const float*, uint8_t*, size_t, const mini_t*, bool, bool);
+  void (*to_i8)(const float*, int8_t*, size_t, bool);
+};
+
+//! kernels_t of ISA (Run is run_generic, run_avx2 or run_avx512)
+#define LPCONV_KERNELS(Run) {                                               \
+    Run<op_f16_to_float, const uint16_t*, float*, size_t>,                  \
+    Run<op_bf16_to_float, const uint16_t*, float*, size_t>,                 \
+    Run<op_lut_to_float, const uint8_t*, float*, size_t, const float*>,     \
+    Run<op_i8_to_float, const int8_t*, float*, size_t>,                     \
+    Run<op_to_mini<uint16_t>, const float*, uint16_t*, size_t,              \
+        const mini_t*, bool, bool>,                                         \
+    Run<op_to_mini<uint8_t>, const float*, uint8_t*, size_t,                \
+        const mini_t*, bool, bool>,                                         \
+    Run<op_to_i8, const float*, int8_t*, size_t, bool> }
+
+#if defined(__x86_64__)
+
+//! fp16 to float with F16C
+__attribute__((target("avx,f16c")))
+void f16_to_float_f16c(const uint16_t* s, float* d, size_t n) {
+  size_t i = 0;
+
+  for (; i + 8 <= n; i += 8) {
+    __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+    _mm256_storeu_ps(d + i, _mm256_cvtph_ps(h));
+  }
+  for (; i < n; i++)
+    d[i] = f16_bits_to_float(s[i]);
+}
+
+//! float to fp16 with F16C (saturation clamps before conversion)
+template <int Round>
+__attribute__((target("avx,f16c")))
+void float_to_f16_f16c(const float* s, uint16_t* d, size_t n, bool sat) {
+  const __m256 max = _mm256_set1_ps(65504.0f);
+  const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  const bool rtz = Round == _MM_FROUND_TO_ZERO;
+  size_t i = 0;
+
+  for (; i + 8 <= n; i += 8) {
+    __m256 x = _mm256_loadu_ps(s + i);
+    if (sat) {
+      __m256 a = _mm256_and_ps(x, abs_mask);
+      __m256 big = _mm256_cmp_ps(a, max, _CMP_GT_OQ);
+      __m256 clamped = _mm256_or_ps(_mm256_andnot_ps(abs_mask, x), max);
+      x = _mm256_blendv_ps(x, clamped, big);
+    }
+    __m128i h = _mm256_cvtps_ph(x, Round | _MM_FROUND_NO_EXC);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d + i), h);
+  }
+  for (; i < n; i++)
+    d[i] = encode_mini(std::bit_cast<uint32_t>(s[i]), mini_f16, rtz, sat);
+}
+
+#endif
+
+//! conversion routines for the ISA selected by rvs::hostgemm
+const kernels_t& kernels() {
+  static const kernels_t generic = LPCONV_KERNELS(run_generic);
+#if defined(__x86_64__)
+  static const kernels_t avx2 = LPCONV_KERNELS(run_avx2);
+  static const kernels_t avx512 = LPCONV_KERNELS(run_avx512);
+
+  switch (rvs::hostgemm::get_isa()) {
+    case rvs::hostgemm::isa_avx512:
+      return avx512;
+    case rvs::hostgemm::isa_avx2:
+      return avx2;
+    default:
+      break;
+  }
+#endif
+  return generic;
+}
+
+//! true if fp16 conversions can use F16C
+bool has_f16c() {
+#if defined(__x86_64__)
+  static const bool f16c = rvs::hostgemm::get_isa() != rvs::hostgemm::isa_generic
+      && __builtin_cpu_supports("f16c");
+  return f16c;
+#else
+  return false;
+#endif
+}
+
+}  // namespace
+
+//! Returns element size (bytes) of format
+size_t rvs::lpconv::format_size(format_t fmt) {
+  switch (fmt) {
+    case fmt_f32:
+      return 4;
+    case fmt_f16:
+    case fmt_bf16:
+      return 2;
+    case fmt_e4m3:
+    case fmt_e5m2:
+    case fmt_e4m3_fnuz:
+    case fmt_e5m2_fnuz:
+    case fmt_i8:
+      return 1;
+    default:
+      return 0;
+  }
+}
+
+//! Returns format name
+const char* rvs::lpconv::format_name(format_t fmt) {
+  switch (fmt) {
+    case fmt_f32:
+      return "f32";
+    case fmt_f16:
+      return "f16";
+    case fmt_bf16:
+      return "bf16";
+    case fmt_e4m3:
+      return "e4m3";
+    case fmt_e5m2:
+      return "e5m2";
+    case fmt_e4m3_fnuz:
+      return "e4m3_fnuz";
+    case fmt_e5m2_fnuz:
+      return "e5m2_fnuz";
+    case fmt_i8:
+      return "i8";
+    default:
+      return "none";
+  }
+}
+
+/**
+ * @brief Decodes one element
+ *
+ * @param fmt element format
+ * @param bits element bits
+ * @return element value
+ *
+ * */
+float rvs::lpconv::decode(format_t fmt, uint32_t bits) {
+  const mini_t* f = mini_desc(fmt);
+
+  if (f)
+    return decode_mini(bits, *f);
+  if (fmt == fmt_i8)
+    return static_cast<int8_t>(bits);
+  if (fmt == fmt_f32)
+    return std::bit_cast<float>(bits);
+  return std::numeric_limits<float>::quiet_NaN();
+}
+
+/**
+ * @brief Encodes one element
+ *
+ * @param conv conversion (format, rounding, saturation)
+ * @param x value
+ * @return element bits
+ *
+ * */
+uint32_t rvs::lpconv::encode(const conv_t& conv, float x) {
+  const mini_t* f = mini_desc(conv.fmt);
+  bool rtz = conv.round == round_toward_zero;
+
+  if (f)
+    return encode_mini(std::bit_cast<uint32_t>(x), *f, rtz, conv.saturate);
+  if (conv.fmt == fmt_i8)
+    return static_cast<uint8_t>(encode_i8(x, rtz));
+  if (conv.fmt == fmt_f32)
+    return std::bit_cast<uint32_t>(x);
+  return 0;
+}
+
+/**
+ * @brief Returns 256 entry decoding table of 8 bit format
+ *
+ * @param fmt element format
+ * @return table, nullptr if fmt is not an 8 bit format
+ *
+ * */
+const float* rvs::lpconv::decode_table(format_t fmt) {
+  static const std::vector<std::vector<float>> tables = [] {
+    std::vector<std::vector<float>> t(fmt_i8 + 1);
+    for (int f = fmt_none; f <= fmt_i8; f++) {
+      if (format_size(static_cast<format_t>(f)) != 1)
+        continue;
+      t[f].resize(256);
+      for (uint32_t c = 0; c < 256; c++)
+        t[f][c] = decode(static_cast<format_t>(f), c);
+    }
+    return t;
+  }();
+
+  if (fmt < fmt_none || fmt > fmt_i8 || tables[fmt].empty())
+    return nullptr;
+  return tables[fmt].data();
+}
+
+/**
+ * @brief Converts n elements to float
+ *
+ * @param fmt element format
+ * @param src elements
+ * @param dst float values
+ * @param n number of elements
+ *
+ * */
+void rvs::lpconv::to_float(format_t fmt, const void* src, float* dst,
+                           size_t n) {
+  const kernels_t& k = kernels();
+
+  switch (fmt) {
+    case fmt_f32:
+      memcpy(dst, src, n * sizeof(float));
+      break;
+    case fmt_f16:
+#if defined(__x86_64__)
+      if (has_f16c()) {
+        f16_to_float_f16c(static_cast<const uint16_t*>(src), dst, n);
+        break;
+      }
+#endif
+      k.f16_to_float(static_cast<const uint16_t*>(src), dst, n);
+      break;
+    case fmt_bf16:
+      k.bf16_to_float(static_cast<const uint16_t*>(src), dst, n);
+      break;
+    case fmt_i8:
+      k.i8_to_float(static_cast<const int8_t*>(src), dst, n);
+      break;
+    default:
+      if (format_size(fmt) == 1)
+        k.lut_to_float(static_cast<const uint8_t*>(src), dst, n,
+                       decode_table(fmt));
+      break;
+  }
+}
+
+/**
+ * @brief Converts n floats to elements
+ *
+ * @param conv conversion (format, rounding, saturation)
+ * @param src float values
+ * @param dst elements
+ * @param n number of elements
+ *
+ * */
+void rvs::lpconv::from_float(const conv_t& conv, const float* src, void* dst,
+                             size_t n) {
+  const kernels_t& k = kernels();
+  const mini_t* f = mini_desc(conv.fmt);
+  bool rtz = conv.round == round_toward_zero;
+
+  if (conv.fmt == fmt_f32) {
+    memcpy(dst, src, n * sizeof(float));
+  } else if (conv.fmt == fmt_i8) {
+    k.to_i8(src, static_cast<int8_t*>(dst), n, rtz);
+  } else if (conv.fmt == fmt_f16) {
+#if defined(__x86_64__)
+    if (has_f16c()) {
+      if (rtz)
+        float_to_f16_f16c<_MM_FROUND_TO_ZERO>(src, static_cast<uint16_t*>(dst),
+                                              n, conv.saturate);
+      else
+        float_to_f16_f16c<_MM_FROUND_TO_NEAREST_INT>(
+            src, static_cast<uint16_t*>(dst), n, conv.saturate);
+      return;
+    }
+#endif
+    k.to_mini16(src, static_cast<uint16_t*>(dst), n, f, rtz, conv.saturate);
+  } else if (f && format_size(conv.fmt) == 2) {
+    k.to_mini16(src, static_cast<uint16_t*>(dst), n, f, rtz, conv.saturate);
+  } else if (f) {
+    k.to_mini8(src, static_cast<uint8_t*>(dst), n, f, rtz, conv.saturate);
+  }
+}
+
+/**
+ * @brief Values exercising every rounding decision of a format
+ *
+ * All finite values of the format, the midpoints between neighbours and
+ * the floats next to them (both signs), values beyond the largest finite
+ * one, Inf and NaN.
+ *
+ * @param fmt element format
+ * @param[out] values probe values
+ *
+ * */
+void rvs::lpconv::probe_values(format_t fmt, std::vector<float>* values) {
+  const mini_t* f = mini_desc(fmt);
+  const float inf = std::numeric_limits<float>::infinity();
+
+  values->clear();
+  if (!f)
+    return;
+
+  std::vector<float> pos;
+  for (uint32_t c = 0; c <= f->max_code; c++)
+    pos.push_back(decode_mini(c, *f));
+
+  for (size_t i = 0; i < pos.size(); i++) {
+    float next = i + 1 < pos.size() ? pos[i + 1] :
+        pos[i] + (pos[i] - pos[i - 1]);
+    float mid = pos[i] + (next - pos[i]) / 2;
+    for (float v : {pos[i], mid, std::nextafter(mid, 0.0f),
+                    std::nextafter(mid, inf), next}) {
+      values->push_back(v);
+      values->push_back(-v);
+    }
+  }
+
+  for (float v : {std::numeric_limits<float>::denorm_min(),
+                  std::numeric_limits<float>::max(), inf,
+                  std::numeric_limits<float>::quiet_NaN()}) {
+    values->push_back(v);
+    values->push_back(-v);
+  }
+}
@@ -0,0 +1,241 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_matrix_stage.h"
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+namespace {
+
+//! staged matrices and their initialization state
+struct entry_t : rvs::matrix_stage::buffers_t {
+  //! key the matrices are currently staged under
+  rvs::matrix_stage::key_t key;
+  //! becomes true (initialized) or false (failed)
+  std::shared_future<bool> ready;
+  //! initialization time in seconds
+  double seconds;
+};
+
+std::mutex stage_mutex;
+std::map<rvs::matrix_stage::key_t, std::weak_ptr<entry_t>> stage_entries;
+rvs::matrix_stage::stats_t stage_stats = {};
+
+size_t align_up(size_t bytes) {
+  const size_t a = rvs::matrix_stage::ALIGNMENT;
+  return (bytes + a - 1) / a * a;
+}
+
+//! size of the buffer holding the matrices of key
+size_t stage_bytes(const rvs::matrix_stage::key_t& key) {
+  return std::max<size_t>(align_up(key.bytes_a) + align_up(key.bytes_b) +
+                          key.bytes_c, 1);
+}
+
+//! allocates the matrices of a new entry
+bool entry_alloc(entry_t* e, const rvs::matrix_stage::key_t& key,
+                 rvs::matrix_stage::alloc_fn_t alloc_fn) {
+  size_t off_b = align_up(key.bytes_a);
+  size_t off_c = off_b + align_up(key.bytes_b);
+  size_t bytes = stage_bytes(key);
+  bool pinned = false;
+
+  uint8_t* p = static_cast<uint8_t*>(alloc_fn(bytes, &pinned));
+  if (!p)
+    return false;
+
+  e->ha = p;
+  e->hb = p + off_b;
+  e->hc = p + off_c;
+  e->bytes = bytes;
+  e->pinned = pinned;
+
+  std::lock_guard<std::mutex> lk(stage_mutex);
+  stage_stats.bytes_resident += bytes;
+  stage_stats.bytes_peak = std::max(stage_stats.bytes_peak,
+                                    stage_stats.bytes_resident);
+  return true;
+}
+
+//! initializes the matrices of an allocated entry
+bool entry_init(entry_t* e, const rvs::matrix_stage::init_fn_t& init) {
+  auto t0 = std::chrono::steady_clock::now();
+  bool ok = false;
+  try {
+    ok = init(*e);
+  } catch (...) {
+    ok = false;
+  }
+  e->seconds = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - t0).count();
+  return ok;
+}
+
+}  // namespace
+
+/**
+ * @brief Orders keys (for the key to entry map)
+ * @param rhs other key
+ * @return true if this key orders before rhs
+ */
+bool rvs::matrix_stage::key_t::operator<(const key_t& rhs) const {
+  return std::tie(type, init, range, seed, generation,
+                  bytes_a, bytes_b, bytes_c) <
+         std::tie(rhs.type, rhs.init, rhs.range, rhs.seed, rhs.generation,
+                  rhs.bytes_a, rhs.bytes_b, rhs.bytes_c);
+}
+
+/**
+ * @brief Returns matrices for key, generating them if no worker holds them
+ *
+ * Only the first caller for a key allocates and runs init, concurrent
+ * callers for the same key block until it is done.
+ *
+ * A caller moving on to new matrices (e.g. next generation of the same
+ * seed) passes the matrices it held so far in held. They are released,
+ * or refilled in place and staged under the new key when the caller is
+ * their only holder and the sizes match, so regeneration does not free
+ * and allocate (pin) host memory again.
+ *
+ * @param key matrix contents
+ * @param init initializes newly allocated matrices
+ * @param alloc_fn host memory allocation
+ * @param free_fn host memory release
+ * @param held matrices held by the caller so far (reset on return), may
+ * be nullptr
+ * @return shared matrices (read-only) or nullptr on failure
+ *
+ * */
+std::shared_ptr<const rvs::matrix_stage::buffers_t>
+rvs::matrix_stage::acquire(const key_t& key, const init_fn_t& init,
+                           alloc_fn_t alloc_fn, free_fn_t free_fn,
+                           std::shared_ptr<const buffers_t>* held) {
+  std::shared_ptr<entry_t> entry;
+  std::shared_ptr<entry_t> prev;
+  std::promise<bool> promise;
+  bool creator = false;
+  bool reused = false;
+
+  // all buffers handed out are entries
+  if (held && *held) {
+    prev = std::const_pointer_cast<entry_t>(
+        std::static_pointer_cast<const entry_t>(*held));
+    held->reset();
+  }
+
+  {
+    std::lock_guard<std::mutex> lk(stage_mutex);
+    auto it = stage_entries.find(key);
+    if (it != stage_entries.end())
+      entry = it->second.lock();
+
+    if (!entry && prev && prev.use_count() == 1 &&
+        prev->bytes == stage_bytes(key)) {
+      // only holder (new references need stage_mutex): re-key in place
+      auto old = stage_entries.find(prev->key);
+      if (old != stage_entries.end() && old->second.lock() == prev)
+        stage_entries.erase(old);
+      entry = std::move(prev);
+      entry->key = key;
+      entry->seconds = 0;
+      entry->ready = promise.get_future().share();
+      stage_entries[key] = entry;
+      creator = true;
+      reused = true;
+    }
+
+    if (!entry) {
+      entry = std::shared_ptr<entry_t>(new entry_t(),
+        [free_fn](entry_t* e) {
+          {
+            std::lock_guard<std::mutex> lk(stage_mutex);
+            auto it = stage_entries.find(e->key);
+            if (it != stage_entries.end() && it->second.expired())
+              stage_entries.erase(it);
+            stage_stats.bytes_resident -= e->bytes;
+          }
+          if (e->ha)
+            free_fn(e->ha, e->pinned);
+          delete e;
+        });
+      entry->ha = entry->hb = entry->hc = nullptr;
+      entry->bytes = 0;
+      entry->pinned = false;
+      entry->key = key;
+      entry->seconds = 0;
+      entry->ready = promise.get_future().share();
+      stage_entries[key] = entry;
+      creator = true;
+    }
+  }
+
+  // previous matrices not reused are released before allocating
+  prev.reset();
+
+  bool ok;
+  if (creator) {
+    ok = (reused || entry_alloc(entry.get(), key, alloc_fn)) &&
+         entry_init(entry.get(), init);
+
+    std::lock_guard<std::mutex> lk(stage_mutex);
+    if (ok) {
+      stage_stats.generated++;
+      if (reused)
+        stage_stats.reused++;
+    } else {
+      // let the next caller retry
+      auto it = stage_entries.find(key);
+      if (it != stage_entries.end() && it->second.lock() == entry)
+        stage_entries.erase(it);
+    }
+    promise.set_value(ok);
+  } else {
+    ok = entry->ready.get();
+
+    if (ok) {
+      std::lock_guard<std::mutex> lk(stage_mutex);
+      stage_stats.shared++;
+      stage_stats.bytes_saved += entry->bytes;
+      stage_stats.seconds_saved += entry->seconds;
+    }
+  }
+
+  if (!ok)
+    return nullptr;
+  return std::shared_ptr<const buffers_t>(entry, entry.get());
+}
+
+/**
+ * @brief Returns staging statistics
+ * @return counters accumulated since process start
+ * */
+rvs::matrix_stage::stats_t rvs::matrix_stage::get_stats(void) {
+  std::lock_guard<std::mutex> lk(stage_mutex);
+  return stage_stats;
+}
@@ -0,0 +1,254 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_mxpack.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+//! bit-parallel paths assume little endian 64 bit loads and stores
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define MXPACK_SWAR                             1
+#else
+#define MXPACK_SWAR                             0
+#endif
+
+//! rows of a K block transposed at a time by align_blocks()
+#define MXPACK_ALIGN_TILE                       64
+
+namespace {
+
+//! loads n (at most 8) bytes into the low bytes of a 64 bit word
+inline uint64_t load_bytes(const uint8_t* p, size_t n) {
+  uint64_t x = 0;
+  memcpy(&x, p, n);
+  return x;
+}
+
+//! stores the n (at most 8) low bytes of a 64 bit word
+inline void store_bytes(uint8_t* p, uint64_t x, size_t n) {
+  memcpy(p, &x, n);
+}
+
+//! fp6 value i of a packed stream (i / 4 group, i % 4 position)
+inline uint8_t fp6_at(const uint8_t* in, size_t i) {
+  size_t bit = i * 6;
+  size_t byte = bit / 8;
+  unsigned shift = bit % 8;
+  unsigned v = in[byte] >> shift;
+  if (shift > 2)
+    v |= in[byte + 1] << (8 - shift);
+  return v & 0x3F;
+}
+
+}  // namespace
+
+/**
+ * @brief Unpacks fp4 values, two per byte with the low nibble first
+ *
+ * @param in packed values
+ * @param bytes number of packed bytes
+ * @param out 2 * bytes unpacked values, one per byte
+ * */
+void rvs::mxpack::unpack_fp4(const uint8_t* in, size_t bytes, uint8_t* out) {
+  size_t i = 0;
+
+  if (MXPACK_SWAR) {
+    int64_t groups = bytes / 4;
+#pragma omp parallel for
+    for (int64_t g = 0; g < groups; g++) {
+      // spread 4 bytes to 16 bit lanes, then split each byte into nibbles
+      uint64_t y = load_bytes(in + g * 4, 4);
+      y = (y | (y << 16)) & 0x0000FFFF0000FFFFull;
+      y = (y | (y << 8)) & 0x00FF00FF00FF00FFull;
+      y = (y & 0x000F000F000F000Full) | ((y << 4) & 0x0F000F000F000F00ull);
+      store_bytes(out + g * 8, y, 8);
+    }
+    i = groups * 4;
+  }
+
+  for (; i < bytes; i++) {
+    out[i * 2] = in[i] & 0x0F;
+    out[i * 2 + 1] = in[i] >> 4;
+  }
+}
+
+/**
+ * @brief Packs fp4 values, two per byte with the low nibble first
+ *
+ * @param in unpacked values, one per byte (upper bits ignored)
+ * @param values number of values (odd count : last high nibble is 0)
+ * @param out (values + 1) / 2 packed bytes
+ * */
+void rvs::mxpack::pack_fp4(const uint8_t* in, size_t values, uint8_t* out) {
+  size_t i = 0;
+
+  if (MXPACK_SWAR) {
+    int64_t groups = values / 8;
+#pragma omp parallel for
+    for (int64_t g = 0; g < groups; g++) {
+      // merge nibble pairs into the low byte of 16 bit lanes, then compact
+      uint64_t y = load_bytes(in + g * 8, 8);
+      y = (y & 0x000F000F000F000Full) | ((y >> 4) & 0x00F000F000F000F0ull);
+      y = (y & 0x000000FF000000FFull) | ((y >> 8) & 0x0000FF000000FF00ull);
+      y = (y & 0xFFFFull) | ((y >> 16) & 0xFFFF0000ull);
+      store_bytes(out + g * 4, y, 4);
+    }
+    i = groups * 8;
+  }
+
+  for (; i + 1 < values; i += 2)
+    out[i / 2] = (in[i] & 0x0F) | (in[i + 1] << 4);
+  if (i < values)
+    out[i / 2] = in[i] & 0x0F;
+}
+
+/**
+ * @brief Unpacks fp6 values, four per three bytes, least significant bits
+ * first
+ *
+ * @param in packed values
+ * @param bytes number of packed bytes
+ * @param out bytes * 8 / 6 unpacked values, one per byte
+ * */
+void rvs::mxpack::unpack_fp6(const uint8_t* in, size_t bytes, uint8_t* out) {
+  size_t values = bytes * 8 / 6;
+  size_t i = 0;
+
+  if (MXPACK_SWAR) {
+    int64_t groups = bytes / 6;
+#pragma omp parallel for
+    for (int64_t g = 0; g < groups; g++) {
+      // 48 bits -> two 24 bit halves -> four 12 bit -> eight 6 bit lanes
+      uint64_t y = load_bytes(in + g * 6, 6);
+      y = (y & 0xFFFFFFull) | ((y & 0xFFFFFF000000ull) << 8);
+      y = (y & 0x00000FFF00000FFFull) | ((y & 0x00FFF00000FFF000ull) << 4);
+      y = (y & 0x003F003F003F003Full) | ((y & 0x0FC00FC00FC00FC0ull) << 2);
+      store_bytes(out + g * 8, y, 8);
+    }
+    i = groups * 8;
+  }
+
+  for (; i < values; i++)
+    out[i] = fp6_at(in, i);
+}
+
+/**
+ * @brief Packs fp6 values, four per three bytes, least significant bits
+ * first
+ *
+ * @param in unpacked values, one per byte (upper bits ignored)
+ * @param values number of values
+ * @param out (values * 6 + 7) / 8 packed bytes
+ * */
+void rvs::mxpack::pack_fp6(const uint8_t* in, size_t values, uint8_t* out) {
+  size_t i = 0;
+
+  if (MXPACK_SWAR) {
+    int64_t groups = values / 8;
+#pragma omp parallel for
+    for (int64_t g = 0; g < groups; g++) {
+      // eight 6 bit lanes -> four 12 bit -> two 24 bit -> 48 bits
+      uint64_t y = load_bytes(in + g * 8, 8) & 0x3F3F3F3F3F3F3F3Full;
+      y = (y & 0x003F003F003F003Full) | ((y & 0x3F003F003F003F00ull) >> 2);
+      y = (y & 0x00000FFF00000FFFull) | ((y & 0x0FFF00000FFF0000ull) >> 4);
+      y = (y & 0xFFFFFFull) | ((y & 0x00FFFFFF00000000ull) >> 8);
+      store_bytes(out + g * 6, y, 6);
+    }
+    i = groups * 8;
+  }
+
+  if (i < values)
+    memset(out + i * 6 / 8, 0, (values * 6 + 7) / 8 - i * 6 / 8);
+  for (; i < values; i++) {
+    size_t bit = i * 6;
+    unsigned v = in[i] & 0x3F;
+    out[bit / 8] |= v << (bit % 8);
+    if (bit % 8 > 2)
+      out[bit / 8 + 1] |= v >> (8 - bit % 8);
+  }
+}
+
+/**
+ * @brief Realigns MX data with its scales
+ *
+ * The source holds one scale block of consecutive values per row and K
+ * block: value (r, k) is at ((k / block) * rows + r) * block + k % block.
+ * The destination holds value (r, k) at k * rows + r. Each K block is a
+ * rows x block to block x rows transpose, done in tiles of
+ * MXPACK_ALIGN_TILE rows so that source and destination lines stay cached.
+ *
+ * @param src values as generated (one byte each)
+ * @param dst realigned values (rows * cols bytes)
+ * @param rows M of non-transposed A, N of transposed B
+ * @param cols K
+ * @param block values per scale
+ * */
+void rvs::mxpack::align_blocks(const uint8_t* src, uint8_t* dst, int64_t rows,
+                               int64_t cols, int64_t block) {
+  int64_t kblocks = (cols + block - 1) / block;
+
+#pragma omp parallel for
+  for (int64_t kb = 0; kb < kblocks; kb++) {
+    const uint8_t* s = src + kb * rows * block;
+    int64_t width = std::min(block, cols - kb * block);
+    uint8_t* d = dst + kb * block * rows;
+
+    for (int64_t r0 = 0; r0 < rows; r0 += MXPACK_ALIGN_TILE) {
+      int64_t r1 = std::min<int64_t>(r0 + MXPACK_ALIGN_TILE, rows);
+      for (int64_t kk = 0; kk < width; kk++)
+        for (int64_t r = r0; r < r1; r++)
+          d[kk * rows + r] = s[r * block + kk];
+    }
+  }
+}
+
+/**
+ * @brief Converts realigned MX values to float through per scale tables
+ *
+ * @param codes realigned values (see align_blocks())
+ * @param scales one scale per row and K block ((k / block) * rows + r)
+ * @param rows M of non-transposed A, N of transposed B
+ * @param cols K
+ * @param block values per scale
+ * @param luts 256 tables (one per scale value) of lut_size floats each,
+ * only tables of scales present need to be filled in
+ * @param lut_size number of codes of the type (power of 2)
+ * @param out float values (rows * cols)
+ * */
+void rvs::mxpack::aligned_to_float(const uint8_t* codes, const uint8_t* scales,
+    int64_t rows, int64_t cols, int64_t block, const float* luts,
+    int64_t lut_size, float* out) {
+  const unsigned mask = static_cast<unsigned>(lut_size - 1);
+
+#pragma omp parallel for
+  for (int64_t k = 0; k < cols; k++) {
+    const uint8_t* sc = scales + (k / block) * rows;
+    const uint8_t* c = codes + k * rows;
+    float* o = out + k * rows;
+    for (int64_t r = 0; r < rows; r++)
+      o[r] = luts[sc[r] * lut_size + (c[r] & mask)];
+  }
+}
@@ -0,0 +1,293 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_normcheck.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "include/rvs_hostgemm.h"
+
+//! elements decoded at a time per column (fits L1 for ref and cur)
+#define NORMCHECK_CHUNK                         2048
+
+namespace {
+
+//! column kernel: accumulates difference and reference sums of squares
+template <typename T>
+using column_fn_t = void (*)(int64_t m, const T* ref, const T* cur,
+                             double scale, double* pdiff, double* pref);
+
+//! Fused difference/reference sum of squares of one column
+template <typename T>
+__attribute__((always_inline))
+inline void column_ssq(int64_t m, const T* r, const T* c, double scale,
+                       double* pdiff, double* pref) {
+  double sd = 0;
+  double sr = 0;
+
+  #pragma omp simd reduction(+:sd, sr)
+  for (int64_t i = 0; i < m; i++) {
+    double x = r[i] * scale;
+    double d = c[i] * scale - x;
+    sd += d * d;
+    sr += x * x;
+  }
+
+  *pdiff += sd;
+  *pref += sr;
+}
+
+template <typename T>
+void column_generic(int64_t m, const T* ref, const T* cur, double scale,
+                    double* pdiff, double* pref) {
+  column_ssq<T>(m, ref, cur, scale, pdiff, pref);
+}
+
+#if defined(__x86_64__)
+
+template <typename T>
+__attribute__((target("avx2,fma")))
+void column_avx2(int64_t m, const T* ref, const T* cur, double scale,
+                 double* pdiff, double* pref) {
+  column_ssq<T>(m, ref, cur, scale, pdiff, pref);
+}
+
+template <typename T>
+__attribute__((target("avx512f,avx512bw")))
+void column_avx512(int64_t m, const T* ref, const T* cur, double scale,
+                   double* pdiff, double* pref) {
+  column_ssq<T>(m, ref, cur, scale, pdiff, pref);
+}
+
+#endif
+
+//! Column kernel for element type and ISA
+template <typename T>
+column_fn_t<T> column_kernel(rvs::hostgemm::isa_t isa) {
+#if defined(__x86_64__)
+  if (isa == rvs::hostgemm::isa_avx512)
+    return column_avx512<T>;
+  if (isa == rvs::hostgemm::isa_avx2)
+    return column_avx2<T>;
+#endif
+  return column_generic<T>;
+}
+
+//! Reads column chunks of both matrices as T
+struct column_reader {
+  //! element format decoded by rvs::lpconv (fmt_none - read in place)
+  rvs::lpconv::format_t fmt;
+  //! element size in bytes
+  size_t elem_size;
+  //! leading dimension (elements)
+  int64_t ld;
+  //! reference matrix
+  const char* ref;
+  //! current matrix
+  const char* cur;
+
+  //! rows i .. i + len - 1 of column j, decoded into rbuf/cbuf if needed
+  template <typename T>
+  void get(int64_t j, int64_t i, int64_t len, T* rbuf, T* cbuf,
+           const T** pr, const T** pc) const {
+    size_t off = (j * ld + i) * elem_size;
+
+    if constexpr (std::is_same<T, float>::value) {
+      if (fmt != rvs::lpconv::fmt_none) {
+        rvs::lpconv::to_float(fmt, ref + off, rbuf, len);
+        rvs::lpconv::to_float(fmt, cur + off, cbuf, len);
+        *pr = rbuf;
+        *pc = cbuf;
+        return;
+      }
+    }
+    *pr = reinterpret_cast<const T*>(ref + off);
+    *pc = reinterpret_cast<const T*>(cur + off);
+  }
+};
+
+//! Largest magnitude in both matrices (used to rescale on overflow)
+template <typename T>
+double max_abs(const column_reader& rd, int64_t m, int64_t n) {
+  std::vector<T> rbuf(std::min<int64_t>(m, NORMCHECK_CHUNK));
+  std::vector<T> cbuf(rbuf.size());
+  double mx = 0;
+
+  for (int64_t j = 0; j < n; j++) {
+    for (int64_t i = 0; i < m; i += NORMCHECK_CHUNK) {
+      int64_t len = std::min<int64_t>(m - i, NORMCHECK_CHUNK);
+      const T* r;
+      const T* c;
+      rd.get(j, i, len, rbuf.data(), cbuf.data(), &r, &c);
+      for (int64_t k = 0; k < len; k++) {
+        mx = std::max(mx, std::fabs(static_cast<double>(r[k])));
+        mx = std::max(mx, std::fabs(static_cast<double>(c[k])));
+      }
+    }
+  }
+  return mx;
+}
+
+template <typename T>
+double relative_error_impl(const column_reader& rd, int64_t m, int64_t n,
+                           int threads) {
+  column_fn_t<T> fn = column_kernel<T>(rvs::hostgemm::get_isa());
+  double scale = 1.0;
+  double sd = 0;
+  double sr = 0;
+
+  if (m <= 0 || n <= 0)
+    return 0;
+
+  threads = rvs::hostgemm::get_threads(threads);
+  int64_t chunk = rd.fmt == rvs::lpconv::fmt_none ?
+    m : std::min<int64_t>(m, NORMCHECK_CHUNK);
+
+  for (int pass = 0; pass < 2; pass++) {
+    sd = 0;
+    sr = 0;
+
+    #pragma omp parallel num_threads(threads) reduction(+:sd, sr)
+    {
+      std::vector<T> rbuf(rd.fmt == rvs::lpconv::fmt_none ? 0 : chunk);
+      std::vector<T> cbuf(rbuf.size());
+
+      #pragma omp for schedule(static)
+      for (int64_t j = 0; j < n; j++) {
+        for (int64_t i = 0; i < m; i += chunk) {
+          int64_t len = std::min(m - i, chunk);
+          const T* r;
+          const T* c;
+          rd.get(j, i, len, rbuf.data(), cbuf.data(), &r, &c);
+          fn(len, r, c, scale, &sd, &sr);
+        }
+      }
+    }
+
+    // squares of large (double) values overflowed, rescale and retry
+    if (!std::isinf(sd) && !std::isinf(sr))
+      break;
+    double mx = max_abs<T>(rd, m, n);
+    if (!(mx > 0) || std::isinf(mx))
+      break;
+    scale = 1.0 / mx;
+  }
+
+  // NaN/Inf in output is always an error
+  if (!(sd <= std::numeric_limits<double>::max()) ||
+      !(sr <= std::numeric_limits<double>::max()))
+    return std::numeric_limits<double>::infinity();
+
+  if (sr == 0)
+    return std::sqrt(sd) / scale;
+  return std::sqrt(sd / sr);
+}
+
+}  // namespace
+
+/**
+ * @brief Relative Frobenius norm error of two matrices
+ *
+ * @param fmt element format (fp32 or a low precision format)
+ * @param m rows
+ * @param n columns
+ * @param ld leading dimension (elements)
+ * @param ref reference (previous) matrix
+ * @param cur current matrix
+ * @param threads number of threads (0 - OpenMP default)
+ * @return ||cur - ref||_F / ||ref||_F (absolute error if ref is zero,
+ * infinity if either matrix contains NaN or infinity or fmt is unknown)
+ *
+ * */
+double rvs::normcheck::relative_error(lpconv::format_t fmt, int64_t m,
+    int64_t n, int64_t ld, const void* ref, const void* cur, int threads) {
+  size_t elem_size = lpconv::format_size(fmt);
+
+  if (elem_size == 0)
+    return std::numeric_limits<double>::infinity();
+
+  // fp32 is read in place, other formats are decoded chunk by chunk
+  column_reader rd = {fmt == lpconv::fmt_f32 ? lpconv::fmt_none : fmt,
+                      elem_size, ld, static_cast<const char*>(ref),
+                      static_cast<const char*>(cur)};
+  return relative_error_impl<float>(rd, m, n, threads);
+}
+
+/**
+ * @brief Relative Frobenius norm error of two double precision matrices
+ *
+ * @param m rows
+ * @param n columns
+ * @param ld leading dimension (elements)
+ * @param ref reference (previous) matrix
+ * @param cur current matrix
+ * @param threads number of threads (0 - OpenMP default)
+ * @return ||cur - ref||_F / ||ref||_F (absolute error if ref is zero,
+ * infinity if either matrix contains NaN or infinity)
+ *
+ * */
+double rvs::normcheck::relative_error(int64_t m, int64_t n, int64_t ld,
+    const double* ref, const double* cur, int threads) {
+  column_reader rd = {lpconv::fmt_none, sizeof(double), ld,
+                      reinterpret_cast<const char*>(ref),
+                      reinterpret_cast<const char*>(cur)};
+  return relative_error_impl<double>(rd, m, n, threads);
+}
+
+/**
+ * @brief Bitwise comparison of two matrices (stops at first difference)
+ *
+ * @param m rows
+ * @param n columns
+ * @param ld leading dimension (elements)
+ * @param elem_size size of element in bytes
+ * @param ref reference (previous) matrix
+ * @param cur current matrix
+ * @return true if all m x n elements are bitwise identical
+ *
+ * */
+bool rvs::normcheck::equal(int64_t m, int64_t n, int64_t ld, size_t elem_size,
+                           const void* ref, const void* cur) {
+  const char* r = static_cast<const char*>(ref);
+  const char* c = static_cast<const char*>(cur);
+
+  if (m <= 0 || n <= 0)
+    return true;
+
+  // contiguous columns - compare in one go
+  if (m == ld)
+    return memcmp(r, c, m * n * elem_size) == 0;
+
+  for (int64_t j = 0; j < n; j++) {
+    if (memcmp(r + j * ld * elem_size, c + j * ld * elem_size,
+               m * elem_size) != 0)
+      return false;
+  }
+  return true;
+}
@@ -0,0 +1,209 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_philox.h"
+
+#include <cmath>
+
+namespace {
+
+//! Philox4x32 multipliers and Weyl key increments
+const uint32_t PHILOX_M0 = 0xD2511F53;
+const uint32_t PHILOX_M1 = 0xCD9E8D57;
+const uint32_t PHILOX_W0 = 0x9E3779B9;
+const uint32_t PHILOX_W1 = 0xBB67AE85;
+const int PHILOX_ROUNDS = 10;
+
+//! blocks generated per vector batch
+const size_t BATCH = 64;
+
+//! batch kernel: nblk blocks starting at block index first into out
+typedef void (*batch_fn_t)(uint64_t seed, uint64_t stream, uint64_t first,
+                           size_t nblk, uint32_t* out);
+
+//! Philox4x32-10 of nblk consecutive counters, lanes kept in separate arrays
+__attribute__((always_inline))
+inline void philox_batch(uint64_t seed, uint64_t stream, uint64_t first,
+                         size_t nblk, uint32_t* out) {
+  uint32_t c0[BATCH], c1[BATCH], c2[BATCH], c3[BATCH];
+  uint32_t k0 = static_cast<uint32_t>(seed);
+  uint32_t k1 = static_cast<uint32_t>(seed >> 32);
+
+  #pragma omp simd
+  for (size_t j = 0; j < nblk; j++) {
+    uint64_t ctr = first + j;
+    c0[j] = static_cast<uint32_t>(ctr);
+    c1[j] = static_cast<uint32_t>(ctr >> 32);
+    c2[j] = static_cast<uint32_t>(stream);
+    c3[j] = static_cast<uint32_t>(stream >> 32);
+  }
+
+  for (int r = 0; r < PHILOX_ROUNDS; r++) {
+    #pragma omp simd
+    for (size_t j = 0; j < nblk; j++) {
+      uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * c0[j];
+      uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * c2[j];
+      uint32_t x0 = static_cast<uint32_t>(p1 >> 32) ^ c1[j] ^ k0;
+      uint32_t x2 = static_cast<uint32_t>(p0 >> 32) ^ c3[j] ^ k1;
+      c1[j] = static_cast<uint32_t>(p1);
+      c3[j] = static_cast<uint32_t>(p0);
+      c0[j] = x0;
+      c2[j] = x2;
+    }
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+
+  for (size_t j = 0; j < nblk; j++) {
+    out[4 * j + 0] = c0[j];
+    out[4 * j + 1] = c1[j];
+    out[4 * j + 2] = c2[j];
+    out[4 * j + 3] = c3[j];
+  }
+}
+
+void batch_generic(uint64_t seed, uint64_t stream, uint64_t first,
+                   size_t nblk, uint32_t* out) {
+  philox_batch(seed, stream, first, nblk, out);
+}
+
+#if defined(__x86_64__)
+
+__attribute__((target("avx2,fma")))
+void batch_avx2(uint64_t seed, uint64_t stream, uint64_t first,
+                size_t nblk, uint32_t* out) {
+  philox_batch(seed, stream, first, nblk, out);
+}
+
+__attribute__((target("avx512f")))
+void batch_avx512(uint64_t seed, uint64_t stream, uint64_t first,
+                  size_t nblk, uint32_t* out) {
+  philox_batch(seed, stream, first, nblk, out);
+}
+
+#endif
+
+batch_fn_t batch_kernel(rvs::hostgemm::isa_t isa) {
+#if defined(__x86_64__)
+  if (isa == rvs::hostgemm::isa_avx512)
+    return batch_avx512;
+  if (isa == rvs::hostgemm::isa_avx2)
+    return batch_avx2;
+#endif
+  return batch_generic;
+}
+
+//! Maps random words of elements [index, index + count) to values
+void to_values(const rvs::philox::params_t& p, const uint32_t* bits,
+               uint64_t index, size_t count, float* dst) {
+  switch (p.dist) {
+    case rvs::philox::dist_int: {
+      uint64_t range = static_cast<uint64_t>(
+          static_cast<int64_t>(p.hi) - p.lo + 1);
+      #pragma omp simd
+      for (size_t i = 0; i < count; i++)
+        dst[i] = static_cast<float>(p.lo +
+            static_cast<int64_t>((bits[i] * range) >> 32));
+      break;
+    }
+    case rvs::philox::dist_mod:
+      for (size_t i = 0; i < count; i++)
+        dst[i] = static_cast<float>(bits[i] % p.modulus) / p.divisor;
+      break;
+    case rvs::philox::dist_sin:
+      for (size_t i = 0; i < count; i++)
+        dst[i] = std::sin(static_cast<float>(index + i));
+      break;
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Philox4x32-10 block function
+ *
+ * @param ctr 128 bit counter
+ * @param key 64 bit key
+ * @param out four random 32 bit words
+ *
+ * */
+void rvs::philox::block(const uint32_t ctr[4], const uint32_t key[2],
+                        uint32_t out[4]) {
+  uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+  uint32_t k0 = key[0], k1 = key[1];
+
+  for (int r = 0; r < PHILOX_ROUNDS; r++) {
+    uint64_t p0 = static_cast<uint64_t>(PHILOX_M0) * c0;
+    uint64_t p1 = static_cast<uint64_t>(PHILOX_M1) * c2;
+    uint32_t x0 = static_cast<uint32_t>(p1 >> 32) ^ c1 ^ k0;
+    uint32_t x2 = static_cast<uint32_t>(p0 >> 32) ^ c3 ^ k1;
+    c1 = static_cast<uint32_t>(p1);
+    c3 = static_cast<uint32_t>(p0);
+    c0 = x0;
+    c2 = x2;
+    k0 += PHILOX_W0;
+    k1 += PHILOX_W1;
+  }
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+}
+
+/**
+ * @brief Fills elements [offset, offset + count) of a stream
+ *
+ * Element i takes word i % 4 of the block with counter
+ * (i / 4, stream) and key seed.
+ *
+ * @param p fill parameters
+ * @param offset index of the first element
+ * @param count number of elements
+ * @param dst destination (count elements)
+ *
+ * */
+void rvs::philox::fill(const params_t& p, uint64_t offset, size_t count,
+                       float* dst) {
+  batch_fn_t fn = batch_kernel(rvs::hostgemm::get_isa());
+  uint32_t bits[4 * BATCH];
+  uint64_t end = offset + count;
+  uint64_t i = offset;
+
+  // values depend on the element index only
+  if (p.dist == dist_sin) {
+    to_values(p, nullptr, offset, count, dst);
+    return;
+  }
+
+  while (i < end) {
+    uint64_t first = i / 4;
+    size_t nblk = std::min<uint64_t>(BATCH, (end - first * 4 + 3) / 4);
+    size_t skip = i - first * 4;
+    size_t len = std::min<uint64_t>(nblk * 4, end - first * 4) - skip;
+
+    fn(p.seed, p.stream, first, nblk, bits);
+    to_values(p, bits + skip, i, len, dst + (i - offset));
+    i += len;
+  }
+}
@@ -0,0 +1,201 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_power_control.h"
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Constructor
+ *
+ * @param _gains controller gains
+ * @param _out_min lowest output
+ * @param _out_max highest output
+ * */
+rvs::pid_controller::pid_controller(const pid_gains_t& _gains,
+                                    double _out_min, double _out_max)
+  : gains(_gains), out_min(_out_min), out_max(_out_max) {
+  reset(_out_max);
+}
+
+/**
+ * @brief Resets the controller (bumpless: the integral term starts at the
+ * given output)
+ *
+ * @param output initial output
+ * */
+void rvs::pid_controller::reset(double output) {
+  out = std::min(out_max, std::max(out_min, output));
+  integral = out;
+  prev_measurement = 0;
+  have_prev = false;
+  sat = false;
+}
+
+/**
+ * @brief Computes the next output
+ *
+ * @param setpoint desired value
+ * @param measurement measured value
+ * @param dt_s time since the previous update in seconds
+ * @return controller output within [out_min, out_max]
+ * */
+double rvs::pid_controller::update(double setpoint, double measurement,
+                                   double dt_s) {
+  double error = setpoint - measurement;
+
+  double derivative = 0;
+  if (have_prev && dt_s > 0)
+    derivative = -gains.kd * (measurement - prev_measurement) / dt_s;
+  prev_measurement = measurement;
+  have_prev = true;
+
+  double candidate = integral + gains.ki * error * dt_s;
+  double raw = gains.kp * error + candidate + derivative;
+
+  // conditional integration: do not wind up further into saturation
+  bool high = raw > out_max;
+  bool low = raw < out_min;
+  if (!(high && error > 0) && !(low && error < 0))
+    integral = std::min(out_max, std::max(out_min, candidate));
+
+  sat = high || low;
+  out = std::min(out_max, std::max(out_min, raw));
+  return out;
+}
+
+/**
+ * @brief Constructor, the plant starts idle at ambient temperature
+ *
+ * @param _params plant parameters
+ * */
+rvs::first_order_power_plant::first_order_power_plant(
+    const power_plant_params_t& _params)
+  : params(_params), pwr(_params.idle_w), temp(_params.ambient_c) {
+}
+
+/**
+ * @brief Advances the plant (exact discretization of both first order lags)
+ *
+ * @param command load command in [0, 1]
+ * @param dt_s time step in seconds
+ * @return power at the end of the step in W
+ * */
+double rvs::first_order_power_plant::step(double command, double dt_s) {
+  command = std::min(1.0, std::max(0.0, command));
+
+  double leakage = params.leakage_w_per_c * (temp - params.ambient_c);
+  double target = params.idle_w + (params.max_w - params.idle_w) * command +
+    leakage;
+  pwr += (target - pwr) * (1.0 - std::exp(-dt_s / params.tau_s));
+
+  double temp_target = params.ambient_c + params.thermal_r * pwr;
+  temp += (temp_target - temp) *
+    (1.0 - std::exp(-dt_s / params.thermal_tau_s));
+
+  return pwr;
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param _target target power
+ * @param _tolerance relative tolerance
+ * @param _min_hold minimum number of consecutive samples within the band
+ * @param _hold_fraction minimum fraction of all samples within the band
+ * */
+rvs::power_loop_stats::power_loop_stats(double _target, double _tolerance,
+                                        uint64_t _min_hold,
+                                        double _hold_fraction)
+  : target(_target), tolerance(_tolerance), min_hold(_min_hold),
+    hold_fraction(_hold_fraction), settle_s(-1), err_sum(0),
+    settled_samples(0), num_samples(0) {
+}
+
+/**
+ * @brief Adds a power sample
+ *
+ * @param t_s time of the sample in seconds
+ * @param power measured power
+ * */
+void rvs::power_loop_stats::add(double t_s, double power) {
+  num_samples++;
+  double rel = target > 0 ? (power - target) / target : 0;
+
+  if (std::fabs(rel) > tolerance) {
+    settle_s = -1;
+    err_sum = 0;
+    settled_samples = 0;
+    return;
+  }
+
+  if (settle_s < 0)
+    settle_s = t_s;
+  err_sum += rel;
+  settled_samples++;
+}
+
+/**
+ * @brief Tells whether the loop settled
+ *
+ * @return TRUE if the latest samples held the band for the minimum number
+ * of samples and the minimum fraction of the run
+ * */
+bool rvs::power_loop_stats::settled(void) const {
+  return settle_s >= 0 && settled_samples >= min_hold &&
+         settled_samples >= hold_fraction * num_samples;
+}
+
+/**
+ * @brief Mean relative error of the settled samples
+ *
+ * @return (power - target) / target averaged after settling, 0 if not settled
+ * */
+double rvs::power_loop_stats::steady_state_error(void) const {
+  return settled_samples ? err_sum / settled_samples : 0;
+}
+
+/**
+ * @brief Maps a controller command to the workload knobs
+ *
+ * The GEMM duty cycle and bandwidth kernel intensity follow the command and
+ * the GEMM batch shrinks with it, so that low commands also shorten the
+ * bursts seen by the power sensor.
+ *
+ * @param command controller output in [0, 1]
+ * @param max_hot_calls configured GEMMs per batch
+ * @return workload intensity
+ * */
+rvs::power_actuation_t rvs::power_actuation(double command,
+                                            uint64_t max_hot_calls) {
+  command = std::min(1.0, std::max(0.0, command));
+
+  power_actuation_t act;
+  act.gemm_duty = command;
+  act.bw_intensity = command;
+  act.hot_calls = std::max<uint64_t>(1,
+      static_cast<uint64_t>(std::ceil(command * max_hot_calls)));
+  return act;
+}
@@ -0,0 +1,172 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_pulse_scheduler.h"
+
+#include <errno.h>
+#include <time.h>
+
+#include <algorithm>
+#include <cmath>
+
+#define NS_PER_SEC                              1000000000LL
+
+/**
+ * @brief Constructor
+ *
+ * @param high_ms high phase length in ms
+ * @param low_ms low phase length in ms
+ * @param spin_us busy-wait tail of each wait in us (0 - sleep only)
+ * */
+rvs::pulse_scheduler::pulse_scheduler(double high_ms, double low_ms,
+                                      double spin_us)
+  : high_ns(static_cast<int64_t>(high_ms * 1e6)),
+    low_ns(static_cast<int64_t>(low_ms * 1e6)),
+    spin_ns(static_cast<int64_t>(spin_us * 1e3)),
+    t0_ns(0), pulse(0), is_high(false), phase_plan_ns(0), phase_start_ns(0),
+    phase_end_ns(0), high_actual_ns(0), pulse_late_ns(0) {
+}
+
+/**
+ * @brief Reads CLOCK_MONOTONIC
+ *
+ * @return time in ns
+ * */
+int64_t rvs::pulse_scheduler::now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * NS_PER_SEC + ts.tv_nsec;
+}
+
+/**
+ * @brief Sleeps until an absolute CLOCK_MONOTONIC time, busy-waiting the
+ * last spin_ns
+ *
+ * @param deadline_ns wake up time in ns
+ * */
+void rvs::pulse_scheduler::sleep_until(int64_t deadline_ns) const {
+  int64_t wake_ns = deadline_ns - spin_ns;
+  if (wake_ns > now_ns()) {
+    struct timespec ts;
+    ts.tv_sec = wake_ns / NS_PER_SEC;
+    ts.tv_nsec = wake_ns % NS_PER_SEC;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) ==
+           EINTR) {
+    }
+  }
+  while (now_ns() < deadline_ns) {
+  }
+}
+
+/**
+ * @brief Anchors the schedule, the first pulse is planned to start now
+ * */
+void rvs::pulse_scheduler::start(void) {
+  t0_ns = now_ns();
+  pulse = 0;
+  is_high = false;
+  phase_end_ns = t0_ns;
+  lateness_ns.clear();
+}
+
+/**
+ * @brief Starts the next phase (high after low) and records its lateness
+ * */
+void rvs::pulse_scheduler::begin_phase(void) {
+  is_high = !is_high;
+  int64_t period_ns = high_ns + low_ns;
+  phase_plan_ns = t0_ns + static_cast<int64_t>(pulse) * period_ns +
+    (is_high ? 0 : high_ns);
+  phase_end_ns = phase_plan_ns + (is_high ? high_ns : low_ns);
+  phase_start_ns = now_ns();
+
+  int64_t late_ns = std::max<int64_t>(0, phase_start_ns - phase_plan_ns);
+  lateness_ns.push_back(late_ns);
+  if (is_high)
+    pulse_late_ns = late_ns;
+}
+
+/**
+ * @brief Ends the current phase
+ *
+ * @param timing filled with the pulse timing when a low phase ends
+ * @return true if a pulse (high and low phase) was completed
+ * */
+bool rvs::pulse_scheduler::end_phase(pulse_timing_t* timing) {
+  int64_t end_ns = now_ns();
+  if (is_high) {
+    high_actual_ns = end_ns - phase_start_ns;
+    return false;
+  }
+
+  if (timing) {
+    timing->pulse = pulse;
+    timing->high_ms = high_actual_ns / 1e6;
+    timing->low_ms = (end_ns - phase_start_ns) / 1e6;
+    timing->drift_us = pulse_late_ns / 1e3;
+  }
+  pulse++;
+  return true;
+}
+
+/**
+ * @brief Summarizes the lateness of the phase starts
+ *
+ * @return jitter percentiles and cumulative drift
+ * */
+rvs::pulse_jitter_t rvs::pulse_scheduler::jitter(void) const {
+  pulse_jitter_t j = {};
+  j.boundaries = lateness_ns.size();
+  if (lateness_ns.empty())
+    return j;
+
+  std::vector<double> us;
+  us.reserve(lateness_ns.size());
+  for (int64_t ns : lateness_ns)
+    us.push_back(ns / 1e3);
+
+  j.p50_us = percentile(us, 50);
+  j.p90_us = percentile(us, 90);
+  j.p99_us = percentile(us, 99);
+  j.max_us = *std::max_element(us.begin(), us.end());
+  j.drift_us = pulse_late_ns / 1e3;
+  return j;
+}
+
+/**
+ * @brief Percentile with linear interpolation between closest ranks
+ *
+ * @param values samples (any order)
+ * @param p percentile in [0, 100]
+ * @return the percentile, 0 for no samples
+ * */
+double rvs::percentile(std::vector<double> values, double p) {
+  if (values.empty())
+    return 0;
+  std::sort(values.begin(), values.end());
+  double rank = std::min(100.0, std::max(0.0, p)) / 100 * (values.size() - 1);
+  size_t lo = static_cast<size_t>(std::floor(rank));
+  size_t hi = std::min(values.size() - 1, lo + 1);
+  return values[lo] + (values[hi] - values[lo]) * (rank - lo);
+}
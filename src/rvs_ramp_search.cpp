@@ -0,0 +1,235 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_ramp_search.h"
+
+#include <algorithm>
+#include <cmath>
+
+//! growth limit of the batch size per step
+#define RAMP_MAX_CALLS_GROWTH                   8
+
+/**
+ * @brief Two sided 95% quantile of the Student t distribution
+ *
+ * @param dof degrees of freedom
+ * @return t value (normal quantile above 30 degrees of freedom)
+ * */
+double rvs::student_t95(uint64_t dof) {
+  static const double t95[] = {
+    12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+  };
+  if (dof == 0)
+    return INFINITY;
+  if (dof <= sizeof(t95) / sizeof(t95[0]))
+    return t95[dof - 1];
+  return 1.960;
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param _size window length (at least 4)
+ * @param _precision relative precision
+ * */
+rvs::steady_state_window::steady_state_window(uint64_t _size,
+                                              double _precision)
+  : size(std::max<uint64_t>(4, _size)), precision(_precision) {
+}
+
+/**
+ * @brief Drops all measurements
+ * */
+void rvs::steady_state_window::clear(void) {
+  samples.clear();
+}
+
+/**
+ * @brief Adds a measurement, the oldest one leaves a full window
+ *
+ * @param x measurement
+ * */
+void rvs::steady_state_window::add(double x) {
+  samples.push_back(x);
+  if (samples.size() > size)
+    samples.pop_front();
+}
+
+/**
+ * @brief Mean of the window
+ *
+ * @return mean, 0 for an empty window
+ * */
+double rvs::steady_state_window::mean(void) const {
+  if (samples.empty())
+    return 0;
+  double sum = 0;
+  for (double x : samples)
+    sum += x;
+  return sum / samples.size();
+}
+
+/**
+ * @brief Sample standard deviation of the window
+ *
+ * @return standard deviation, 0 with less than 2 samples
+ * */
+double rvs::steady_state_window::stddev(void) const {
+  if (samples.size() < 2)
+    return 0;
+  double m = mean();
+  double ss = 0;
+  for (double x : samples)
+    ss += (x - m) * (x - m);
+  return std::sqrt(ss / (samples.size() - 1));
+}
+
+/**
+ * @brief Half width of the 95% confidence interval of the mean
+ *
+ * @return half width, infinity with less than 2 samples
+ * */
+double rvs::steady_state_window::ci_half_width(void) const {
+  if (samples.size() < 2)
+    return INFINITY;
+  return student_t95(samples.size() - 1) * stddev() /
+    std::sqrt(static_cast<double>(samples.size()));
+}
+
+/**
+ * @brief Relative difference of the newer and older half means
+ *
+ * @return (mean(newer) - mean(older)) / mean, 0 with less than 2 samples
+ * */
+double rvs::steady_state_window::trend(void) const {
+  size_t n = samples.size();
+  if (n < 2)
+    return 0;
+  size_t half = n / 2;
+  double older = 0;
+  double newer = 0;
+  for (size_t i = 0; i < half; i++)
+    older += samples[i];
+  for (size_t i = n - half; i < n; i++)
+    newer += samples[i];
+  double m = mean();
+  return m > 0 ? (newer - older) / half / m : 0;
+}
+
+/**
+ * @brief Steady state test
+ *
+ * @return true if the window is full, its confidence interval within the
+ * precision and no trend is left
+ * */
+bool rvs::steady_state_window::converged(void) const {
+  if (!full())
+    return false;
+  double m = mean();
+  if (m <= 0)
+    return false;
+  return ci_half_width() <= precision * m &&
+    std::fabs(trend()) <= precision;
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param _cfg ramp parameters
+ * @param _gflop_per_gemm GFLOP of one GEMM
+ * */
+rvs::gemm_ramp_control::gemm_ramp_control(const gemm_ramp_config_t& _cfg,
+                                          double _gflop_per_gemm)
+  : cfg(_cfg), gflop_per_gemm(_gflop_per_gemm),
+    window(_cfg.window, _cfg.precision), num_calls(0), busy_us(0),
+    is_converged(false) {
+}
+
+/**
+ * @brief GEMMs in the next batch
+ *
+ * @param configured configured batch size, used for the first batch
+ * @return batch size
+ * */
+uint64_t rvs::gemm_ramp_control::calls(uint64_t configured) {
+  if (num_calls == 0)
+    num_calls = std::max<uint64_t>(1, configured);
+  return num_calls;
+}
+
+/**
+ * @brief Takes the batch as a measurement or grows the batch size
+ *
+ * @param calls GEMMs in the batch
+ * @param batch_us batch time in microseconds
+ * @return pass/fail once steady state is established, proceed otherwise
+ * */
+rvs::gemm_action rvs::gemm_ramp_control::on_batch(uint64_t calls,
+                                                  double batch_us) {
+  busy_us += batch_us;
+  if (batch_us <= 0)
+    return gemm_action::proceed;
+
+  double min_batch_us = cfg.min_batch_ms * 1000;
+  if (batch_us < min_batch_us && num_calls < cfg.max_calls) {
+    // too short to be measured reliably: scale the batch up and restart
+    double scale = std::min<double>(RAMP_MAX_CALLS_GROWTH,
+                                    min_batch_us / batch_us);
+    uint64_t next = static_cast<uint64_t>(std::ceil(calls * scale));
+    num_calls = std::min(cfg.max_calls, std::max(num_calls + 1, next));
+    window.clear();
+    return gemm_action::proceed;
+  }
+
+  window.add(calls * gflop_per_gemm / (batch_us / 1e6));
+  if (!window.converged())
+    return gemm_action::proceed;
+
+  is_converged = true;
+  return target_met() ? gemm_action::pass : gemm_action::fail;
+}
+
+/**
+ * @brief Checks the window mean against the target
+ *
+ * @return true if there is no target or the mean GFLOPS are at least
+ * target - tolerance
+ * */
+bool rvs::gemm_ramp_control::target_met(void) const {
+  if (cfg.target <= 0)
+    return window.count() > 0;
+  return window.mean() >= cfg.target - cfg.target * cfg.tolerance;
+}
+
+/**
+ * @brief Coefficient of variation of the window
+ *
+ * @return standard deviation / mean, 0 for an empty window
+ * */
+double rvs::gemm_ramp_control::cv(void) const {
+  double m = window.mean();
+  return m > 0 ? window.stddev() / m : 0;
+}
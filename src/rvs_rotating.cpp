@@ -0,0 +1,155 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_rotating.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Parses a rotating buffer sizing policy
+ *
+ * @param name policy name (fixed, cold or cache)
+ * @param pmode [out] policy
+ * @return true if the name is valid
+ * */
+bool rvs::rotating_mode_parse(const std::string& name, rotating_mode* pmode) {
+  if (name == "fixed")
+    *pmode = rotating_mode::fixed;
+  else if (name == "cold")
+    *pmode = rotating_mode::cold;
+  else if (name == "cache")
+    *pmode = rotating_mode::cache;
+  else
+    return false;
+  return true;
+}
+
+/**
+ * @brief Name of a rotating buffer sizing policy
+ *
+ * */
+const char* rvs::rotating_mode_name(rotating_mode mode) {
+  switch (mode) {
+    case rotating_mode::cold:
+      return "cold";
+    case rotating_mode::cache:
+      return "cache";
+    default:
+      return "fixed";
+  }
+}
+
+/**
+ * @brief Sizes a rotating buffer set
+ *
+ * Calls cycle through the blocks, so between two uses of a block the other
+ * blocks - (blocks - 1) * block_bytes - pass through the cache.
+ * fixed: as many blocks as fit in the requested working set.
+ * cold: enough blocks that margin times the cache is touched between two
+ * uses of a block, so no input is still cached when it is read again.
+ * cache: as many blocks as keep the working set within 1/margin of the cache
+ * (at least one), for the cache resident ceiling.
+ * The set is then limited to max_blocks and max_bytes.
+ *
+ * @param cfg sizing parameters
+ * @param block_bytes bytes one GEMM call touches
+ * @return rotating buffer set
+ * */
+rvs::rotating_plan_t rvs::rotating_plan(const rotating_config_t& cfg,
+                                        uint64_t block_bytes) {
+  rotating_plan_t plan = {1, block_bytes, block_bytes, false, false, false};
+  double margin = std::max(1.0, cfg.margin);
+  double cache = static_cast<double>(cfg.cache_bytes);
+  uint64_t blocks = 1;
+
+  if (block_bytes == 0) {
+    plan.resident = cfg.cache_bytes != 0;
+    return plan;
+  }
+
+  switch (cfg.mode) {
+    case rotating_mode::fixed:
+      blocks = (cfg.fixed_bytes + block_bytes - 1) / block_bytes;
+      break;
+    case rotating_mode::cold:
+      if (cfg.cache_bytes)
+        blocks = static_cast<uint64_t>(std::ceil(margin * cache / block_bytes))
+          + 1;
+      break;
+    case rotating_mode::cache:
+      blocks = static_cast<uint64_t>(cache / (margin * block_bytes));
+      break;
+  }
+  blocks = std::max<uint64_t>(1, blocks);
+
+  uint64_t limit = std::max<uint64_t>(1, cfg.max_blocks);
+  if (cfg.max_bytes)
+    limit = std::min(limit,
+        std::max<uint64_t>(1, cfg.max_bytes / block_bytes));
+  if (blocks > limit) {
+    blocks = limit;
+    plan.capped = true;
+  }
+
+  plan.blocks = blocks;
+  plan.working_set = blocks * block_bytes;
+  if (cfg.cache_bytes) {
+    plan.cold = blocks > 1 &&
+      static_cast<double>(blocks - 1) * block_bytes >= margin * cache;
+    plan.resident = static_cast<double>(plan.working_set) * margin <= cache;
+  }
+  return plan;
+}
+
+/**
+ * @brief Describes a rotating buffer set for logging
+ *
+ * */
+std::string rvs::rotating_summary(const rotating_config_t& cfg,
+                                  const rotating_plan_t& plan) {
+  char buff[256];
+  const double mib = 1024.0 * 1024.0;
+
+  snprintf(buff, sizeof(buff),
+      "mode: %s blocks: %llu block: %.2f MiB working set: %.2f MiB",
+      rotating_mode_name(cfg.mode),
+      static_cast<unsigned long long>(plan.blocks),
+      plan.block_bytes / mib, plan.working_set / mib);
+  std::string s = buff;
+
+  if (cfg.cache_bytes) {
+    snprintf(buff, sizeof(buff), " cache: %.2f MiB inputs: %s",
+        cfg.cache_bytes / mib,
+        plan.cold ? "cold" : (plan.resident ? "cache resident" : "mixed"));
+    s += buff;
+  } else {
+    s += " cache: unknown";
+  }
+  if (plan.capped)
+    s += " (capped)";
+  return s;
+}
@@ -0,0 +1,307 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_telemetry_corr.h"
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <istream>
+#include <ostream>
+#include <sstream>
+
+/**
+ * @brief Adds a telemetry sample
+ *
+ * @param s sample, in time order
+ * */
+void rvs::telemetry_corr::add_sample(const sample_t& s) {
+  std::lock_guard<std::mutex> lk(mtx);
+  samples.push_back(s);
+}
+
+/**
+ * @brief Adds a throughput interval
+ *
+ * @param iv interval, in time order
+ * */
+void rvs::telemetry_corr::add_interval(const interval_t& iv) {
+  std::lock_guard<std::mutex> lk(mtx);
+  intervals.push_back(iv);
+}
+
+/**
+ * @brief Drops all the samples and intervals
+ * */
+void rvs::telemetry_corr::clear(void) {
+  std::lock_guard<std::mutex> lk(mtx);
+  samples.clear();
+  intervals.clear();
+}
+
+/**
+ * @brief Returns a copy of the telemetry samples
+ * */
+std::vector<rvs::telemetry_corr::sample_t>
+rvs::telemetry_corr::get_samples(void) const {
+  std::lock_guard<std::mutex> lk(mtx);
+  return samples;
+}
+
+/**
+ * @brief Returns a copy of the throughput intervals
+ * */
+std::vector<rvs::telemetry_corr::interval_t>
+rvs::telemetry_corr::get_intervals(void) const {
+  std::lock_guard<std::mutex> lk(mtx);
+  return intervals;
+}
+
+/**
+ * @brief Median of a set of values
+ *
+ * @param v values
+ * @return median (0 if empty)
+ * */
+double rvs::telemetry_corr::median(std::vector<double> v) {
+  if (v.empty())
+    return 0;
+  size_t mid = v.size() / 2;
+  std::nth_element(v.begin(), v.begin() + mid, v.end());
+  double m = v[mid];
+  if (v.size() % 2 == 0) {
+    double lower = *std::max_element(v.begin(), v.begin() + mid);
+    m = (m + lower) / 2;
+  }
+  return m;
+}
+
+/**
+ * @brief GFLOPS the intervals are compared against
+ *
+ * @return median interval GFLOPS
+ * */
+double rvs::telemetry_corr::reference_gflops(void) const {
+  std::vector<double> g;
+  {
+    std::lock_guard<std::mutex> lk(mtx);
+    for (const interval_t& iv : intervals)
+      g.push_back(iv.gflops);
+  }
+  return median(g);
+}
+
+/**
+ * @brief Finds the throughput dips and annotates them with telemetry
+ *
+ * The telemetry of a dip is taken from the samples within the interval or,
+ * if there are none (interval shorter than the sampling period), from the
+ * last sample before its end.
+ *
+ * @param cfg analysis parameters
+ * @return dips in time order
+ * */
+std::vector<rvs::telemetry_corr::dip_t>
+rvs::telemetry_corr::analyze(const config_t& cfg) const {
+  std::vector<sample_t> s = get_samples();
+  std::vector<interval_t> ivs = get_intervals();
+  std::vector<dip_t> dips;
+
+  std::vector<double> g, clk;
+  for (const interval_t& iv : ivs)
+    g.push_back(iv.gflops);
+  for (const sample_t& x : s)
+    if (x.gfx_mhz > 0)
+      clk.push_back(x.gfx_mhz);
+  double ref = median(g);
+  double ref_mhz = median(clk);
+  if (ref <= 0)
+    return dips;
+
+  auto by_time = [](const sample_t& x, double t) { return x.t_us < t; };
+
+  for (size_t i = 0; i < ivs.size(); i++) {
+    const interval_t& iv = ivs[i];
+    double drop = (ref - iv.gflops) / ref;
+    if (drop <= cfg.dip_threshold)
+      continue;
+
+    dip_t d = {};
+    d.index = i;
+    d.interval = iv;
+    d.drop = drop;
+    d.max_power_w = -1;
+    d.power_cap_w = -1;
+    d.max_temp_c = -1;
+    d.temp_limit_c = -1;
+    d.min_gfx_mhz = -1;
+
+    double start_us = iv.end_us - iv.seconds * 1e6;
+    auto first = std::lower_bound(s.begin(), s.end(), start_us, by_time);
+    auto last = std::upper_bound(s.begin(), s.end(), iv.end_us,
+        [](double t, const sample_t& x) { return t < x.t_us; });
+    d.samples = last - first;
+    if (first == last && first != s.begin())
+      first = last - 1;
+
+    for (auto it = first; it != last; ++it) {
+      d.max_power_w = std::max(d.max_power_w, it->power_w);
+      d.max_temp_c = std::max(d.max_temp_c, it->temp_c);
+      if (it->power_cap_w > 0)
+        d.power_cap_w = it->power_cap_w;
+      if (it->temp_limit_c > 0)
+        d.temp_limit_c = it->temp_limit_c;
+      if (it->gfx_mhz > 0 && (d.min_gfx_mhz < 0 || it->gfx_mhz < d.min_gfx_mhz))
+        d.min_gfx_mhz = it->gfx_mhz;
+      d.throttle |= it->throttle;
+    }
+
+    if (first == last) {
+      d.cause = cause_t::no_telemetry;
+    } else if (d.temp_limit_c > 0 && d.max_temp_c >= 0 &&
+        d.max_temp_c >= d.temp_limit_c - cfg.temp_margin_c) {
+      d.cause = cause_t::thermal;
+    } else if (d.power_cap_w > 0 && d.max_power_w >= 0 &&
+        d.max_power_w >= d.power_cap_w * (1 - cfg.power_margin)) {
+      d.cause = cause_t::power_cap;
+    } else if (d.throttle) {
+      d.cause = cause_t::throttle;
+    } else if (ref_mhz > 0 && d.min_gfx_mhz > 0 &&
+        d.min_gfx_mhz < ref_mhz * (1 - cfg.clock_drop)) {
+      d.cause = cause_t::clock;
+    } else {
+      d.cause = cause_t::unknown;
+    }
+
+    dips.push_back(d);
+  }
+
+  return dips;
+}
+
+/**
+ * @brief Writes the samples and intervals as text
+ *
+ * One record per line: "S t_us power_w power_cap_w temp_c temp_limit_c
+ * gfx_mhz gfx_max_mhz throttle" or "I end_us seconds gflops".
+ *
+ * @param os output stream
+ * @return false if writing failed
+ * */
+bool rvs::telemetry_corr::save(std::ostream& os) const {
+  std::vector<sample_t> s = get_samples();
+  std::vector<interval_t> ivs = get_intervals();
+  char line[256];
+
+  os << "# rvs telemetry trace\n";
+  for (const sample_t& x : s) {
+    snprintf(line, sizeof(line), "S %.1f %.3f %.3f %.3f %.3f %.1f %.1f %llu\n",
+        x.t_us, x.power_w, x.power_cap_w, x.temp_c, x.temp_limit_c,
+        x.gfx_mhz, x.gfx_max_mhz, static_cast<unsigned long long>(x.throttle));
+    os << line;
+  }
+  for (const interval_t& iv : ivs) {
+    snprintf(line, sizeof(line), "I %.1f %.6f %.3f\n", iv.end_us, iv.seconds,
+        iv.gflops);
+    os << line;
+  }
+  return static_cast<bool>(os);
+}
+
+/**
+ * @brief Reads samples and intervals written by save()
+ *
+ * Replaces the current content; empty lines and lines starting with '#'
+ * are ignored.
+ *
+ * @param is input stream
+ * @return false on a malformed record (content is left unchanged)
+ * */
+bool rvs::telemetry_corr::load(std::istream& is) {
+  std::vector<sample_t> s;
+  std::vector<interval_t> ivs;
+  std::string line;
+
+  while (std::getline(is, line)) {
+    if (line.empty() || line[0] == '#')
+      continue;
+
+    std::istringstream ls(line);
+    std::string tag;
+    ls >> tag;
+    if (tag == "S") {
+      sample_t x = {};
+      unsigned long long throttle = 0;
+      if (!(ls >> x.t_us >> x.power_w >> x.power_cap_w >> x.temp_c >>
+            x.temp_limit_c >> x.gfx_mhz >> x.gfx_max_mhz >> throttle))
+        return false;
+      x.throttle = throttle;
+      s.push_back(x);
+    } else if (tag == "I") {
+      interval_t iv = {};
+      if (!(ls >> iv.end_us >> iv.seconds >> iv.gflops))
+        return false;
+      ivs.push_back(iv);
+    } else {
+      return false;
+    }
+  }
+
+  std::lock_guard<std::mutex> lk(mtx);
+  samples.swap(s);
+  intervals.swap(ivs);
+  return true;
+}
+
+/**
+ * @brief Returns the name of a dip cause
+ * */
+const char* rvs::telemetry_corr::cause_name(cause_t c) {
+  switch (c) {
+    case cause_t::thermal: return "thermal";
+    case cause_t::power_cap: return "power_cap";
+    case cause_t::throttle: return "throttle";
+    case cause_t::clock: return "clock";
+    case cause_t::unknown: return "unknown";
+    case cause_t::no_telemetry: return "no_telemetry";
+  }
+  return "unknown";
+}
+
+/**
+ * @brief One line description of a dip for the log
+ *
+ * @param d dip
+ * @return description
+ * */
+std::string rvs::telemetry_corr::describe(const dip_t& d) {
+  char buff[384];
+  snprintf(buff, sizeof(buff),
+      "interval %zu gflops %.0f (-%.1f%%) cause: %s power(W): %.1f/%.1f "
+      "temp(C): %.1f/%.1f gfx(MHz): %.0f throttle: 0x%llx samples: %zu",
+      d.index, d.interval.gflops, d.drop * 100, cause_name(d.cause),
+      d.max_power_w, d.power_cap_w, d.max_temp_c, d.temp_limit_c,
+      d.min_gfx_mhz, static_cast<unsigned long long>(d.throttle), d.samples);
+  return buff;
+}
@@ -0,0 +1,265 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvs_thermal_control.h"
+
+#include <algorithm>
+#include <cmath>
+
+//! covariance trace above which forgetting is suspended
+#define THERMAL_RLS_TRACE_CAP (1e4)
+//! initial covariance
+#define THERMAL_RLS_P0 (1e4)
+
+/**
+ * @brief Constructor
+ *
+ * @param _forgetting forgetting factor (1 - no forgetting)
+ * */
+rvs::thermal_model_estimator::thermal_model_estimator(double _forgetting)
+  : forgetting(_forgetting) {
+  reset();
+}
+
+/**
+ * @brief Forgets all samples
+ * */
+void rvs::thermal_model_estimator::reset(void) {
+  a = 0;
+  b = 0;
+  p[0][0] = p[1][1] = THERMAL_RLS_P0;
+  p[0][1] = p[1][0] = 0;
+  dt = 0;
+  num_samples = 0;
+}
+
+/**
+ * @brief Adds one sample
+ *
+ * @param x temperature rise over idle at the start of the sample in C
+ * @param u load command held over the sample
+ * @param x_next temperature rise over idle at the end of the sample in C
+ * @param dt_s sample period in seconds
+ * */
+void rvs::thermal_model_estimator::add(double x, double u, double x_next,
+                                       double dt_s) {
+  // gain K = P * phi / (lambda + phi' * P * phi), phi = (x, u)
+  double lambda = p[0][0] + p[1][1] < THERMAL_RLS_TRACE_CAP ? forgetting : 1;
+  double pphi0 = p[0][0] * x + p[0][1] * u;
+  double pphi1 = p[1][0] * x + p[1][1] * u;
+  double den = lambda + x * pphi0 + u * pphi1;
+  double k0 = pphi0 / den;
+  double k1 = pphi1 / den;
+
+  double e = x_next - (a * x + b * u);
+  a += k0 * e;
+  b += k1 * e;
+
+  // P = (P - K * phi' * P) / lambda, phi' * P = (pphi0, pphi1) (P symmetric)
+  double p00 = (p[0][0] - k0 * pphi0) / lambda;
+  double p01 = (p[0][1] - k0 * pphi1) / lambda;
+  double p11 = (p[1][1] - k1 * pphi1) / lambda;
+  p[0][0] = p00;
+  p[0][1] = p[1][0] = p01;
+  p[1][1] = p11;
+
+  num_samples++;
+  dt += (dt_s - dt) / num_samples;
+}
+
+/**
+ * @brief Returns the estimated thermal time constant
+ *
+ * @return time constant in seconds (0 if the estimate is not valid)
+ * */
+double rvs::thermal_model_estimator::time_constant(void) const {
+  if (!valid())
+    return 0;
+  return -dt / std::log(a);
+}
+
+/**
+ * @brief Returns the estimated steady state rise over idle at full load
+ *
+ * @return temperature rise in C (0 if the estimate is not valid)
+ * */
+double rvs::thermal_model_estimator::full_load_rise(void) const {
+  if (!valid())
+    return 0;
+  return b / (1 - a);
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param _cfg controller parameters
+ * */
+rvs::thermal_mpc::thermal_mpc(const thermal_mpc_config_t& _cfg)
+  : cfg(_cfg), estimator(_cfg.forgetting), have_prev(false), ready(false),
+    held(false), idle_c(0), prev_t(0), prev_x(0), max_x(0), x_pred(0),
+    dist(0), cmd(1) {
+  if (cfg.horizon < 1)
+    cfg.horizon = 1;
+}
+
+/**
+ * @brief Computes the command held over the horizon
+ *
+ * With s_j = 1 + a + ... + a^(j-1) the model predicts
+ * x_j = a^j * x + (b * u + d) * s_j; the command minimizes the squared
+ * tracking error over j = 1..horizon plus the move penalty; on the approach
+ * it is limited so that no x_j exceeds the target.
+ *
+ * @param x current temperature rise over idle in C
+ * @return command in [min_command, 1]
+ * */
+double rvs::thermal_mpc::solve(double x) const {
+  double a = estimator.get_a();
+  double b = estimator.get_b();
+  double r = cfg.target_c - idle_c;
+
+  double num = cfg.move_weight * cmd;
+  double den = cfg.move_weight;
+  double u_max = 1;
+  double aj = 1;
+  double sj = 0;
+  for (uint32_t j = 1; j <= cfg.horizon; j++) {
+    sj += aj;
+    aj *= a;
+    double alpha = aj * x + dist * sj;
+    double beta = b * sj;
+    num += beta * (r - alpha);
+    den += beta * beta;
+    u_max = std::min(u_max, (r - alpha) / beta);
+  }
+
+  double u = den > 0 ? num / den : 1;
+  if (!held)
+    u = std::min(u, u_max);
+  return std::min(1.0, std::max(cfg.min_command, u));
+}
+
+/**
+ * @brief Takes a temperature sample and computes the next command
+ *
+ * @param t_s sample time in seconds
+ * @param temp_c junction temperature in C
+ * @return load command in [min_command, 1]
+ * */
+double rvs::thermal_mpc::update(double t_s, double temp_c) {
+  if (!have_prev) {
+    idle_c = temp_c;
+    prev_t = t_s;
+    prev_x = 0;
+    have_prev = true;
+    cmd = temp_c < cfg.target_c ? 1 : cfg.min_command;
+    return cmd;
+  }
+
+  double dt_s = t_s - prev_t;
+  if (dt_s <= 0)
+    return cmd;
+
+  double x = temp_c - idle_c;
+  // identify on the approach only: the hold carries little information
+  // and would let the estimate drift
+  if (!held)
+    estimator.add(prev_x, cmd, x, dt_s);
+  max_x = std::max(max_x, x);
+
+  if (ready && estimator.valid()) {
+    // the disturbance absorbs what the model did not predict
+    double nominal = estimator.get_a() * prev_x + estimator.get_b() * cmd;
+    dist += cfg.disturbance_gain * (x - nominal - dist);
+  }
+
+  ready = ready || (estimator.samples() >= cfg.min_samples &&
+                    max_x >= cfg.min_rise_c && estimator.valid());
+
+  if (ready && estimator.valid()) {
+    held = held || temp_c >= cfg.target_c;
+    cmd = solve(x);
+    x_pred = estimator.get_a() * x + estimator.get_b() * cmd + dist;
+  } else {
+    cmd = temp_c < cfg.target_c ? 1 : cfg.min_command;
+    x_pred = x;
+  }
+
+  prev_t = t_s;
+  prev_x = x;
+  return cmd;
+}
+
+/**
+ * @brief Constructor
+ *
+ * @param _target_c target temperature in C
+ * @param _band_c band around the target in C
+ * */
+rvs::thermal_track_stats::thermal_track_stats(double _target_c,
+                                              double _band_c)
+  : target_c(_target_c), band_c(_band_c), reach_s(-1), max_over(0),
+    hold_sq(0), hold_max(0), num_hold(0), num_in_band(0) {
+}
+
+/**
+ * @brief Adds one temperature sample
+ *
+ * @param t_s time since the start of the loop in seconds
+ * @param temp_c temperature in C
+ * */
+void rvs::thermal_track_stats::add(double t_s, double temp_c) {
+  double error = temp_c - target_c;
+  max_over = std::max(max_over, error);
+
+  if (reach_s < 0) {
+    if (error < -band_c)
+      return;
+    reach_s = t_s;
+  }
+
+  hold_sq += error * error;
+  hold_max = std::max(hold_max, std::fabs(error));
+  num_hold++;
+  if (std::fabs(error) <= band_c)
+    num_in_band++;
+}
+
+/**
+ * @brief Returns the RMS error of the hold phase
+ *
+ * @return RMS error in C (0 if the target was not reached)
+ * */
+double rvs::thermal_track_stats::hold_error(void) const {
+  return num_hold ? std::sqrt(hold_sq / num_hold) : 0;
+}
+
+/**
+ * @brief Returns the fraction of hold samples within the band
+ *
+ * @return fraction in [0, 1] (0 if the target was not reached)
+ * */
+double rvs::thermal_track_stats::hold_in_band(void) const {
+  return num_hold ? static_cast<double>(num_in_band) / num_hold : 0;
+}
@@ -55,6 +55,7 @@ rvs::actionbase::actionbase() {
   property_device_all = true;
   property_device_index_all = true;
   property_device_id = 0u;
+  property_cpu_affinity = DEFAULT_CPU_AFFINITY;
   property_device.clear();
   property_device_index.clear();
   callback = nullptr;
@@ -224,6 +225,14 @@ bool rvs::actionbase::get_all_common_config_keys(void) {
     bsts = false;
   }
 
+  if (property_get(RVS_CONF_CPU_AFFINITY_KEY, &property_cpu_affinity,
+        DEFAULT_CPU_AFFINITY)) {
+    msg = "invalid '" +
+      std::string(RVS_CONF_CPU_AFFINITY_KEY) + "' key value";
+    rvs::lp::Err(msg, module_name, action_name);
+    bsts = false;
+  }
+
   if (duration_mods.find(module_name) == duration_mods.end())
     return bsts;
 
@@ -246,6 +255,46 @@ bool rvs::actionbase::get_all_common_config_keys(void) {
   return bsts;
 }
  
+/**
+ * @brief Pin per-GPU worker thread to CPUs local to its GPU
+ *
+ * Does nothing unless 'cpu_affinity' key is set. Resulting CPU set is
+ * reported for each worker.
+ *
+ * @param pworker worker thread (not yet started)
+ * @param gpu_id GPU the worker is driving
+ *
+ * */
+void rvs::actionbase::set_worker_affinity(rvs::ThreadBase* pworker,
+    uint16_t gpu_id) {
+  std::string msg;
+  uint16_t node_id;
+  rvs::cpu_affinity_t aff;
+
+  if (!property_cpu_affinity)
+    return;
+
+  if (rvs::gpulist::gpu2node(gpu_id, &node_id) ||
+      rvs::affinity::gpu_local_affinity(node_id, &aff)) {
+    msg = "[" + action_name + "] " + module_name + " " +
+      std::to_string(gpu_id) +
+      " could not determine GPU local CPUs, thread will not be pinned";
+    rvs::lp::Log(msg, rvs::loginfo);
+    return;
+  }
+
+  pworker->set_cpu_affinity(aff);
+
+  msg = "[" + action_name + "] " + module_name + " " +
+    std::to_string(gpu_id) + " cpu affinity " + rvs::affinity::to_string(aff);
+  rvs::lp::Log(msg, rvs::loginfo);
+  if (bjson) {
+    log_to_json(action_descriptor{action_name, module_name, gpu_id},
+        rvs::loginfo, "numa_node", std::to_string(aff.numa_node),
+        "cpuset", rvs::affinity::cpu_list_to_string(aff.cpus));
+  }
+}
+
 /**
  * @brief Checks if property is set.
  *
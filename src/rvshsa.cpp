@@ -36,8 +36,10 @@
 #include "hsa/hsa.h"
 #include "hsa/hsa_ext_amd.h"
 
+#include "include/rvs_affinity.h"
 #include "include/rvs_util.h"
 #include "include/rvsloglp.h"
+#include "include/rvstracer.h"
 
 extern void gpu_get_all_gpu_id(std::vector<uint16_t>* pgpus_id);
 // ptr to singletone instance
@@ -50,6 +52,7 @@ const uint32_t rvs::hsa::NO_CONN;
  * */
 void rvs::hsa::Init() {
   if (pDsc == nullptr) {
+    RVS_TRACE_SCOPE("topology", "hsa_init_agents");
     pDsc = new rvs::hsa();
     pDsc->InitAgents();
   }
@@ -321,6 +324,11 @@ void rvs::hsa::InitAgents() {
 
     // separate the lists
     if (agent_list[i].agent_device_type == "CPU") {
+      // one CPU agent per online NUMA node with CPUs, in node id order
+      int numa_node;
+      agent_list[i].numa_node =
+        rvs::affinity::cpu_node_to_numa_node(cpu_list.size(), &numa_node) ?
+        NO_CONN : numa_node;
       cpu_list.push_back(agent_list[i]);
     } else if (agent_list[i].agent_device_type == "GPU") {
       gpu_list.push_back(agent_list[i]);
@@ -386,6 +394,7 @@ hsa_status_t rvs::hsa::ProcessAgent(hsa_agent_t agent, void* data) {
     print_hsa_status(__FILE__, __LINE__, __func__,
                    "[RVSHSA] HSA_AGENT_INFO_NODE", status);
   agent_info.node = node;
+  agent_info.numa_node = NO_CONN;
   rvs::lp::Log("node: " + std::to_string(node), rvs::logdebug);
 
   log_agent_name = agent_name;
@@ -745,6 +754,7 @@ int rvs::hsa::SendTraffic(uint32_t SrcNode, uint32_t DstNode,
                           size_t Size, bool bidirectional, bool b2b,
                           uint32_t warm_calls, uint32_t hot_calls,
                           double* Duration) {
+  RVS_TRACE_SCOPE("hsa", "copy");
   hsa_status_t status;
   int sts;
 
@@ -918,6 +928,189 @@ int rvs::hsa::SendTraffic(uint32_t SrcNode, uint32_t DstNode,
 }
 
 
+/**
+ * @brief Copy data between two buffers and wait for the copy to complete
+ *
+ * @param Dst destination buffer
+ * @param DstAgent agent owning the destination buffer
+ * @param Src source buffer
+ * @param SrcAgent agent owning the source buffer
+ * @param Size size of data to copy
+ * @param Signal signal used to wait on the copy
+ * @return 0 - if successfull, non-zero otherwise
+ *
+ * */
+int rvs::hsa::CopyWait(void* Dst, hsa_agent_t DstAgent,
+                       const void* Src, hsa_agent_t SrcAgent,
+                       size_t Size, hsa_signal_t Signal) {
+  hsa_status_t status;
+
+  hsa_signal_store_relaxed(Signal, 1);
+  if (HSA_STATUS_SUCCESS !=
+      (status = hsa_amd_memory_async_copy(Dst, DstAgent, Src, SrcAgent,
+                                          Size, 0, NULL, Signal))) {
+    print_hsa_status(__FILE__, __LINE__, __func__,
+        "hsa_amd_memory_async_copy()",
+        status);
+    return -1;
+  }
+  hsa_signal_wait_acquire(Signal, HSA_SIGNAL_CONDITION_LT, 1, uint64_t(-1),
+                          HSA_WAIT_STATE_BLOCKED);
+  return 0;
+}
+
+/**
+ * @brief Verify data delivered by a transfer between two NUMA nodes
+ *
+ * Source and destination buffers are allocated the same way SendTraffic()
+ * allocates them. The source is filled with a pattern derived from Seed
+ * through a host staging buffer in system memory, copied to the
+ * destination, and the destination is read back into the staging buffer
+ * and compared with the pattern in 32 bit words. Nothing here is timed,
+ * so the check does not affect the bandwidth of SendTraffic().
+ *
+ * @param SrcNode source NUMA node
+ * @param DstNode destination NUMA node
+ * @param Size size of data to transfer
+ * @param Seed pattern seed
+ * @param Inspect called with the host copy of the destination before it
+ * is compared (may be empty)
+ * @param pMismatch [out] number of words that differ from the pattern
+ * @return 0 - if successfull, non-zero otherwise
+ *
+ * */
+int rvs::hsa::VerifyTraffic(uint32_t SrcNode, uint32_t DstNode, size_t Size,
+    uint64_t Seed, const std::function<void(void*, size_t)>& Inspect,
+    size_t* pMismatch) {
+  RVS_TRACE_SCOPE("hsa", "verify");
+  hsa_status_t status;
+  hsa_amd_memory_pool_t src_pool;
+  hsa_amd_memory_pool_t dst_pool;
+  void* src_ptr = nullptr;
+  void* dst_ptr = nullptr;
+  void* host_ptr = nullptr;
+  hsa_signal_t signal;
+  int sts = 0;
+
+  *pMismatch = 0;
+
+  int32_t src_ix = FindAgent(SrcNode);
+  int32_t dst_ix = FindAgent(DstNode);
+  if (src_ix < 0 || dst_ix < 0 || Size == 0) {
+    RVSHSATRACE_
+    return -1;
+  }
+
+  // stage through system memory of the CPU end of the transfer (first CPU
+  // agent for peer to peer transfers)
+  int32_t host_ix = -1;
+  if (agent_list[src_ix].agent_device_type == "CPU") {
+    host_ix = src_ix;
+  } else if (agent_list[dst_ix].agent_device_type == "CPU") {
+    host_ix = dst_ix;
+  } else if (cpu_list.size() > 0) {
+    host_ix = FindAgent(cpu_list[0].node);
+  }
+  if (host_ix < 0 || agent_list[host_ix].sys_pool.handle == 0) {
+    RVSHSATRACE_
+    return -1;
+  }
+  hsa_agent_t host_agent = agent_list[host_ix].agent;
+
+  if (Allocate(src_ix, dst_ix, Size, &src_pool, &src_ptr,
+               &dst_pool, &dst_ptr)) {
+    RVSHSATRACE_
+    return -1;
+  }
+
+  if (HSA_STATUS_SUCCESS != (status = hsa_amd_memory_pool_allocate(
+              agent_list[host_ix].sys_pool, Size, 0, &host_ptr))) {
+    print_hsa_status(__FILE__, __LINE__, __func__,
+        "hsa_amd_memory_pool_allocate()",
+        status);
+    hsa_amd_memory_pool_free(src_ptr);
+    hsa_amd_memory_pool_free(dst_ptr);
+    return -1;
+  }
+
+  hsa_agent_t gpus[2];
+  uint32_t num_gpus = 0;
+  if (agent_list[src_ix].agent_device_type == "GPU")
+    gpus[num_gpus++] = agent_list[src_ix].agent;
+  if (agent_list[dst_ix].agent_device_type == "GPU" && dst_ix != src_ix)
+    gpus[num_gpus++] = agent_list[dst_ix].agent;
+  if (num_gpus > 0 && HSA_STATUS_SUCCESS !=
+      (status = hsa_amd_agents_allow_access(num_gpus, gpus, NULL,
+                                            host_ptr))) {
+    print_hsa_status(__FILE__, __LINE__, __func__,
+        "hsa_amd_agents_allow_access()",
+        status);
+    hsa_amd_memory_pool_free(host_ptr);
+    hsa_amd_memory_pool_free(src_ptr);
+    hsa_amd_memory_pool_free(dst_ptr);
+    return -1;
+  }
+
+  if (HSA_STATUS_SUCCESS !=
+      (status = hsa_signal_create(1, 0, NULL, &signal))) {
+    print_hsa_status(__FILE__, __LINE__, __func__,
+        "hsa_signal_create()",
+        status);
+    hsa_amd_memory_pool_free(host_ptr);
+    hsa_amd_memory_pool_free(src_ptr);
+    hsa_amd_memory_pool_free(dst_ptr);
+    return -1;
+  }
+
+  // pattern: one mixed 32 bit word per word index, tail bytes take the low
+  // bytes of the next word
+  const size_t words = (Size + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+  std::vector<uint32_t> expected(words);
+  for (size_t i = 0; i < words; i++) {
+    uint64_t z = Seed + (i + 1) * 0x9e3779b97f4a7c15ULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    expected[i] = static_cast<uint32_t>(z ^ (z >> 31));
+  }
+
+  memcpy(host_ptr, expected.data(), Size);
+  if (CopyWait(src_ptr, agent_list[src_ix].agent,
+               host_ptr, host_agent, Size, signal) ||
+      CopyWait(dst_ptr, agent_list[dst_ix].agent,
+               src_ptr, agent_list[src_ix].agent, Size, signal)) {
+    sts = -1;
+  } else {
+    // clear the staging buffer so stale pattern cannot pass the compare
+    memset(host_ptr, 0, Size);
+    if (CopyWait(host_ptr, host_agent,
+                 dst_ptr, agent_list[dst_ix].agent, Size, signal))
+      sts = -1;
+  }
+
+  if (sts == 0) {
+    if (Inspect)
+      Inspect(host_ptr, Size);
+
+    const uint8_t* got = static_cast<const uint8_t*>(host_ptr);
+    const uint8_t* exp = reinterpret_cast<const uint8_t*>(expected.data());
+    for (size_t i = 0; i < words; i++) {
+      size_t offset = i * sizeof(uint32_t);
+      size_t len = std::min(sizeof(uint32_t), Size - offset);
+      if (memcmp(got + offset, exp + offset, len))
+        (*pMismatch)++;
+    }
+  }
+
+  hsa_signal_destroy(signal);
+  hsa_amd_memory_pool_free(host_ptr);
+  hsa_amd_memory_pool_free(src_ptr);
+  hsa_amd_memory_pool_free(dst_ptr);
+
+  RVSHSATRACE_
+  return sts;
+}
+
+
 /**
  * @brief Get peer status between Src and Dst nodes
  *
@@ -1135,6 +1328,47 @@ int rvs::hsa::GetLinkInfo(uint32_t SrcNode, uint32_t DstNode,
   return 0;
 }
 
+/**
+ * @brief Get NUMA distance between two nodes in either direction
+ *
+ * @param SrcNode source node
+ * @param DstNode destination node
+ * @return NUMA distance, NO_CONN if nodes are not connected
+ *
+ * */
+uint32_t rvs::hsa::GetNumaDistance(uint32_t SrcNode, uint32_t DstNode) {
+  uint32_t distance = NO_CONN;
+  std::vector<linkinfo_t> arr_linkinfo;
+
+  RVSHSATRACE_
+  GetLinkInfo(SrcNode, DstNode, &distance, &arr_linkinfo);
+  if (distance == NO_CONN) {
+    RVSHSATRACE_
+    GetLinkInfo(DstNode, SrcNode, &distance, &arr_linkinfo);
+  }
+
+  return distance;
+}
+
+/**
+ * @brief Get OS NUMA node of the CPU agent on the given HSA node
+ *
+ * @param Node HSA node of a CPU agent
+ * @param pNumaNode [out] OS NUMA node
+ * @return 0 - OK, -1 if node is not a CPU agent
+ *
+ * */
+int rvs::hsa::GetCpuNumaNode(uint32_t Node, uint32_t* pNumaNode) {
+  for (const auto& cpu : cpu_list) {
+    if (cpu.node == Node) {
+      *pNumaNode = cpu.numa_node;
+      return 0;
+    }
+  }
+
+  RVSHSATRACE_
+  return -1;
+}
 
 void rvs::hsa::PrintTopology() {
   vector<uint16_t> gpuId;
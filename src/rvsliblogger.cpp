@@ -40,6 +40,7 @@
 #include <mutex>
 
 #include "include/rvstrace.h"
+#include "include/rvstracer.h"
 #include "include/rvslognode.h"
 #include "include/rvslognodestring.h"
 #include "include/rvslognodeint.h"
@@ -466,6 +467,7 @@ int rvs::logger::JsonEndNodeCreate(void) {
  *
  */
 int   rvs::logger::LogRecordFlush(void* pLogRecord, bool minimal) {
+  RVS_TRACE_SCOPE("log", "log_record_flush");
   // lock log_mutex for the duration of this block
   std::lock_guard<std::mutex> lk(json_log_mutex);
   std::string val;
@@ -545,6 +547,7 @@ int rvs::logger::ToFile(const std::string& Row, bool json_rec) {
       return 0;
   }
 
+  RVS_TRACE_SCOPE("log", "log_to_file");
   std::string logfile;
   if (json_rec)
 	logfile.assign(json_log_file);
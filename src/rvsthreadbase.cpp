@@ -27,7 +27,7 @@
 #include <chrono>
 
 //! Default constructor.
-rvs::ThreadBase::ThreadBase() : t() {
+rvs::ThreadBase::ThreadBase() : t(), affinity_hint(-1) {
 }
 
 //! Default destructor.
@@ -48,15 +48,16 @@ void rvs::ThreadBase::runinternal() {
 /**
  *  \brief Starts the thread.
  *
- * Creates std::thread object passing runinternal() as thread function.
+ * Queues runinternal() as blocking task on the shared thread pool, pinned
+ * to cpu_affinity if set.
  *
  */
 void rvs::ThreadBase::start() {
-  t = std::thread(&rvs::ThreadBase::runinternal, this);
+  t.start([this]() { runinternal(); }, affinity_hint, cpu_affinity);
 }
 
 /**
- *  \brief Performs detach() on the underlaying std::thread object.
+ *  \brief Performs detach() on the underlaying thread handle.
  *
  */
 void rvs::ThreadBase::detach() {
@@ -64,7 +65,7 @@ void rvs::ThreadBase::detach() {
 }
 
 /**
- *  \brief Performs join() on the underlaying std::thread object.
+ *  \brief Performs join() on the underlaying thread handle.
  *
  */
 void rvs::ThreadBase::join() {
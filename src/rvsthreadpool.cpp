@@ -0,0 +1,427 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvsthreadpool.h"
+
+#include <algorithm>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "include/rvs_affinity.h"
+#include "include/rvsliblogger.h"
+#include "include/rvstracer.h"
+
+/**
+ * @brief Report exception thrown by a task nobody waits for
+ *
+ * @param error exception
+ *
+ * */
+static void log_task_error(std::exception_ptr error) {
+  std::string msg = "pool task failed: ";
+  try {
+    std::rethrow_exception(error);
+  } catch (const std::exception& e) {
+    msg += e.what();
+  } catch (...) {
+    msg += "unknown exception";
+  }
+  rvs::logger::Err(msg.c_str(), "POOL", nullptr);
+}
+
+// ptr to singleton instance
+rvs::ThreadPool* rvs::ThreadPool::pDsc = nullptr;
+std::mutex rvs::ThreadPool::init_mtx;
+
+//! Default constructor.
+rvs::ThreadPool::ThreadPool() {
+  idle = 0;
+  pending = 0;
+  nblocking = 0;
+  next_queue = 0;
+  last_flow_id = 0;
+  bstop = false;
+  max_threads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+//! Default destructor. Waits for queued tasks and stops pool threads.
+rvs::ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lk(mtx);
+    bstop = true;
+  }
+  cv.notify_all();
+
+  for (auto& thread : threads) {
+    if (thread.joinable())
+      thread.join();
+  }
+}
+
+/**
+ * @brief Get pool singleton, create it on first use
+ *
+ * @return pointer to process-wide thread pool
+ *
+ * */
+rvs::ThreadPool* rvs::ThreadPool::Get() {
+  std::lock_guard<std::mutex> lk(init_mtx);
+  if (pDsc == nullptr) {
+    pDsc = new rvs::ThreadPool();
+  }
+  return pDsc;
+}
+
+/**
+ * @brief Stop pool threads and destroy pool singleton
+ *
+ * Queued tasks are executed before the threads exit.
+ *
+ * */
+void rvs::ThreadPool::Terminate() {
+  std::lock_guard<std::mutex> lk(init_mtx);
+  if (pDsc != nullptr) {
+    delete pDsc;
+    pDsc = nullptr;
+  }
+}
+
+/**
+ * @brief Set maximum number of threads used for non-blocking tasks
+ *
+ * @param val thread limit (0 - number of hardware threads)
+ *
+ * */
+void rvs::ThreadPool::set_max_threads(size_t val) {
+  std::lock_guard<std::mutex> lk(mtx);
+  max_threads = val ? val : std::max(1u, std::thread::hardware_concurrency());
+}
+
+//! Get maximum number of threads used for non-blocking tasks
+size_t rvs::ThreadPool::get_max_threads() {
+  std::lock_guard<std::mutex> lk(mtx);
+  return max_threads;
+}
+
+//! Get current number of pool threads
+size_t rvs::ThreadPool::size() {
+  std::shared_lock<std::shared_mutex> rlk(qmtx);
+  return threads.size();
+}
+
+/**
+ * @brief Queue task for execution
+ *
+ * @param task task function
+ * @param hint affinity hint selecting preferred thread queue (-1 - none)
+ * @param aff CPUs and NUMA memory node to run the task on (empty - pool
+ * default)
+ * @param blocking 'true' if task may run for long/wait on other tasks, in
+ * which case a new thread is created if no idle one is available
+ *
+ * */
+void rvs::ThreadPool::submit(task_t task, int hint,
+                             const cpu_affinity_t& aff, bool blocking) {
+  RVS_TRACE_SCOPE("pool", "pool_submit");
+  size_t nthreads = size();
+  bool bspawn;
+  size_t qix;
+  uint64_t flow_id = 0;
+
+  if (rvs::tracer::enabled()) {
+    flow_id = ++last_flow_id;
+    rvs::tracer::flow("pool", "pool_task", flow_id, true);
+  }
+
+  {
+    std::lock_guard<std::mutex> lk(mtx);
+    pending++;
+    RVS_TRACE_COUNTER("pool", "pool_pending", pending);
+    // threads taken by long running tasks do not count against the limit
+    // for short ones
+    if (blocking)
+      nblocking++;
+    bspawn = nthreads == 0 ||
+             (pending > idle &&
+              (blocking || nthreads < max_threads + nblocking));
+    qix = hint >= 0 ? static_cast<size_t>(hint) : next_queue++;
+  }
+
+  if (bspawn) {
+    add_thread();
+  }
+
+  {
+    std::shared_lock<std::shared_mutex> rlk(qmtx);
+    task_queue& q = *queues[qix % queues.size()];
+    std::lock_guard<std::mutex> lk(q.mtx);
+    q.tasks.push_back(pool_task{std::move(task), aff, flow_id, blocking});
+  }
+
+  cv.notify_one();
+}
+
+/**
+ * @brief Create new pool thread together with its task queue
+ *
+ * */
+void rvs::ThreadPool::add_thread() {
+  std::unique_lock<std::shared_mutex> wlk(qmtx);
+  size_t ix = queues.size();
+
+  queues.push_back(std::unique_ptr<task_queue>(new task_queue));
+  threads.push_back(std::thread(&rvs::ThreadPool::worker_loop, this, ix));
+}
+
+/**
+ * @brief Take task from own queue or steal one from other threads
+ *
+ * Own queue is served LIFO (most recently queued, warm data), stealing is
+ * done FIFO from the other end to reduce contention with the owner.
+ *
+ * @param ix index of the calling pool thread
+ * @param ptask [out] task to execute
+ * @return true if task was found
+ *
+ * */
+bool rvs::ThreadPool::pop_task(size_t ix, pool_task* ptask) {
+  bool bfound = false;
+
+  {
+    std::shared_lock<std::shared_mutex> rlk(qmtx);
+    size_t n = queues.size();
+
+    for (size_t k = 0; k < n && !bfound; k++) {
+      task_queue& q = *queues[(ix + k) % n];
+      std::lock_guard<std::mutex> lk(q.mtx);
+      if (q.tasks.empty())
+        continue;
+
+      if (k == 0) {
+        *ptask = std::move(q.tasks.back());
+        q.tasks.pop_back();
+      } else {
+        *ptask = std::move(q.tasks.front());
+        q.tasks.pop_front();
+      }
+      bfound = true;
+    }
+  }
+
+  if (bfound) {
+    std::lock_guard<std::mutex> lk(mtx);
+    pending--;
+    RVS_TRACE_COUNTER("pool", "pool_pending", pending);
+  }
+  return bfound;
+}
+
+/**
+ * @brief Pool thread function
+ *
+ * @param ix index of this thread's task queue
+ *
+ * */
+void rvs::ThreadPool::worker_loop(size_t ix) {
+  if (rvs::tracer::enabled()) {
+    rvs::tracer::set_thread_name("rvs pool " + std::to_string(ix));
+  }
+
+  for (;;) {
+    pool_task task;
+
+    if (pop_task(ix, &task)) {
+      RVS_TRACE_SCOPE("pool", "pool_task");
+      if (task.flow_id != 0) {
+        rvs::tracer::flow("pool", "pool_task", task.flow_id, false);
+      }
+      // tasks may change placement themselves (e.g. pin to a cpuset), so
+      // whatever they leave behind is undone before the thread is reused
+      rvs::thread_placement_t saved;
+      rvs::affinity::get_thread_placement(&saved);
+      if (!task.aff.cpus.empty()) {
+        rvs::affinity::set_thread_affinity(task.aff.cpus);
+      }
+      if (task.aff.numa_node >= 0) {
+        rvs::affinity::set_thread_mem_node(task.aff.numa_node);
+      }
+      try {
+        task.func();
+      } catch (...) {
+        log_task_error(std::current_exception());
+      }
+      if (task.blocking) {
+        std::lock_guard<std::mutex> lk(mtx);
+        nblocking--;
+      }
+      rvs::affinity::set_thread_placement(saved);
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lk(mtx);
+    if (bstop && pending == 0)
+      return;
+
+    idle++;
+    cv.wait(lk, [this] { return bstop || pending > 0; });
+    idle--;
+  }
+}
+
+//! Reports an exception no wait() has collected (e.g. detached task).
+rvs::TaskGroup::group_state::~group_state() {
+  if (error)
+    log_task_error(error);
+}
+
+//! Default constructor.
+rvs::TaskGroup::TaskGroup() : state(std::make_shared<group_state>()) {
+}
+
+/**
+ * @brief Run task on the pool as part of this group
+ *
+ * @param task task function
+ * @param hint affinity hint selecting preferred thread queue (-1 - none)
+ * @param aff CPUs and NUMA memory node to run the task on (empty - pool
+ * default)
+ * @param blocking 'true' if task is long running (see ThreadPool::submit())
+ *
+ * */
+void rvs::TaskGroup::run(ThreadPool::task_t task, int hint,
+                         const cpu_affinity_t& aff, bool blocking) {
+  std::shared_ptr<group_state> st = state;
+
+  {
+    std::lock_guard<std::mutex> lk(st->mtx);
+    st->pending++;
+  }
+
+  ThreadPool::Get()->submit([st, task]() {
+    try {
+      task();
+    } catch (...) {
+      std::unique_lock<std::mutex> lk(st->mtx);
+      if (!st->error) {
+        st->error = std::current_exception();
+      } else {
+        lk.unlock();
+        log_task_error(std::current_exception());
+      }
+    }
+
+    std::lock_guard<std::mutex> lk(st->mtx);
+    if (--st->pending == 0)
+      st->cv.notify_all();
+  }, hint, aff, blocking);
+}
+
+/**
+ * @brief Wait for all tasks in the group to finish
+ *
+ * Rethrows the first exception thrown by any of the tasks; further ones are
+ * logged.
+ *
+ * */
+void rvs::TaskGroup::wait() {
+  std::exception_ptr error;
+
+  {
+    std::unique_lock<std::mutex> lk(state->mtx);
+    state->cv.wait(lk, [this] { return state->pending == 0; });
+    std::swap(error, state->error);
+  }
+
+  if (error)
+    std::rethrow_exception(error);
+}
+
+//! Returns 'true' if all tasks in the group have finished
+bool rvs::TaskGroup::done() {
+  std::lock_guard<std::mutex> lk(state->mtx);
+  return state->pending == 0;
+}
+
+//! Default constructor.
+rvs::PooledThread::PooledThread() {
+}
+
+/**
+ * @brief Start task on a pool thread
+ *
+ * @param task task function
+ * @param hint affinity hint selecting preferred thread queue (-1 - none)
+ * @param aff CPUs and NUMA memory node to run the task on (empty - pool
+ * default)
+ *
+ * */
+void rvs::PooledThread::start(ThreadPool::task_t task, int hint,
+                              const cpu_affinity_t& aff) {
+  std::shared_ptr<std::atomic<std::thread::id>> id =
+    std::make_shared<std::atomic<std::thread::id>>();
+
+  exec_id = id;
+  group.reset(new TaskGroup);
+  group->run([id, task]() {
+    id->store(std::this_thread::get_id());
+    task();
+  }, hint, aff, true);
+}
+
+//! Returns 'true' if task was started and not yet joined or detached
+bool rvs::PooledThread::joinable() const {
+  return group != nullptr;
+}
+
+/**
+ * @brief Wait for the task to finish
+ *
+ * Same as std::thread::join() throws std::system_error if not joinable or
+ * if called from the task itself.
+ *
+ * */
+void rvs::PooledThread::join() {
+  if (!group) {
+    throw std::system_error(std::make_error_code(std::errc::invalid_argument));
+  }
+  if (exec_id && exec_id->load() == std::this_thread::get_id()) {
+    throw std::system_error(
+      std::make_error_code(std::errc::resource_deadlock_would_occur));
+  }
+
+  std::unique_ptr<TaskGroup> g = std::move(group);
+  g->wait();
+}
+
+/**
+ * @brief Let the task run independently of this handle
+ *
+ * */
+void rvs::PooledThread::detach() {
+  if (!group) {
+    throw std::system_error(std::make_error_code(std::errc::invalid_argument));
+  }
+  group.reset();
+}
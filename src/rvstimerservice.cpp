@@ -0,0 +1,267 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvstimerservice.h"
+
+#include <algorithm>
+#include <utility>
+
+// ptr to singleton instance
+rvs::TimerService* rvs::TimerService::pDsc = nullptr;
+std::mutex rvs::TimerService::init_mtx;
+const size_t rvs::TimerService::WHEEL_SLOTS;
+
+//! Default constructor. Starts service thread.
+rvs::TimerService::TimerService() : wheel(WHEEL_SLOTS) {
+  base = clock_t::now();
+  last_tick = 0;
+  last_id = 0;
+  running_id = 0;
+  wakeups = 0;
+  bstop = false;
+  thread = std::thread(&rvs::TimerService::run, this);
+}
+
+//! Default destructor. Stops service thread, pending timers are dropped.
+rvs::TimerService::~TimerService() {
+  {
+    std::lock_guard<std::mutex> lk(mtx);
+    bstop = true;
+  }
+  cv.notify_all();
+
+  if (thread.joinable())
+    thread.join();
+}
+
+/**
+ * @brief Get service singleton, create it on first use
+ *
+ * @return pointer to process-wide timer service
+ *
+ * */
+rvs::TimerService* rvs::TimerService::Get() {
+  std::lock_guard<std::mutex> lk(init_mtx);
+  if (pDsc == nullptr) {
+    pDsc = new rvs::TimerService();
+  }
+  return pDsc;
+}
+
+/**
+ * @brief Stop service thread and destroy service singleton
+ *
+ * */
+void rvs::TimerService::Terminate() {
+  std::lock_guard<std::mutex> lk(init_mtx);
+  if (pDsc != nullptr) {
+    delete pDsc;
+    pDsc = nullptr;
+  }
+}
+
+/**
+ * @brief Arm new timer
+ *
+ * @param deadline first expiration
+ * @param period interval between expirations, zero for one-shot timer
+ * @param callback function called on expiration
+ * @return timer id to be used with cancel()
+ *
+ * */
+uint64_t rvs::TimerService::schedule(clock_t::time_point deadline,
+                                     std::chrono::milliseconds period,
+                                     callback_t callback) {
+  uint64_t id;
+
+  {
+    std::lock_guard<std::mutex> lk(mtx);
+    id = ++last_id;
+    timer_entry& entry = timers[id];
+    entry.deadline = deadline;
+    entry.period = period;
+    entry.callback = std::move(callback);
+    insert(id, &entry);
+  }
+
+  // service thread re-evaluates nearest deadline
+  cv.notify_one();
+  return id;
+}
+
+/**
+ * @brief Disarm timer
+ *
+ * When this returns the callback is not running and will not be called
+ * again, unless cancel() is called from the callback itself.
+ *
+ * @param id timer id returned by schedule()
+ *
+ * */
+void rvs::TimerService::cancel(uint64_t id) {
+  std::unique_lock<std::mutex> lk(mtx);
+
+  if (timers.find(id) != timers.end()) {
+    remove(id);
+    timers.erase(id);
+  }
+
+  if (std::this_thread::get_id() != thread.get_id()) {
+    cv_done.wait(lk, [this, id] { return running_id != id; });
+  }
+}
+
+//! Returns number of times service thread woke up
+uint64_t rvs::TimerService::get_wakeups() {
+  std::lock_guard<std::mutex> lk(mtx);
+  return wakeups;
+}
+
+//! Convert time point to wheel tick (1 ms resolution)
+int64_t rvs::TimerService::to_tick(clock_t::time_point tp) {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+    tp - base).count();
+}
+
+/**
+ * @brief Hash timer into wheel slot of its deadline
+ *
+ * Deadlines already processed by the service thread are hashed on the last
+ * processed tick so that they are picked up on next wakeup.
+ *
+ * */
+void rvs::TimerService::insert(uint64_t id, timer_entry* pentry) {
+  pentry->tick = std::max(to_tick(pentry->deadline), last_tick);
+  wheel[pentry->tick % WHEEL_SLOTS].push_back(id);
+}
+
+//! Remove timer from its wheel slot
+void rvs::TimerService::remove(uint64_t id) {
+  std::vector<uint64_t>& slot = wheel[timers[id].tick % WHEEL_SLOTS];
+  slot.erase(std::remove(slot.begin(), slot.end(), id), slot.end());
+}
+
+/**
+ * @brief Find nearest deadline within one wheel revolution
+ *
+ * @param now_tick current tick
+ * @param pdeadline [out] nearest deadline
+ * @return true if any timer is due within one revolution
+ *
+ * */
+bool rvs::TimerService::next_deadline(int64_t now_tick,
+                                      clock_t::time_point* pdeadline) {
+  for (size_t k = 0; k < WHEEL_SLOTS; k++) {
+    int64_t tick = now_tick + k;
+    bool bfound = false;
+
+    for (uint64_t id : wheel[tick % WHEEL_SLOTS]) {
+      const timer_entry& entry = timers[id];
+      if (entry.tick > tick)
+        continue;  // later revolution
+      if (!bfound || entry.deadline < *pdeadline)
+        *pdeadline = entry.deadline;
+      bfound = true;
+    }
+    if (bfound)
+      return true;
+  }
+  return false;
+}
+
+/**
+ * @brief Service thread function
+ *
+ * Expires due timers, then sleeps until the nearest deadline.
+ *
+ * */
+void rvs::TimerService::run() {
+  std::unique_lock<std::mutex> lk(mtx);
+
+  while (!bstop) {
+    wakeups++;
+
+    clock_t::time_point now = clock_t::now();
+    int64_t now_tick = to_tick(now);
+    std::vector<std::pair<clock_t::time_point, uint64_t>> due;
+
+    // collect expired timers from slots passed since last wakeup
+    int64_t first = now_tick - last_tick >= static_cast<int64_t>(WHEEL_SLOTS)
+                    ? now_tick - WHEEL_SLOTS + 1 : last_tick;
+    for (int64_t tick = first; tick <= now_tick; tick++) {
+      for (uint64_t id : wheel[tick % WHEEL_SLOTS]) {
+        const timer_entry& entry = timers[id];
+        if (entry.tick <= now_tick && entry.deadline <= now)
+          due.push_back(std::make_pair(entry.deadline, id));
+      }
+    }
+    last_tick = now_tick;
+    std::sort(due.begin(), due.end());
+
+    for (auto& d : due) {
+      uint64_t id = d.second;
+      if (timers.find(id) == timers.end())
+        continue;  // cancelled by earlier callback
+
+      remove(id);
+      callback_t callback = timers[id].callback;
+
+      running_id = id;
+      lk.unlock();
+      callback();
+      lk.lock();
+      running_id = 0;
+      cv_done.notify_all();
+
+      auto it = timers.find(id);
+      if (it == timers.end())
+        continue;  // cancelled from callback
+
+      if (it->second.period.count() == 0) {
+        timers.erase(it);
+        continue;
+      }
+
+      // next expiration is relative to previous deadline (no drift);
+      // periods missed due to slow callback are skipped
+      now = clock_t::now();
+      do {
+        it->second.deadline += it->second.period;
+      } while (it->second.deadline <= now);
+      insert(id, &it->second);
+    }
+
+    if (bstop)
+      break;
+
+    clock_t::time_point deadline;
+    if (timers.empty()) {
+      cv.wait(lk);
+    } else if (next_deadline(to_tick(clock_t::now()), &deadline)) {
+      cv.wait_until(lk, deadline);
+    } else {
+      cv.wait_for(lk, std::chrono::milliseconds(WHEEL_SLOTS));
+    }
+  }
+}
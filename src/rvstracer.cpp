@@ -0,0 +1,304 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+#include "include/rvstracer.h"
+
+#include <unistd.h>
+#include <sys/syscall.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+std::atomic<bool> rvs::tracer::benabled(false);
+size_t rvs::tracer::buffer_events(rvs::tracer::DEFAULT_BUFFER_EVENTS);
+std::chrono::steady_clock::time_point rvs::tracer::base(
+  std::chrono::steady_clock::now());
+std::mutex rvs::tracer::mtx;
+std::vector<rvs::tracer::thread_buffer*> rvs::tracer::buffers;
+std::vector<std::string*> rvs::tracer::strings;
+const size_t rvs::tracer::DEFAULT_BUFFER_EVENTS;
+
+//! buffer of the calling thread
+static thread_local rvs::tracer::thread_buffer* tls_buffer = nullptr;
+
+/**
+ * @brief Enable or disable tracing
+ *
+ * Disabling tracing keeps recorded events so that they can be dumped later.
+ *
+ * @param flag 'true' to enable tracing
+ * @param buffer_events capacity (in events) of per-thread ring buffers
+ *
+ * */
+void rvs::tracer::enable(bool flag, size_t buffer_events) {
+  {
+    std::lock_guard<std::mutex> lk(mtx);
+    rvs::tracer::buffer_events = std::max(buffer_events, size_t(1));
+  }
+  benabled.store(flag, std::memory_order_relaxed);
+}
+
+//! Returns current time in ns since tracer start
+int64_t rvs::tracer::now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - base).count();
+}
+
+/**
+ * @brief Get event buffer of calling thread, create it on first use
+ *
+ * */
+rvs::tracer::thread_buffer* rvs::tracer::get_buffer() {
+  if (tls_buffer == nullptr) {
+    thread_buffer* pbuf = new thread_buffer;
+    pbuf->head = 0;
+    pbuf->tid = static_cast<int>(syscall(SYS_gettid));
+
+    std::lock_guard<std::mutex> lk(mtx);
+    pbuf->events.resize(buffer_events);
+    buffers.push_back(pbuf);
+    tls_buffer = pbuf;
+  }
+  return tls_buffer;
+}
+
+//! Append event to ring buffer of calling thread
+void rvs::tracer::record(const char* cat, const char* name, char ph,
+                         int64_t ts, int64_t val) {
+  thread_buffer* pbuf = get_buffer();
+  uint64_t h = pbuf->head.load(std::memory_order_relaxed);
+  event& ev = pbuf->events[h % pbuf->events.size()];
+
+  ev.name = name;
+  ev.cat = cat;
+  ev.ts = ts;
+  ev.val = val;
+  ev.ph = ph;
+  pbuf->head.store(h + 1, std::memory_order_release);
+}
+
+/**
+ * @brief Record complete span
+ *
+ * @param cat category
+ * @param name span name
+ * @param start span start as returned by now()
+ * @param end span end as returned by now()
+ *
+ * */
+void rvs::tracer::complete(const char* cat, const char* name,
+                           int64_t start, int64_t end) {
+  record(cat, name, 'X', start, end - start);
+}
+
+/**
+ * @brief Record counter sample
+ *
+ * @param cat category
+ * @param name counter name
+ * @param value counter value
+ *
+ * */
+void rvs::tracer::counter(const char* cat, const char* name, int64_t value) {
+  record(cat, name, 'C', now(), value);
+}
+
+/**
+ * @brief Record flow event
+ *
+ * Flow events connect the enclosing spans of begin and end events (possibly
+ * on different threads) having the same id.
+ *
+ * @param cat category
+ * @param name flow name
+ * @param id flow id
+ * @param begin 'true' for flow start, 'false' for flow end
+ *
+ * */
+void rvs::tracer::flow(const char* cat, const char* name, uint64_t id,
+                       bool begin) {
+  record(cat, name, begin ? 's' : 'f', now(), static_cast<int64_t>(id));
+}
+
+/**
+ * @brief Set name of calling thread as shown in trace viewer
+ *
+ * @param name thread name
+ *
+ * */
+void rvs::tracer::set_thread_name(const std::string& name) {
+  thread_buffer* pbuf = get_buffer();
+
+  std::lock_guard<std::mutex> lk(mtx);
+  pbuf->name = name;
+}
+
+/**
+ * @brief Get copy of a string valid for the lifetime of the process
+ *
+ * Used for event names built at runtime (e.g. module names). Not intended to
+ * be called on hot paths.
+ *
+ * @param str string to intern
+ * @return pointer to interned string
+ *
+ * */
+const char* rvs::tracer::intern(const std::string& str) {
+  std::lock_guard<std::mutex> lk(mtx);
+
+  for (std::string* ps : strings) {
+    if (*ps == str)
+      return ps->c_str();
+  }
+  strings.push_back(new std::string(str));
+  return strings.back()->c_str();
+}
+
+//! Append JSON escaped string to stream
+static void json_escape(std::ostringstream* pss, const char* str) {
+  for (const char* p = str; *p; p++) {
+    switch (*p) {
+      case '"':  *pss << "\\\""; break;
+      case '\\': *pss << "\\\\"; break;
+      case '\n': *pss << "\\n"; break;
+      case '\t': *pss << "\\t"; break;
+      default:
+        if (static_cast<unsigned char>(*p) < 0x20) {
+          char buff[8];
+          snprintf(buff, sizeof(buff), "\\u%04x", *p);
+          *pss << buff;
+        } else {
+          *pss << *p;
+        }
+    }
+  }
+}
+
+/**
+ * @brief Render recorded events as Chrome trace-event JSON
+ *
+ * Should be called when traced activity has stopped. Events recorded
+ * concurrently with this call may be missed.
+ *
+ * @return JSON document
+ *
+ * */
+std::string rvs::tracer::to_json() {
+  std::ostringstream ss;
+  int pid = static_cast<int>(getpid());
+  bool bfirst = true;
+  char ts[32];
+
+  auto sep = [&ss, &bfirst]() {
+    ss << (bfirst ? "\n" : ",\n");
+    bfirst = false;
+  };
+
+  std::lock_guard<std::mutex> lk(mtx);
+
+  ss << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  sep();
+  ss << "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":" << pid
+     << ",\"tid\":0,\"args\":{\"name\":\"rvs\"}}";
+
+  for (thread_buffer* pbuf : buffers) {
+    if (!pbuf->name.empty()) {
+      sep();
+      ss << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" << pid
+         << ",\"tid\":" << pbuf->tid << ",\"args\":{\"name\":\"";
+      json_escape(&ss, pbuf->name.c_str());
+      ss << "\"}}";
+    }
+
+    uint64_t head = pbuf->head.load(std::memory_order_acquire);
+    uint64_t size = pbuf->events.size();
+    uint64_t first = head > size ? head - size : 0;
+
+    for (uint64_t i = first; i < head; i++) {
+      const event& ev = pbuf->events[i % size];
+
+      sep();
+      snprintf(ts, sizeof(ts), "%.3f", ev.ts / 1000.0);
+      ss << "{\"ph\":\"" << ev.ph << "\",\"cat\":\"";
+      json_escape(&ss, ev.cat);
+      ss << "\",\"name\":\"";
+      json_escape(&ss, ev.name);
+      ss << "\",\"pid\":" << pid << ",\"tid\":" << pbuf->tid
+         << ",\"ts\":" << ts;
+
+      switch (ev.ph) {
+        case 'X':
+          snprintf(ts, sizeof(ts), "%.3f", ev.val / 1000.0);
+          ss << ",\"dur\":" << ts;
+          break;
+        case 'C':
+          ss << ",\"args\":{\"value\":" << ev.val << "}";
+          break;
+        case 's':
+          ss << ",\"id\":" << ev.val;
+          break;
+        case 'f':
+          ss << ",\"id\":" << ev.val << ",\"bp\":\"e\"";
+          break;
+      }
+      ss << "}";
+    }
+  }
+  ss << "\n]}\n";
+
+  return ss.str();
+}
+
+/**
+ * @brief Write recorded events to file in Chrome trace-event JSON format
+ *
+ * @param path output file
+ * @return 0 - success, non-zero otherwise
+ *
+ * */
+int rvs::tracer::dump(const std::string& path) {
+  std::ofstream file(path, std::ios::out | std::ios::trunc);
+  if (!file.good())
+    return -1;
+
+  file << to_json();
+  file.close();
+  return file.good() ? 0 : -1;
+}
+
+/**
+ * @brief Discard recorded events
+ *
+ * Should only be called while no thread is recording events.
+ *
+ * */
+void rvs::tracer::clear() {
+  std::lock_guard<std::mutex> lk(mtx);
+
+  for (thread_buffer* pbuf : buffers) {
+    pbuf->head.store(0, std::memory_order_relaxed);
+  }
+}
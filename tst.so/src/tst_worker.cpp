@@ -0,0 +1,410 @@
+/********************************************************************************
+ *
+ * Copyright (c) 2018-2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * MIT LICENSE:
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is furnished to do
+ * so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ *******************************************************************************/
+
+#include <unistd.h>
+#include <string>
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <exception>
+
+#include "include/rvs_module.h"
+#include "include/rvsloglp.h"
+#include "include/rvstracer.h"
+#include "include/rvs_power_control.h"
+
+#include "include/tst_worker.h"
+
+#define MODULE_NAME                             "tst"
+#define MAX_MS_TRAIN_GPU                        1000
+#define MAX_MS_WAIT_BLAS_THREAD                 10000
+#define SGEMM_DELAY_FREQ_DEV                    10
+
+#define TST_RESULT_PASS_MESSAGE                 "TRUE"
+#define TST_RESULT_FAIL_MESSAGE                 "FALSE"
+
+#define TST_BLAS_FAILURE                        "BLAS setup failed!"
+#define TST_SGEMM_FAILURE                       "GPU failed to run the SGEMMs!"
+
+#define TST_JSON_TARGET_TEMP_KEY                  "target_temp"
+#define TST_JSON_THROTTLE_TEMP_KEY                 "throttle_temp"
+
+#define TST_TARGET_MESSAGE                      "target"
+#define TST_DTYPE_MESSAGE                       "dtype"
+#define TST_PWR_TARGET_ACHIEVED_MSG             "target achieved"
+#define TST_PWR_RAMP_EXCEEDED_MSG               "ramp time exceeded"
+#define TST_PASS_KEY                            "pass"
+
+#define TST_JSON_LOG_GPU_ID_KEY                 "gpu_id"
+#define TST_JSON_LOG_GPU_IDX_KEY                "gpu_index"
+#define TST_MEM_ALLOC_ERROR                     1
+#define TST_BLAS_ERROR                          2
+#define TST_BLAS_MEMCPY_ERROR                   3
+#define TST_BLAS_ITERATIONS                     25
+#define TST_LOG_GFLOPS_INTERVAL_KEY             "GFLOPS"
+#define TST_AVERAGE_EDGE_TEMP_KEY               "average edge temperature"
+#define TST_AVERAGE_JUNCTION_TEMP_KEY               "average junction temperature"
+#define TST_TIME_TO_TARGET_KEY                  "time to target (s)"
+#define TST_OVERSHOOT_KEY                       "overshoot (C)"
+#define TST_HOLD_ERROR_KEY                      "hold error (C)"
+#define TST_HOLD_IN_BAND_KEY                    "hold in band"
+#define TST_THERMAL_TAU_KEY                     "thermal time constant (s)"
+
+using std::string;
+
+bool TSTWorker::bjson = false;
+
+/**
+ * @brief class default constructor
+ */
+TSTWorker::TSTWorker():thermal_control(false), thermal_horizon(8),
+    thermal_band(1.0), endtest(false) {
+}
+
+TSTWorker::~TSTWorker() {
+}
+
+/**
+ * @brief logs the Gflops computed over the last log_interval period
+ * @param gflops_interval the Gflops that the GPU achieved
+ */
+void TSTWorker::log_interval_gflops(double gflops_interval) {
+    string msg;
+    msg = " GPU flops :" + std::to_string(gflops_interval);
+    rvs::lp::Log(msg, rvs::logtrace);
+
+}
+
+/**
+ * @brief logs the GPU batch time spread over the last log_interval period
+ * @param iv interval statistics
+ */
+void TSTWorker::log_interval_batch_times(const rvs::gemm_interval_t& iv) {
+    if (iv.device.samples == 0)
+        return;
+
+    string msg = " GPU batch time median(us) :" +
+        std::to_string(iv.device.median_us) + " p99(us) :" +
+        std::to_string(iv.device.p99_us) + " max(us) :" +
+        std::to_string(iv.device.max_us) + " cv :" +
+        std::to_string(iv.device.cv);
+    rvs::lp::Log(msg, rvs::logtrace);
+}
+
+/**
+ * @brief Thread function to execute blas gemm operations for GPU workload.
+ * @param gpuIdx the gpu that will run the GEMM
+ * @param matrix_size matrix size
+ * @param tst_ops_type blas operation type
+ * @param start
+ * @param run_duration_ms test run duration
+ * @param transa matrix A transpose operation type
+ * @param transb matrix B transpose operation type
+ * @param alpha scalar for matrix A*B
+ * @param beta scalar for matrix C
+ * @param tst_lda_offset leading dimension for matrix A
+ * @param tst_ldb_offset leading dimension for matrix B
+ * @param tst_ldc_offset leading dimension for matrix C
+ * @param tst_ldd_offset leading dimension for matrix D
+ */
+void TSTWorker::blasThread(int gpuIdx, uint64_t matrix_size, std::string tst_ops_type,
+    bool start, uint64_t run_duration_ms, int transa, int transb, float alpha, float beta,
+    int tst_lda_offset, int tst_ldb_offset, int tst_ldc_offset, int tst_ldd_offset){
+
+    std::unique_ptr<rvs_blas> gpu_blas;
+    string msg;
+    std::string blas_source = "rocblas";
+    std::string compute_type = "fp32_r";
+
+    {
+        RVS_TRACE_SCOPE("tst", "tst_setup");
+
+        // setup rvsBlas
+        gpu_blas = std::unique_ptr<rvs_blas>(new rvs_blas(gpuIdx, matrix_size, matrix_size, matrix_size, "default",
+              transa, transb, alpha, beta, tst_lda_offset, tst_ldb_offset, tst_ldc_offset, tst_ldd_offset, tst_ops_type,
+              "", "", 0, 0, 0, 0, 0, blas_source, compute_type, "", "", "", 0, 1));
+
+        // generate random matrix data & copy it to the GPU
+        if (rvs::gemm_prepare(gpu_blas.get(), false) != rvs::gemm_outcome::completed) {
+            msg = "[" + action_name + "] " + MODULE_NAME + " " +
+                std::to_string(gpu_id) + " " + " BLAS data copy failed !!! ";
+            rvs::lp::Log(msg, rvs::logtrace);
+            return;
+        }
+    }
+
+    // hit the GPU with load to increase temperature
+    rvs::gemm_engine_config_t cfg;
+    cfg.duration_ms = run_duration_ms;
+    cfg.interval_ms = MAX_MS_TRAIN_GPU;
+    cfg.stopping = rvs::lp::Stopping;
+
+    // full duty unless the thermal controller modulates it
+    rvs::gemm_no_validation val;
+    engine_logger log{this};
+    rvs::gemm_engine<rvs_blas, rvs::gemm_duty_control,
+        rvs::gemm_no_validation, engine_logger> engine(gpu_blas.get(), cfg,
+        &duty_ctl, &val, &log);
+
+    rvs::gemm_outcome outcome;
+    {
+        RVS_TRACE_SCOPE("tst", "tst_gemm");
+        outcome = engine.run();
+    }
+    if (outcome == rvs::gemm_outcome::gemm_error) {
+        msg = "[" + action_name + "] " + MODULE_NAME + " " +
+            std::to_string(gpu_id) + " " + " BLAS gemm operations failed !!! ";
+        rvs::lp::Log(msg, rvs::logtrace);
+    }
+}
+
+/**
+ * @brief performs the Thermal Stress Test (TST) on 
+ * the given GPU (attempts to sustain the target thermal).
+ * @return true if test succeeded, false otherwise
+ */
+bool TSTWorker::do_thermal_stress(void) {
+
+    std::chrono::steady_clock::time_point tst_start_time, 
+        end_time,
+        sampling_start_time;
+    uint64_t  total_time_ms;
+    int64_t   temperature = 0;
+    float     cur_edge_temperature = 0;
+    float     max_edge_temperature = 0;
+    float     cur_junction_temperature = 0;
+    float     max_junction_temperature = 0;
+    string    msg;
+    bool      result = true;
+    bool      start = true;
+    rvs::action_result_t action_result;
+    amdsmi_status_t smi_stat;
+    auto desc = action_descriptor{action_name, MODULE_NAME, gpu_id}; 
+    rvs::thermal_mpc_config_t mpc_cfg;
+    mpc_cfg.target_c = target_temp;
+    mpc_cfg.horizon = thermal_horizon;
+    rvs::thermal_mpc mpc(mpc_cfg);
+    rvs::thermal_track_stats track(target_temp, thermal_band);
+    // Initiate blas workload thread
+    std::thread t(&TSTWorker::blasThread, this, gpu_device_index, matrix_size_a, tst_ops_type, start, run_duration_ms,
+            tst_trans_a, tst_trans_b, tst_alpha_val, tst_beta_val, tst_lda_offset, tst_ldb_offset, tst_ldc_offset, tst_ldd_offset);
+
+    // Record ramp-up start time
+    tst_start_time = std::chrono::steady_clock::now();
+
+    for (;;) {
+
+        // Check if stop signal was received
+        if (rvs::lp::Stopping())
+            break;
+
+        // Get GPU's current edge temperature
+        smi_stat = amdsmi_get_temp_metric(smi_device_handle, AMDSMI_TEMPERATURE_TYPE_EDGE,
+                AMDSMI_TEMP_CURRENT, &temperature);
+        if (smi_stat == AMDSMI_STATUS_SUCCESS) {
+            cur_edge_temperature = static_cast<float>(temperature);
+        }
+        
+        temperature = 0;
+   
+        // Get GPU's current junction temperature
+        smi_stat = amdsmi_get_temp_metric(smi_device_handle, AMDSMI_TEMPERATURE_TYPE_JUNCTION ,
+                AMDSMI_TEMP_CURRENT, &temperature);
+        if (smi_stat == AMDSMI_STATUS_SUCCESS) {
+            cur_junction_temperature = static_cast<float>(temperature);
+        }
+
+        msg = "[" + action_name + "] " + MODULE_NAME + " " + "GPU " +
+            std::to_string(gpu_id) + " " + "Current edge temperature is : " + " " + std::to_string(cur_edge_temperature);
+        rvs::lp::Log(msg, rvs::loginfo);
+
+        msg = "[" + action_name + "] " + MODULE_NAME + " " + "GPU " +
+            std::to_string(gpu_id) + " " + "Current junction temperature is : " + " " + std::to_string(cur_junction_temperature);
+        rvs::lp::Log(msg, rvs::loginfo);
+
+        // Update edge temperature to max if it is valid
+        if(cur_edge_temperature > 0) {
+            // Max. of edge temperature
+            max_edge_temperature = std::max(max_edge_temperature, cur_edge_temperature);
+        }
+
+        // Update junction temperature to max if it is valid
+        if(cur_junction_temperature > 0) {
+            // Max. of junction temperature
+            max_junction_temperature = std::max(max_junction_temperature, cur_junction_temperature);
+        }
+
+        end_time = std::chrono::steady_clock::now();
+
+        total_time_ms = rvs::time_diff(end_time, tst_start_time);
+
+        if (thermal_control && cur_junction_temperature > 0) {
+            double t_s = total_time_ms / 1000.0;
+            double command = mpc.update(t_s, cur_junction_temperature);
+            track.add(t_s, cur_junction_temperature);
+
+            rvs::power_actuation_t act = rvs::power_actuation(command, 1);
+            duty_ctl.set(act.gemm_duty, act.hot_calls);
+
+            msg = "[" + action_name + "] " + MODULE_NAME + " " +
+                std::to_string(gpu_id) + " " + " thermal control command " +
+                std::to_string(command) + " predicted " + std::to_string(mpc.predicted()) +
+                " model " + (mpc.model_ready() ? "ready" : "identifying");
+            rvs::lp::Log(msg, rvs::logtrace);
+        }
+
+        msg = "[" + action_name + "] " + MODULE_NAME + " " +
+            std::to_string(gpu_id) + " " + " Total time in ms " + " " + std::to_string(total_time_ms) +
+            " Run duration in ms " + " " + std::to_string(run_duration_ms);
+        rvs::lp::Log(msg, rvs::logtrace);
+
+        if (total_time_ms > run_duration_ms) {
+            break;
+        }
+
+        // It doesnt make sense to read temperature continously so slowing down
+        sleep(1000);
+
+        // Check if stop signal was received
+        if (rvs::lp::Stopping()) {
+            result = true;
+            goto end;
+        }
+    }
+
+
+    msg = "[" + action_name + "] " + MODULE_NAME + " " + "GPU " +
+        std::to_string(gpu_id) + " " + "max. edge temperature :" + " " + std::to_string(max_edge_temperature);
+    rvs::lp::Log(msg, rvs::loginfo);
+
+    msg = "[" + action_name + "] " + MODULE_NAME + " " + "GPU " +
+        std::to_string(gpu_id) + " " + "max. junction temperature :" + " " + std::to_string(max_junction_temperature);
+    rvs::lp::Log(msg, rvs::loginfo);
+
+
+    if (thermal_control) {
+        msg = "[" + action_name + "] " + MODULE_NAME + " " + "GPU " +
+            std::to_string(gpu_id) + " " + "thermal control time to target(s) " +
+            std::to_string(track.time_to_target()) + " overshoot(C) " +
+            std::to_string(track.overshoot()) + " hold error(C) " +
+            std::to_string(track.hold_error()) + " max hold error(C) " +
+            std::to_string(track.hold_max_error()) + " in band " +
+            std::to_string(track.hold_in_band()) + " thermal time constant(s) " +
+            std::to_string(mpc.model().time_constant());
+        rvs::lp::Log(msg, rvs::loginfo);
+    }
+
+    //check whether we reached (and with thermal control held) the target temperature
+    if(thermal_control ? track.reached() : max_junction_temperature >= target_temp) {
+        msg = "[" + action_name + "] " + MODULE_NAME + " " + "GPU " +
+            std::to_string(gpu_id) + " " + " Target temperature met :" + " " + std::to_string(max_junction_temperature);
+        rvs::lp::Log(msg, rvs::loginfo);
+        result = true;
+    }
+    else {
+        msg = "[" + action_name + "] " + MODULE_NAME + " " + "GPU " +
+            std::to_string(gpu_id) + " " + " Target temperature could not be met :" + " " + std::to_string(max_junction_temperature);
+        rvs::lp::Log(msg, rvs::loginfo);
+        result = false;
+    }
+    //check whether we reached the trottle temperature
+    if(max_junction_temperature >= throttle_temp) {
+        msg = "[" + action_name + "] " + MODULE_NAME + " " + "GPU " +
+            std::to_string(gpu_id) + " " + " Thermal throttling condition met :" + " " + std::to_string(max_junction_temperature);
+        rvs::lp::Log(msg, rvs::loginfo);
+    }
+    else {
+        msg = "[" + action_name + "] " + MODULE_NAME + " " + "GPU " +
+            std::to_string(gpu_id) + " " + " Thermal throttling condition could not be met :" + " " + std::to_string(max_junction_temperature);
+        rvs::lp::Log(msg, rvs::loginfo);
+    }
+    if (bjson && thermal_control)
+        log_to_json(desc, rvs::logresults,
+           TST_TIME_TO_TARGET_KEY, std::to_string(track.time_to_target()),
+           TST_OVERSHOOT_KEY, std::to_string(track.overshoot()),
+           TST_HOLD_ERROR_KEY, std::to_string(track.hold_error()),
+           TST_HOLD_IN_BAND_KEY, std::to_string(track.hold_in_band()),
+           TST_THERMAL_TAU_KEY, std::to_string(mpc.model().time_constant()));
+    if (bjson)
+        log_to_json(desc, rvs::logresults,
+           TST_JSON_THROTTLE_TEMP_KEY, std::to_string(throttle_temp), 
+           TST_JSON_TARGET_TEMP_KEY, std::to_string(target_temp),
+           TST_DTYPE_MESSAGE, tst_ops_type,
+           TST_AVERAGE_EDGE_TEMP_KEY, std::to_string(max_edge_temperature),
+           TST_AVERAGE_JUNCTION_TEMP_KEY, std::to_string(max_junction_temperature),
+           "pass", result ? "true" : "false");
+    action_result.state = rvs::actionstate::ACTION_RUNNING;
+    action_result.status = (true == result) ? rvs::actionstatus::ACTION_SUCCESS : rvs::actionstatus::ACTION_FAILED;
+    action_result.output = msg.c_str();
+    action.action_callback(&action_result);
+
+    msg = "[" + action_name + "] " + MODULE_NAME + " " +
+        std::to_string(gpu_id) + " " + " End of worker thread " ;
+    rvs::lp::Log(msg, rvs::loginfo);
+
+end:
+
+    endtest = true;
+
+    if (true == t.joinable()) {
+
+        try {
+            t.join();
+        }
+        catch (std::exception& e) {
+            std::cout << "Standard exception: " << e.what() << std::endl;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief performs the TST test on the given GPU
+ */
+void TSTWorker::run() {
+    string msg, err_description;
+
+    msg = "[" + action_name + "] " + MODULE_NAME + " " +
+            std::to_string(gpu_id) + " start " + std::to_string(throttle_temp);
+
+    rvs::lp::Log(msg, rvs::loginfo);
+
+    if (run_duration_ms < MAX_MS_TRAIN_GPU)
+        run_duration_ms += MAX_MS_TRAIN_GPU;
+
+    bool pass = do_thermal_stress();
+
+    // check if stop signal was received
+    if (rvs::lp::Stopping())
+         return;
+
+    msg = "[" + action_name + "] "  +
+               "[GPU:: " + std::to_string(gpu_id) + "] " + TST_PASS_KEY + ": " +
+               (pass ? TST_RESULT_PASS_MESSAGE : TST_RESULT_FAIL_MESSAGE);
+    rvs::lp::Log(msg, rvs::logresults);
+
+    sleep(5);
+}
+